@@ -92,12 +92,14 @@ int MLI_Utils_HypreMatrixFormJacobi(void *A, double alpha, void **J)
 {
    int                *rowPart, mypid, nprocs;
    int                localNRows, startRow, ierr, irow, *rowLengths;
-   int                rownum, rowSize, *colInd, *newColInd, newRowSize;
-   int                icol, maxnnz;
+   int                rownum, rowSize, *newColInd, newRowSize;
+   int                icol, maxnnz, *blkI;
    double             *colVal, *newColVal, dtemp;
+   HYPRE_BigInt       *colInd;
    MPI_Comm           comm;
    HYPRE_IJMatrix     IJmat;
    hypre_ParCSRMatrix *Amat, *Jmat;
+   hypre_CSRMatrix    *Ablk;
 
    /* -----------------------------------------------------------------------
     * get matrix parameters
@@ -128,8 +130,11 @@ int MLI_Utils_HypreMatrixFormJacobi(void *A, double alpha, void **J)
    }
    for ( irow = 0; irow < localNRows; irow++ )
    {
+      hypre_ParCSRMatrixRowView view;
+
       rownum = startRow + irow;
-      hypre_ParCSRMatrixGetRow(Amat, rownum, &rowSize, &colInd, NULL);
+      hypre_ParCSRMatrixGetRowView(Amat, irow, &view);
+      rowSize = hypre_ParCSRMatrixRowViewSize(&view);
       rowLengths[irow] = rowSize;
       if ( rowSize <= 0 )
       {
@@ -137,9 +142,8 @@ int MLI_Utils_HypreMatrixFormJacobi(void *A, double alpha, void **J)
          exit(1);
       }
       for ( icol = 0; icol < rowSize; icol++ )
-         if ( colInd[icol] == rownum ) break;
+         if ( hypre_ParCSRMatrixRowViewGlobalCol(&view, icol) == rownum ) break;
       if ( icol == rowSize ) rowLengths[irow]++;
-      hypre_ParCSRMatrixRestoreRow(Amat, rownum, &rowSize, &colInd, NULL);
       maxnnz = ( rowLengths[irow] > maxnnz ) ? rowLengths[irow] : maxnnz;
    }
    ierr = HYPRE_IJMatrixSetRowSizes(IJmat, rowLengths);
@@ -153,10 +157,14 @@ int MLI_Utils_HypreMatrixFormJacobi(void *A, double alpha, void **J)
    newColInd = hypre_CTAlloc(int,  maxnnz, HYPRE_MEMORY_HOST);
    newColVal = hypre_CTAlloc(double,  maxnnz, HYPRE_MEMORY_HOST);
 
+   Ablk = hypre_ParCSRMatrixExtractRowBlock(Amat, 0, localNRows, 1);
+   blkI = hypre_CSRMatrixI(Ablk);
    for ( irow = 0; irow < localNRows; irow++ )
    {
-      rownum = startRow + irow;
-      hypre_ParCSRMatrixGetRow(Amat, rownum, &rowSize, &colInd, &colVal);
+      rownum  = startRow + irow;
+      rowSize = blkI[irow+1] - blkI[irow];
+      colInd  = hypre_CSRMatrixBigJ(Ablk) + blkI[irow];
+      colVal  = hypre_CSRMatrixData(Ablk) + blkI[irow];
       dtemp = 1.0;
       for ( icol = 0; icol < rowSize; icol++ )
          if ( colInd[icol] == rownum ) {dtemp = colVal[icol]; break;}
@@ -164,7 +172,7 @@ int MLI_Utils_HypreMatrixFormJacobi(void *A, double alpha, void **J)
       else                         dtemp = 1.0;
       for ( icol = 0; icol < rowSize; icol++ )
       {
-         newColInd[icol] = colInd[icol];
+         newColInd[icol] = (int) colInd[icol];
          newColVal[icol] = - alpha * colVal[icol] * dtemp;
          if ( colInd[icol] == rownum ) newColVal[icol] += 1.0;
       }
@@ -174,10 +182,10 @@ int MLI_Utils_HypreMatrixFormJacobi(void *A, double alpha, void **J)
          newColInd[newRowSize] = rownum;
          newColVal[newRowSize++] = 1.0;
       }
-      hypre_ParCSRMatrixRestoreRow(Amat, rownum, &rowSize, &colInd, &colVal);
       HYPRE_IJMatrixSetValues(IJmat, 1, &newRowSize,(const int *) &rownum,
                 (const int *) newColInd, (const double *) newColVal);
    }
+   hypre_CSRMatrixDestroy(Ablk);
    HYPRE_IJMatrixAssemble(IJmat);
 
    /* -----------------------------------------------------------------------
@@ -705,9 +713,9 @@ int MLI_Utils_HypreMatrixComputeRAP(void *Pmat, void *Amat, void **RAPmat)
 int MLI_Utils_HypreMatrixGetInfo(void *Amat, int *matInfo, double *valInfo)
 {
    int      mypid, nprocs, icol, isum[4], ibuf[4], *partition, thisNnz;
-   int      localNRows, irow, rownum, rowsize, *colind, startrow;
+   int      localNRows, irow, rowsize;
    int      globalNRows, maxNnz, minNnz, totalNnz;
-   double   *colval, dsum[2], dbuf[2], maxVal, minVal;
+   double   dtemp, dsum[2], dbuf[2], maxVal, minVal;
    MPI_Comm mpiComm;
    hypre_ParCSRMatrix *hypreA;
 
@@ -717,7 +725,6 @@ int MLI_Utils_HypreMatrixGetInfo(void *Amat, int *matInfo, double *valInfo)
    MPI_Comm_size( mpiComm, &nprocs);
    HYPRE_ParCSRMatrixGetRowPartitioning((HYPRE_ParCSRMatrix) hypreA,&partition);
    localNRows  = partition[mypid+1] - partition[mypid];
-   startrow    = partition[mypid];
    globalNRows = partition[nprocs];
    hypre_TFree(partition, HYPRE_MEMORY_HOST);
    maxVal  = -1.0E-30;
@@ -727,17 +734,19 @@ int MLI_Utils_HypreMatrixGetInfo(void *Amat, int *matInfo, double *valInfo)
    thisNnz = 0;
    for ( irow = 0; irow < localNRows; irow++ )
    {
-      rownum = startrow + irow;
-      hypre_ParCSRMatrixGetRow(hypreA,rownum,&rowsize,&colind,&colval);
+      hypre_ParCSRMatrixRowView view;
+
+      hypre_ParCSRMatrixGetRowView(hypreA, irow, &view);
+      rowsize = hypre_ParCSRMatrixRowViewSize(&view);
       for ( icol = 0; icol < rowsize; icol++ )
       {
-         if ( colval[icol] > maxVal ) maxVal = colval[icol];
-         if ( colval[icol] < minVal ) minVal = colval[icol];
+         dtemp = hypre_ParCSRMatrixRowViewValue(&view, icol);
+         if ( dtemp > maxVal ) maxVal = dtemp;
+         if ( dtemp < minVal ) minVal = dtemp;
       }
       if ( rowsize > maxNnz ) maxNnz = rowsize;
       if ( rowsize < minNnz ) minNnz = rowsize;
       thisNnz += rowsize;
-      hypre_ParCSRMatrixRestoreRow(hypreA,rownum,&rowsize,&colind,&colval);
    }
    dsum[0] = maxVal;
    dsum[1] = - minVal;
@@ -771,11 +780,13 @@ int MLI_Utils_HypreMatrixCompress(void *Amat, int blksize, void **Amat2)
 {
    int                mypid, *partition, startRow, localNRows;
    int                newLNRows, newStartRow, blksize2;
-   int                ierr, *rowLengths, irow, rowNum, rowSize, *colInd;
+   int                ierr, *rowLengths, irow, rowNum, *blkI;
    int                *newInd, newSize, j, k, nprocs;
    double             *colVal, *newVal, *newVal2;
+   HYPRE_BigInt       *colInd;
    MPI_Comm           mpiComm;
    hypre_ParCSRMatrix *hypreA, *hypreA2;
+   hypre_CSRMatrix    *Ablk;
    HYPRE_IJMatrix     IJAmat2;
 
    /* ----------------------------------------------------------------
@@ -823,10 +834,10 @@ int MLI_Utils_HypreMatrixCompress(void *Amat, int blksize, void **Amat2)
       rowLengths[irow] = 0;
       for ( j = 0; j < blksize2; j++)
       {
-         rowNum = startRow + irow * blksize2 + j;
-         hypre_ParCSRMatrixGetRow(hypreA,rowNum,&rowSize,&colInd,NULL);
-         rowLengths[irow] += rowSize;
-         hypre_ParCSRMatrixRestoreRow(hypreA,rowNum,&rowSize,&colInd,NULL);
+         hypre_ParCSRMatrixRowView view;
+
+         hypre_ParCSRMatrixGetRowView(hypreA, irow * blksize2 + j, &view);
+         rowLengths[irow] += hypre_ParCSRMatrixRowViewSize(&view);
       }
    }
    ierr =  HYPRE_IJMatrixSetRowSizes(IJAmat2, rowLengths);
@@ -837,23 +848,21 @@ int MLI_Utils_HypreMatrixCompress(void *Amat, int blksize, void **Amat2)
     * load the compressed matrix
     * ----------------------------------------------------------------*/
 
+   Ablk   = hypre_ParCSRMatrixExtractRowBlock(hypreA, 0, localNRows, 1);
+   blkI   = hypre_CSRMatrixI(Ablk);
+   colInd = hypre_CSRMatrixBigJ(Ablk);
+   colVal = hypre_CSRMatrixData(Ablk);
    for ( irow = 0; irow < newLNRows; irow++ )
    {
       newInd  = hypre_TAlloc(int,  rowLengths[irow] , HYPRE_MEMORY_HOST);
       newVal  = hypre_TAlloc(double,  rowLengths[irow] , HYPRE_MEMORY_HOST);
       newVal2 = hypre_TAlloc(double,  rowLengths[irow] , HYPRE_MEMORY_HOST);
       newSize = 0;
-      for ( j = 0; j < blksize2; j++)
+      /* the blksize2 rows of this block row are contiguous in Ablk */
+      for ( k = blkI[irow*blksize2]; k < blkI[(irow+1)*blksize2]; k++ )
       {
-         rowNum = startRow + irow * blksize2 + j;
-         hypre_ParCSRMatrixGetRow(hypreA,rowNum,&rowSize,&colInd,&colVal);
-         for ( k = 0; k < rowSize; k++ )
-         {
-            newInd[newSize] = colInd[k] / blksize2;
-            newVal[newSize++] = colVal[k];
-         }
-         hypre_ParCSRMatrixRestoreRow(hypreA,rowNum,&rowSize,
-                                      &colInd,&colVal);
+         newInd[newSize] = (int) (colInd[k] / blksize2);
+         newVal[newSize++] = colVal[k];
       }
       if ( newSize > 0 )
       {
@@ -918,6 +927,7 @@ int MLI_Utils_HypreMatrixCompress(void *Amat, int blksize, void **Amat2)
       hypre_TFree(newVal, HYPRE_MEMORY_HOST);
       hypre_TFree(newVal2, HYPRE_MEMORY_HOST);
    }
+   hypre_CSRMatrixDestroy(Ablk);
    ierr = HYPRE_IJMatrixAssemble(IJAmat2);
    hypre_assert( !ierr );
    HYPRE_IJMatrixGetObject(IJAmat2, (void **) &hypreA2);
@@ -937,13 +947,15 @@ int MLI_Utils_HypreBoolMatrixDecompress(void *Smat, int blkSize,
                                         void **Smat2, void *Amat)
 {
    int                mypid, *partition, startRow, localNRows, newLNRows;
-   int                newStartRow, maxRowLeng, index, ierr, irow, sRowNum;
-   int                *rowLengths=NULL, rowNum, rowSize, *colInd, *sInd=NULL;
+   int                maxRowLeng, index, ierr, irow;
+   int                *rowLengths=NULL, rowNum, rowSize, *sInd=NULL;
    int                *newInd=NULL, newSize, j, k, nprocs, searchInd;
-   int                sRowSize;
+   int                sRowSize, *sBlkI, *aBlkI;
    double             *newVal=NULL;
+   HYPRE_BigInt       *colInd;
    MPI_Comm           mpiComm;
    hypre_ParCSRMatrix *hypreA, *hypreS, *hypreS2;
+   hypre_CSRMatrix    *Sblk, *Ablk;
    HYPRE_IJMatrix     IJSmat2;
 
    /* ----------------------------------------------------------------
@@ -971,7 +983,6 @@ int MLI_Utils_HypreBoolMatrixDecompress(void *Smat, int blkSize,
     * ----------------------------------------------------------------*/
 
    newLNRows   = localNRows / blkSize;
-   newStartRow = startRow / blkSize;
    ierr =  HYPRE_IJMatrixCreate(mpiComm, startRow,
                   startRow+localNRows-1, startRow,
                   startRow+localNRows-1, &IJSmat2);
@@ -987,11 +998,12 @@ int MLI_Utils_HypreBoolMatrixDecompress(void *Smat, int blkSize,
    maxRowLeng = 0;
    for ( irow = 0; irow < localNRows; irow++ )
    {
-      rowNum = startRow + irow;
-      hypre_ParCSRMatrixGetRow(hypreA,rowNum,&rowSize,&colInd,NULL);
+      hypre_ParCSRMatrixRowView view;
+
+      hypre_ParCSRMatrixGetRowView(hypreA, irow, &view);
+      rowSize = hypre_ParCSRMatrixRowViewSize(&view);
       rowLengths[irow] = rowSize;
       if ( rowSize > maxRowLeng ) maxRowLeng = rowSize;
-      hypre_ParCSRMatrixRestoreRow(hypreA,rowNum,&rowSize,&colInd,NULL);
    }
    ierr =  HYPRE_IJMatrixSetRowSizes(IJSmat2, rowLengths);
    ierr += HYPRE_IJMatrixInitialize(IJSmat2);
@@ -1009,29 +1021,32 @@ int MLI_Utils_HypreBoolMatrixDecompress(void *Smat, int blkSize,
       sInd    = hypre_TAlloc(int,  maxRowLeng , HYPRE_MEMORY_HOST);
       for ( irow = 0; irow < maxRowLeng; irow++ ) newVal[irow] = 1.0;
    }
+   Sblk  = hypre_ParCSRMatrixExtractRowBlock(hypreS, 0, newLNRows, 0);
+   Ablk  = hypre_ParCSRMatrixExtractRowBlock(hypreA, 0, localNRows, 0);
+   sBlkI = hypre_CSRMatrixI(Sblk);
+   aBlkI = hypre_CSRMatrixI(Ablk);
    for ( irow = 0; irow < newLNRows; irow++ )
    {
-      sRowNum = newStartRow + irow;
-      hypre_ParCSRMatrixGetRow(hypreS,sRowNum,&sRowSize,&colInd,NULL);
-      for ( k = 0; k < sRowSize; k++ ) sInd[k] = colInd[k];
-      hypre_ParCSRMatrixRestoreRow(hypreS,sRowNum,&sRowSize,&colInd,NULL);
+      sRowSize = sBlkI[irow+1] - sBlkI[irow];
+      colInd   = hypre_CSRMatrixBigJ(Sblk) + sBlkI[irow];
+      for ( k = 0; k < sRowSize; k++ ) sInd[k] = (int) colInd[k];
       hypre_qsort0(sInd, 0, sRowSize-1);
       for ( j = 0; j < blkSize; j++)
       {
-         rowNum = startRow + irow * blkSize + j;
-         hypre_ParCSRMatrixGetRow(hypreA,rowNum,&rowSize,&colInd,NULL);
+         rowNum  = startRow + irow * blkSize + j;
+         rowSize = aBlkI[irow*blkSize+j+1] - aBlkI[irow*blkSize+j];
+         colInd  = hypre_CSRMatrixBigJ(Ablk) + aBlkI[irow*blkSize+j];
          for ( k = 0; k < rowSize; k++ )
          {
-            index = colInd[k] / blkSize;
+            index = (int) (colInd[k] / blkSize);
             searchInd = MLI_Utils_BinarySearch(index, sInd, sRowSize);
             if ( searchInd >= 0 && colInd[k] == index*blkSize+j )
-                 newInd[k] = colInd[k];
+                 newInd[k] = (int) colInd[k];
             else newInd[k] = -1;
          }
          newSize = 0;
          for ( k = 0; k < rowSize; k++ )
             if ( newInd[k] >= 0 ) newInd[newSize++] = newInd[k];
-         hypre_ParCSRMatrixRestoreRow(hypreA,rowNum,&rowSize,&colInd,NULL);
          HYPRE_IJMatrixSetValues(IJSmat2, 1, &newSize,(const int *) &rowNum,
                 (const int *) newInd, (const double *) newVal);
       }
@@ -1039,6 +1054,8 @@ int MLI_Utils_HypreBoolMatrixDecompress(void *Smat, int blkSize,
    hypre_TFree(newInd, HYPRE_MEMORY_HOST);
    hypre_TFree(newVal, HYPRE_MEMORY_HOST);
    hypre_TFree(sInd, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(Sblk);
+   hypre_CSRMatrixDestroy(Ablk);
    ierr = HYPRE_IJMatrixAssemble(IJSmat2);
    hypre_assert( !ierr );
    HYPRE_IJMatrixGetObject(IJSmat2, (void **) &hypreS2);
@@ -115,6 +115,9 @@ void Euclid_dhDestroy(Euclid_dh ctx)
   FREE_DH(ctx); CHECK_V_ERROR;
 
   --ref_counter;
+#if defined(HYPRE_GET_ROW)
+  if (ref_counter == 0) { EuclidDestroyRowBuffers(); CHECK_V_ERROR; }
+#endif
   END_FUNC_DH
 }
 
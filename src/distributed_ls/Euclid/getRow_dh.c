@@ -6,6 +6,7 @@
  ******************************************************************************/
 
 #include "_hypre_Euclid.h"
+#include "_hypre_parcsr_mv.h"
 /* #include "getRow_dh.h" */
 /* #include "Mat_dh.h" */
 /* #include "Euclid_dh.h" */
@@ -16,17 +17,64 @@
  *-------------------------------------------------------------------*/
 #if defined(HYPRE_GET_ROW)
 
+/* Rows are read through hypre_ParCSRMatrixGetRowView and converted into
+   buffers that persist across calls, so nothing is allocated per row and
+   the matrix is not modified.  As with HYPRE_ParCSRMatrixGetRow, only one
+   row may be active at a time.  The buffers are released by
+   EuclidDestroyRowBuffers when the last Euclid object is destroyed. */
+
+static HYPRE_Int   row_buf_size_dh = 0;
+static HYPRE_Int  *row_ind_buf_dh  = NULL;
+static HYPRE_Real *row_val_buf_dh  = NULL;
+
 #undef __FUNC__
 #define __FUNC__ "EuclidGetRow (HYPRE_GET_ROW)"
 void EuclidGetRow(void *A, HYPRE_Int row, HYPRE_Int *len, HYPRE_Int **ind, HYPRE_Real **val)
 {
   START_FUNC_DH
-  HYPRE_Int ierr;
-  HYPRE_ParCSRMatrix mat = (HYPRE_ParCSRMatrix) A;
-  ierr = HYPRE_ParCSRMatrixGetRow(mat, row, len, (HYPRE_BigInt **) ind, val);
-  if (ierr) {
-    hypre_sprintf(msgBuf_dh, "HYPRE_ParCSRMatrixRestoreRow(row= %i) returned %i", row+1, ierr);
-    SET_V_ERROR(msgBuf_dh);
+  HYPRE_Int ierr, k, n;
+  hypre_ParCSRMatrix *mat = (hypre_ParCSRMatrix *) A;
+  hypre_ParCSRMatrixRowView view;
+
+#if defined(HYPRE_USING_GPU)
+  if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(mat)) == HYPRE_EXEC_DEVICE) {
+    ierr = HYPRE_ParCSRMatrixGetRow((HYPRE_ParCSRMatrix) mat, row, len, (HYPRE_BigInt **) ind, val);
+    if (ierr) {
+      hypre_sprintf(msgBuf_dh, "HYPRE_ParCSRMatrixGetRow(row= %i) returned %i", row+1, ierr);
+      SET_V_ERROR(msgBuf_dh);
+    }
+  }
+  else
+#endif
+  {
+    ierr = hypre_ParCSRMatrixGetRowView(mat, row - (HYPRE_Int) hypre_ParCSRMatrixFirstRowIndex(mat), &view);
+    if (ierr) {
+      hypre_sprintf(msgBuf_dh, "hypre_ParCSRMatrixGetRowView(row= %i) returned %i", row+1, ierr);
+      SET_V_ERROR(msgBuf_dh);
+    }
+
+    n = hypre_ParCSRMatrixRowViewSize(&view);
+    if (n > row_buf_size_dh) {
+      hypre_TFree(row_ind_buf_dh, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_val_buf_dh, HYPRE_MEMORY_HOST);
+      row_buf_size_dh = hypre_max(n, 2*row_buf_size_dh);
+      row_ind_buf_dh  = hypre_TAlloc(HYPRE_Int, row_buf_size_dh, HYPRE_MEMORY_HOST);
+      row_val_buf_dh  = hypre_TAlloc(HYPRE_Real, row_buf_size_dh, HYPRE_MEMORY_HOST);
+    }
+
+    *len = n;
+    if (ind != NULL) {
+      for (k = 0; k < n; ++k) {
+        row_ind_buf_dh[k] = (HYPRE_Int) hypre_ParCSRMatrixRowViewGlobalCol(&view, k);
+      }
+      *ind = row_ind_buf_dh;
+    }
+    if (val != NULL) {
+      for (k = 0; k < n; ++k) {
+        row_val_buf_dh[k] = hypre_ParCSRMatrixRowViewValue(&view, k);
+      }
+      *val = row_val_buf_dh;
+    }
   }
   END_FUNC_DH
 }
@@ -36,13 +84,39 @@ void EuclidGetRow(void *A, HYPRE_Int row, HYPRE_Int *len, HYPRE_Int **ind, HYPRE
 void EuclidRestoreRow(void *A, HYPRE_Int row, HYPRE_Int *len, HYPRE_Int **ind, HYPRE_Real **val)
 {
   START_FUNC_DH
+#if defined(HYPRE_USING_GPU)
   HYPRE_Int ierr;
-  HYPRE_ParCSRMatrix mat = (HYPRE_ParCSRMatrix) A;
-  ierr = HYPRE_ParCSRMatrixRestoreRow(mat, row, len, (HYPRE_BigInt **) ind, val);
-  if (ierr) {
-    hypre_sprintf(msgBuf_dh, "HYPRE_ParCSRMatrixRestoreRow(row= %i) returned %i", row+1, ierr);
-    SET_V_ERROR(msgBuf_dh);
+  hypre_ParCSRMatrix *mat = (hypre_ParCSRMatrix *) A;
+
+  if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(mat)) == HYPRE_EXEC_DEVICE) {
+    ierr = HYPRE_ParCSRMatrixRestoreRow((HYPRE_ParCSRMatrix) mat, row, len, (HYPRE_BigInt **) ind, val);
+    if (ierr) {
+      hypre_sprintf(msgBuf_dh, "HYPRE_ParCSRMatrixRestoreRow(row= %i) returned %i", row+1, ierr);
+      SET_V_ERROR(msgBuf_dh);
+    }
   }
+  else
+#else
+  HYPRE_UNUSED_VAR(A);
+  HYPRE_UNUSED_VAR(row);
+  HYPRE_UNUSED_VAR(len);
+#endif
+  {
+    /* the buffers persist until EuclidDestroyRowBuffers */
+    if (ind != NULL) *ind = NULL;
+    if (val != NULL) *val = NULL;
+  }
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "EuclidDestroyRowBuffers (HYPRE_GET_ROW)"
+void EuclidDestroyRowBuffers(void)
+{
+  START_FUNC_DH
+  hypre_TFree(row_ind_buf_dh, HYPRE_MEMORY_HOST);
+  hypre_TFree(row_val_buf_dh, HYPRE_MEMORY_HOST);
+  row_buf_size_dh = 0;
   END_FUNC_DH
 }
 
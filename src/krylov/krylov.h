@@ -1067,6 +1067,15 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional, only needed for deflation (see hypre_PCGFunctionsSetMassOps) */
+   void *       (*CreateVectorArray) ( HYPRE_Int size, void *vectors );
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result );
+   HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result_x, void *result_y );
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll );
+
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
 
@@ -1105,6 +1114,11 @@ typedef struct
    every "recompute_residual_p" iterations.  This can be expensive and degrade the
    convergence. Use it only if you have seen a problem with the regular residual
    computation.
+   - num_deflation>0 means: deflated CG with the basis W (see hypre_PCGSetDeflationBasis)
+   or with a deflation operator (see hypre_PCGSetDeflationOperator).
+   With E = W^T A W, each residual r and preconditioned residual z = C r are
+   deflated as x = x + W E^{-1} W^T r, r = r - AW E^{-1} W^T r and
+   z = z - W E^{-1} (AW)^T z, using a single global reduction for W^T r and (AW)^T z.
    */
 
 typedef struct
@@ -1148,6 +1162,19 @@ typedef struct
    HYPRE_Real  *norms;
    HYPRE_Real  *rel_norms;
 
+   /* deflation */
+   HYPRE_Int     num_deflation; /* number of deflation vectors, k */
+   void        **W;             /* [W, A*W], contiguous array of 2k vectors */
+   void         *deflation_data; /* deflation operator, used instead of W */
+   HYPRE_Int   (*DeflationSetup)   ( void *data, void *A, HYPRE_Real *E );
+   HYPRE_Int   (*DeflationDotpTwo) ( void *data, void *r, void *z, HYPRE_Real *mu_r,
+                                     HYPRE_Real *mu_z );
+   HYPRE_Int   (*DeflationUpdate)  ( void *data, HYPRE_Real *mu_r, HYPRE_Real *mu_z,
+                                     void *x, void *r, void *z );
+   HYPRE_Int   (*DeflationDestroy) ( void *data );
+   HYPRE_Real   *deflation_E;   /* Cholesky factor of E = W^T A W, k x k */
+   HYPRE_Real   *deflation_mu;  /* work array of size 4k */
+
 } hypre_PCGData;
 
 #define hypre_PCGDataOwnsMatvecData(pcgdata)  ((pcgdata) -> owns_matvec_data)
@@ -1610,6 +1637,15 @@ HYPRE_Int HYPRE_PCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Rea
 HYPRE_Int HYPRE_PCGGetResidual ( HYPRE_Solver solver, void *residual );
 
 /* pcg.c */
+HYPRE_Int hypre_PCGFunctionsSetMassOps ( hypre_PCGFunctions *pcg_functions,
+                                         void *(*CreateVectorArray)(HYPRE_Int size, void *vectors),
+                                         HYPRE_Int (*MassInnerProd)(void *x, void **y, HYPRE_Int k,
+                                                                    HYPRE_Int unroll, void *result),
+                                         HYPRE_Int (*MassDotpTwo)(void *x, void *y, void **z,
+                                                                  HYPRE_Int k, HYPRE_Int unroll,
+                                                                  void *result_x, void *result_y),
+                                         HYPRE_Int (*MassAxpy)(HYPRE_Complex *alpha, void **x,
+                                                               void *y, HYPRE_Int k, HYPRE_Int unroll) );
 void *hypre_PCGCreate ( hypre_PCGFunctions *pcg_functions );
 HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata, void **residual );
@@ -1647,6 +1683,15 @@ HYPRE_Int hypre_PCGSetPrecond ( void *pcg_vdata,
                                 HYPRE_Int (*precond_setup )(void*, void*, void*, void*),
                                 void *precond_data );
 HYPRE_Int hypre_PCGSetPreconditioner ( void *pcg_vdata, void *precond_data );
+HYPRE_Int hypre_PCGSetDeflationBasis ( void *pcg_vdata, HYPRE_Int num_vectors, void **Z );
+HYPRE_Int hypre_PCGSetDeflationOperator ( void *pcg_vdata, HYPRE_Int num_vectors,
+                                          void *deflation_data,
+                                          HYPRE_Int (*DeflationSetup) ( void *data, void *A, HYPRE_Real *E ),
+                                          HYPRE_Int (*DeflationDotpTwo) ( void *data, void *r, void *z,
+                                                                          HYPRE_Real *mu_r, HYPRE_Real *mu_z ),
+                                          HYPRE_Int (*DeflationUpdate) ( void *data, HYPRE_Real *mu_r,
+                                                                         HYPRE_Real *mu_z, void *x, void *r, void *z ),
+                                          HYPRE_Int (*DeflationDestroy) ( void *data ) );
 HYPRE_Int hypre_PCGSetPrintLevel ( void *pcg_vdata, HYPRE_Int level );
 HYPRE_Int hypre_PCGGetPrintLevel ( void *pcg_vdata, HYPRE_Int *level );
 HYPRE_Int hypre_PCGSetLogging ( void *pcg_vdata, HYPRE_Int level );
@@ -22,6 +22,7 @@
 
 #include "krylov.h"
 #include "_hypre_utilities.h"
+#include "_hypre_lapack.h"
 
 /*--------------------------------------------------------------------------
  * hypre_PCGFunctionsCreate
@@ -65,6 +66,10 @@ hypre_PCGFunctionsCreate(
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->CreateVectorArray = NULL;
+   pcg_functions->MassInnerProd = NULL;
+   pcg_functions->MassDotpTwo = NULL;
+   pcg_functions->MassAxpy = NULL;
    /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -72,6 +77,34 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetMassOps
+ *
+ * Sets the (optional) operations on contiguous vector arrays needed for
+ * deflation.  As in COGMRES, MassInnerProd and MassDotpTwo compute all
+ * their inner products with a single global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetMassOps(
+   hypre_PCGFunctions *pcg_functions,
+   void *       (*CreateVectorArray) ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result ),
+   HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result_x, void *result_y ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll )
+)
+{
+   pcg_functions->CreateVectorArray = CreateVectorArray;
+   pcg_functions->MassInnerProd = MassInnerProd;
+   pcg_functions->MassDotpTwo = MassDotpTwo;
+   pcg_functions->MassAxpy = MassAxpy;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -114,12 +147,137 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> r)            = NULL;
    (pcg_data -> r_old)        = NULL;
    (pcg_data -> v)            = NULL;
+   (pcg_data -> num_deflation) = 0;
+   (pcg_data -> W)            = NULL;
+   (pcg_data -> deflation_data) = NULL;
+   (pcg_data -> deflation_E)  = NULL;
+   (pcg_data -> deflation_mu) = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
    return (void *) pcg_data;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGDestroyVectorArray
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGDestroyVectorArray( hypre_PCGFunctions   *pcg_functions,
+                             HYPRE_Int             size,
+                             void               ***vectors_ptr )
+{
+   void **vectors = *vectors_ptr;
+   HYPRE_Int i;
+
+   if (vectors != NULL)
+   {
+      for (i = 0; i < size; i++)
+      {
+         (*(pcg_functions->DestroyVector))(vectors[i]);
+      }
+      hypre_TFreeF( vectors, pcg_functions );
+   }
+   *vectors_ptr = NULL;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGClearDeflation
+ *
+ * Frees the deflation space, whether it is an explicit basis or a
+ * deflation operator, and turns deflation off.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGClearDeflation( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   hypre_PCGDestroyVectorArray(pcg_functions, 2 * (pcg_data -> num_deflation),
+                               &(pcg_data -> W));
+   if ( (pcg_data -> deflation_data) != NULL )
+   {
+      (*(pcg_data -> DeflationDestroy))(pcg_data -> deflation_data);
+      (pcg_data -> deflation_data) = NULL;
+   }
+   if ( (pcg_data -> deflation_E) != NULL )
+   {
+      hypre_TFreeF( pcg_data -> deflation_E, pcg_functions );
+   }
+   if ( (pcg_data -> deflation_mu) != NULL )
+   {
+      hypre_TFreeF( pcg_data -> deflation_mu, pcg_functions );
+   }
+   (pcg_data -> num_deflation) = 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGDeflate
+ *
+ * With E = W^T A W, sets x = x + W E^{-1} W^T r, r = r - AW E^{-1} W^T r
+ * and z = z - W E^{-1} (AW)^T z, so that W^T r = 0 and z is A-orthogonal
+ * to W.  W^T r and (AW)^T z come from a single global reduction, over
+ * [W, AW] for an explicit basis or inside the deflation operator.  z is
+ * not updated for the change in r: in exact arithmetic W^T r is already
+ * zero, and the correction only removes rounding errors that would
+ * otherwise grow once the residual is small.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGDeflate( hypre_PCGData  *pcg_data,
+                  void           *x,
+                  void           *r,
+                  void           *z )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           k             = (pcg_data -> num_deflation);
+   void              **W             = (pcg_data -> W);
+   void              **AW            = (pcg_data -> W) + k;
+   void               *defl_data     = (pcg_data -> deflation_data);
+   HYPRE_Real         *E             = (pcg_data -> deflation_E);
+   HYPRE_Real         *mu_r          = (pcg_data -> deflation_mu);
+   HYPRE_Real         *mu_z          = (pcg_data -> deflation_mu) + 3 * k;
+   HYPRE_Int           one = 1, info, i;
+
+   /* mu_r[0:k) = W^T r, mu_z[0:k) = (AW)^T z */
+   if (defl_data)
+   {
+      (*(pcg_data -> DeflationDotpTwo))(defl_data, r, z, mu_r, mu_z);
+   }
+   else
+   {
+      (*(pcg_functions->MassDotpTwo))(r, z, W, 2 * k, 0, mu_r, mu_r + 2 * k);
+   }
+   hypre_dpotrs((char *) "L", &k, &one, E, &k, mu_r, &k, &info);
+   if (info == 0)
+   {
+      hypre_dpotrs((char *) "L", &k, &one, E, &k, mu_z, &k, &info);
+   }
+   if (info != 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Deflation solve failed in PCG");
+      return hypre_error_flag;
+   }
+
+   if (defl_data)
+   {
+      (*(pcg_data -> DeflationUpdate))(defl_data, mu_r, mu_z, x, r, z);
+   }
+   else
+   {
+      (*(pcg_functions->MassAxpy))(mu_r, W, x, k, 0);
+      for (i = 0; i < k; i++)
+      {
+         mu_r[i] = -mu_r[i];
+         mu_z[i] = -mu_z[i];
+      }
+      (*(pcg_functions->MassAxpy))(mu_r, AW, r, k, 0);
+      (*(pcg_functions->MassAxpy))(mu_z, W, z, k, 0);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGDestroy
  *--------------------------------------------------------------------------*/
@@ -174,6 +332,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> v);
          pcg_data -> v = NULL;
       }
+      hypre_PCGClearDeflation(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -213,6 +372,7 @@ hypre_PCGSetup( void *pcg_vdata,
    HYPRE_Real           rtol = (pcg_data -> rtol);
    HYPRE_Int            two_norm = (pcg_data -> two_norm);
    HYPRE_Int            flex = (pcg_data -> flex);
+   HYPRE_Int            num_deflation = (pcg_data -> num_deflation);
    HYPRE_Int          (*precond_setup)(void*, void*, void*, void*) = (pcg_functions -> precond_setup);
    void          *precond_data     = (pcg_data -> precond_data);
 
@@ -270,6 +430,46 @@ hypre_PCGSetup( void *pcg_vdata,
 
    precond_setup(precond_data, A, b, x);
 
+   /*-----------------------------------------------------
+    * Set up the deflation: AW = A*W and the Cholesky
+    * factor of the coarse matrix E = W^T A W.  If E is
+    * not positive definite, deflation is turned off.
+    *-----------------------------------------------------*/
+
+   if (num_deflation > 0)
+   {
+      void       **W  = (pcg_data -> W);
+      void       **AW = (pcg_data -> W) + num_deflation;
+      HYPRE_Real  *E  = (pcg_data -> deflation_E);
+      HYPRE_Int    i, info;
+
+      if (pcg_data -> deflation_data)
+      {
+         (*(pcg_data -> DeflationSetup))(pcg_data -> deflation_data, A, E);
+      }
+      else
+      {
+         for (i = 0; i < num_deflation; i++)
+         {
+            (*(pcg_functions->Matvec))(pcg_data -> matvec_data, 1.0, A, W[i], 0.0, AW[i]);
+         }
+
+         /* E is symmetric, so row i is the column of inner products with W[i] */
+         for (i = 0; i < num_deflation; i++)
+         {
+            (*(pcg_functions->MassInnerProd))(W[i], AW, num_deflation, 0,
+                                              &E[i * num_deflation]);
+         }
+      }
+      hypre_dpotrf("L", &num_deflation, E, &num_deflation, &info);
+      if (info != 0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Deflation matrix W^T A W is not positive definite in PCG");
+         hypre_PCGClearDeflation(pcg_data);
+      }
+   }
+
    /*-----------------------------------------------------
     * Allocate space for log info
     *-----------------------------------------------------*/
@@ -357,6 +557,7 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       logging      = (pcg_data -> logging);
    HYPRE_Real     *norms        = (pcg_data -> norms);
    HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+   HYPRE_Int       num_deflation = (pcg_data -> num_deflation);
 
    HYPRE_Real      alpha, beta;
    HYPRE_Real      delta = 0.0;
@@ -493,8 +694,18 @@ hypre_PCGSolve( void *pcg_vdata,
    //hypre_ParVectorUpdateHost(r);
    /* p = C*r */
    (*(pcg_functions->ClearVector))(p);
+   if (num_deflation > 0)
+   {
+      /* p = 0 here, so this only deflates the initial residual */
+      hypre_PCGDeflate(pcg_data, x, r, p);
+   }
    precond(precond_data, A, r, p);
 
+   if (num_deflation > 0)
+   {
+      hypre_PCGDeflate(pcg_data, x, r, p);
+   }
+
    /* gamma = <r,p> = <r,Cr> */
    gamma = (*(pcg_functions->InnerProd))(r, p);
 
@@ -715,6 +926,11 @@ hypre_PCGSolve( void *pcg_vdata,
       (*(pcg_functions->ClearVector))(s);
       precond(precond_data, A, r, s);
 
+      if (num_deflation > 0)
+      {
+         hypre_PCGDeflate(pcg_data, x, r, s);
+      }
+
       /* gamma = <r,s> */
       gamma = (*(pcg_functions->InnerProd))(r, s);
       if (flex)
@@ -820,6 +1036,10 @@ hypre_PCGSolve( void *pcg_vdata,
             /* s = C*r */
             (*(pcg_functions->ClearVector))(s);
             precond(precond_data, A, r, s);
+            if (num_deflation > 0)
+            {
+               hypre_PCGDeflate(pcg_data, x, r, s);
+            }
             /* iprod = gamma = <r,s> */
             i_prod = (*(pcg_functions->InnerProd))(r, s);
             gamma = i_prod;
@@ -1414,6 +1634,108 @@ hypre_PCGSetPreconditioner(void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetDeflationBasis
+ *
+ * Sets the basis W of the deflation space.  The num_vectors vectors in Z
+ * are copied, so Z may be destroyed after this call.  num_vectors = 0
+ * turns deflation off.  Takes effect at the next setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetDeflationBasis( void       *pcg_vdata,
+                            HYPRE_Int   num_vectors,
+                            void      **Z )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           i;
+
+   if (num_vectors > 0 &&
+       (!(pcg_functions->CreateVectorArray) || !(pcg_functions->MassInnerProd) ||
+        !(pcg_functions->MassDotpTwo) || !(pcg_functions->MassAxpy)))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Deflation is not supported by this PCG interface");
+      return hypre_error_flag;
+   }
+
+   hypre_PCGClearDeflation(pcg_data);
+
+   if (num_vectors > 0)
+   {
+      /* the second half of W holds A*W, computed at setup */
+      (pcg_data -> W) = (void **) (*(pcg_functions->CreateVectorArray))(2 * num_vectors, Z[0]);
+      for (i = 0; i < num_vectors; i++)
+      {
+         (*(pcg_functions->CopyVector))(Z[i], (pcg_data -> W)[i]);
+      }
+      (pcg_data -> deflation_E)  = hypre_CTAllocF(HYPRE_Real, num_vectors * num_vectors,
+                                                  pcg_functions, HYPRE_MEMORY_HOST);
+      (pcg_data -> deflation_mu) = hypre_CTAllocF(HYPRE_Real, 4 * num_vectors,
+                                                  pcg_functions, HYPRE_MEMORY_HOST);
+      (pcg_data -> num_deflation) = num_vectors;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetDeflationOperator
+ *
+ * Deflates with a space of dimension num_vectors that is not stored as
+ * explicit vectors.  The operator in deflation_data provides:
+ *
+ *   Setup(data, A, E):     forms E = W^T A W (k x k, column-major)
+ *   DotpTwo(data, r, z, mu_r, mu_z):
+ *                          mu_r = W^T r and mu_z = (AW)^T z, one reduction
+ *   Update(data, mu_r, mu_z, x, r, z):
+ *                          x += W mu_r, r -= AW mu_r, z -= W mu_z
+ *   Destroy(data)
+ *
+ * PCG takes ownership of deflation_data.  num_vectors = 0 turns deflation
+ * off.  Takes effect at the next setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetDeflationOperator( void       *pcg_vdata,
+                               HYPRE_Int   num_vectors,
+                               void       *deflation_data,
+                               HYPRE_Int (*DeflationSetup)   ( void *data, void *A,
+                                                               HYPRE_Real *E ),
+                               HYPRE_Int (*DeflationDotpTwo) ( void *data, void *r, void *z,
+                                                               HYPRE_Real *mu_r,
+                                                               HYPRE_Real *mu_z ),
+                               HYPRE_Int (*DeflationUpdate)  ( void *data, HYPRE_Real *mu_r,
+                                                               HYPRE_Real *mu_z, void *x,
+                                                               void *r, void *z ),
+                               HYPRE_Int (*DeflationDestroy) ( void *data ) )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   hypre_PCGClearDeflation(pcg_data);
+
+   if (num_vectors > 0)
+   {
+      (pcg_data -> deflation_data)   = deflation_data;
+      (pcg_data -> DeflationSetup)   = DeflationSetup;
+      (pcg_data -> DeflationDotpTwo) = DeflationDotpTwo;
+      (pcg_data -> DeflationUpdate)  = DeflationUpdate;
+      (pcg_data -> DeflationDestroy) = DeflationDestroy;
+      (pcg_data -> deflation_E)  = hypre_CTAllocF(HYPRE_Real, num_vectors * num_vectors,
+                                                  pcg_functions, HYPRE_MEMORY_HOST);
+      (pcg_data -> deflation_mu) = hypre_CTAllocF(HYPRE_Real, 4 * num_vectors,
+                                                  pcg_functions, HYPRE_MEMORY_HOST);
+      (pcg_data -> num_deflation) = num_vectors;
+   }
+   else if (deflation_data)
+   {
+      (*DeflationDestroy)(deflation_data);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetPrintLevel, hypre_PCGGetPrintLevel
  *--------------------------------------------------------------------------*/
@@ -150,6 +150,16 @@ HYPRE_Int HYPRE_ADSSetCycleType(HYPRE_Solver solver,
    return hypre_ADSSetCycleType((void *) solver, cycle_type);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ADSSetConcurrentCorrections
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_ADSSetConcurrentCorrections(HYPRE_Solver solver,
+                                            HYPRE_Int concurrent_corrections)
+{
+   return hypre_ADSSetConcurrentCorrections((void *) solver, concurrent_corrections);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ADSSetPrintLevel
  *--------------------------------------------------------------------------*/
@@ -198,6 +198,16 @@ HYPRE_Int HYPRE_AMSSetCycleType(HYPRE_Solver solver,
    return hypre_AMSSetCycleType((void *) solver, cycle_type);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_AMSSetConcurrentCorrections
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_AMSSetConcurrentCorrections(HYPRE_Solver solver,
+                                            HYPRE_Int concurrent_corrections)
+{
+   return hypre_AMSSetConcurrentCorrections((void *) solver, concurrent_corrections);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_AMSSetPrintLevel
  *--------------------------------------------------------------------------*/
@@ -56,6 +56,37 @@ HYPRE_BoomerAMGSetup( HYPRE_Solver solver,
                                   (hypre_ParVector *) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetupUpdate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetupUpdate( HYPRE_Solver       solver,
+                            HYPRE_ParCSRMatrix A,
+                            HYPRE_ParVector    b,
+                            HYPRE_ParVector    x,
+                            HYPRE_Int          num_rows,
+                            HYPRE_BigInt      *rows )
+{
+   if (!A)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (num_rows < 0 || (num_rows > 0 && !rows))
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_BoomerAMGSetupUpdate( (void *) solver,
+                                        (hypre_ParCSRMatrix *) A,
+                                        (hypre_ParVector *) b,
+                                        (hypre_ParVector *) x,
+                                        num_rows, rows ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSolve
  *--------------------------------------------------------------------------*/
@@ -124,6 +155,40 @@ HYPRE_BoomerAMGSolveT( HYPRE_Solver solver,
                                    (hypre_ParVector *) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGBlockSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGBlockSolve( HYPRE_Solver solver,
+                           HYPRE_ParCSRMatrix A,
+                           HYPRE_ParVector b,
+                           HYPRE_ParVector x      )
+{
+   if (!A)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (!b)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!x)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_BoomerAMGBlockSolve( (void *) solver,
+                                       (hypre_ParCSRMatrix *) A,
+                                       (hypre_ParVector *) b,
+                                       (hypre_ParVector *) x ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRestriction
  *--------------------------------------------------------------------------*/
@@ -386,6 +451,46 @@ HYPRE_BoomerAMGGetPMaxElmts( HYPRE_Solver solver,
                                          P_max_elmts ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetTargetOpCmplxty, HYPRE_BoomerAMGGetTargetOpCmplxty
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetTargetOpCmplxty( HYPRE_Solver solver,
+                                   HYPRE_Real   target_op_cmplxty  )
+{
+   return ( hypre_BoomerAMGSetTargetOpCmplxty( (void *) solver,
+                                               target_op_cmplxty ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetTargetOpCmplxty( HYPRE_Solver solver,
+                                   HYPRE_Real  *target_op_cmplxty  )
+{
+   return ( hypre_BoomerAMGGetTargetOpCmplxty( (void *) solver,
+                                               target_op_cmplxty ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetUpdateMaxFraction, HYPRE_BoomerAMGGetUpdateMaxFraction
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetUpdateMaxFraction( HYPRE_Solver solver,
+                                     HYPRE_Real   update_max_fraction )
+{
+   return ( hypre_BoomerAMGSetUpdateMaxFraction( (void *) solver,
+                                                 update_max_fraction ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetUpdateMaxFraction( HYPRE_Solver solver,
+                                     HYPRE_Real  *update_max_fraction )
+{
+   return ( hypre_BoomerAMGGetUpdateMaxFraction( (void *) solver,
+                                                 update_max_fraction ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetJacobiTruncThreshold, HYPRE_BoomerAMGGetJacobiTruncThreshold
  *--------------------------------------------------------------------------*/
@@ -608,6 +713,42 @@ HYPRE_BoomerAMGGetConvergeType( HYPRE_Solver solver,
    return ( hypre_BoomerAMGGetConvergeType( (void *) solver, type ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetConvCheckType, HYPRE_BoomerAMGGetConvCheckType
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetConvCheckType( HYPRE_Solver solver,
+                                 HYPRE_Int    type    )
+{
+   return ( hypre_BoomerAMGSetConvCheckType( (void *) solver, type ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetConvCheckType( HYPRE_Solver solver,
+                                 HYPRE_Int   *type    )
+{
+   return ( hypre_BoomerAMGGetConvCheckType( (void *) solver, type ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetConvCheckFreq, HYPRE_BoomerAMGGetConvCheckFreq
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetConvCheckFreq( HYPRE_Solver solver,
+                                 HYPRE_Int    freq    )
+{
+   return ( hypre_BoomerAMGSetConvCheckFreq( (void *) solver, freq ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetConvCheckFreq( HYPRE_Solver solver,
+                                 HYPRE_Int   *freq    )
+{
+   return ( hypre_BoomerAMGGetConvCheckFreq( (void *) solver, freq ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetTol, HYPRE_BoomerAMGGetTol
  *--------------------------------------------------------------------------*/
@@ -626,6 +767,35 @@ HYPRE_BoomerAMGGetTol( HYPRE_Solver solver,
    return ( hypre_BoomerAMGGetTol( (void *) solver, tol ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFloatHaloLevel, HYPRE_BoomerAMGGetFloatHaloLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFloatHaloLevel( HYPRE_Solver solver,
+                                  HYPRE_Int    float_halo_level )
+{
+   return ( hypre_BoomerAMGSetFloatHaloLevel( (void *) solver, float_halo_level ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetFloatHaloLevel( HYPRE_Solver solver,
+                                  HYPRE_Int   *float_halo_level )
+{
+   return ( hypre_BoomerAMGGetFloatHaloLevel( (void *) solver, float_halo_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetFloatHaloBytesSaved
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetFloatHaloBytesSaved( HYPRE_Solver  solver,
+                                       HYPRE_Real   *bytes_saved )
+{
+   return ( hypre_BoomerAMGGetFloatHaloBytesSaved( (void *) solver, bytes_saved ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetNumGridSweeps
  * DEPRECATED.  There are memory management problems associated with the
@@ -1966,6 +2136,17 @@ HYPRE_BoomerAMGSetChebyEigEst( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetChebyEigEst( (void *) solver, eig_est ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyEigReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyEigReuse( HYPRE_Solver  solver,
+                                 HYPRE_Int     eig_reuse )
+{
+   return ( hypre_BoomerAMGSetChebyEigReuse( (void *) solver, eig_reuse ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetInterpVectors
  *--------------------------------------------------------------------------*/
@@ -2172,6 +2353,28 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFusedRAP
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFusedRAP (HYPRE_Solver solver,
+                            HYPRE_Int    fused_rap)
+{
+   return (hypre_BoomerAMGSetFusedRAP ( (void *) solver, fused_rap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFusedRAPWorkingSet
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFusedRAPWorkingSet (HYPRE_Solver solver,
+                                      HYPRE_Int    working_set)
+{
+   return (hypre_BoomerAMGSetFusedRAPWorkingSet ( (void *) solver, working_set ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
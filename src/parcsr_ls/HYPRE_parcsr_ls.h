@@ -93,6 +93,32 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
                                HYPRE_ParVector    b,
                                HYPRE_ParVector    x);
 
+/**
+ * Update a BoomerAMG hierarchy after the values or the sparsity pattern of
+ * a few rows of the matrix have changed. The splittings and interpolation
+ * operators of the previous setup are kept, and only the rows of the coarse
+ * operators that depend on the modified rows are recomputed. Smoother and
+ * coarse solver data is refreshed for the new operators. A full setup is
+ * done instead when no previous setup exists, when the options of the
+ * solver do not allow an update (e.g., non-Galerkin coarse operators, AIR
+ * restriction, Chebyshev or complex smoothers), or when the fraction of
+ * modified rows exceeds the value set by
+ * \e HYPRE_BoomerAMGSetUpdateMaxFraction.
+ *
+ * @param solver [IN] object previously set up with \e HYPRE_BoomerAMGSetup.
+ * @param A [IN] ParCSR matrix with the same row partitioning as before.
+ * @param b Ignored by this function.
+ * @param x Ignored by this function.
+ * @param num_rows [IN] number of rows modified on this process.
+ * @param rows [IN] global indices of the modified rows owned by this process.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetupUpdate(HYPRE_Solver       solver,
+                                     HYPRE_ParCSRMatrix A,
+                                     HYPRE_ParVector    b,
+                                     HYPRE_ParVector    x,
+                                     HYPRE_Int          num_rows,
+                                     HYPRE_BigInt      *rows);
+
 /**
  * Solve the system or apply AMG as a preconditioner.
  * If used as a preconditioner, this function should be passed
@@ -127,6 +153,29 @@ HYPRE_Int HYPRE_BoomerAMGSolveT(HYPRE_Solver       solver,
                                 HYPRE_ParVector    b,
                                 HYPRE_ParVector    x);
 
+/**
+ * Solve the block-diagonal system diag(A,...,A) x = b, where the solver was
+ * set up with the scalar matrix \e A, and \e b and \e x are vectors with
+ * \e dim interleaved components per row of \e A, i.e., entry i of
+ * component d is stored at position dim*i+d. This is the situation of
+ * decoupled vector Laplacians, where every component shares one AMG
+ * hierarchy. If the solver runs a fixed number of cycles (tolerance 0) on
+ * the host with only hybrid Gauss-Seidel smoothers (relax types 3, 4, 6, 8,
+ * 13, 14, 88, 89), all components are cycled together so that each matrix
+ * of the hierarchy is read once per cycle. Otherwise, the components are
+ * solved one after the other, each with its own convergence test; this
+ * case supports at most 3 components.
+ *
+ * @param solver [IN] solver or preconditioner object to be applied.
+ * @param A [IN] ParCSR matrix of a single component
+ * @param b [IN] right hand side with interleaved components
+ * @param x [OUT] approximated solution with interleaved components
+ **/
+HYPRE_Int HYPRE_BoomerAMGBlockSolve(HYPRE_Solver       solver,
+                                    HYPRE_ParCSRMatrix A,
+                                    HYPRE_ParVector    b,
+                                    HYPRE_ParVector    x);
+
 /**
  * Recovers old default for coarsening and interpolation, i.e Falgout
  * coarsening and untruncated modified classical interpolation.
@@ -205,6 +254,28 @@ HYPRE_Int HYPRE_BoomerAMGSetDofFunc(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType(HYPRE_Solver solver,
                                          HYPRE_Int    type);
 
+/**
+ * (Optional) Set how often the residual norm is computed to check convergence
+ * when BoomerAMG is used as a solver (tol > 0). Each check costs a fine grid
+ * matvec and a global reduction.
+ * 0: (default) check after every cycle
+ * 1: check every k cycles, see \e HYPRE\_BoomerAMGSetConvCheckFreq
+ * 2: extrapolate from the observed convergence factor and check increasingly
+ *    often as the tolerance is predicted to be reached
+ *
+ * With types 1 and 2, up to k-1 (or the mispredicted number of) extra cycles
+ * may be done. The residual is always checked after the last cycle.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetConvCheckType(HYPRE_Solver solver,
+                                          HYPRE_Int    type);
+
+/**
+ * (Optional) Set the number of cycles k between convergence checks for
+ * convergence check type 1. The default is 1.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetConvCheckFreq(HYPRE_Solver solver,
+                                          HYPRE_Int    freq);
+
 /**
  * (Optional) Set the convergence tolerance, if BoomerAMG is used
  * as a solver. If it is used as a preconditioner, it should be set to 0.
@@ -213,6 +284,28 @@ HYPRE_Int HYPRE_BoomerAMGSetConvergeType(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetTol(HYPRE_Solver solver,
                                 HYPRE_Real   tol);
 
+/**
+ * (Optional) Sets the first level from which on the halo exchanges of the
+ * matvecs and relaxations inside the cycle send single-precision values.
+ * This reduces the message volume on levels where communication is
+ * bandwidth bound. It only takes effect when BoomerAMG is used as a
+ * preconditioner, i.e., the tolerance is 0, and for host execution.
+ * The value -2 chooses the levels automatically: single precision is used
+ * on each level whose halo messages hold 256 values or more on average,
+ * i.e., where the exchange is bandwidth rather than latency bound.
+ * The default is -1, which disables the option.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFloatHaloLevel(HYPRE_Solver solver,
+                                           HYPRE_Int    float_halo_level);
+
+/**
+ * Returns the number of bytes that single-precision halos (see
+ * \e HYPRE_BoomerAMGSetFloatHaloLevel) saved, summed over all processes
+ * and all solves since the last setup.  Collective.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetFloatHaloBytesSaved(HYPRE_Solver  solver,
+                                                HYPRE_Real   *bytes_saved);
+
 /**
  * (Optional) Sets maximum number of iterations, if BoomerAMG is used
  * as a solver. If it is used as a preconditioner, it should be set to 1.
@@ -477,6 +570,26 @@ HYPRE_Int HYPRE_BoomerAMGSetTruncFactor(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetPMaxElmts(HYPRE_Solver solver,
                                       HYPRE_Int    P_max_elmts);
 
+/**
+ * (Optional) Sets a target operator complexity C > 1 that enables adaptive
+ * truncation of the interpolation. Each level is allowed to have at most
+ * (1 - 1/C) times the nonzeros of the next finer level, which bounds the
+ * operator complexity by about C. If a Galerkin coarse operator exceeds this
+ * budget, P is truncated further (smaller max elements per row, larger
+ * truncation factor) and the coarse operator is recomputed. The default is
+ * 0, which turns this off.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetTargetOpCmplxty(HYPRE_Solver solver,
+                                            HYPRE_Real   target_op_cmplxty);
+
+/**
+ * (Optional) Sets the largest fraction of modified rows for which
+ * \e HYPRE_BoomerAMGSetupUpdate updates the hierarchy in place. For
+ * larger changes, a full setup is done. The default is 0.1.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetUpdateMaxFraction(HYPRE_Solver solver,
+                                              HYPRE_Real   update_max_fraction);
+
 /**
  * (Optional) Defines whether separation of weights is used
  * when defining strength for standard interpolation or
@@ -942,6 +1055,18 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                          HYPRE_Int   eig_est);
 
+/**
+ * (Optional) If eig_reuse is nonzero, the CG eigenvalue estimation of a new
+ * setup (e.g., after the matrix values changed) starts on each level from the
+ * last search direction of the previous setup, blended with the usual random
+ * vector, when the level has the same size. This needs one additional vector
+ * per level between setups. The eigenvalues of all levels are always
+ * estimated together, with one global reduction per step.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigReuse (HYPRE_Solver solver,
+                                           HYPRE_Int    eig_reuse);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -1379,6 +1504,31 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the Galerkin coarse-grid operators are formed one
+ * row at a time from the rows of P^T, A and P, without storing the product
+ * A*P. Besides the coarse operator, each thread only needs hash tables sized
+ * by the longest rows of P^T A and of the coarse operator, instead of work
+ * arrays of the size of the fine or coarse grid. Unless the transposes of P
+ * are kept (see \e HYPRE_BoomerAMGSetKeepTranspose), P^T is formed in row
+ * blocks whose size is set by \e HYPRE_BoomerAMGSetFusedRAPWorkingSet. The
+ * interpolation operators are still built for a whole level at once. It
+ * applies to host execution on a single MPI task when neither rap2 nor a
+ * target operator complexity is used; otherwise it is ignored. The default
+ * is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFusedRAP(HYPRE_Solver solver,
+                                     HYPRE_Int    fused_rap);
+
+/**
+ * (Optional) Sets the largest number of nonzeros of P^T held at once by the
+ * row-wise Galerkin product (see \e HYPRE_BoomerAMGSetFusedRAP). Each block
+ * of rows of P^T is built twice, so small values trade setup time for
+ * memory. If set to 0, P^T is formed whole. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFusedRAPWorkingSet(HYPRE_Solver solver,
+                                               HYPRE_Int    working_set);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2401,6 +2551,20 @@ HYPRE_Int HYPRE_AMSSetTol(HYPRE_Solver solver,
 HYPRE_Int HYPRE_AMSSetCycleType(HYPRE_Solver solver,
                                 HYPRE_Int    cycle_type);
 
+/**
+ * (Optional) Apply the subspace corrections of additive cycles
+ * concurrently. The corrections that use the residual computed at the start
+ * of an additive cycle (e.g., 1 and 2 in (0+1+2)) are computed at the same
+ * time as the other operations of the cycle, each on a subset of the OpenMP
+ * threads, and are then added to the solution in the order of the cycle.
+ * This needs one additional vector per concurrent
+ * correction and is used only with a single MPI task, more than one OpenMP
+ * thread, host memory, and MPI initialized with MPI_THREAD_MULTIPLE. The
+ * default is 0 (sequential corrections).
+ **/
+HYPRE_Int HYPRE_AMSSetConcurrentCorrections(HYPRE_Solver solver,
+                                            HYPRE_Int    concurrent_corrections);
+
 /**
  * (Optional) Control how much information is printed during the
  * solution iterations.
@@ -2663,6 +2827,20 @@ HYPRE_Int HYPRE_ADSSetTol(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ADSSetCycleType(HYPRE_Solver solver,
                                 HYPRE_Int    cycle_type);
 
+/**
+ * (Optional) Apply the subspace corrections of additive cycles
+ * concurrently. The corrections that use the residual computed at the start
+ * of an additive cycle (e.g., 1 and 2 in (0+1+2)) are computed at the same
+ * time as the other operations of the cycle, each on a subset of the OpenMP
+ * threads, and are then added to the solution in the order of the cycle.
+ * This needs one additional vector per concurrent
+ * correction and is used only with a single MPI task, more than one OpenMP
+ * thread, host memory, and MPI initialized with MPI_THREAD_MULTIPLE. The
+ * default is 0 (sequential corrections).
+ **/
+HYPRE_Int HYPRE_ADSSetConcurrentCorrections(HYPRE_Solver solver,
+                                            HYPRE_Int    concurrent_corrections);
+
 /**
  * (Optional) Control how much information is printed during the
  * solution iterations.
@@ -2821,6 +2999,33 @@ HYPRE_Int HYPRE_ParCSRPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_ParCSRPCGGetResidual(HYPRE_Solver     solver,
                                      HYPRE_ParVector *residual);
 
+/**
+ * (Optional) Use deflated PCG with the columns of the multivector Z as the
+ * deflation basis.  The initial guess is corrected so that the initial
+ * residual is orthogonal to Z, and the search directions are kept
+ * A-orthogonal to Z.  This removes the eigenvalues associated with Z, such
+ * as the small ones caused by high-contrast coefficients, from the
+ * convergence of PCG.  Each iteration costs one extra global reduction of
+ * four values per column of Z.  Z is copied.  Passing NULL turns deflation
+ * off.  Host memory only.  Takes effect at the next setup.
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSetDeflationBasis(HYPRE_Solver    solver,
+                                           HYPRE_ParVector Z);
+
+/**
+ * (Optional) Use deflated PCG with piecewise-constant subdomain vectors.
+ * The subdomains are formed from consecutive ranks of the row partition of
+ * \e A.  \e num_subdomains <= 0 uses one subdomain per rank; it may not
+ * exceed the number of ranks.  The subdomain vectors are not stored, and
+ * \e A times them is kept only on the rows next to each subdomain, so each
+ * iteration costs local sums plus one global reduction of
+ * 2*\e num_subdomains values.  Host memory only.  Takes effect at the next
+ * setup.  See \e HYPRE_ParCSRPCGSetDeflationBasis.
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSetDeflationSubdomains(HYPRE_Solver       solver,
+                                                HYPRE_ParCSRMatrix A,
+                                                HYPRE_Int          num_subdomains);
+
 /**
  * Setup routine for diagonal preconditioning.
  **/
@@ -4403,6 +4608,24 @@ HYPRE_Int
 HYPRE_MGRSetTruncateCoarseGridThreshold( HYPRE_Solver solver,
                                          HYPRE_Real threshold);
 
+/**
+ * (Optional) Reuse the symbolic data of the previous setup when MGR is set up
+ * again for a matrix with the same sparsity pattern and row partitioning, as
+ * in a sequence of Newton steps.  If \e reuse is nonzero, the C/F splitting of
+ * every level, the sparsity patterns of its C/F blocks and the communication
+ * packages of the interpolation and coarse level operators are kept, and
+ * subsequent setups only recompute numerical values, the F-relaxation and the
+ * coarse grid solver.  When the splitting is computed by coarsening (see
+ * \e HYPRE_MGRSetNonCpointsToFpoints), it is frozen at its first value.
+ * Levels whose pattern has changed are detected and rebuilt.  Setting any of
+ * the options that define the C/F splitting, the interpolation or the
+ * restriction discards the kept data, so the next setup is a full one.  Host
+ * execution only; default is 0 (no reuse).
+ **/
+HYPRE_Int
+HYPRE_MGRSetReuse( HYPRE_Solver solver,
+                   HYPRE_Int    reuse );
+
 /**
  * (Optional) Requests logging of solver diagnostics.
  * Requests additional computations for diagnostic and similar
@@ -652,6 +652,23 @@ HYPRE_MGRSetTruncateCoarseGridThreshold( HYPRE_Solver solver,
    return hypre_MGRSetTruncateCoarseGridThreshold( solver, threshold );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_MGRSetReuse( HYPRE_Solver solver,
+                   HYPRE_Int    reuse )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return hypre_MGRSetReuse( solver, reuse );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_MGRSetBlockJacobiBlockSize
  *--------------------------------------------------------------------------*/
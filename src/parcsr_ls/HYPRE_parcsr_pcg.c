@@ -33,6 +33,9 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_PCGFunctionsSetMassOps(pcg_functions, hypre_ParKrylovCreateVectorArray,
+                                hypre_ParKrylovMassInnerProd, hypre_ParKrylovMassDotpTwo,
+                                hypre_ParKrylovMassAxpy);
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -241,6 +244,127 @@ HYPRE_ParCSRPCGGetResidual( HYPRE_Solver  solver,
    return ( HYPRE_PCGGetResidual( solver, (void *) residual ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetDeflationBasis
+ *
+ * Uses the columns of the multivector Z as the deflation basis.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPCGSetDeflationBasis( HYPRE_Solver    solver,
+                                  HYPRE_ParVector Z )
+{
+   hypre_ParVector       *par_Z = (hypre_ParVector *) Z;
+   hypre_Vector          *Z_local;
+   hypre_ParVector      **columns;
+   HYPRE_Complex         *col_data;
+   HYPRE_MemoryLocation   memory_location;
+   HYPRE_Int              num_vectors, local_size, i, j;
+
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!par_Z)
+   {
+      return hypre_PCGSetDeflationBasis( (void *) solver, 0, NULL );
+   }
+
+   memory_location = hypre_ParVectorMemoryLocation(par_Z);
+   if (hypre_GetExecPolicy1(memory_location) != HYPRE_EXEC_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "PCG deflation is only available on the host");
+      return hypre_error_flag;
+   }
+
+   Z_local     = hypre_ParVectorLocalVector(par_Z);
+   num_vectors = hypre_VectorNumVectors(Z_local);
+   local_size  = hypre_VectorSize(Z_local);
+
+   /* Split Z into single vectors; hypre_VectorEntryIJ honors both the
+      column-major and the row-major (interleaved) multivector layouts */
+   columns = hypre_TAlloc(hypre_ParVector *, num_vectors, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_vectors; j++)
+   {
+      columns[j] = hypre_ParVectorCreate(hypre_ParVectorComm(par_Z),
+                                         hypre_ParVectorGlobalSize(par_Z),
+                                         hypre_ParVectorPartitioning(par_Z));
+      hypre_ParVectorInitialize_v2(columns[j], memory_location);
+      col_data = hypre_VectorData(hypre_ParVectorLocalVector(columns[j]));
+      for (i = 0; i < local_size; i++)
+      {
+         col_data[i] = hypre_VectorEntryIJ(Z_local, i, j);
+      }
+   }
+
+   hypre_PCGSetDeflationBasis( (void *) solver, num_vectors, (void **) columns );
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      hypre_ParVectorDestroy(columns[j]);
+   }
+   hypre_TFree(columns, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetDeflationSubdomains
+ *
+ * Deflates piecewise-constant vectors on subdomains made of consecutive
+ * ranks of the row partition of A.  Subdomain s is the indicator of the
+ * rows owned by ranks [s*P/n, (s+1)*P/n), where P is the number of ranks
+ * and n = num_subdomains.  num_subdomains <= 0 uses one subdomain per rank.
+ * The indicators are not stored; see par_pcg_deflation.c.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPCGSetDeflationSubdomains( HYPRE_Solver       solver,
+                                       HYPRE_ParCSRMatrix A,
+                                       HYPRE_Int          num_subdomains )
+{
+   hypre_ParCSRMatrix  *par_A = (hypre_ParCSRMatrix *) A;
+   MPI_Comm             comm;
+   HYPRE_Int            num_procs;
+
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!par_A)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParCSRMatrixComm(par_A);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   if (num_subdomains > num_procs)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   if (num_subdomains <= 0)
+   {
+      num_subdomains = num_procs;
+   }
+
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(par_A)) != HYPRE_EXEC_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "PCG deflation is only available on the host");
+      return hypre_error_flag;
+   }
+
+   return hypre_PCGSetDeflationOperator( (void *) solver, num_subdomains,
+                                         hypre_ParPCGSubdomainDeflationCreate(comm, num_subdomains),
+                                         hypre_ParPCGSubdomainDeflationSetup,
+                                         hypre_ParPCGSubdomainDeflationDotpTwo,
+                                         hypre_ParPCGSubdomainDeflationUpdate,
+                                         hypre_ParPCGSubdomainDeflationDestroy );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRDiagScaleSetup
  *--------------------------------------------------------------------------*/
@@ -62,6 +62,8 @@ typedef struct
    HYPRE_Int      setup_type;
    HYPRE_Int      coarsen_type;
    HYPRE_Int      P_max_elmts;
+   HYPRE_Real     target_op_cmplxty;
+   HYPRE_Real     update_max_fraction;
    HYPRE_Int      interp_type;
    HYPRE_Int      sep_weight;
    HYPRE_Int      agg_interp_type;
@@ -101,9 +103,14 @@ typedef struct
    HYPRE_Real    *relax_weight;
    HYPRE_Real    *omega;
    HYPRE_Int      converge_type;
+   HYPRE_Int      conv_check_type;
+   HYPRE_Int      conv_check_freq;
    HYPRE_Real     tol;
    HYPRE_Int      partial_cycle_coarsest_level;
    HYPRE_Int      partial_cycle_control;
+   HYPRE_Int      float_halo_level;
+   HYPRE_Int     *float_halo_auto;   /* levels chosen for float_halo_level = -2 */
+   HYPRE_Real     float_halo_bytes;  /* bytes saved by this rank since setup */
 
 
    /* problem data */
@@ -127,6 +134,11 @@ typedef struct
    hypre_ParCSRMatrix **P_array;
    hypre_ParCSRMatrix **R_array;
    hypre_IntArray     **CF_marker_array;
+
+   /* transposes of P and their plans, kept by hypre_BoomerAMGSetupUpdate */
+   hypre_ParCSRMatrix        **update_PT_array;
+   hypre_ParCSRTransposePlan **update_PT_plans;
+
    hypre_IntArray     **dof_func_array;
    HYPRE_Int          **dof_point_array;
    HYPRE_Int          **point_dof_map_array;
@@ -196,6 +208,9 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_eig_reuse;
+   HYPRE_Int            cheby_num_eig_vecs;
+   hypre_ParVector    **cheby_eig_vecs;
 
    HYPRE_Real           cum_nnz_AP;
 
@@ -214,6 +229,12 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* If set, the work vectors above are lent by the pool while AMG is active
+      (setup or solve) and returned afterwards.  work_vectors records which
+      ones are needed (hypre_PAR_AMG_WORK_*). */
+   hypre_ParVectorPool *vector_pool;
+   HYPRE_Int          work_vectors;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -289,6 +310,8 @@ typedef struct
    HYPRE_Int rap2;
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
+   HYPRE_Int fused_rap;
+   HYPRE_Int fused_rap_working_set;
 
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
@@ -340,6 +363,8 @@ typedef struct
 #define hypre_ParAMGDataMeasureType(amg_data)          ((amg_data) -> measure_type)
 #define hypre_ParAMGDataSetupType(amg_data)            ((amg_data) -> setup_type)
 #define hypre_ParAMGDataPMaxElmts(amg_data)            ((amg_data) -> P_max_elmts)
+#define hypre_ParAMGDataTargetOpCmplxty(amg_data)      ((amg_data) -> target_op_cmplxty)
+#define hypre_ParAMGDataUpdateMaxFraction(amg_data)    ((amg_data) -> update_max_fraction)
 #define hypre_ParAMGDataAggPMaxElmts(amg_data)         ((amg_data) -> agg_P_max_elmts)
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
 #define hypre_ParAMGDataNumPaths(amg_data)             ((amg_data) -> num_paths)
@@ -365,9 +390,14 @@ typedef struct
 #define hypre_ParAMGDataFCycle(amg_data) ((amg_data)->fcycle)
 #define hypre_ParAMGDataCycleType(amg_data) ((amg_data)->cycle_type)
 #define hypre_ParAMGDataConvergeType(amg_data) ((amg_data)->converge_type)
+#define hypre_ParAMGDataConvCheckType(amg_data) ((amg_data)->conv_check_type)
+#define hypre_ParAMGDataConvCheckFreq(amg_data) ((amg_data)->conv_check_freq)
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
 #define hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) ((amg_data)->partial_cycle_coarsest_level)
 #define hypre_ParAMGDataPartialCycleControl(amg_data) ((amg_data)->partial_cycle_control)
+#define hypre_ParAMGDataFloatHaloLevel(amg_data) ((amg_data)->float_halo_level)
+#define hypre_ParAMGDataFloatHaloAuto(amg_data) ((amg_data)->float_halo_auto)
+#define hypre_ParAMGDataFloatHaloBytes(amg_data) ((amg_data)->float_halo_bytes)
 #define hypre_ParAMGDataNumGridSweeps(amg_data) ((amg_data)->num_grid_sweeps)
 #define hypre_ParAMGDataUserCoarseRelaxType(amg_data) ((amg_data)->user_coarse_relax_type)
 #define hypre_ParAMGDataUserRelaxType(amg_data) ((amg_data)->user_relax_type)
@@ -400,6 +430,8 @@ typedef struct
 #define hypre_ParAMGDataUArray(amg_data) ((amg_data)->U_array)
 #define hypre_ParAMGDataPArray(amg_data) ((amg_data)->P_array)
 #define hypre_ParAMGDataRArray(amg_data) ((amg_data)->R_array)
+#define hypre_ParAMGDataUpdatePTArray(amg_data) ((amg_data)->update_PT_array)
+#define hypre_ParAMGDataUpdatePTPlans(amg_data) ((amg_data)->update_PT_plans)
 #define hypre_ParAMGDataDofFuncArray(amg_data) ((amg_data)->dof_func_array)
 #define hypre_ParAMGDataDofPointArray(amg_data) ((amg_data)->dof_point_array)
 #define hypre_ParAMGDataPointDofMapArray(amg_data) \
@@ -460,6 +492,9 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyEigReuse(amg_data) ((amg_data)->cheby_eig_reuse)
+#define hypre_ParAMGDataChebyNumEigVecs(amg_data) ((amg_data)->cheby_num_eig_vecs)
+#define hypre_ParAMGDataChebyEigVecs(amg_data) ((amg_data)->cheby_eig_vecs)
 
 #define hypre_ParAMGDataCumNnzAP(amg_data)   ((amg_data)->cum_nnz_AP)
 
@@ -479,6 +514,13 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataVectorPool(amg_data) ((amg_data)->vector_pool)
+#define hypre_ParAMGDataWorkVectors(amg_data) ((amg_data)->work_vectors)
+
+#define hypre_PAR_AMG_WORK_VTEMP 1
+#define hypre_PAR_AMG_WORK_RTEMP 2
+#define hypre_PAR_AMG_WORK_PTEMP 4
+#define hypre_PAR_AMG_WORK_ZTEMP 8
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -560,6 +602,8 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataFusedRAP(amg_data) ((amg_data)->fused_rap)
+#define hypre_ParAMGDataFusedRAPWorkingSet(amg_data) ((amg_data)->fused_rap_working_set)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -962,6 +1006,10 @@ typedef struct
    /* AMG solvers for A_Pi{x,y,z} */
    HYPRE_Solver B_Pix, B_Piy, B_Piz;
 
+   /* Work vectors shared by the AMG subspace solvers, which are never active
+      at the same time */
+   hypre_ParVectorPool *vector_pool;
+
    /* Does the solver own the Nedelec interpolations? */
    HYPRE_Int owns_Pi;
    /* Does the solver own the coarse grid matrices? */
@@ -1024,6 +1072,11 @@ typedef struct
    /* Temporary vectors */
    hypre_ParVector *r0, *g0, *r1, *g1, *r2, *g2, *zz;
 
+   /* Run the additive subspace corrections concurrently (OpenMP team split),
+      accumulating them in the fine-level vectors zi before adding them up */
+   HYPRE_Int concurrent_corrections;
+   hypre_ParVector *zi[5];
+
    /* Output log info */
    HYPRE_Int num_iterations;
    HYPRE_Real rel_resid_norm;
@@ -1475,6 +1528,7 @@ HYPRE_Int hypre_ADSSetInterpolations ( void *solver, hypre_ParCSRMatrix *RT_Pi,
 HYPRE_Int hypre_ADSSetMaxIter ( void *solver, HYPRE_Int maxit );
 HYPRE_Int hypre_ADSSetTol ( void *solver, HYPRE_Real tol );
 HYPRE_Int hypre_ADSSetCycleType ( void *solver, HYPRE_Int cycle_type );
+HYPRE_Int hypre_ADSSetConcurrentCorrections ( void *solver, HYPRE_Int concurrent_corrections );
 HYPRE_Int hypre_ADSSetPrintLevel ( void *solver, HYPRE_Int print_level );
 HYPRE_Int hypre_ADSSetSmoothingOptions ( void *solver, HYPRE_Int A_relax_type,
                                          HYPRE_Int A_relax_times, HYPRE_Real A_relax_weight, HYPRE_Real A_omega );
@@ -1612,6 +1666,9 @@ hypre_ParVector *hypre_ParVectorInDomainOf ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_ParVectorBlockSplit ( hypre_ParVector *x, hypre_ParVector *x_ [3 ], HYPRE_Int dim );
 HYPRE_Int hypre_ParVectorBlockGather ( hypre_ParVector *x, hypre_ParVector *x_ [3 ],
                                        HYPRE_Int dim );
+hypre_ParVector *hypre_ParVectorBlockToMultiVector ( hypre_ParVector *x, hypre_ParCSRMatrix *A,
+                                                    HYPRE_Int dim );
+HYPRE_Int hypre_ParVectorBlockFromMultiVector ( hypre_ParVector *x, hypre_ParVector *x_ );
 HYPRE_Int hypre_BoomerAMGBlockSolve ( void *B, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                                       hypre_ParVector *x );
 HYPRE_Int hypre_ParCSRMatrixFixZeroRows ( hypre_ParCSRMatrix *A );
@@ -1635,6 +1692,7 @@ HYPRE_Int hypre_AMSSetProjectionFrequency ( void *solver, HYPRE_Int projection_f
 HYPRE_Int hypre_AMSSetMaxIter ( void *solver, HYPRE_Int maxit );
 HYPRE_Int hypre_AMSSetTol ( void *solver, HYPRE_Real tol );
 HYPRE_Int hypre_AMSSetCycleType ( void *solver, HYPRE_Int cycle_type );
+HYPRE_Int hypre_AMSSetConcurrentCorrections ( void *solver, HYPRE_Int concurrent_corrections );
 HYPRE_Int hypre_AMSSetPrintLevel ( void *solver, HYPRE_Int print_level );
 HYPRE_Int hypre_AMSSetSmoothingOptions ( void *solver, HYPRE_Int A_relax_type,
                                          HYPRE_Int A_relax_times, HYPRE_Real A_relax_weight, HYPRE_Real A_omega );
@@ -1659,12 +1717,15 @@ HYPRE_Int hypre_AMSSetup ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector
                            hypre_ParVector *x );
 HYPRE_Int hypre_AMSSolve ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
+hypre_ParVector **hypre_ParCSRSubspacePrecConcurrentVectors ( hypre_ParCSRMatrix *A0,
+                                                              hypre_ParCSRMatrix **A, char *cycle, hypre_ParVector **zi );
 HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0, HYPRE_Int A0_relax_type,
                                      HYPRE_Int A0_relax_times, HYPRE_Real *A0_l1_norms, HYPRE_Real A0_relax_weight, HYPRE_Real A0_omega,
                                      HYPRE_Real A0_max_eig_est, HYPRE_Real A0_min_eig_est, HYPRE_Int A0_cheby_order,
                                      HYPRE_Real A0_cheby_fraction, hypre_ParCSRMatrix **A, HYPRE_Solver *B, HYPRE_PtrToSolverFcn *HB,
                                      hypre_ParCSRMatrix **P, hypre_ParVector **r, hypre_ParVector **g, hypre_ParVector *x,
-                                     hypre_ParVector *y, hypre_ParVector *r0, hypre_ParVector *g0, char *cycle, hypre_ParVector *z );
+                                     hypre_ParVector *y, hypre_ParVector *r0, hypre_ParVector *g0, char *cycle, hypre_ParVector *z,
+                                     hypre_ParVector **zi );
 HYPRE_Int hypre_AMSGetNumIterations ( void *solver, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_AMSGetFinalRelativeResidualNorm ( void *solver, HYPRE_Real *rel_resid_norm );
 HYPRE_Int hypre_AMSProjectOutGradients ( void *solver, hypre_ParVector *x );
@@ -1756,6 +1817,8 @@ HYPRE_Int HYPRE_ADSSetInterpolations ( HYPRE_Solver solver, HYPRE_ParCSRMatrix R
 HYPRE_Int HYPRE_ADSSetMaxIter ( HYPRE_Solver solver, HYPRE_Int maxit );
 HYPRE_Int HYPRE_ADSSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ADSSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
+HYPRE_Int HYPRE_ADSSetConcurrentCorrections ( HYPRE_Solver solver,
+                                             HYPRE_Int concurrent_corrections );
 HYPRE_Int HYPRE_ADSSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int print_level );
 HYPRE_Int HYPRE_ADSSetSmoothingOptions ( HYPRE_Solver solver, HYPRE_Int relax_type,
                                          HYPRE_Int relax_times, HYPRE_Real relax_weight, HYPRE_Real omega );
@@ -1808,6 +1871,8 @@ HYPRE_Int HYPRE_AMSSetProjectionFrequency ( HYPRE_Solver solver, HYPRE_Int proje
 HYPRE_Int HYPRE_AMSSetMaxIter ( HYPRE_Solver solver, HYPRE_Int maxit );
 HYPRE_Int HYPRE_AMSSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_AMSSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
+HYPRE_Int HYPRE_AMSSetConcurrentCorrections ( HYPRE_Solver solver,
+                                             HYPRE_Int concurrent_corrections );
 HYPRE_Int HYPRE_AMSSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int print_level );
 HYPRE_Int HYPRE_AMSSetSmoothingOptions ( HYPRE_Solver solver, HYPRE_Int relax_type,
                                          HYPRE_Int relax_times, HYPRE_Real relax_weight, HYPRE_Real omega );
@@ -1838,10 +1903,15 @@ HYPRE_Int HYPRE_BoomerAMGCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_BoomerAMGDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                  HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGSetupUpdate ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                       HYPRE_ParVector b, HYPRE_ParVector x, HYPRE_Int num_rows,
+                                       HYPRE_BigInt *rows );
 HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                   HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGBlockSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
+                                      HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSetRestriction ( HYPRE_Solver solver, HYPRE_Int restr_par );
 HYPRE_Int HYPRE_BoomerAMGSetIsTriangular ( HYPRE_Solver solver, HYPRE_Int is_triangular );
 HYPRE_Int HYPRE_BoomerAMGSetGMRESSwitchR ( HYPRE_Solver solver, HYPRE_Int gmres_switch );
@@ -1871,6 +1941,13 @@ HYPRE_Int HYPRE_BoomerAMGSetTruncFactor ( HYPRE_Solver solver, HYPRE_Real trunc_
 HYPRE_Int HYPRE_BoomerAMGGetTruncFactor ( HYPRE_Solver solver, HYPRE_Real *trunc_factor );
 HYPRE_Int HYPRE_BoomerAMGSetPMaxElmts ( HYPRE_Solver solver, HYPRE_Int P_max_elmts );
 HYPRE_Int HYPRE_BoomerAMGGetPMaxElmts ( HYPRE_Solver solver, HYPRE_Int *P_max_elmts );
+HYPRE_Int HYPRE_BoomerAMGSetTargetOpCmplxty ( HYPRE_Solver solver, HYPRE_Real target_op_cmplxty );
+HYPRE_Int HYPRE_BoomerAMGGetTargetOpCmplxty ( HYPRE_Solver solver,
+                                              HYPRE_Real *target_op_cmplxty );
+HYPRE_Int HYPRE_BoomerAMGSetUpdateMaxFraction ( HYPRE_Solver solver,
+                                                HYPRE_Real update_max_fraction );
+HYPRE_Int HYPRE_BoomerAMGGetUpdateMaxFraction ( HYPRE_Solver solver,
+                                                HYPRE_Real *update_max_fraction );
 HYPRE_Int HYPRE_BoomerAMGSetJacobiTruncThreshold ( HYPRE_Solver solver,
                                                    HYPRE_Real jacobi_trunc_threshold );
 HYPRE_Int HYPRE_BoomerAMGGetJacobiTruncThreshold ( HYPRE_Solver solver,
@@ -1895,8 +1972,15 @@ HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_typ
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver, HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType ( HYPRE_Solver solver, HYPRE_Int type );
 HYPRE_Int HYPRE_BoomerAMGGetConvergeType ( HYPRE_Solver solver, HYPRE_Int *type );
+HYPRE_Int HYPRE_BoomerAMGSetConvCheckType ( HYPRE_Solver solver, HYPRE_Int type );
+HYPRE_Int HYPRE_BoomerAMGGetConvCheckType ( HYPRE_Solver solver, HYPRE_Int *type );
+HYPRE_Int HYPRE_BoomerAMGSetConvCheckFreq ( HYPRE_Solver solver, HYPRE_Int freq );
+HYPRE_Int HYPRE_BoomerAMGGetConvCheckFreq ( HYPRE_Solver solver, HYPRE_Int *freq );
 HYPRE_Int HYPRE_BoomerAMGSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_BoomerAMGGetTol ( HYPRE_Solver solver, HYPRE_Real *tol );
+HYPRE_Int HYPRE_BoomerAMGSetFloatHaloLevel ( HYPRE_Solver solver, HYPRE_Int float_halo_level );
+HYPRE_Int HYPRE_BoomerAMGGetFloatHaloLevel ( HYPRE_Solver solver, HYPRE_Int *float_halo_level );
+HYPRE_Int HYPRE_BoomerAMGGetFloatHaloBytesSaved ( HYPRE_Solver solver, HYPRE_Real *bytes_saved );
 HYPRE_Int HYPRE_BoomerAMGSetNumGridSweeps ( HYPRE_Solver solver, HYPRE_Int *num_grid_sweeps );
 HYPRE_Int HYPRE_BoomerAMGSetNumSweeps ( HYPRE_Solver solver, HYPRE_Int num_sweeps );
 HYPRE_Int HYPRE_BoomerAMGSetCycleNumSweeps ( HYPRE_Solver solver, HYPRE_Int num_sweeps,
@@ -2021,6 +2105,7 @@ HYPRE_Int HYPRE_BoomerAMGGetGridHierarchy(HYPRE_Solver solver, HYPRE_Int *cgrid
 HYPRE_Int HYPRE_BoomerAMGSetChebyOrder ( HYPRE_Solver solver, HYPRE_Int order );
 HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver, HYPRE_Real ratio );
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver, HYPRE_Int eig_est );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigReuse ( HYPRE_Solver solver, HYPRE_Int eig_reuse );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver, HYPRE_Int scale );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver, HYPRE_Int num_vectors,
@@ -2047,6 +2132,8 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetFusedRAP ( HYPRE_Solver solver, HYPRE_Int fused_rap );
+HYPRE_Int HYPRE_BoomerAMGSetFusedRAPWorkingSet ( HYPRE_Solver solver, HYPRE_Int working_set );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -2426,6 +2513,9 @@ HYPRE_Int HYPRE_ParCSRPCGSetLogging ( HYPRE_Solver solver, HYPRE_Int level );
 HYPRE_Int HYPRE_ParCSRPCGGetNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
 HYPRE_Int HYPRE_ParCSRPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
 HYPRE_Int HYPRE_ParCSRPCGGetResidual ( HYPRE_Solver solver, HYPRE_ParVector *residual );
+HYPRE_Int HYPRE_ParCSRPCGSetDeflationBasis ( HYPRE_Solver solver, HYPRE_ParVector Z );
+HYPRE_Int HYPRE_ParCSRPCGSetDeflationSubdomains ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                                  HYPRE_Int num_subdomains );
 HYPRE_Int HYPRE_ParCSRDiagScaleSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector y,
                                        HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRDiagScale ( HYPRE_Solver solver, HYPRE_ParCSRMatrix HA, HYPRE_ParVector Hy,
@@ -2498,6 +2588,10 @@ HYPRE_Int hypre_BoomerAMGSetTruncFactor ( void *data, HYPRE_Real trunc_factor );
 HYPRE_Int hypre_BoomerAMGGetTruncFactor ( void *data, HYPRE_Real *trunc_factor );
 HYPRE_Int hypre_BoomerAMGSetPMaxElmts ( void *data, HYPRE_Int P_max_elmts );
 HYPRE_Int hypre_BoomerAMGGetPMaxElmts ( void *data, HYPRE_Int *P_max_elmts );
+HYPRE_Int hypre_BoomerAMGSetTargetOpCmplxty ( void *data, HYPRE_Real target_op_cmplxty );
+HYPRE_Int hypre_BoomerAMGGetTargetOpCmplxty ( void *data, HYPRE_Real *target_op_cmplxty );
+HYPRE_Int hypre_BoomerAMGSetUpdateMaxFraction ( void *data, HYPRE_Real update_max_fraction );
+HYPRE_Int hypre_BoomerAMGGetUpdateMaxFraction ( void *data, HYPRE_Real *update_max_fraction );
 HYPRE_Int hypre_BoomerAMGSetJacobiTruncThreshold ( void *data, HYPRE_Real jacobi_trunc_threshold );
 HYPRE_Int hypre_BoomerAMGGetJacobiTruncThreshold ( void *data, HYPRE_Real *jacobi_trunc_threshold );
 HYPRE_Int hypre_BoomerAMGSetPostInterpType ( void *data, HYPRE_Int post_interp_type );
@@ -2521,8 +2615,15 @@ HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data, HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data, HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetConvergeType ( void *data, HYPRE_Int type );
 HYPRE_Int hypre_BoomerAMGGetConvergeType ( void *data, HYPRE_Int *type );
+HYPRE_Int hypre_BoomerAMGSetConvCheckType ( void *data, HYPRE_Int type );
+HYPRE_Int hypre_BoomerAMGGetConvCheckType ( void *data, HYPRE_Int *type );
+HYPRE_Int hypre_BoomerAMGSetConvCheckFreq ( void *data, HYPRE_Int freq );
+HYPRE_Int hypre_BoomerAMGGetConvCheckFreq ( void *data, HYPRE_Int *freq );
 HYPRE_Int hypre_BoomerAMGSetTol ( void *data, HYPRE_Real tol );
 HYPRE_Int hypre_BoomerAMGGetTol ( void *data, HYPRE_Real *tol );
+HYPRE_Int hypre_BoomerAMGSetFloatHaloLevel ( void *data, HYPRE_Int float_halo_level );
+HYPRE_Int hypre_BoomerAMGGetFloatHaloLevel ( void *data, HYPRE_Int *float_halo_level );
+HYPRE_Int hypre_BoomerAMGGetFloatHaloBytesSaved ( void *data, HYPRE_Real *bytes_saved );
 HYPRE_Int hypre_BoomerAMGSetNumSweeps ( void *data, HYPRE_Int num_sweeps );
 HYPRE_Int hypre_BoomerAMGSetCycleNumSweeps ( void *data, HYPRE_Int num_sweeps, HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGGetCycleNumSweeps ( void *data, HYPRE_Int *num_sweeps, HYPRE_Int k );
@@ -2649,6 +2750,7 @@ HYPRE_Int hypre_BoomerAMGSetFSAIKapTolerance ( void *data, HYPRE_Real fsai_kap_t
 HYPRE_Int hypre_BoomerAMGSetChebyOrder ( void *data, HYPRE_Int order );
 HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
+HYPRE_Int hypre_BoomerAMGSetChebyEigReuse ( void *data, HYPRE_Int cheby_eig_reuse );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data, HYPRE_Int scale );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver, HYPRE_Int num_vectors,
@@ -2674,6 +2776,8 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetFusedRAP ( void *data, HYPRE_Int fused_rap );
+HYPRE_Int hypre_BoomerAMGSetFusedRAPWorkingSet ( void *data, HYPRE_Int working_set );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -2683,12 +2787,26 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
                                      HYPRE_BigInt *indices );
 HYPRE_Int hypre_BoomerAMGSetCumNnzAP ( void *data, HYPRE_Real cum_nnz_AP );
 HYPRE_Int hypre_BoomerAMGGetCumNnzAP ( void *data, HYPRE_Real *cum_nnz_AP );
+HYPRE_Int hypre_BoomerAMGSetVectorPool ( void *data, hypre_ParVectorPool *pool );
+HYPRE_Int hypre_BoomerAMGAcquireWorkVectors ( void *data, HYPRE_Int num_vectors,
+                                              HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_BoomerAMGReleaseWorkVectors ( void *data );
 
 /* par_amg_setup.c */
+HYPRE_Int hypre_BoomerAMGRelaxL1NormOption ( HYPRE_Int *grid_relax_type, HYPRE_Int level,
+                                             HYPRE_Int num_levels );
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
 
+/* par_amg_update.c */
+HYPRE_Int hypre_BoomerAMGSetupUpdate ( void *amg_vdata, hypre_ParCSRMatrix *A,
+                                       hypre_ParVector *f, hypre_ParVector *u,
+                                       HYPRE_Int num_rows, HYPRE_BigInt *rows );
+HYPRE_Int hypre_BoomerAMGUpdateDestroyTransposes ( void *amg_vdata );
+
 /* par_amg_solve.c */
+HYPRE_Int hypre_BoomerAMGMultiVecCycleSupported ( void *amg_vdata,
+                                                  HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
 
@@ -3090,40 +3208,11 @@ HYPRE_Int hypre_BoomerAMGCreateScalarCF ( HYPRE_Int *CFN_marker, HYPRE_Int num_f
                                           HYPRE_Int num_nodes, hypre_IntArray **dof_func_ptr, hypre_IntArray **CF_marker_ptr );
 
 /* par_nongalerkin.c */
-HYPRE_Int hypre_GrabSubArray ( HYPRE_Int *indices, HYPRE_Int start, HYPRE_Int end,
-                               HYPRE_BigInt *array, HYPRE_BigInt *output );
-HYPRE_Int hypre_IntersectTwoArrays ( HYPRE_Int *x, HYPRE_Real *x_data, HYPRE_Int x_length,
-                                     HYPRE_Int *y, HYPRE_Int y_length, HYPRE_Int *z, HYPRE_Real *output_x_data,
-                                     HYPRE_Int *intersect_length );
-HYPRE_Int hypre_IntersectTwoBigArrays ( HYPRE_BigInt *x, HYPRE_Real *x_data, HYPRE_Int x_length,
-                                        HYPRE_BigInt *y, HYPRE_Int y_length, HYPRE_BigInt *z, HYPRE_Real *output_x_data,
-                                        HYPRE_Int *intersect_length );
-HYPRE_Int hypre_SortedCopyParCSRData ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B );
 HYPRE_Int hypre_BoomerAMG_MyCreateS ( hypre_ParCSRMatrix *A, HYPRE_Real strength_threshold,
                                       HYPRE_Real max_row_sum, HYPRE_Int num_functions, HYPRE_Int *dof_func, hypre_ParCSRMatrix **S_ptr );
 HYPRE_Int hypre_BoomerAMGCreateSFromCFMarker(hypre_ParCSRMatrix    *A,
                                              HYPRE_Real strength_threshold, HYPRE_Real max_row_sum, HYPRE_Int *CF_marker,
                                              HYPRE_Int num_functions, HYPRE_Int *dof_func, HYPRE_Int SMRK, hypre_ParCSRMatrix    **S_ptr);
-HYPRE_Int hypre_NonGalerkinIJBufferInit ( HYPRE_Int *ijbuf_cnt, HYPRE_Int *ijbuf_rowcounter,
-                                          HYPRE_Int *ijbuf_numcols );
-HYPRE_Int hypre_NonGalerkinIJBigBufferInit ( HYPRE_Int *ijbuf_cnt, HYPRE_Int *ijbuf_rowcounter,
-                                             HYPRE_BigInt *ijbuf_numcols );
-HYPRE_Int hypre_NonGalerkinIJBufferNewRow ( HYPRE_BigInt *ijbuf_rownums, HYPRE_Int *ijbuf_numcols,
-                                            HYPRE_Int *ijbuf_rowcounter, HYPRE_BigInt new_row );
-HYPRE_Int hypre_NonGalerkinIJBufferCompressRow ( HYPRE_Int *ijbuf_cnt, HYPRE_Int ijbuf_rowcounter,
-                                                 HYPRE_Real *ijbuf_data, HYPRE_BigInt *ijbuf_cols, HYPRE_BigInt *ijbuf_rownums,
-                                                 HYPRE_Int *ijbuf_numcols );
-HYPRE_Int hypre_NonGalerkinIJBufferCompress ( HYPRE_MemoryLocation memory_location,
-                                              HYPRE_Int ijbuf_size, HYPRE_Int *ijbuf_cnt,
-                                              HYPRE_Int *ijbuf_rowcounter, HYPRE_Real **ijbuf_data, HYPRE_BigInt **ijbuf_cols,
-                                              HYPRE_BigInt **ijbuf_rownums, HYPRE_Int **ijbuf_numcols );
-HYPRE_Int hypre_NonGalerkinIJBufferWrite ( HYPRE_IJMatrix B, HYPRE_Int *ijbuf_cnt,
-                                           HYPRE_Int ijbuf_size, HYPRE_Int *ijbuf_rowcounter, HYPRE_Real **ijbuf_data,
-                                           HYPRE_BigInt **ijbuf_cols, HYPRE_BigInt **ijbuf_rownums, HYPRE_Int **ijbuf_numcols,
-                                           HYPRE_BigInt row_to_write, HYPRE_BigInt col_to_write, HYPRE_Real val_to_write );
-HYPRE_Int hypre_NonGalerkinIJBufferEmpty ( HYPRE_IJMatrix B, HYPRE_Int ijbuf_size,
-                                           HYPRE_Int *ijbuf_cnt, HYPRE_Int ijbuf_rowcounter, HYPRE_Real **ijbuf_data,
-                                           HYPRE_BigInt **ijbuf_cols, HYPRE_BigInt **ijbuf_rownums, HYPRE_Int **ijbuf_numcols );
 hypre_ParCSRMatrix * hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
                                                       hypre_ParCSRMatrix *RAP, HYPRE_Int * CF_marker, HYPRE_Real droptol, HYPRE_Int sym_collapse,
                                                       HYPRE_Int collapse_beta );
@@ -3132,11 +3221,23 @@ HYPRE_Int hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RA
                                                          HYPRE_Int num_functions, HYPRE_Int * dof_func_value, HYPRE_Int * CF_marker, HYPRE_Real droptol,
                                                          HYPRE_Int sym_collapse, HYPRE_Real lump_percent, HYPRE_Int collapse_beta );
 
+/* par_pcg_deflation.c */
+void *hypre_ParPCGSubdomainDeflationCreate ( MPI_Comm comm, HYPRE_Int num_subdomains );
+HYPRE_Int hypre_ParPCGSubdomainDeflationDestroy ( void *data );
+HYPRE_Int hypre_ParPCGSubdomainDeflationSetup ( void *data, void *A_vdata, HYPRE_Real *E );
+HYPRE_Int hypre_ParPCGSubdomainDeflationDotpTwo ( void *data, void *r_vdata, void *z_vdata,
+                                                  HYPRE_Real *mu_r, HYPRE_Real *mu_z );
+HYPRE_Int hypre_ParPCGSubdomainDeflationUpdate ( void *data, HYPRE_Real *mu_r, HYPRE_Real *mu_z,
+                                                 void *x_vdata, void *r_vdata, void *z_vdata );
+
 /* par_rap.c */
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
                                                hypre_ParCSRMatrix *P, hypre_ParCSRMatrix **RAP_ptr );
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorKT ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
                                                  hypre_ParCSRMatrix *P, HYPRE_Int keepTranspose, hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorAdaptive ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                                       HYPRE_Int keepTranspose, HYPRE_Int modularized, HYPRE_Real max_growth,
+                                                       HYPRE_Real trunc_factor, HYPRE_Int P_max_elmts, hypre_ParCSRMatrix **RAP_ptr );
 
 /* par_rap_communication.c */
 HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
@@ -3276,6 +3377,10 @@ HYPRE_Int hypre_ParCSRMaxEigEstimateCG ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                          HYPRE_Real *max_eig, HYPRE_Real *min_eig );
 HYPRE_Int hypre_ParCSRMaxEigEstimateCGHost ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                              HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_ParCSRMaxEigEstimateCGLevels ( HYPRE_Int num_levels, hypre_ParCSRMatrix **A_array,
+                                               HYPRE_Int *active, HYPRE_Int scale, HYPRE_Int max_iter,
+                                               hypre_ParVector **start, HYPRE_Real *max_eig,
+                                               HYPRE_Real *min_eig );
 HYPRE_Int hypre_ParCSRRelax_Cheby ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Real max_eig,
                                     HYPRE_Real min_eig, HYPRE_Real fraction, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                     hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r );
@@ -3327,6 +3432,7 @@ HYPRE_Int hypre_SchwarzSetDofFunc ( void *data, HYPRE_Int *dof_func );
 
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata, hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGThreadingStats ( void *amg_vdata, HYPRE_Int num_reps );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
 const char* hypre_BoomerAMGGetProlongationName( hypre_ParAMGData *amg_data );
 const char* hypre_BoomerAMGGetAggProlongationName( hypre_ParAMGData *amg_data );
@@ -3563,9 +3669,12 @@ void *hypre_MGRCreateFrelaxVcycleData( void );
 HYPRE_Int hypre_MGRDestroyFrelaxVcycleData( void *mgr_vdata );
 void *hypre_MGRCreateGSElimData( void );
 HYPRE_Int hypre_MGRDestroyGSElimData( void *mgr_vdata );
+HYPRE_Int hypre_MGRDestroyReuseData( void *mgr_vdata );
 HYPRE_Int hypre_MGRSetupFrelaxVcycleData( void *mgr_vdata, hypre_ParCSRMatrix *A,
                                           hypre_ParVector *f, hypre_ParVector *u,
                                           HYPRE_Int level );
+HYPRE_Int hypre_MGRReuseCommPkg( hypre_ParCSRMatrix *A, hypre_ParCSRCommPkg **comm_pkg_ptr,
+                                 HYPRE_Int *num_cols_offd_ptr, HYPRE_BigInt **col_map_offd_ptr );
 HYPRE_Int hypre_MGRFrelaxVcycle ( void *mgr_vdata, hypre_ParVector *f, hypre_ParVector *u );
 HYPRE_Int hypre_MGRSetCpointsByBlock( void *mgr_vdata, HYPRE_Int  block_size,
                                       HYPRE_Int  max_num_levels,
@@ -3686,6 +3795,7 @@ HYPRE_Int hypre_MGRSetPrintLevel( void *mgr_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_MGRSetFrelaxPrintLevel( void *mgr_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_MGRSetCoarseGridPrintLevel( void *mgr_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_MGRSetTruncateCoarseGridThreshold( void *mgr_vdata, HYPRE_Real threshold );
+HYPRE_Int hypre_MGRSetReuse( void *mgr_vdata, HYPRE_Int reuse );
 HYPRE_Int hypre_MGRSetBlockJacobiBlockSize( void *mgr_vdata, HYPRE_Int blk_size );
 HYPRE_Int hypre_MGRSetLogging( void *mgr_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_MGRSetMaxIter( void *mgr_vdata, HYPRE_Int max_iter );
@@ -4204,6 +4314,8 @@ hypre_AMGDDCompGridMatrix* hypre_AMGDDCompGridMatrixCreate( void );
 HYPRE_Int hypre_AMGDDCompGridMatrixDestroy ( hypre_AMGDDCompGridMatrix *matrix );
 HYPRE_Int hypre_AMGDDCompGridMatvec ( HYPRE_Complex alpha, hypre_AMGDDCompGridMatrix *A,
                                       hypre_AMGDDCompGridVector *x, HYPRE_Complex beta, hypre_AMGDDCompGridVector *y );
+HYPRE_Int hypre_AMGDDCompGridMatvecT ( HYPRE_Complex alpha, hypre_AMGDDCompGridMatrix *A,
+                                       hypre_AMGDDCompGridVector *x, HYPRE_Complex beta, hypre_AMGDDCompGridVector *y );
 HYPRE_Int hypre_AMGDDCompGridRealMatvec ( HYPRE_Complex alpha, hypre_AMGDDCompGridMatrix *A,
                                           hypre_AMGDDCompGridVector *x, HYPRE_Complex beta, hypre_AMGDDCompGridVector *y );
 hypre_AMGDDCompGridVector* hypre_AMGDDCompGridVectorCreate( void );
@@ -55,6 +55,7 @@ void * hypre_ADSCreate(void)
    ads_data -> tol = 1e-6;             /* convergence tolerance */
    ads_data -> print_level = 1;        /* print residual norm at each step */
    ads_data -> cycle_type = 1;         /* a 3-level multiplicative solver */
+   ads_data -> concurrent_corrections = 0; /* sequential subspace corrections */
    ads_data -> A_relax_type = 2;       /* offd-l1-scaled GS */
    ads_data -> A_relax_times = 1;      /* one relaxation sweep */
    ads_data -> A_relax_weight = 1.0;   /* damping parameter */
@@ -130,6 +131,7 @@ void * hypre_ADSCreate(void)
 HYPRE_Int hypre_ADSDestroy(void *solver)
 {
    hypre_ADSData *ads_data = (hypre_ADSData *) solver;
+   HYPRE_Int i;
 
    if (!ads_data)
    {
@@ -224,6 +226,10 @@ HYPRE_Int hypre_ADSDestroy(void *solver)
    {
       hypre_ParVectorDestroy(ads_data -> zz);
    }
+   for (i = 0; i < 5; i++)
+   {
+      hypre_ParVectorDestroy(ads_data -> zi[i]);
+   }
 
    hypre_SeqVectorDestroy(ads_data -> A_l1_norms);
 
@@ -405,6 +411,29 @@ HYPRE_Int hypre_ADSSetCycleType(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ADSSetConcurrentCorrections
+ *
+ * If concurrent_corrections is nonzero, the subspace corrections that follow
+ * the residual computation of an additive cycle (e.g., 1 and 2 in (0+1+2))
+ * are applied concurrently with the rest of the group, each on its share of
+ * the OpenMP threads, and are then added to the solution in the order of the
+ * cycle.  The iteration is mathematically unchanged, although smoothers
+ * whose results depend on the number of threads may round differently.  This
+ * requires one additional fine-level vector per concurrent correction and is
+ * only used on a single MPI task, with host memory, more than one thread and
+ * MPI_THREAD_MULTIPLE support.
+ * The default value is 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ADSSetConcurrentCorrections(void *solver,
+                                            HYPRE_Int concurrent_corrections)
+{
+   hypre_ADSData *ads_data = (hypre_ADSData *) solver;
+   ads_data -> concurrent_corrections = concurrent_corrections;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ADSSetPrintLevel
  *
@@ -1496,6 +1525,7 @@ HYPRE_Int hypre_ADSSolve(void *solver,
    HYPRE_Solver Bi[5];
    HYPRE_PtrToSolverFcn HBi[5];
    hypre_ParVector *ri[5], *gi[5];
+   hypre_ParVector **zi = NULL;
    HYPRE_Int needZ = 0;
 
    hypre_ParVector *z = ads_data -> zz;
@@ -1606,6 +1636,11 @@ HYPRE_Int hypre_ADSSolve(void *solver,
          break;
    }
 
+   if (ads_data -> concurrent_corrections)
+   {
+      zi = hypre_ParCSRSubspacePrecConcurrentVectors(A, Ai, cycle, ads_data -> zi);
+   }
+
    for (i = 0; i < ads_data -> maxit; i++)
    {
       /* Compute initial residual norms */
@@ -1650,7 +1685,7 @@ HYPRE_Int hypre_ADSSolve(void *solver,
                                ads_data -> r0,
                                ads_data -> g0,
                                cycle,
-                               z);
+                               z, zi);
 
       /* Compute new residual norms */
       if (ads_data -> maxit > 1)
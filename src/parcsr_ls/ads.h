@@ -84,6 +84,11 @@ typedef struct
    /* Temporary vectors */
    hypre_ParVector *r0, *g0, *r1, *g1, *r2, *g2, *zz;
 
+   /* Run the additive subspace corrections concurrently (OpenMP team split),
+      accumulating them in the fine-level vectors zi before adding them up */
+   HYPRE_Int concurrent_corrections;
+   hypre_ParVector *zi[5];
+
    /* Output log info */
    HYPRE_Int num_iterations;
    HYPRE_Real rel_resid_norm;
@@ -254,12 +254,86 @@ hypre_ParVectorBlockGather(hypre_ParVector *x,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockToMultiVector
+ *
+ * Return a dim-component multivector in the range of A with column-wise
+ * storage, holding a copy of the parallel block vector x, i.e., component d
+ * of row i is x[dim*i+d]. Host memory only.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVector *
+hypre_ParVectorBlockToMultiVector(hypre_ParVector *x,
+                                  hypre_ParCSRMatrix *A,
+                                  HYPRE_Int dim)
+{
+   hypre_ParVector *x_;
+   HYPRE_Int        i, d, size_;
+   HYPRE_Real      *x_data, *x_data_;
+
+   x_ = hypre_ParMultiVectorCreate(hypre_ParCSRMatrixComm(A),
+                                   hypre_ParCSRMatrixGlobalNumRows(A),
+                                   hypre_ParCSRMatrixRowStarts(A),
+                                   dim);
+   hypre_ParVectorInitialize_v2(x_, HYPRE_MEMORY_HOST);
+
+   size_   = hypre_VectorSize(hypre_ParVectorLocalVector(x_));
+   x_data  = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   x_data_ = hypre_VectorData(hypre_ParVectorLocalVector(x_));
+
+   for (d = 0; d < dim; d++)
+   {
+      for (i = 0; i < size_; i++)
+      {
+         x_data_[d * size_ + i] = x_data[dim * i + d];
+      }
+   }
+
+   return x_;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockFromMultiVector
+ *
+ * Copy the column-wise multivector x_ back into the parallel block vector x
+ * (the inverse of hypre_ParVectorBlockToMultiVector). Host memory only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockFromMultiVector(hypre_ParVector *x,
+                                    hypre_ParVector *x_)
+{
+   HYPRE_Int   i, d, size_;
+   HYPRE_Int   dim = hypre_ParVectorNumVectors(x_);
+   HYPRE_Real *x_data, *x_data_;
+
+   size_   = hypre_VectorSize(hypre_ParVectorLocalVector(x_));
+   x_data  = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   x_data_ = hypre_VectorData(hypre_ParVectorLocalVector(x_));
+
+   for (i = 0; i < size_; i++)
+   {
+      for (d = 0; d < dim; d++)
+      {
+         x_data[dim * i + d] = x_data_[d * size_ + i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGBlockSolve
  *
  * Apply the block-diagonal solver diag(B) to the system diag(A) x = b.
  * Here B is a given BoomerAMG solver for A, while x and b are "block"
  * parallel vectors.
+ *
+ * When B runs a fixed number of cycles that support it, all components are
+ * copied into multivectors and cycled together through the shared
+ * hierarchy, so that each matrix is streamed once per cycle instead of once
+ * per component. Otherwise, the components are split and solved one at a
+ * time, each with its own convergence test.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_BoomerAMGBlockSolve(void *B,
@@ -280,6 +354,27 @@ HYPRE_Int hypre_BoomerAMGBlockSolve(void *B,
       return hypre_error_flag;
    }
 
+   if (hypre_BoomerAMGMultiVecCycleSupported(B, hypre_ParVectorMemoryLocation(x)))
+   {
+      b_[0] = hypre_ParVectorBlockToMultiVector(b, A, dim);
+      x_[0] = hypre_ParVectorBlockToMultiVector(x, A, dim);
+
+      hypre_BoomerAMGSolve(B, A, b_[0], x_[0]);
+
+      hypre_ParVectorBlockFromMultiVector(x, x_[0]);
+      hypre_ParVectorDestroy(b_[0]);
+      hypre_ParVectorDestroy(x_[0]);
+
+      return hypre_error_flag;
+   }
+
+   if (dim > 3)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "More than 3 components require a fixed number of multivector cycles");
+      return hypre_error_flag;
+   }
+
    for (d = 0; d < dim; d++)
    {
       b_[d] = hypre_ParVectorInRangeOf(A);
@@ -905,6 +1000,7 @@ void * hypre_AMSCreate(void)
    ams_data -> tol = 1e-6;             /* convergence tolerance */
    ams_data -> print_level = 1;        /* print residual norm at each step */
    ams_data -> cycle_type = 1;         /* a 3-level multiplicative solver */
+   ams_data -> concurrent_corrections = 0; /* sequential subspace corrections */
    ams_data -> A_relax_type = 2;       /* offd-l1-scaled GS */
    ams_data -> A_relax_times = 1;      /* one relaxation sweep */
    ams_data -> A_relax_weight = 1.0;   /* damping parameter */
@@ -963,6 +1059,7 @@ void * hypre_AMSCreate(void)
    ams_data -> B_Pix  = 0;
    ams_data -> B_Piy  = 0;
    ams_data -> B_Piz  = 0;
+   ams_data -> vector_pool = NULL;
 
    ams_data -> interior_nodes       = NULL;
    ams_data -> G0                   = NULL;
@@ -991,6 +1088,7 @@ void * hypre_AMSCreate(void)
 HYPRE_Int hypre_AMSDestroy(void *solver)
 {
    hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   HYPRE_Int i;
 
    if (!ams_data)
    {
@@ -1088,6 +1186,10 @@ HYPRE_Int hypre_AMSDestroy(void *solver)
    {
       hypre_ParVectorDestroy(ams_data -> zz);
    }
+   for (i = 0; i < 5; i++)
+   {
+      hypre_ParVectorDestroy(ams_data -> zi[i]);
+   }
 
    if (ams_data -> G0)
    {
@@ -1108,6 +1210,9 @@ HYPRE_Int hypre_AMSDestroy(void *solver)
 
    hypre_SeqVectorDestroy(ams_data -> A_l1_norms);
 
+   /* after the AMG solvers that borrow from it */
+   hypre_ParVectorPoolDestroy(ams_data -> vector_pool);
+
    /* G, x, y ,z, Gx, Gy and Gz are not destroyed */
 
    if (ams_data)
@@ -1398,6 +1503,29 @@ HYPRE_Int hypre_AMSSetCycleType(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetConcurrentCorrections
+ *
+ * If concurrent_corrections is nonzero, the subspace corrections that follow
+ * the residual computation of an additive cycle (e.g., 1 and 2 in (0+1+2))
+ * are applied concurrently with the rest of the group, each on its share of
+ * the OpenMP threads, and are then added to the solution in the order of the
+ * cycle.  The iteration is mathematically unchanged, although smoothers
+ * whose results depend on the number of threads may round differently.  This
+ * requires one additional fine-level vector per concurrent correction and is
+ * only used on a single MPI task, with host memory, more than one thread and
+ * MPI_THREAD_MULTIPLE support.
+ * The default value is 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetConcurrentCorrections(void *solver,
+                                            HYPRE_Int concurrent_corrections)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   ams_data -> concurrent_corrections = concurrent_corrections;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSSetPrintLevel
  *
@@ -2942,6 +3070,11 @@ hypre_AMSSetup(void *solver,
 
    ams_data -> A = A;
 
+   if (!ams_data -> vector_pool)
+   {
+      ams_data -> vector_pool = hypre_ParVectorPoolCreate();
+   }
+
    /* Modifications for problems with zero-conductivity regions */
    if (ams_data -> interior_nodes)
    {
@@ -3013,6 +3146,7 @@ hypre_AMSSetup(void *solver,
 
       /* Create AMG solver for A_G0 */
       HYPRE_BoomerAMGCreate(&ams_data -> B_G0);
+      hypre_BoomerAMGSetVectorPool(ams_data -> B_G0, ams_data -> vector_pool);
       HYPRE_BoomerAMGSetCoarsenType(ams_data -> B_G0, ams_data -> B_G_coarsen_type);
       HYPRE_BoomerAMGSetAggNumLevels(ams_data -> B_G0, ams_data -> B_G_agg_levels);
       HYPRE_BoomerAMGSetRelaxType(ams_data -> B_G0, ams_data -> B_G_relax_type);
@@ -3305,6 +3439,7 @@ hypre_AMSSetup(void *solver,
    if (!ams_data -> beta_is_zero && ams_data -> cycle_type != 20)
    {
       HYPRE_BoomerAMGCreate(&ams_data -> B_G);
+      hypre_BoomerAMGSetVectorPool(ams_data -> B_G, ams_data -> vector_pool);
       HYPRE_BoomerAMGSetCoarsenType(ams_data -> B_G, ams_data -> B_G_coarsen_type);
       HYPRE_BoomerAMGSetAggNumLevels(ams_data -> B_G, ams_data -> B_G_agg_levels);
       HYPRE_BoomerAMGSetRelaxType(ams_data -> B_G, ams_data -> B_G_relax_type);
@@ -3369,6 +3504,7 @@ hypre_AMSSetup(void *solver,
       /* Create the AMG solvers on the range of Pi{x,y,z}^T */
    {
       HYPRE_BoomerAMGCreate(&ams_data -> B_Pix);
+      hypre_BoomerAMGSetVectorPool(ams_data -> B_Pix, ams_data -> vector_pool);
       HYPRE_BoomerAMGSetCoarsenType(ams_data -> B_Pix, ams_data -> B_Pi_coarsen_type);
       HYPRE_BoomerAMGSetAggNumLevels(ams_data -> B_Pix, ams_data -> B_Pi_agg_levels);
       HYPRE_BoomerAMGSetRelaxType(ams_data -> B_Pix, ams_data -> B_Pi_relax_type);
@@ -3382,6 +3518,8 @@ hypre_AMSSetup(void *solver,
       HYPRE_BoomerAMGSetMinCoarseSize(ams_data -> B_Pix, 2);
 
       HYPRE_BoomerAMGCreate(&ams_data -> B_Piy);
+
+      hypre_BoomerAMGSetVectorPool(ams_data -> B_Piy, ams_data -> vector_pool);
       HYPRE_BoomerAMGSetCoarsenType(ams_data -> B_Piy, ams_data -> B_Pi_coarsen_type);
       HYPRE_BoomerAMGSetAggNumLevels(ams_data -> B_Piy, ams_data -> B_Pi_agg_levels);
       HYPRE_BoomerAMGSetRelaxType(ams_data -> B_Piy, ams_data -> B_Pi_relax_type);
@@ -3395,6 +3533,8 @@ hypre_AMSSetup(void *solver,
       HYPRE_BoomerAMGSetMinCoarseSize(ams_data -> B_Piy, 2);
 
       HYPRE_BoomerAMGCreate(&ams_data -> B_Piz);
+
+      hypre_BoomerAMGSetVectorPool(ams_data -> B_Piz, ams_data -> vector_pool);
       HYPRE_BoomerAMGSetCoarsenType(ams_data -> B_Piz, ams_data -> B_Pi_coarsen_type);
       HYPRE_BoomerAMGSetAggNumLevels(ams_data -> B_Piz, ams_data -> B_Pi_agg_levels);
       HYPRE_BoomerAMGSetRelaxType(ams_data -> B_Piz, ams_data -> B_Pi_relax_type);
@@ -3515,6 +3655,7 @@ hypre_AMSSetup(void *solver,
       /* Create the AMG solver on the range of Pi^T */
    {
       HYPRE_BoomerAMGCreate(&ams_data -> B_Pi);
+      hypre_BoomerAMGSetVectorPool(ams_data -> B_Pi, ams_data -> vector_pool);
       HYPRE_BoomerAMGSetCoarsenType(ams_data -> B_Pi, ams_data -> B_Pi_coarsen_type);
       HYPRE_BoomerAMGSetAggNumLevels(ams_data -> B_Pi, ams_data -> B_Pi_agg_levels);
       HYPRE_BoomerAMGSetRelaxType(ams_data -> B_Pi, ams_data -> B_Pi_relax_type);
@@ -3789,6 +3930,7 @@ HYPRE_Int hypre_AMSSolve(void *solver,
    HYPRE_Solver Bi[5];
    HYPRE_PtrToSolverFcn HBi[5];
    hypre_ParVector *ri[5], *gi[5];
+   hypre_ParVector **zi = NULL;
    HYPRE_Int needZ = 0;
 
    hypre_ParVector *z = ams_data -> zz;
@@ -3952,6 +4094,11 @@ HYPRE_Int hypre_AMSSolve(void *solver,
       }
    }
 
+   if (ams_data -> concurrent_corrections)
+   {
+      zi = hypre_ParCSRSubspacePrecConcurrentVectors(A, Ai, cycle, ams_data -> zi);
+   }
+
    for (i = 0; i < ams_data -> maxit; i++)
    {
       /* Compute initial residual norms */
@@ -3996,7 +4143,7 @@ HYPRE_Int hypre_AMSSolve(void *solver,
                                ams_data -> r0,
                                ams_data -> g0,
                                cycle,
-                               z);
+                               z, zi);
 
       /* Compute new residual norms */
       if (ams_data -> maxit > 1)
@@ -4042,6 +4189,201 @@ HYPRE_Int hypre_AMSSolve(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspacePrecConcurrentVectors
+ *
+ * Returns the fine-level correction vectors zi to be passed to
+ * hypre_ParCSRSubspacePrec for concurrent additive corrections, creating the
+ * ones needed by cycle, or NULL if the corrections should run sequentially.
+ * Concurrent corrections share the OpenMP threads of a single MPI task, since
+ * the subspace solvers communicate on the same communicator. They also require
+ * MPI_THREAD_MULTIPLE, because the solvers still call MPI from each thread.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVector **
+hypre_ParCSRSubspacePrecConcurrentVectors( hypre_ParCSRMatrix  *A0,
+                                           hypre_ParCSRMatrix **A,
+                                           char                *cycle,
+                                           hypre_ParVector    **zi )
+{
+   MPI_Comm   comm = hypre_ParCSRMatrixComm(A0);
+   HYPRE_Int  num_procs, thread_level, i;
+   char      *op;
+
+   if (hypre_NumThreads() < 2)
+   {
+      return NULL;
+   }
+
+   hypre_MPI_Query_thread(&thread_level);
+   if (thread_level != hypre_MPI_THREAD_MULTIPLE)
+   {
+      return NULL;
+   }
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A0)) == HYPRE_EXEC_DEVICE)
+   {
+      return NULL;
+   }
+#endif
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   if (num_procs > 1)
+   {
+      return NULL;
+   }
+
+   for (op = cycle; *op != '\0'; op++)
+   {
+      if (op[0] == '+' && op[1] >= '1' && op[1] <= '5')
+      {
+         i = op[1] - '1';
+         if (A[i] && !zi[i])
+         {
+            zi[i] = hypre_ParVectorCreate(comm,
+                                          hypre_ParCSRMatrixGlobalNumRows(A0),
+                                          hypre_ParCSRMatrixRowStarts(A0));
+            hypre_ParVectorInitialize(zi[i]);
+         }
+      }
+   }
+
+   return zi;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceGroupTasks
+ *
+ * Splits the additive group starting at '(' in cycle into the chain of
+ * operations preceding the first '+' and the subspace corrections following
+ * it, which only depend on the saved residual.  The chain is assigned to task
+ * 0 and corrections sharing a solver, a matrix or a work vector (with each
+ * other or with the chain) are assigned to the same task.  Returns the offset
+ * of the closing ')', or -1 if the group cannot run concurrently.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSubspaceGroupTasks( char                *cycle,
+                                hypre_ParCSRMatrix **A,
+                                HYPRE_Solver        *B,
+                                hypre_ParCSRMatrix **P,
+                                hypre_ParVector    **r,
+                                hypre_ParVector    **g,
+                                hypre_ParVector    **zi,
+                                char                *chain,
+                                HYPRE_Int           *corr,
+                                HYPRE_Int           *num_corr_ptr,
+                                HYPRE_Int           *task,
+                                HYPRE_Int           *num_tasks_ptr )
+{
+   char      *op = cycle + 1;
+   HYPRE_Int  num_chain = 0, num_corr = 0, num_tasks;
+   HYPRE_Int  in_chain[5] = {0, 0, 0, 0, 0};
+   HYPRE_Int  label[5];
+   HYPRE_Int  i, j, k, l, old_label, new_label;
+
+#define hypre_SubspacesShareData(i, j) \
+   (B[i] == B[j] || A[i] == A[j] || P[i] == P[j] || r[i] == r[j] || g[i] == g[j])
+
+   /* chain of operations using the current approximation */
+   for (; *op != '+' && *op != ')'; op++)
+   {
+      if (*op == '\0' || *op == '(' || num_chain > 20)
+      {
+         return -1;
+      }
+      if (*op >= '1' && *op <= '5')
+      {
+         in_chain[*op - '1'] = 1;
+      }
+      chain[num_chain++] = *op;
+   }
+   chain[num_chain] = '\0';
+
+   /* corrections based on the saved residual */
+   for (; *op == '+'; op += 2)
+   {
+      if (op[1] < '1' || op[1] > '5')
+      {
+         return -1;
+      }
+      i = op[1] - '1';
+      if (A[i])
+      {
+         if (!zi[i])
+         {
+            return -1;
+         }
+         corr[num_corr++] = i;
+      }
+   }
+   if (*op != ')')
+   {
+      return -1;
+   }
+
+   /* group the corrections which cannot run at the same time */
+   for (k = 0; k < num_corr; k++)
+   {
+      i = corr[k];
+      label[k] = k + 1;
+      for (j = 0; j < 5; j++)
+      {
+         if (in_chain[j] && A[j] && hypre_SubspacesShareData(i, j))
+         {
+            label[k] = 0;
+         }
+      }
+      for (l = 0; l < k; l++)
+      {
+         if (label[l] != label[k] && hypre_SubspacesShareData(i, corr[l]))
+         {
+            old_label = hypre_max(label[l], label[k]);
+            new_label = hypre_min(label[l], label[k]);
+            for (j = 0; j <= k; j++)
+            {
+               if (label[j] == old_label)
+               {
+                  label[j] = new_label;
+               }
+            }
+         }
+      }
+   }
+
+#undef hypre_SubspacesShareData
+
+   /* number the tasks consecutively, starting from the chain */
+   num_tasks = (num_chain > 0);
+   for (k = 0; k < num_corr; k++)
+   {
+      task[k] = -1;
+      if (label[k] == 0 && num_chain > 0)
+      {
+         task[k] = 0;
+         continue;
+      }
+      for (l = 0; l < k; l++)
+      {
+         if (label[l] == label[k])
+         {
+            task[k] = task[l];
+            break;
+         }
+      }
+      if (task[k] < 0)
+      {
+         task[k] = num_tasks++;
+      }
+   }
+
+   *num_corr_ptr  = num_corr;
+   *num_tasks_ptr = num_tasks;
+
+   return (num_tasks > 1) ? (HYPRE_Int) (op - cycle) : -1;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRSubspacePrec
  *
@@ -4053,6 +4395,10 @@ HYPRE_Int hypre_AMSSolve(void *solver,
  *
  * The default mode is multiplicative, '+' changes the next correction
  * to additive, based on residual computed at '('.
+ *
+ * If zi is not NULL, the additive corrections of a group are computed
+ * concurrently with the rest of the group into the fine-level vectors zi,
+ * and are added to y at the closing ')'.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
@@ -4088,7 +4434,9 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
    hypre_ParVector *g0,
    char *cycle,
    /* temporary vector */
-   hypre_ParVector *z)
+   hypre_ParVector *z,
+   /* subspace corrections for concurrent additive groups (optional) */
+   hypre_ParVector **zi)
 {
    char *op;
    HYPRE_Int use_saved_residual = 0;
@@ -4106,6 +4454,64 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
       {
          hypre_ParVectorCopy(x, r0);
          hypre_ParCSRMatrixMatvec(-1.0, A0, y, 1.0, r0);
+
+#if defined(HYPRE_USING_OPENMP)
+         if (zi)
+         {
+            char      chain[24];
+            HYPRE_Int corr[5], task[5];
+            HYPRE_Int num_corr, num_tasks, num_threads, max_levels, end, t, k;
+
+            end = hypre_ParCSRSubspaceGroupTasks(op, A, B, P, r, g, zi, chain,
+                                                 corr, &num_corr, task, &num_tasks);
+            num_threads = hypre_NumThreads();
+
+            if (end > 0 && num_threads >= num_tasks)
+            {
+               /* split the threads between the chain and the corrections */
+               max_levels = omp_get_max_active_levels();
+               omp_set_max_active_levels(hypre_max(max_levels, omp_get_level() + 2));
+
+               #pragma omp parallel for private(t, k) schedule(static, 1) num_threads(num_tasks)
+               for (t = 0; t < num_tasks; t++)
+               {
+                  hypre_SetNumThreads(num_threads / num_tasks + (t < num_threads % num_tasks));
+
+                  if (t == 0 && chain[0] != '\0')
+                  {
+                     hypre_ParCSRSubspacePrec(A0, A0_relax_type, A0_relax_times, A0_l1_norms,
+                                              A0_relax_weight, A0_omega, A0_max_eig_est,
+                                              A0_min_eig_est, A0_cheby_order, A0_cheby_fraction,
+                                              A, B, HB, P, r, g, x, y, r0, g0, chain, z, NULL);
+                  }
+                  for (k = 0; k < num_corr; k++)
+                  {
+                     HYPRE_Int i = corr[k];
+
+                     if (task[k] == t)
+                     {
+                        hypre_ParCSRMatrixMatvecT(1.0, P[i], r0, 0.0, r[i]);
+                        hypre_ParVectorSetConstantValues(g[i], 0.0);
+                        (*HB[i]) (B[i], (HYPRE_Matrix)A[i],
+                                  (HYPRE_Vector)r[i], (HYPRE_Vector)g[i]);
+                        hypre_ParCSRMatrixMatvec(1.0, P[i], g[i], 0.0, zi[i]);
+                     }
+                  }
+               }
+
+               omp_set_max_active_levels(max_levels);
+
+               /* add the corrections in the order of the cycle */
+               for (k = 0; k < num_corr; k++)
+               {
+                  hypre_ParVectorAxpy(1.0, zi[corr[k]], y);
+               }
+
+               /* continue after the closing ')' */
+               op += end;
+            }
+         }
+#endif
       }
 
       /* switch to additive correction */
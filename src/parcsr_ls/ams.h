@@ -42,6 +42,10 @@ typedef struct
    /* AMG solvers for A_Pi{x,y,z} */
    HYPRE_Solver B_Pix, B_Piy, B_Piz;
 
+   /* Work vectors shared by the AMG subspace solvers, which are never active
+      at the same time */
+   hypre_ParVectorPool *vector_pool;
+
    /* Does the solver own the Nedelec interpolations? */
    HYPRE_Int owns_Pi;
    /* Does the solver own the coarse grid matrices? */
@@ -104,6 +108,11 @@ typedef struct
    /* Temporary vectors */
    hypre_ParVector *r0, *g0, *r1, *g1, *r2, *g2, *zz;
 
+   /* Run the additive subspace corrections concurrently (OpenMP team split),
+      accumulating them in the fine-level vectors zi before adding them up */
+   HYPRE_Int concurrent_corrections;
+   hypre_ParVector *zi[5];
+
    /* Output log info */
    HYPRE_Int num_iterations;
    HYPRE_Real rel_resid_norm;
@@ -47,6 +47,7 @@ hypre_BoomerAMGCreate( void )
    HYPRE_Int    measure_type;
    HYPRE_Int    setup_type;
    HYPRE_Int    P_max_elmts;
+   HYPRE_Real   target_op_cmplxty;
    HYPRE_Int    num_functions;
    HYPRE_Int    filter_functions;
    HYPRE_Int    nodal, nodal_levels, nodal_diag;
@@ -74,6 +75,8 @@ hypre_BoomerAMGCreate( void )
    HYPRE_Int    cycle_type;
 
    HYPRE_Int    converge_type;
+   HYPRE_Int    conv_check_type;
+   HYPRE_Int    conv_check_freq;
    HYPRE_Real   tol;
 
    HYPRE_Int    num_sweeps;
@@ -180,6 +183,7 @@ hypre_BoomerAMGCreate( void )
    measure_type = 0;
    setup_type = 1;
    P_max_elmts = 4;
+   target_op_cmplxty = 0.0;
    agg_P_max_elmts = 0;
    agg_P12_max_elmts = 0;
    num_functions = 1;
@@ -260,6 +264,8 @@ hypre_BoomerAMGCreate( void )
    fcycle = 0;
    cycle_type = 1;
    converge_type = 0;
+   conv_check_type = 0;
+   conv_check_freq = 1;
    tol = 1.0e-6;
 
    num_sweeps = 1;
@@ -334,6 +340,9 @@ hypre_BoomerAMGCreate( void )
 
    hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) = -1;
    hypre_ParAMGDataPartialCycleControl(amg_data) = -1;
+   hypre_ParAMGDataFloatHaloLevel(amg_data) = -1;
+   hypre_ParAMGDataFloatHaloAuto(amg_data) = NULL;
+   hypre_ParAMGDataFloatHaloBytes(amg_data) = 0.0;
    hypre_ParAMGDataMaxLevels(amg_data) =  max_levels;
    hypre_ParAMGDataUserCoarseRelaxType(amg_data) = 9;
    hypre_ParAMGDataUserRelaxType(amg_data) = -1;
@@ -358,6 +367,8 @@ hypre_BoomerAMGCreate( void )
    hypre_BoomerAMGSetInterpType(amg_data, interp_type);
    hypre_BoomerAMGSetSetupType(amg_data, setup_type);
    hypre_BoomerAMGSetPMaxElmts(amg_data, P_max_elmts);
+   hypre_BoomerAMGSetTargetOpCmplxty(amg_data, target_op_cmplxty);
+   hypre_ParAMGDataUpdateMaxFraction(amg_data) = 0.1;
    hypre_BoomerAMGSetAggPMaxElmts(amg_data, agg_P_max_elmts);
    hypre_BoomerAMGSetAggP12MaxElmts(amg_data, agg_P12_max_elmts);
    hypre_BoomerAMGSetNumFunctions(amg_data, num_functions);
@@ -421,6 +432,8 @@ hypre_BoomerAMGCreate( void )
    hypre_BoomerAMGSetCycleType(amg_data, cycle_type);
    hypre_BoomerAMGSetFCycle(amg_data, fcycle);
    hypre_BoomerAMGSetConvergeType(amg_data, converge_type);
+   hypre_BoomerAMGSetConvCheckType(amg_data, conv_check_type);
+   hypre_BoomerAMGSetConvCheckFreq(amg_data, conv_check_freq);
    hypre_BoomerAMGSetTol(amg_data, tol);
    hypre_BoomerAMGSetNumSweeps(amg_data, num_sweeps);
    hypre_BoomerAMGSetCycleRelaxType(amg_data, relax_down, 1);
@@ -476,6 +489,8 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
    hypre_ParAMGDataZtemp(amg_data)  = NULL;
+   hypre_ParAMGDataVectorPool(amg_data) = NULL;
+   hypre_ParAMGDataWorkVectors(amg_data) = 0;
    hypre_ParAMGDataFArray(amg_data) = NULL;
    hypre_ParAMGDataUArray(amg_data) = NULL;
    hypre_ParAMGDataDofFunc(amg_data) = NULL;
@@ -498,6 +513,9 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataMinEigEst(amg_data) = NULL;
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
+   hypre_ParAMGDataChebyEigReuse(amg_data) = 0;
+   hypre_ParAMGDataChebyNumEigVecs(amg_data) = 0;
+   hypre_ParAMGDataChebyEigVecs(amg_data) = NULL;
 
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
@@ -545,6 +563,8 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataFusedRAP(amg_data)          = 0;
+   hypre_ParAMGDataFusedRAPWorkingSet(amg_data) = 0;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -589,6 +609,9 @@ hypre_BoomerAMGDestroy( void *data )
       HYPRE_Int     i;
       HYPRE_MemoryLocation memory_location = hypre_ParAMGDataMemoryLocation(amg_data);
 
+      /* pooled work vectors are owned by the pool */
+      hypre_BoomerAMGReleaseWorkVectors(amg_data);
+
 #ifdef HYPRE_USING_DSUPERLU
       // if (hypre_ParAMGDataDSLUThreshold(amg_data) > 0)
       if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
@@ -598,6 +621,7 @@ hypre_BoomerAMGDestroy( void *data )
       }
 #endif
 
+      hypre_TFree(hypre_ParAMGDataFloatHaloAuto(amg_data), HYPRE_MEMORY_HOST);
       if (hypre_ParAMGDataMaxEigEst(amg_data))
       {
          hypre_TFree(hypre_ParAMGDataMaxEigEst(amg_data), HYPRE_MEMORY_HOST);
@@ -753,6 +777,15 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
       }
 
+      if (hypre_ParAMGDataChebyEigVecs(amg_data))
+      {
+         for (i = 0; i < hypre_ParAMGDataChebyNumEigVecs(amg_data); i++)
+         {
+            hypre_ParVectorDestroy(hypre_ParAMGDataChebyEigVecs(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataChebyEigVecs(amg_data), HYPRE_MEMORY_HOST);
+      }
+
       hypre_TFree(hypre_ParAMGDataDinv(amg_data), HYPRE_MEMORY_HOST);
 
       /* get rid of a fine level block matrix */
@@ -770,6 +803,8 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_IntArrayDestroy(hypre_ParAMGDataCFMarkerArray(amg_data)[0]);
       }
 
+      hypre_BoomerAMGUpdateDestroyTransposes(amg_data);
+
       hypre_ParVectorDestroy(hypre_ParAMGDataVtemp(amg_data));
       hypre_TFree(hypre_ParAMGDataFArray(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataUArray(amg_data), HYPRE_MEMORY_HOST);
@@ -1531,6 +1566,86 @@ hypre_BoomerAMGGetPMaxElmts( void     *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetTargetOpCmplxty( void       *data,
+                                   HYPRE_Real  target_op_cmplxty )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (target_op_cmplxty < 0.0 || (target_op_cmplxty > 0.0 && target_op_cmplxty <= 1.0))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataTargetOpCmplxty(amg_data) = target_op_cmplxty;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetTargetOpCmplxty( void       *data,
+                                   HYPRE_Real *target_op_cmplxty )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *target_op_cmplxty = hypre_ParAMGDataTargetOpCmplxty(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetUpdateMaxFraction( void       *data,
+                                     HYPRE_Real  update_max_fraction )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (update_max_fraction < 0.0 || update_max_fraction > 1.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataUpdateMaxFraction(amg_data) = update_max_fraction;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetUpdateMaxFraction( void       *data,
+                                     HYPRE_Real *update_max_fraction )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *update_max_fraction = hypre_ParAMGDataUpdateMaxFraction(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetJacobiTruncThreshold( void     *data,
                                         HYPRE_Real    jacobi_trunc_threshold )
@@ -1965,6 +2080,91 @@ hypre_BoomerAMGGetConvergeType( void      *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetConvCheckType( void      *data,
+                                 HYPRE_Int  type )
+{
+   /* type 0: default. residual norm computed after every cycle
+    *      1:          residual norm computed every conv_check_freq cycles
+    *      2:          residual norm computed when the observed convergence
+    *                  factor predicts that the tolerance has been reached
+    */
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (type < 0 || type > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataConvCheckType(amg_data) = type;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetConvCheckType( void      *data,
+                                 HYPRE_Int *type )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *type = hypre_ParAMGDataConvCheckType(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetConvCheckFreq( void      *data,
+                                 HYPRE_Int  freq )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (freq < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataConvCheckFreq(amg_data) = freq;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetConvCheckFreq( void      *data,
+                                 HYPRE_Int *freq )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *freq = hypre_ParAMGDataConvCheckFreq(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetTol( void     *data,
                        HYPRE_Real    tol  )
@@ -2005,6 +2205,72 @@ hypre_BoomerAMGGetTol( void     *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetFloatHaloLevel( void      *data,
+                                  HYPRE_Int  float_halo_level )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (float_halo_level < -2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataFloatHaloLevel(amg_data) = float_halo_level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetFloatHaloLevel( void      *data,
+                                  HYPRE_Int *float_halo_level )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *float_halo_level = hypre_ParAMGDataFloatHaloLevel(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetFloatHaloBytesSaved( void       *data,
+                                       HYPRE_Real *bytes_saved )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   MPI_Comm           comm;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParAMGDataAArray(amg_data))
+   {
+      *bytes_saved = 0.0;
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParCSRMatrixComm(hypre_ParAMGDataAArray(amg_data)[0]);
+   hypre_MPI_Allreduce(&hypre_ParAMGDataFloatHaloBytes(amg_data), bytes_saved, 1,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   return hypre_error_flag;
+}
+
 /* The "Get" function for SetNumSweeps is GetCycleNumSweeps. */
 HYPRE_Int
 hypre_BoomerAMGSetNumSweeps( void     *data,
@@ -4640,6 +4906,21 @@ hypre_BoomerAMGSetChebyEigEst( void     *data,
    return hypre_error_flag;
 }
 HYPRE_Int
+hypre_BoomerAMGSetChebyEigReuse( void     *data,
+                                 HYPRE_Int cheby_eig_reuse)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyEigReuse(amg_data) = cheby_eig_reuse;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
 hypre_BoomerAMGSetChebyVariant( void     *data,
                                 HYPRE_Int     cheby_variant)
 {
@@ -5064,6 +5345,44 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetFusedRAP( void       *data,
+                            HYPRE_Int   fused_rap )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataFusedRAP(amg_data) = fused_rap;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetFusedRAPWorkingSet( void       *data,
+                                      HYPRE_Int   working_set )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (working_set < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataFusedRAPWorkingSet(amg_data) = working_set;
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -5244,3 +5563,153 @@ hypre_BoomerAMGGetCumNnzAP( void       *data,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * The interpolation-vector variants may enlarge the work vectors during
+ * setup, so these never use the pool.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParVectorPool *
+hypre_BoomerAMGWorkVectorPool( hypre_ParAMGData *amg_data )
+{
+   if (hypre_ParAMGInterpVecVariant(amg_data) > 0)
+   {
+      return NULL;
+   }
+
+   return hypre_ParAMGDataVectorPool(amg_data);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetVectorPool
+ *
+ * Lets AMG borrow its fine-level work vectors from pool while it is active,
+ * instead of keeping them for its whole lifetime.  The pool must outlive the
+ * AMG solver.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetVectorPool( void                *data,
+                              hypre_ParVectorPool *pool )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* return borrowed work vectors, or free owned ones; they are acquired
+      again when needed */
+   if (hypre_BoomerAMGWorkVectorPool(amg_data))
+   {
+      hypre_BoomerAMGReleaseWorkVectors(amg_data);
+   }
+   else
+   {
+      hypre_ParVectorDestroy(hypre_ParAMGDataVtemp(amg_data));
+      hypre_ParVectorDestroy(hypre_ParAMGDataRtemp(amg_data));
+      hypre_ParVectorDestroy(hypre_ParAMGDataPtemp(amg_data));
+      hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
+      hypre_ParAMGDataVtemp(amg_data) = NULL;
+      hypre_ParAMGDataRtemp(amg_data) = NULL;
+      hypre_ParAMGDataPtemp(amg_data) = NULL;
+      hypre_ParAMGDataZtemp(amg_data) = NULL;
+   }
+   hypre_ParAMGDataVectorPool(amg_data) = pool;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAcquireWorkVectors
+ *
+ * Makes sure that the fine-level work vectors flagged in work_vectors exist,
+ * either by borrowing them from the vector pool or by creating them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAcquireWorkVectors( void                 *data,
+                                   HYPRE_Int             num_vectors,
+                                   HYPRE_MemoryLocation  memory_location )
+{
+   hypre_ParAMGData     *amg_data     = (hypre_ParAMGData*) data;
+   hypre_ParCSRMatrix   *A            = hypre_ParAMGDataAArray(amg_data)[0];
+   hypre_ParVectorPool  *pool         = hypre_BoomerAMGWorkVectorPool(amg_data);
+   HYPRE_Int             work_vectors = hypre_ParAMGDataWorkVectors(amg_data);
+   hypre_ParVector     **temps[4];
+   HYPRE_Int             flags[4] = {hypre_PAR_AMG_WORK_VTEMP, hypre_PAR_AMG_WORK_RTEMP,
+                                     hypre_PAR_AMG_WORK_PTEMP, hypre_PAR_AMG_WORK_ZTEMP
+                                    };
+   HYPRE_Int             i;
+
+   temps[0] = &hypre_ParAMGDataVtemp(amg_data);
+   temps[1] = &hypre_ParAMGDataRtemp(amg_data);
+   temps[2] = &hypre_ParAMGDataPtemp(amg_data);
+   temps[3] = &hypre_ParAMGDataZtemp(amg_data);
+
+   for (i = 0; i < 4; i++)
+   {
+      if ((work_vectors & flags[i]) && *temps[i] == NULL)
+      {
+         if (pool)
+         {
+            *temps[i] = hypre_ParVectorPoolAcquire(pool, hypre_ParCSRMatrixComm(A),
+                                                   hypre_ParCSRMatrixGlobalNumRows(A),
+                                                   hypre_ParCSRMatrixRowStarts(A),
+                                                   num_vectors, memory_location);
+         }
+         else
+         {
+            *temps[i] = hypre_ParMultiVectorCreate(hypre_ParCSRMatrixComm(A),
+                                                   hypre_ParCSRMatrixGlobalNumRows(A),
+                                                   hypre_ParCSRMatrixRowStarts(A),
+                                                   num_vectors);
+            hypre_ParVectorInitialize_v2(*temps[i], memory_location);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReleaseWorkVectors
+ *
+ * Returns borrowed work vectors to the vector pool.  Does nothing if AMG
+ * owns its work vectors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReleaseWorkVectors( void *data )
+{
+   hypre_ParAMGData     *amg_data = (hypre_ParAMGData*) data;
+   hypre_ParVectorPool  *pool     = hypre_BoomerAMGWorkVectorPool(amg_data);
+
+   if (pool)
+   {
+      if (hypre_ParAMGDataVtemp(amg_data))
+      {
+         hypre_ParVectorPoolRelease(pool, hypre_ParAMGDataVtemp(amg_data));
+         hypre_ParAMGDataVtemp(amg_data) = NULL;
+      }
+      if (hypre_ParAMGDataRtemp(amg_data))
+      {
+         hypre_ParVectorPoolRelease(pool, hypre_ParAMGDataRtemp(amg_data));
+         hypre_ParAMGDataRtemp(amg_data) = NULL;
+      }
+      if (hypre_ParAMGDataPtemp(amg_data))
+      {
+         hypre_ParVectorPoolRelease(pool, hypre_ParAMGDataPtemp(amg_data));
+         hypre_ParAMGDataPtemp(amg_data) = NULL;
+      }
+      if (hypre_ParAMGDataZtemp(amg_data))
+      {
+         hypre_ParVectorPoolRelease(pool, hypre_ParAMGDataZtemp(amg_data));
+         hypre_ParAMGDataZtemp(amg_data) = NULL;
+      }
+   }
+
+   return hypre_error_flag;
+}
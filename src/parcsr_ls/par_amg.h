@@ -44,6 +44,8 @@ typedef struct
    HYPRE_Int      setup_type;
    HYPRE_Int      coarsen_type;
    HYPRE_Int      P_max_elmts;
+   HYPRE_Real     target_op_cmplxty;
+   HYPRE_Real     update_max_fraction;
    HYPRE_Int      interp_type;
    HYPRE_Int      sep_weight;
    HYPRE_Int      agg_interp_type;
@@ -83,9 +85,14 @@ typedef struct
    HYPRE_Real    *relax_weight;
    HYPRE_Real    *omega;
    HYPRE_Int      converge_type;
+   HYPRE_Int      conv_check_type;
+   HYPRE_Int      conv_check_freq;
    HYPRE_Real     tol;
    HYPRE_Int      partial_cycle_coarsest_level;
    HYPRE_Int      partial_cycle_control;
+   HYPRE_Int      float_halo_level;
+   HYPRE_Int     *float_halo_auto;   /* levels chosen for float_halo_level = -2 */
+   HYPRE_Real     float_halo_bytes;  /* bytes saved by this rank since setup */
 
 
    /* problem data */
@@ -109,6 +116,11 @@ typedef struct
    hypre_ParCSRMatrix **P_array;
    hypre_ParCSRMatrix **R_array;
    hypre_IntArray     **CF_marker_array;
+
+   /* transposes of P and their plans, kept by hypre_BoomerAMGSetupUpdate */
+   hypre_ParCSRMatrix        **update_PT_array;
+   hypre_ParCSRTransposePlan **update_PT_plans;
+
    hypre_IntArray     **dof_func_array;
    HYPRE_Int          **dof_point_array;
    HYPRE_Int          **point_dof_map_array;
@@ -178,6 +190,9 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_eig_reuse;
+   HYPRE_Int            cheby_num_eig_vecs;
+   hypre_ParVector    **cheby_eig_vecs;
 
    HYPRE_Real           cum_nnz_AP;
 
@@ -196,6 +211,12 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* If set, the work vectors above are lent by the pool while AMG is active
+      (setup or solve) and returned afterwards.  work_vectors records which
+      ones are needed (hypre_PAR_AMG_WORK_*). */
+   hypre_ParVectorPool *vector_pool;
+   HYPRE_Int          work_vectors;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -271,6 +292,8 @@ typedef struct
    HYPRE_Int rap2;
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
+   HYPRE_Int fused_rap;
+   HYPRE_Int fused_rap_working_set;
 
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
@@ -322,6 +345,8 @@ typedef struct
 #define hypre_ParAMGDataMeasureType(amg_data)          ((amg_data) -> measure_type)
 #define hypre_ParAMGDataSetupType(amg_data)            ((amg_data) -> setup_type)
 #define hypre_ParAMGDataPMaxElmts(amg_data)            ((amg_data) -> P_max_elmts)
+#define hypre_ParAMGDataTargetOpCmplxty(amg_data)      ((amg_data) -> target_op_cmplxty)
+#define hypre_ParAMGDataUpdateMaxFraction(amg_data)    ((amg_data) -> update_max_fraction)
 #define hypre_ParAMGDataAggPMaxElmts(amg_data)         ((amg_data) -> agg_P_max_elmts)
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
 #define hypre_ParAMGDataNumPaths(amg_data)             ((amg_data) -> num_paths)
@@ -347,9 +372,14 @@ typedef struct
 #define hypre_ParAMGDataFCycle(amg_data) ((amg_data)->fcycle)
 #define hypre_ParAMGDataCycleType(amg_data) ((amg_data)->cycle_type)
 #define hypre_ParAMGDataConvergeType(amg_data) ((amg_data)->converge_type)
+#define hypre_ParAMGDataConvCheckType(amg_data) ((amg_data)->conv_check_type)
+#define hypre_ParAMGDataConvCheckFreq(amg_data) ((amg_data)->conv_check_freq)
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
 #define hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) ((amg_data)->partial_cycle_coarsest_level)
 #define hypre_ParAMGDataPartialCycleControl(amg_data) ((amg_data)->partial_cycle_control)
+#define hypre_ParAMGDataFloatHaloLevel(amg_data) ((amg_data)->float_halo_level)
+#define hypre_ParAMGDataFloatHaloAuto(amg_data) ((amg_data)->float_halo_auto)
+#define hypre_ParAMGDataFloatHaloBytes(amg_data) ((amg_data)->float_halo_bytes)
 #define hypre_ParAMGDataNumGridSweeps(amg_data) ((amg_data)->num_grid_sweeps)
 #define hypre_ParAMGDataUserCoarseRelaxType(amg_data) ((amg_data)->user_coarse_relax_type)
 #define hypre_ParAMGDataUserRelaxType(amg_data) ((amg_data)->user_relax_type)
@@ -382,6 +412,8 @@ typedef struct
 #define hypre_ParAMGDataUArray(amg_data) ((amg_data)->U_array)
 #define hypre_ParAMGDataPArray(amg_data) ((amg_data)->P_array)
 #define hypre_ParAMGDataRArray(amg_data) ((amg_data)->R_array)
+#define hypre_ParAMGDataUpdatePTArray(amg_data) ((amg_data)->update_PT_array)
+#define hypre_ParAMGDataUpdatePTPlans(amg_data) ((amg_data)->update_PT_plans)
 #define hypre_ParAMGDataDofFuncArray(amg_data) ((amg_data)->dof_func_array)
 #define hypre_ParAMGDataDofPointArray(amg_data) ((amg_data)->dof_point_array)
 #define hypre_ParAMGDataPointDofMapArray(amg_data) \
@@ -442,6 +474,9 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyEigReuse(amg_data) ((amg_data)->cheby_eig_reuse)
+#define hypre_ParAMGDataChebyNumEigVecs(amg_data) ((amg_data)->cheby_num_eig_vecs)
+#define hypre_ParAMGDataChebyEigVecs(amg_data) ((amg_data)->cheby_eig_vecs)
 
 #define hypre_ParAMGDataCumNnzAP(amg_data)   ((amg_data)->cum_nnz_AP)
 
@@ -461,6 +496,13 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataVectorPool(amg_data) ((amg_data)->vector_pool)
+#define hypre_ParAMGDataWorkVectors(amg_data) ((amg_data)->work_vectors)
+
+#define hypre_PAR_AMG_WORK_VTEMP 1
+#define hypre_PAR_AMG_WORK_RTEMP 2
+#define hypre_PAR_AMG_WORK_PTEMP 4
+#define hypre_PAR_AMG_WORK_ZTEMP 8
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -542,6 +584,8 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataFusedRAP(amg_data) ((amg_data)->fused_rap)
+#define hypre_ParAMGDataFusedRAPWorkingSet(amg_data) ((amg_data)->fused_rap_working_set)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
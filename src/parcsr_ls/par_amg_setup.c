@@ -21,6 +21,48 @@
  *
  *****************************************************************************/
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxL1NormOption
+ *
+ * Returns the option of hypre_ParCSRComputeL1Norms needed by the relaxation
+ * types of the given level, or 0 if no l1 norms are needed. Coarser levels
+ * of additive cycles are handled separately in hypre_BoomerAMGSetup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxL1NormOption( HYPRE_Int *grid_relax_type,
+                                  HYPRE_Int  level,
+                                  HYPRE_Int  num_levels )
+{
+   HYPRE_Int  option = 0;
+   HYPRE_Int  t1, t2;
+
+   /* down and up relaxation on all but the coarsest level */
+   t1 = (level < num_levels - 1) ? grid_relax_type[1] : grid_relax_type[3];
+   t2 = (level < num_levels - 1) ? grid_relax_type[2] : grid_relax_type[3];
+
+   /* when several types need l1 norms, the last one below wins */
+   if (t1 == 8  || t1 == 13 || t1 == 14 || t1 == 89 ||
+       t2 == 8  || t2 == 13 || t2 == 14 || t2 == 89)
+   {
+      option = 4;
+   }
+   if (t1 == 30 || t2 == 30)
+   {
+      option = 3;
+   }
+   if (t1 == 88 || t2 == 88)
+   {
+      option = 6;
+   }
+   if (t1 == 18 || t2 == 18)
+   {
+      option = 1;
+   }
+
+   return option;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGSetup
  *--------------------------------------------------------------------------*/
@@ -70,6 +112,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int            dbg_flg;
    HYPRE_Int            local_num_vars;
    HYPRE_Int            P_max_elmts;
+   HYPRE_Real           target_op_cmplxty;
    HYPRE_Int            agg_P_max_elmts;
    HYPRE_Int            agg_P12_max_elmts;
    HYPRE_Int            IS_type;
@@ -184,6 +227,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int     fsai_eig_max_iters;
    HYPRE_Real    fsai_kap_tolerance;
    HYPRE_Int     needZ = 0;
+   HYPRE_Int     work_vectors;
 
    HYPRE_Int interp_type, restri_type;
    HYPRE_Int post_interp_type;  /* what to do after computing the interpolation matrix
@@ -249,6 +293,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_CSRMatrixPrint(A_new, "Atestnew"); */
    old_num_levels = hypre_ParAMGDataNumLevels(amg_data);
    max_levels = hypre_ParAMGDataMaxLevels(amg_data);
+
+   /* the automatic single-precision halo levels are chosen at the next solve */
+   hypre_TFree(hypre_ParAMGDataFloatHaloAuto(amg_data), HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataFloatHaloBytes(amg_data) = 0.0;
    add_end = hypre_min(add_last_lvl, max_levels - 1);
    if (add_end == -1) { add_end = max_levels - 1; }
    amg_logging = hypre_ParAMGDataLogging(amg_data);
@@ -432,6 +480,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* free up storage in case of new setup without previous destroy */
 
+   hypre_BoomerAMGUpdateDestroyTransposes(amg_data);
+
    if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
        dof_func_array || R_array || R_block_array)
    {
@@ -495,6 +545,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    {
       MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
       void *amg = hypre_ParAMGDataCoarseSolver(amg_data);
+
+      /* borrowed work vectors go back to the pool */
+      hypre_BoomerAMGReleaseWorkVectors(amg_data);
       if (hypre_ParAMGDataRtemp(amg_data))
       {
          hypre_ParVectorDestroy(hypre_ParAMGDataRtemp(amg_data));
@@ -832,20 +885,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataRBlockArray(amg_data) = P_block_array;
    }
 
-   Vtemp = hypre_ParAMGDataVtemp(amg_data);
-
-   if (Vtemp != NULL)
+   if (hypre_ParAMGDataVtemp(amg_data) != NULL)
    {
-      hypre_ParVectorDestroy(Vtemp);
-      Vtemp = NULL;
+      hypre_ParVectorDestroy(hypre_ParAMGDataVtemp(amg_data));
+      hypre_ParAMGDataVtemp(amg_data) = NULL;
    }
 
-   Vtemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
-                                 hypre_ParCSRMatrixGlobalNumRows(A_array[0]),
-                                 hypre_ParCSRMatrixRowStarts(A_array[0]));
-   hypre_ParVectorNumVectors(Vtemp) = num_vectors;
-   hypre_ParVectorInitialize_v2(Vtemp, memory_location);
-   hypre_ParAMGDataVtemp(amg_data) = Vtemp;
+   work_vectors = hypre_PAR_AMG_WORK_VTEMP;
 
    /* If we are doing Cheby relaxation, we also need up two more temp vectors.
     * If cheby_scale is false, only need one, otherwise need two */
@@ -854,24 +900,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        (grid_relax_type[0] == 16 || grid_relax_type[1] == 16 || grid_relax_type[2] == 16 ||
         grid_relax_type[3] == 16))
    {
-      Ptemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
-                                    hypre_ParCSRMatrixGlobalNumRows(A_array[0]),
-                                    hypre_ParCSRMatrixRowStarts(A_array[0]));
-      hypre_ParVectorNumVectors(Ptemp) = num_vectors;
-      hypre_ParVectorInitialize_v2(Ptemp, memory_location);
-      hypre_ParAMGDataPtemp(amg_data) = Ptemp;
+      work_vectors |= hypre_PAR_AMG_WORK_PTEMP;
 
       /* If not doing chebyshev relaxation, or (doing chebyshev relaxation and scaling) */
       if (!(grid_relax_type[0] == 16 || grid_relax_type[1] == 16 || grid_relax_type[2] == 16 ||
             grid_relax_type[3] == 16) ||
           (hypre_ParAMGDataChebyScale(amg_data)))
       {
-         Rtemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
-                                       hypre_ParCSRMatrixGlobalNumRows(A_array[0]),
-                                       hypre_ParCSRMatrixRowStarts(A_array[0]));
-         hypre_ParVectorNumVectors(Rtemp) = num_vectors;
-         hypre_ParVectorInitialize_v2(Rtemp, memory_location);
-         hypre_ParAMGDataRtemp(amg_data) = Rtemp;
+         work_vectors |= hypre_PAR_AMG_WORK_RTEMP;
       }
    }
 
@@ -910,14 +946,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    if (needZ)
    {
-      Ztemp = hypre_ParMultiVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
-                                         hypre_ParCSRMatrixGlobalNumRows(A_array[0]),
-                                         hypre_ParCSRMatrixRowStarts(A_array[0]),
-                                         num_vectors);
-      hypre_ParVectorInitialize_v2(Ztemp, memory_location);
-      hypre_ParAMGDataZtemp(amg_data) = Ztemp;
+      work_vectors |= hypre_PAR_AMG_WORK_ZTEMP;
    }
 
+   /* create (or borrow from the vector pool) the work vectors */
+   hypre_ParAMGDataWorkVectors(amg_data) = work_vectors;
+   hypre_BoomerAMGAcquireWorkVectors(amg_data, num_vectors, memory_location);
+   Vtemp = hypre_ParAMGDataVtemp(amg_data);
+   Rtemp = hypre_ParAMGDataRtemp(amg_data);
+   Ptemp = hypre_ParAMGDataPtemp(amg_data);
+   Ztemp = hypre_ParAMGDataZtemp(amg_data);
+
    F_array = hypre_ParAMGDataFArray(amg_data);
    U_array = hypre_ParAMGDataUArray(amg_data);
 
@@ -973,6 +1012,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    agg_trunc_factor = hypre_ParAMGDataAggTruncFactor(amg_data);
    agg_P12_trunc_factor = hypre_ParAMGDataAggP12TruncFactor(amg_data);
    P_max_elmts = hypre_ParAMGDataPMaxElmts(amg_data);
+   target_op_cmplxty = hypre_ParAMGDataTargetOpCmplxty(amg_data);
    agg_P_max_elmts = hypre_ParAMGDataAggPMaxElmts(amg_data);
    agg_P12_max_elmts = hypre_ParAMGDataAggP12MaxElmts(amg_data);
    jacobi_trunc_threshold = hypre_ParAMGDataJacobiTruncThreshold(amg_data);
@@ -2883,7 +2923,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                }
                else
                {
-                  if (hypre_ParAMGDataModularizedMatMat(amg_data))
+                  if (hypre_ParAMGDataFusedRAP(amg_data))
+                  {
+                     A_H = hypre_ParCSRMatrixRAPKTFused(P, A_array[level], P, keepTranspose,
+                                                        hypre_ParAMGDataFusedRAPWorkingSet(amg_data));
+                  }
+                  else if (hypre_ParAMGDataModularizedMatMat(amg_data))
                   {
                      A_H = hypre_ParCSRMatrixRAPKT(P, A_array[level],
                                                    P, keepTranspose);
@@ -3069,7 +3114,22 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          else
          {
             /* Compute standard Galerkin coarse-grid product */
-            if (hypre_ParAMGDataModularizedMatMat(amg_data))
+            if (target_op_cmplxty > 1.0 && !(Pnew && ns == 1))
+            {
+               /* truncate P further if A_H exceeds its share of the complexity budget */
+               hypre_BoomerAMGBuildCoarseOperatorAdaptive(A_array[level], P_array[level],
+                                                          keepTranspose,
+                                                          hypre_ParAMGDataModularizedMatMat(amg_data),
+                                                          1.0 - 1.0 / target_op_cmplxty,
+                                                          trunc_factor, P_max_elmts, &A_H);
+            }
+            else if (hypre_ParAMGDataFusedRAP(amg_data))
+            {
+               A_H = hypre_ParCSRMatrixRAPKTFused(P_array[level], A_array[level],
+                                                  P_array[level], keepTranspose,
+                                                  hypre_ParAMGDataFusedRAPWorkingSet(amg_data));
+            }
+            else if (hypre_ParAMGDataModularizedMatMat(amg_data))
             {
                A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
                                              P_array[level], keepTranspose);
@@ -3300,6 +3360,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    for (j = 0; j < addlvl; j++)
    {
       HYPRE_Real *l1_norm_data = NULL;
+      HYPRE_Int   l1_option;
 
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(j);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
@@ -3309,74 +3370,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_sprintf(nvtx_name, "%s-%d", "Relaxation", j);
       hypre_GpuProfilingPushRange(nvtx_name);
 
-      if (j < num_levels - 1 &&
-          (grid_relax_type[1] == 8  || grid_relax_type[1] == 89 ||
-           grid_relax_type[1] == 13 || grid_relax_type[1] == 14 ||
-           grid_relax_type[2] == 8  || grid_relax_type[2] == 89 ||
-           grid_relax_type[2] == 13 || grid_relax_type[2] == 14))
+      l1_option = hypre_BoomerAMGRelaxL1NormOption(grid_relax_type, j, num_levels);
+      if (l1_option)
       {
-         if (relax_order)
-         {
-            hypre_ParCSRComputeL1Norms(A_array[j], 4, hypre_IntArrayData(CF_marker_array[j]), &l1_norm_data);
-         }
-         else
-         {
-            hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
-         }
-      }
-      else if (j == num_levels - 1 &&
-               (grid_relax_type[3] == 8  || grid_relax_type[3] == 89 ||
-                grid_relax_type[3] == 13 || grid_relax_type[3] == 14))
-      {
-         hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
-      }
-
-      if (j < num_levels - 1 && (grid_relax_type[1] == 30 || grid_relax_type[2] == 30))
-      {
-         if (relax_order)
-         {
-            hypre_ParCSRComputeL1Norms(A_array[j], 3, hypre_IntArrayData(CF_marker_array[j]), &l1_norm_data);
-         }
-         else
-         {
-            hypre_ParCSRComputeL1Norms(A_array[j], 3, NULL, &l1_norm_data);
-         }
-      }
-      else if (j == num_levels - 1 && grid_relax_type[3] == 30)
-      {
-         hypre_ParCSRComputeL1Norms(A_array[j], 3, NULL, &l1_norm_data);
-      }
-
-      if (j < num_levels - 1 && (grid_relax_type[1] == 88 || grid_relax_type[2] == 88 ))
-      {
-         if (relax_order)
-         {
-            hypre_ParCSRComputeL1Norms(A_array[j], 6, hypre_IntArrayData(CF_marker_array[j]), &l1_norm_data);
-         }
-         else
-         {
-            hypre_ParCSRComputeL1Norms(A_array[j], 6, NULL, &l1_norm_data);
-         }
-      }
-      else if (j == num_levels - 1 && (grid_relax_type[3] == 88))
-      {
-         hypre_ParCSRComputeL1Norms(A_array[j], 6, NULL, &l1_norm_data);
-      }
-
-      if (j < num_levels - 1 && (grid_relax_type[1] == 18 || grid_relax_type[2] == 18))
-      {
-         if (relax_order)
-         {
-            hypre_ParCSRComputeL1Norms(A_array[j], 1, hypre_IntArrayData(CF_marker_array[j]), &l1_norm_data);
-         }
-         else
-         {
-            hypre_ParCSRComputeL1Norms(A_array[j], 1, NULL, &l1_norm_data);
-         }
-      }
-      else if (j == num_levels - 1 && grid_relax_type[3] == 18)
-      {
-         hypre_ParCSRComputeL1Norms(A_array[j], 1, NULL, &l1_norm_data);
+         hypre_ParCSRComputeL1Norms(A_array[j], l1_option,
+                                    (relax_order && j < num_levels - 1) ?
+                                    hypre_IntArrayData(CF_marker_array[j]) : NULL,
+                                    &l1_norm_data);
       }
 
       if (l1_norm_data)
@@ -3481,6 +3481,61 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_GpuProfilingPopRange();
    }
 
+   /* Chebyshev: run the CG eigenvalue estimation of all levels in lock-step, so
+      that each step needs a single global reduction */
+   if (max_eig_est && hypre_ParAMGDataChebyEigEst(amg_data) > 0)
+   {
+      HYPRE_Int          cheby_eig_reuse = hypre_ParAMGDataChebyEigReuse(amg_data);
+      HYPRE_Int          num_eig_vecs    = hypre_ParAMGDataChebyNumEigVecs(amg_data);
+      hypre_ParVector  **old_eig_vecs    = hypre_ParAMGDataChebyEigVecs(amg_data);
+      hypre_ParVector  **eig_vecs        = NULL;
+      HYPRE_Int         *cheby_levels;
+
+      cheby_levels = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_levels; j++)
+      {
+         /* same selection as in the loop below */
+         if ( grid_relax_type[1]  == 7 || grid_relax_type[2] == 7   ||
+              (grid_relax_type[3] == 7 && j == (num_levels - 1))    ||
+              grid_relax_type[1]  == 11 || grid_relax_type[2] == 11 ||
+              (grid_relax_type[3] == 11 && j == (num_levels - 1))   ||
+              grid_relax_type[1]  == 12 || grid_relax_type[2] == 12 ||
+              (grid_relax_type[3] == 12 && j == (num_levels - 1)) )
+         {
+            continue;
+         }
+         cheby_levels[j] = (grid_relax_type[1] == 16 || grid_relax_type[2] == 16 ||
+                            (grid_relax_type[3] == 16 && j == (num_levels - 1)));
+      }
+
+      /* start vectors kept from the previous setup */
+      if (cheby_eig_reuse)
+      {
+         eig_vecs = hypre_CTAlloc(hypre_ParVector *, num_levels, HYPRE_MEMORY_HOST);
+      }
+      for (j = 0; j < num_eig_vecs; j++)
+      {
+         if (j < num_levels && eig_vecs)
+         {
+            eig_vecs[j] = old_eig_vecs[j];
+         }
+         else
+         {
+            hypre_ParVectorDestroy(old_eig_vecs[j]);
+         }
+      }
+      hypre_TFree(old_eig_vecs, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRMaxEigEstimateCGLevels(num_levels, A_array, cheby_levels,
+                                         hypre_ParAMGDataChebyScale(amg_data),
+                                         hypre_ParAMGDataChebyEigEst(amg_data),
+                                         eig_vecs, max_eig_est, min_eig_est);
+
+      hypre_ParAMGDataChebyEigVecs(amg_data)    = eig_vecs;
+      hypre_ParAMGDataChebyNumEigVecs(amg_data) = eig_vecs ? num_levels : 0;
+      hypre_TFree(cheby_levels, HYPRE_MEMORY_HOST);
+   }
+
    for (j = 0; j < num_levels; j++)
    {
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(j);
@@ -3522,15 +3577,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_Real cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
          if (cheby_eig_est)
          {
-            hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est,
-                                         &max_eig, &min_eig);
+            /* estimated for all levels above */
+            max_eig = max_eig_est[j];
+            min_eig = min_eig_est[j];
          }
          else
          {
             hypre_ParCSRMaxEigEstimate(A_array[j], scale, &max_eig, &min_eig);
+            max_eig_est[j] = max_eig;
+            min_eig_est[j] = min_eig;
          }
-         max_eig_est[j] = max_eig;
-         min_eig_est[j] = min_eig;
 
          cheby_ds[j] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[j]));
          hypre_VectorVectorStride(cheby_ds[j])   = hypre_ParCSRMatrixNumRows(A_array[j]);
@@ -4038,6 +4094,23 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
 #endif
 
+   /* give the coarse level solution vectors a ghost region for the matvecs with A,
+      so that the residual computations in the cycle do not allocate halo buffers */
+   if (!block_mode)
+   {
+      for (level = 1; level < num_levels; level++)
+      {
+         if (!hypre_ParCSRMatrixCommPkg(A_array[level]))
+         {
+            hypre_MatvecCommPkgCreate(A_array[level]);
+         }
+         hypre_ParVectorInitializeGhost(U_array[level], hypre_ParCSRMatrixCommPkg(A_array[level]));
+      }
+   }
+
+   /* borrowed work vectors go back to the pool until the solve phase */
+   hypre_BoomerAMGReleaseWorkVectors(amg_data);
+
    hypre_MemoryPrintUsage(comm, hypre_HandleLogLevel(hypre_handle()), "BoomerAMG setup end", 0);
    hypre_GpuProfilingPopRange();
    HYPRE_ANNOTATE_FUNC_END;
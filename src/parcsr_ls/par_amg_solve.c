@@ -14,6 +14,196 @@
 #include "_hypre_parcsr_ls.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGResizeWorkVector
+ *
+ * Gives a hierarchy vector the number of components and the multivector
+ * layout (column-wise or interleaved) of the right-hand side.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResizeWorkVector( hypre_ParVector *vector,
+                                 HYPRE_Int        num_vectors,
+                                 HYPRE_Int        storage_method )
+{
+   if (vector)
+   {
+      hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(vector)) = storage_method;
+      hypre_ParVectorResize(vector, num_vectors);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGChooseFloatHaloLevels
+ *
+ * For float_halo_level = -2, marks the levels whose halo exchanges are
+ * bandwidth bound, taken to be those whose messages hold at least
+ * hypre_FLOAT_HALO_MIN_MSG_SIZE values on average over all processes.
+ * Both sides of an exchange must agree on the payload type, so the choice
+ * is global.
+ *--------------------------------------------------------------------*/
+
+#define hypre_FLOAT_HALO_MIN_MSG_SIZE 256
+
+static HYPRE_Int
+hypre_BoomerAMGChooseFloatHaloLevels( hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int             num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix  **A_array    = hypre_ParAMGDataAArray(amg_data);
+   MPI_Comm              comm       = hypre_ParCSRMatrixComm(A_array[0]);
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Real           *counts, *global_counts;
+   HYPRE_Int            *use_float;
+   HYPRE_Int             j;
+
+   counts        = hypre_CTAlloc(HYPRE_Real, 2 * num_levels, HYPRE_MEMORY_HOST);
+   global_counts = hypre_CTAlloc(HYPRE_Real, 2 * num_levels, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_levels; j++)
+   {
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A_array[j]);
+      if (comm_pkg)
+      {
+         counts[2 * j]     = (HYPRE_Real) hypre_ParCSRCommPkgNumSends(comm_pkg);
+         counts[2 * j + 1] = (HYPRE_Real)
+                             hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                                             hypre_ParCSRCommPkgNumSends(comm_pkg));
+      }
+   }
+   hypre_MPI_Allreduce(counts, global_counts, 2 * num_levels, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+
+   use_float = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_levels; j++)
+   {
+      use_float[j] = (global_counts[2 * j] > 0.0 &&
+                      global_counts[2 * j + 1] >=
+                      hypre_FLOAT_HALO_MIN_MSG_SIZE * global_counts[2 * j]);
+   }
+   hypre_ParAMGDataFloatHaloAuto(amg_data) = use_float;
+
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(global_counts, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSetFloatHalos
+ *
+ * Turns single-precision halo payloads on (on = 1) or off (on = 0) for
+ * the communication packages of the level matrices, interpolation and
+ * restriction operators from level float_halo_level downwards, or on the
+ * levels chosen by hypre_BoomerAMGChooseFloatHaloLevels. Returns the
+ * number of bytes saved by this process while the payloads were on.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_BoomerAMGSetFloatHalos( hypre_ParAMGData *amg_data,
+                              HYPRE_Int         on )
+{
+   HYPRE_Int             num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int             level      = hypre_ParAMGDataFloatHaloLevel(amg_data);
+   HYPRE_Int            *use_float  = hypre_ParAMGDataFloatHaloAuto(amg_data);
+   hypre_ParCSRMatrix  **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array    = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **R_array    = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParCSRMatrix   *M[3];
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Real            bytes_saved = 0.0;
+   HYPRE_Int             j, k;
+
+   for (j = hypre_max(level, 0); j < num_levels; j++)
+   {
+      if (level == -2 && !use_float[j])
+      {
+         continue;
+      }
+
+      M[0] = A_array[j];
+      M[1] = (j < num_levels - 1) ? P_array[j] : NULL;
+      M[2] = (j < num_levels - 1 && R_array && R_array[j] != P_array[j]) ? R_array[j] : NULL;
+
+      for (k = 0; k < 3; k++)
+      {
+         comm_pkg = M[k] ? hypre_ParCSRMatrixCommPkg(M[k]) : NULL;
+         if (comm_pkg)
+         {
+            if (on)
+            {
+               hypre_ParCSRCommPkgFloatHaloBytesSaved(comm_pkg) = 0.0;
+            }
+            bytes_saved += hypre_ParCSRCommPkgFloatHaloBytesSaved(comm_pkg);
+            hypre_ParCSRCommPkgFloatHalo(comm_pkg) = on;
+         }
+      }
+   }
+
+   return bytes_saved;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGMultiVecCycleSupported
+ *
+ * Returns 1 if the solve of the (set up) solver amg_vdata can be applied to
+ * multivectors of the given memory location in one pass with the same
+ * result as solving for each component, i.e., it runs a fixed number of
+ * cycles (tol = 0, since the convergence test would otherwise use the
+ * combined norm of all components), the cycle runs on the host, is
+ * multiplicative, and only uses the hybrid Gauss-Seidel family of
+ * smoothers (relax types 3, 4, 6, 8, 13, 14, 88 and 89), which relax all
+ * components together.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiVecCycleSupported( void                 *amg_vdata,
+                                       HYPRE_MemoryLocation  memory_location )
+{
+   hypre_ParAMGData  *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int          num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int         *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int          relax_type;
+   HYPRE_Int          k;
+
+   if (hypre_ParAMGDataTol(amg_data) > 0.0                      ||
+       hypre_GetExecPolicy1(memory_location) != HYPRE_EXEC_HOST ||
+       hypre_ParAMGDataBlockMode(amg_data)                      ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 0            ||
+       (hypre_ParAMGDataAdditive(amg_data)     >= 0 &&
+        hypre_ParAMGDataAdditive(amg_data)     < num_levels)    ||
+       (hypre_ParAMGDataMultAdditive(amg_data) >= 0 &&
+        hypre_ParAMGDataMultAdditive(amg_data) < num_levels)    ||
+       (hypre_ParAMGDataSimple(amg_data)       >= 0 &&
+        hypre_ParAMGDataSimple(amg_data)       < num_levels))
+   {
+      return 0;
+   }
+
+   /* relaxation on the down cycle, up cycle, and coarsest grid, or the
+      single smoother used when no coarsening occurred */
+   for (k = 1; k < 4; k++)
+   {
+      if (num_levels > 1)
+      {
+         relax_type = grid_relax_type[k];
+      }
+      else
+      {
+         relax_type = hypre_ParAMGDataUserRelaxType(amg_data);
+         relax_type = (relax_type == -1) ? 6 : relax_type;
+      }
+
+      if (relax_type != 3  && relax_type != 4  && relax_type != 6  && relax_type != 8 &&
+          relax_type != 13 && relax_type != 14 && relax_type != 88 && relax_type != 89)
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGSolve
  *--------------------------------------------------------------------*/
@@ -33,6 +223,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Int            cycle_count;
    HYPRE_Int            num_levels;
    HYPRE_Int            converge_type;
+   HYPRE_Int            conv_check_type;
+   HYPRE_Int            conv_check_freq;
    HYPRE_Int            block_mode;
    HYPRE_Int            additive;
    HYPRE_Int            mult_additive;
@@ -50,8 +242,13 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    /*  Local variables  */
    HYPRE_Int           j;
    HYPRE_Int           Solve_err_flag;
+   HYPRE_Int           check_resid;
+   HYPRE_Int           prev_check, last_check, next_check;
    HYPRE_Int           num_procs, my_id;
    HYPRE_Int           num_vectors;
+   HYPRE_Int           storage_method;
+   HYPRE_Int           float_halos;
+   HYPRE_Real          float_halo_bytes = 0.0;
    HYPRE_Real          alpha = 1.0;
    HYPRE_Real          beta = -1.0;
    HYPRE_Real          cycle_op_count;
@@ -68,6 +265,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Real          relative_resid;
    HYPRE_Real          rhs_norm = 0.0;
    HYPRE_Real          old_resid;
+   HYPRE_Real          num_pred_cycles;
    HYPRE_Real          ieee_check = 0.;
 
    hypre_ParVector    *Vtemp;
@@ -92,6 +290,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    U_array          = hypre_ParAMGDataUArray(amg_data);
 
    converge_type    = hypre_ParAMGDataConvergeType(amg_data);
+   conv_check_type  = hypre_ParAMGDataConvCheckType(amg_data);
+   conv_check_freq  = hypre_ParAMGDataConvCheckFreq(amg_data);
    tol              = hypre_ParAMGDataTol(amg_data);
    min_iter         = hypre_ParAMGDataMinIter(amg_data);
    max_iter         = hypre_ParAMGDataMaxIter(amg_data);
@@ -100,11 +300,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    mult_additive    = hypre_ParAMGDataMultAdditive(amg_data);
    block_mode       = hypre_ParAMGDataBlockMode(amg_data);
    A_block_array    = hypre_ParAMGDataABlockArray(amg_data);
-   Vtemp            = hypre_ParAMGDataVtemp(amg_data);
-   Rtemp            = hypre_ParAMGDataRtemp(amg_data);
-   Ptemp            = hypre_ParAMGDataPtemp(amg_data);
-   Ztemp            = hypre_ParAMGDataZtemp(amg_data);
    num_vectors      = hypre_ParVectorNumVectors(f);
+   storage_method   = hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(f));
 
    A_array[0] = A;
    F_array[0] = f;
@@ -118,19 +315,26 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       return hypre_error_flag;
    }
 
+   /* borrow the work vectors if they come from a vector pool */
+   hypre_BoomerAMGAcquireWorkVectors(amg_data, num_vectors, hypre_ParCSRMatrixMemoryLocation(A));
+   Vtemp            = hypre_ParAMGDataVtemp(amg_data);
+   Rtemp            = hypre_ParAMGDataRtemp(amg_data);
+   Ptemp            = hypre_ParAMGDataPtemp(amg_data);
+   Ztemp            = hypre_ParAMGDataZtemp(amg_data);
+
    /* Update work vectors */
-   hypre_ParVectorResize(Vtemp, num_vectors);
-   hypre_ParVectorResize(Rtemp, num_vectors);
-   hypre_ParVectorResize(Ptemp, num_vectors);
-   hypre_ParVectorResize(Ztemp, num_vectors);
+   hypre_BoomerAMGResizeWorkVector(Vtemp, num_vectors, storage_method);
+   hypre_BoomerAMGResizeWorkVector(Rtemp, num_vectors, storage_method);
+   hypre_BoomerAMGResizeWorkVector(Ptemp, num_vectors, storage_method);
+   hypre_BoomerAMGResizeWorkVector(Ztemp, num_vectors, storage_method);
    if (amg_logging > 1)
    {
-      hypre_ParVectorResize(Residual, num_vectors);
+      hypre_BoomerAMGResizeWorkVector(Residual, num_vectors, storage_method);
    }
    for (j = 1; j < num_levels; j++)
    {
-      hypre_ParVectorResize(F_array[j], num_vectors);
-      hypre_ParVectorResize(U_array[j], num_vectors);
+      hypre_BoomerAMGResizeWorkVector(F_array[j], num_vectors, storage_method);
+      hypre_BoomerAMGResizeWorkVector(U_array[j], num_vectors, storage_method);
    }
 
    /*-----------------------------------------------------------------------
@@ -210,6 +414,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         hypre_BoomerAMGReleaseWorkVectors(amg_data);
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -250,6 +455,29 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
                    relative_resid);
    }
 
+   /* cycle counts at which the previous, last and next residual checks are done */
+   prev_check = last_check = 0;
+   next_check = (conv_check_type == 1) ? conv_check_freq : 1;
+
+   /*-----------------------------------------------------------------------
+    *    Send single-precision halos inside the cycle when used as a
+    *    preconditioner, i.e., when a fixed number of cycles is applied
+    *-----------------------------------------------------------------------*/
+
+   float_halos = ((hypre_ParAMGDataFloatHaloLevel(amg_data) == -2 ||
+                   (hypre_ParAMGDataFloatHaloLevel(amg_data) >= 0 &&
+                    hypre_ParAMGDataFloatHaloLevel(amg_data) < num_levels)) &&
+                  tol == 0.0 && !block_mode);
+   if (float_halos)
+   {
+      if (hypre_ParAMGDataFloatHaloLevel(amg_data) == -2 &&
+          !hypre_ParAMGDataFloatHaloAuto(amg_data))
+      {
+         hypre_BoomerAMGChooseFloatHaloLevels(amg_data);
+      }
+      hypre_BoomerAMGSetFloatHalos(amg_data, 1);
+   }
+
    /*-----------------------------------------------------------------------
     *    Main V-cycle loop
     *-----------------------------------------------------------------------*/
@@ -274,9 +502,19 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
       /*---------------------------------------------------------------
        *    Compute  fine-grid residual and residual norm
+       *
+       *    With a lagged convergence check (conv_check_type > 0), this is
+       *    skipped until the next scheduled check, but always done after
+       *    the last cycle.
        *----------------------------------------------------------------*/
 
-      if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
+      check_resid = (amg_print_level > 1 || amg_logging > 1 || tol > 0.);
+      if (conv_check_type > 0 && cycle_count + 1 < next_check && cycle_count + 1 < max_iter)
+      {
+         check_resid = 0;
+      }
+
+      if (check_resid)
       {
          old_resid = resid_nrm;
 
@@ -302,6 +540,12 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             conv_factor = resid_nrm;
          }
 
+         /* average convergence factor per cycle since the last check */
+         if (cycle_count + 1 - last_check > 1)
+         {
+            conv_factor = hypre_pow(conv_factor, 1.0 / (HYPRE_Real) (cycle_count + 1 - last_check));
+         }
+
          if (0 == converge_type)
          {
             if (rhs_norm)
@@ -319,6 +563,26 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
          }
 
          hypre_ParAMGDataRelativeResidualNorm(amg_data) = relative_resid;
+
+         /* schedule the next convergence check */
+         prev_check = last_check;
+         last_check = cycle_count + 1;
+         next_check = last_check + 1;
+         if (conv_check_type == 1)
+         {
+            next_check = last_check + conv_check_freq;
+         }
+         else if (conv_check_type == 2 && tol > 0. && relative_resid >= tol &&
+                  conv_factor > 0. && conv_factor < 1.)
+         {
+            /* number of cycles predicted to reach the tolerance. Early factors
+               are unreliable, so only half of the predicted cycles, and at most
+               twice as many cycles as since the previous check, are done before
+               checking again */
+            num_pred_cycles = hypre_log(tol / relative_resid) / hypre_log(conv_factor);
+            num_pred_cycles = hypre_min(0.5 * num_pred_cycles, (HYPRE_Real) (2 * (last_check - prev_check)));
+            next_check = last_check + hypre_max(1, (HYPRE_Int) num_pred_cycles);
+         }
       }
 
       ++cycle_count;
@@ -328,13 +592,19 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       ++hypre_ParAMGDataCumNumIterations(amg_data);
 #endif
 
-      if (my_id == 0 && amg_print_level > 1)
+      if (my_id == 0 && amg_print_level > 1 && check_resid)
       {
          hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
                       resid_nrm, conv_factor, relative_resid);
       }
    }
 
+   if (float_halos)
+   {
+      float_halo_bytes = hypre_BoomerAMGSetFloatHalos(amg_data, 0);
+      hypre_ParAMGDataFloatHaloBytes(amg_data) += float_halo_bytes;
+   }
+
    if (cycle_count == max_iter && tol > 0.)
    {
       Solve_err_flag = 1;
@@ -415,9 +685,29 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
          hypre_printf("                   cycle = %f\n\n\n\n", cycle_cmplxty);
       }
 
+      if (float_halos)
+      {
+         HYPRE_Real total_float_halo_bytes;
+
+         hypre_MPI_Allreduce(&float_halo_bytes, &total_float_halo_bytes, 1, HYPRE_MPI_REAL,
+                             hypre_MPI_SUM, comm);
+         if (my_id == 0 && hypre_ParAMGDataFloatHaloLevel(amg_data) == -2)
+         {
+            hypre_printf(" Single-precision halos (automatic levels): %e bytes saved\n\n\n",
+                         total_float_halo_bytes);
+         }
+         else if (my_id == 0)
+         {
+            hypre_printf(" Single-precision halos (levels >= %d): %e bytes saved\n\n\n",
+                         hypre_ParAMGDataFloatHaloLevel(amg_data), total_float_halo_bytes);
+         }
+      }
+
       hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
       hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
    }
+
+   hypre_BoomerAMGReleaseWorkVectors(amg_data);
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
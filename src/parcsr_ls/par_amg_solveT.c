@@ -107,6 +107,8 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
       hypre_ParVectorInitialize(Vtemp);
       hypre_ParAMGDataVtemp(amg_data) = Vtemp;
    */
+   hypre_BoomerAMGAcquireWorkVectors(amg_data, hypre_ParVectorNumVectors(f),
+                                     hypre_ParCSRMatrixMemoryLocation(A));
    Vtemp = hypre_ParAMGDataVtemp(amg_data);
    for (j = 1; j < num_levels; j++)
    {
@@ -292,6 +294,7 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
    hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
    hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
 
+   hypre_BoomerAMGReleaseWorkVectors(amg_data);
    HYPRE_ANNOTATE_FUNC_END;
 
    return (Solve_err_flag);
@@ -0,0 +1,597 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Incremental update of a BoomerAMG hierarchy after local changes of A
+ *
+ * The C/F splittings and interpolation operators of the previous setup are
+ * kept. If the rows S of A_l change, the Galerkin operator P^T A_l P only
+ * changes in the coarse rows K that interpolate to S, i.e., the columns of
+ * P(S,:). These rows are recomputed as P_K^T (A_l(F_K,:) P), where P_K holds
+ * the columns K of P and F_K are the fine rows with nonzeros in P_K. The set
+ * K is the set of modified rows of the next level. The rows K of P^T are
+ * taken from a transpose of P that is kept between updates, along with its
+ * transpose plan, until the next full setup.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGUpdateExtract
+ *
+ * Returns a host copy of A that is restricted to the rows i with
+ * row_marker[i] == keep and to the columns marked in col_marker and
+ * col_marker_offd. NULL markers select all rows or columns. The column map
+ * of the off-diagonal part is copied unchanged.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRMatrix *
+hypre_BoomerAMGUpdateExtract( hypre_ParCSRMatrix *A,
+                              HYPRE_Int          *row_marker,
+                              HYPRE_Int           keep,
+                              HYPRE_Int          *col_marker,
+                              HYPRE_Int          *col_marker_offd )
+{
+   hypre_CSRMatrix     *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int           *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex       *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix     *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i        = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j        = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex       *A_offd_data     = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int            num_rows        = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd   = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_ParCSRMatrix  *B;
+   HYPRE_Int           *B_diag_i, *B_diag_j, *B_offd_i, *B_offd_j;
+   HYPRE_Complex       *B_diag_data, *B_offd_data;
+   HYPRE_Int            nnz_diag = 0, nnz_offd = 0;
+   HYPRE_Int            i, jj;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      if (row_marker && row_marker[i] != keep)
+      {
+         continue;
+      }
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         if (!col_marker || col_marker[A_diag_j[jj]])
+         {
+            nnz_diag++;
+         }
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+      {
+         if (!col_marker_offd || col_marker_offd[A_offd_j[jj]])
+         {
+            nnz_offd++;
+         }
+      }
+   }
+
+   B = hypre_ParCSRMatrixCreate(hypre_ParCSRMatrixComm(A),
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixGlobalNumCols(A),
+                                hypre_ParCSRMatrixRowStarts(A),
+                                hypre_ParCSRMatrixColStarts(A),
+                                num_cols_offd, nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(B, HYPRE_MEMORY_HOST);
+
+   B_diag_i    = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(B));
+   B_diag_j    = hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(B));
+   B_diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(B));
+   B_offd_i    = hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(B));
+   B_offd_j    = hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(B));
+   B_offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(B));
+
+   nnz_diag = nnz_offd = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      B_diag_i[i] = nnz_diag;
+      B_offd_i[i] = nnz_offd;
+      if (row_marker && row_marker[i] != keep)
+      {
+         continue;
+      }
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         if (!col_marker || col_marker[A_diag_j[jj]])
+         {
+            B_diag_j[nnz_diag]      = A_diag_j[jj];
+            B_diag_data[nnz_diag++] = A_diag_data[jj];
+         }
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+      {
+         if (!col_marker_offd || col_marker_offd[A_offd_j[jj]])
+         {
+            B_offd_j[nnz_offd]      = A_offd_j[jj];
+            B_offd_data[nnz_offd++] = A_offd_data[jj];
+         }
+      }
+   }
+   B_diag_i[num_rows] = nnz_diag;
+   B_offd_i[num_rows] = nnz_offd;
+
+   hypre_TMemcpy(hypre_ParCSRMatrixColMapOffd(B), hypre_ParCSRMatrixColMapOffd(A),
+                 HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   return B;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGUpdateCoarseOperator
+ *
+ * Given the coarse operator A_H = P^T A P of a previous setup, PT = P^T and
+ * the marker of the local rows of A that changed since then, computes the new
+ * coarse operator and the marker of its local rows that changed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGUpdateCoarseOperator( hypre_ParCSRMatrix  *A,
+                                     hypre_ParCSRMatrix  *P,
+                                     hypre_ParCSRMatrix  *PT,
+                                     HYPRE_Int           *fine_marker,
+                                     hypre_ParCSRMatrix  *A_H,
+                                     hypre_ParCSRMatrix **A_H_ptr,
+                                     HYPRE_Int          **coarse_marker_ptr )
+{
+   hypre_CSRMatrix      *P_diag        = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int            *P_diag_i      = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int            *P_diag_j      = hypre_CSRMatrixJ(P_diag);
+   hypre_CSRMatrix      *P_offd        = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int            *P_offd_i      = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int            *P_offd_j      = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Int             num_rows      = hypre_CSRMatrixNumRows(P_diag);
+   HYPRE_Int             num_coarse    = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int             num_cols_offd = hypre_CSRMatrixNumCols(P_offd);
+
+   hypre_ParCSRCommPkg  *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int             num_sends, send_size;
+   HYPRE_Int            *int_buf_data;
+   HYPRE_Int            *coarse_marker;
+   HYPRE_Int            *coarse_marker_offd;
+   HYPRE_Int            *row_marker;
+
+   hypre_ParCSRMatrix   *PT_K, *A_R, *AP, *C, *A_H_kept, *A_H_new;
+   HYPRE_Int             i, j, jj;
+
+   if (!hypre_ParCSRMatrixCommPkg(P))
+   {
+      hypre_MatvecCommPkgCreate(P);
+   }
+   comm_pkg  = hypre_ParCSRMatrixCommPkg(P);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   /* Coarse points that interpolate to modified fine rows */
+   coarse_marker      = hypre_CTAlloc(HYPRE_Int, num_coarse, HYPRE_MEMORY_HOST);
+   coarse_marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   int_buf_data       = hypre_CTAlloc(HYPRE_Int, send_size, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      if (fine_marker[i])
+      {
+         for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+         {
+            coarse_marker[P_diag_j[jj]] = 1;
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+         {
+            coarse_marker_offd[P_offd_j[jj]] = 1;
+         }
+      }
+   }
+
+   /* Inform the owners of off-processor coarse points ... */
+   comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg, coarse_marker_offd, int_buf_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   for (j = 0; j < send_size; j++)
+   {
+      if (int_buf_data[j])
+      {
+         coarse_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)] = 1;
+      }
+   }
+
+   /* ... and return the complete marker to all processes that use them */
+   for (j = 0; j < send_size; j++)
+   {
+      int_buf_data[j] = coarse_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, coarse_marker_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* Fine rows F_K interpolating from the coarse points K */
+   row_marker = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = P_diag_i[i]; jj < P_diag_i[i + 1] && !row_marker[i]; jj++)
+      {
+         row_marker[i] = coarse_marker[P_diag_j[jj]];
+      }
+      for (jj = P_offd_i[i]; jj < P_offd_i[i + 1] && !row_marker[i]; jj++)
+      {
+         row_marker[i] = coarse_marker_offd[P_offd_j[jj]];
+      }
+   }
+   A_R = hypre_BoomerAMGUpdateExtract(A, row_marker, 1, NULL, NULL);
+
+   /* Rows K of P^T A P */
+   PT_K = hypre_BoomerAMGUpdateExtract(PT, coarse_marker, 1, NULL, NULL);
+   AP   = hypre_ParCSRMatMat(A_R, P);
+   C    = hypre_ParCSRMatMat(PT_K, AP);
+
+   /* Replace rows K of the previous coarse operator */
+   A_H_kept = hypre_BoomerAMGUpdateExtract(A_H, coarse_marker, 0, NULL, NULL);
+   hypre_ParCSRMatrixAdd(1.0, A_H_kept, 1.0, C, &A_H_new);
+   hypre_ParCSRMatrixReorder(A_H_new);
+   hypre_ParCSRMatrixSetNumNonzeros(A_H_new);
+   hypre_ParCSRMatrixSetDNumNonzeros(A_H_new);
+   if (!hypre_ParCSRMatrixCommPkg(A_H_new))
+   {
+      hypre_MatvecCommPkgCreate(A_H_new);
+   }
+
+   hypre_ParCSRMatrixDestroy(PT_K);
+   hypre_ParCSRMatrixDestroy(A_R);
+   hypre_ParCSRMatrixDestroy(AP);
+   hypre_ParCSRMatrixDestroy(C);
+   hypre_ParCSRMatrixDestroy(A_H_kept);
+   hypre_TFree(row_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_marker_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+
+   *A_H_ptr           = A_H_new;
+   *coarse_marker_ptr = coarse_marker;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGUpdateDestroyTransposes
+ *
+ * Frees the transposes of P, and their plans, kept by
+ * hypre_BoomerAMGSetupUpdate.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGUpdateDestroyTransposes( void *amg_vdata )
+{
+   hypre_ParAMGData           *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix        **PT_array = hypre_ParAMGDataUpdatePTArray(amg_data);
+   hypre_ParCSRTransposePlan **PT_plans = hypre_ParAMGDataUpdatePTPlans(amg_data);
+   HYPRE_Int                   level;
+
+   if (PT_array)
+   {
+      for (level = 0; level < hypre_ParAMGDataNumLevels(amg_data) - 1; level++)
+      {
+         hypre_ParCSRMatrixDestroy(PT_array[level]);
+         hypre_ParCSRTransposePlanDestroy(PT_plans[level]);
+      }
+   }
+   hypre_TFree(PT_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(PT_plans, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataUpdatePTArray(amg_data) = NULL;
+   hypre_ParAMGDataUpdatePTPlans(amg_data) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGUpdateSupported
+ *
+ * Returns 1 if the hierarchy of amg_data can be updated for the matrix A,
+ * i.e., if it consists of Galerkin operators with R = P^T and all level data
+ * other than l1 norms and direct coarse solves is independent of A.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGUpdateSupported( hypre_ParAMGData   *amg_data,
+                                hypre_ParCSRMatrix *A )
+{
+   hypre_ParCSRMatrix  **A_array          = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int             num_levels       = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            *grid_relax_type  = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int             coarse_threshold = hypre_ParAMGDataMaxCoarseSize(amg_data);
+   HYPRE_Int             seq_threshold    = hypre_ParAMGDataSeqThreshold(amg_data);
+   HYPRE_Int             num_procs, k;
+   HYPRE_BigInt          coarse_size;
+
+   if (!A_array || num_levels < 1 || !A_array[0])
+   {
+      return 0;
+   }
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_DEVICE)
+   {
+      return 0;
+   }
+#endif
+
+   /* same row partitioning as in the previous setup */
+   if (hypre_ParCSRMatrixGlobalNumRows(A) != hypre_ParCSRMatrixGlobalNumRows(A_array[0]) ||
+       hypre_ParCSRMatrixNumRows(A) != hypre_ParCSRMatrixNumRows(A_array[0]))
+   {
+      return 0;
+   }
+
+   /* coarse operators and level data that are not P^T A P based */
+   if (hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataRestriction(amg_data) ||
+       hypre_ParAMGDataADropTol(amg_data) > 0.0 ||
+       (hypre_ParAMGDataFilterFunctions(amg_data) && hypre_ParAMGDataNumFunctions(amg_data) > 1) ||
+       hypre_ParAMGDataNonGalerkNumTol(amg_data) > 0 ||
+       hypre_ParAMGDataNonGalTolArray(amg_data) ||
+       hypre_ParAMGDataNonGalerkinTol(amg_data) > 0.0 ||
+       hypre_ParAMGDataAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataSimple(amg_data) > -1 ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 0)
+   {
+      return 0;
+   }
+
+   /* smoothers with data other than l1 norms */
+   for (k = 0; k < 4; k++)
+   {
+      if (grid_relax_type[k] ==  7 || grid_relax_type[k] == 11 || grid_relax_type[k] == 12 ||
+          grid_relax_type[k] == 15 || grid_relax_type[k] == 16)
+      {
+         return 0;
+      }
+   }
+
+   /* redundant or distributed direct coarse solves */
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+   coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[num_levels - 1]);
+   if (num_procs > 1 && seq_threshold >= coarse_threshold &&
+       coarse_size > (HYPRE_BigInt) coarse_threshold &&
+       num_levels != hypre_ParAMGDataMaxLevels(amg_data))
+   {
+      return 0;
+   }
+#if defined(HYPRE_USING_DSUPERLU)
+   if (hypre_ParAMGDataDSLUSolver(amg_data))
+   {
+      return 0;
+   }
+#endif
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupUpdate
+ *
+ * Updates the hierarchy of a previous hypre_BoomerAMGSetup after the rows
+ * with global indices rows[0:num_rows-1] (owned by this process) of A have
+ * been modified. Falls back to hypre_BoomerAMGSetup when the hierarchy does
+ * not support updates or when more than update_max_fraction of all rows
+ * have been modified.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupUpdate( void               *amg_vdata,
+                            hypre_ParCSRMatrix *A,
+                            hypre_ParVector    *f,
+                            hypre_ParVector    *u,
+                            HYPRE_Int           num_rows,
+                            HYPRE_BigInt       *rows )
+{
+   hypre_ParAMGData     *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   MPI_Comm              comm            = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt          first_row       = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_Int             local_size      = hypre_ParCSRMatrixNumRows(A);
+   HYPRE_Int             amg_print_level = hypre_ParAMGDataPrintLevel(amg_data);
+
+   hypre_ParCSRMatrix  **A_array;
+   hypre_ParCSRMatrix  **P_array;
+   hypre_ParCSRMatrix  **PT_array;
+   hypre_ParCSRTransposePlan **PT_plans;
+   hypre_IntArray      **CF_marker_array;
+   hypre_ParVector     **U_array;
+   hypre_Vector        **l1_norms;
+   HYPRE_Int            *grid_relax_type;
+   HYPRE_Int             num_levels, relax_order;
+
+   hypre_ParCSRMatrix   *A_H;
+   HYPRE_Int            *row_marker, *coarse_marker;
+   HYPRE_BigInt          num_changed, global_num_changed;
+   HYPRE_Int             my_id, level, i, l1_option;
+   HYPRE_Real           *l1_norm_data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!hypre_BoomerAMGUpdateSupported(amg_data, A))
+   {
+      return hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* Mark the modified local rows */
+   row_marker = hypre_CTAlloc(HYPRE_Int, local_size, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      if (rows[i] < first_row || rows[i] >= first_row + local_size)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Modified row is not owned by this process!");
+         hypre_TFree(row_marker, HYPRE_MEMORY_HOST);
+         HYPRE_ANNOTATE_FUNC_END;
+         return hypre_error_flag;
+      }
+      row_marker[(HYPRE_Int) (rows[i] - first_row)] = 1;
+   }
+
+   num_changed = 0;
+   for (i = 0; i < local_size; i++)
+   {
+      num_changed += (HYPRE_BigInt) row_marker[i];
+   }
+   hypre_MPI_Allreduce(&num_changed, &global_num_changed, 1, HYPRE_MPI_BIG_INT,
+                       hypre_MPI_SUM, comm);
+
+   if ((HYPRE_Real) global_num_changed >
+       hypre_ParAMGDataUpdateMaxFraction(amg_data) * (HYPRE_Real) hypre_ParCSRMatrixGlobalNumRows(A))
+   {
+      hypre_TFree(row_marker, HYPRE_MEMORY_HOST);
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+   }
+
+   A_array         = hypre_ParAMGDataAArray(amg_data);
+   P_array         = hypre_ParAMGDataPArray(amg_data);
+   CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   U_array         = hypre_ParAMGDataUArray(amg_data);
+   l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+
+   A_array[0] = A;
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+
+   /* Transposes of P, kept until the next full setup */
+   if (!hypre_ParAMGDataUpdatePTArray(amg_data))
+   {
+      hypre_ParAMGDataUpdatePTArray(amg_data) = hypre_CTAlloc(hypre_ParCSRMatrix *,
+                                                              num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataUpdatePTPlans(amg_data) = hypre_CTAlloc(hypre_ParCSRTransposePlan *,
+                                                              num_levels, HYPRE_MEMORY_HOST);
+   }
+   PT_array = hypre_ParAMGDataUpdatePTArray(amg_data);
+   PT_plans = hypre_ParAMGDataUpdatePTPlans(amg_data);
+
+   /*-----------------------------------------------------------------------
+    * Update the coarse operators level by level
+    *-----------------------------------------------------------------------*/
+
+   if (amg_print_level == 1 || amg_print_level == 3)
+   {
+      if (my_id == 0)
+      {
+         hypre_printf("\n BoomerAMG setup update, modified rows per level:\n");
+         hypre_printf("   level %2d: %b\n", 0, global_num_changed);
+      }
+   }
+
+   for (level = 0; level < num_levels - 1 && global_num_changed > 0; level++)
+   {
+      /* The first update creates P^T and its plan; later ones only refresh
+       * the values of P^T through the plan */
+      if (!PT_array[level])
+      {
+         hypre_ParCSRTransposePlanCreate(P_array[level], &PT_array[level], &PT_plans[level]);
+      }
+      else
+      {
+         hypre_ParCSRTransposePlanApply(PT_plans[level], P_array[level], PT_array[level]);
+      }
+
+      hypre_BoomerAMGUpdateCoarseOperator(A_array[level], P_array[level], PT_array[level],
+                                          row_marker, A_array[level + 1], &A_H,
+                                          &coarse_marker);
+      hypre_ParCSRMatrixDestroy(A_array[level + 1]);
+      A_array[level + 1] = A_H;
+
+      hypre_TFree(row_marker, HYPRE_MEMORY_HOST);
+      row_marker = coarse_marker;
+
+      num_changed = 0;
+      for (i = 0; i < hypre_ParCSRMatrixNumRows(A_H); i++)
+      {
+         num_changed += (HYPRE_BigInt) row_marker[i];
+      }
+      hypre_MPI_Allreduce(&num_changed, &global_num_changed, 1, HYPRE_MPI_BIG_INT,
+                          hypre_MPI_SUM, comm);
+
+      if ((amg_print_level == 1 || amg_print_level == 3) && my_id == 0)
+      {
+         hypre_printf("   level %2d: %b\n", level + 1, global_num_changed);
+      }
+
+      /* the ghost region of the solution vector follows the new comm. package */
+      hypre_ParVectorInitializeGhost(U_array[level + 1], hypre_ParCSRMatrixCommPkg(A_H));
+   }
+   hypre_TFree(row_marker, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Refresh the relaxation and coarse solver data of the modified levels
+    *-----------------------------------------------------------------------*/
+
+   for (i = 0; i < hypre_min(level + 1, num_levels); i++)
+   {
+      l1_option = hypre_BoomerAMGRelaxL1NormOption(grid_relax_type, i, num_levels);
+      if (l1_norms && l1_option)
+      {
+         l1_norm_data = NULL;
+         hypre_ParCSRComputeL1Norms(A_array[i], l1_option,
+                                    (relax_order && i < num_levels - 1) ?
+                                    hypre_IntArrayData(CF_marker_array[i]) : NULL,
+                                    &l1_norm_data);
+
+         hypre_SeqVectorDestroy(l1_norms[i]);
+         l1_norms[i] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[i]));
+         hypre_VectorData(l1_norms[i]) = l1_norm_data;
+         hypre_SeqVectorInitialize_v2(l1_norms[i], hypre_ParCSRMatrixMemoryLocation(A_array[i]));
+      }
+   }
+
+   if (level == num_levels - 1 &&
+       (grid_relax_type[3] == 9   || grid_relax_type[3] == 19  ||
+        grid_relax_type[3] == 98  || grid_relax_type[3] == 99  ||
+        grid_relax_type[3] == 198 || grid_relax_type[3] == 199))
+   {
+      HYPRE_MemoryLocation ge_memory_location = hypre_ParAMGDataGEMemoryLocation(amg_data);
+
+#if defined(HYPRE_USING_MAGMA)
+      hypre_TFree(hypre_ParAMGDataAPiv(amg_data),  HYPRE_MEMORY_HOST);
+#else
+      hypre_TFree(hypre_ParAMGDataAPiv(amg_data),  ge_memory_location);
+#endif
+      hypre_TFree(hypre_ParAMGDataAMat(amg_data),  ge_memory_location);
+      hypre_TFree(hypre_ParAMGDataAWork(amg_data), ge_memory_location);
+      hypre_TFree(hypre_ParAMGDataBVec(amg_data),  ge_memory_location);
+      hypre_TFree(hypre_ParAMGDataUVec(amg_data),  ge_memory_location);
+      hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+      if (hypre_ParAMGDataNewComm(amg_data) != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&hypre_ParAMGDataNewComm(amg_data));
+         hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
+      }
+
+      hypre_GaussElimSetup(amg_data, num_levels - 1, grid_relax_type[3]);
+   }
+
+   if (amg_print_level == 1 || amg_print_level == 3)
+   {
+      hypre_BoomerAMGSetupStats(amg_data, A);
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
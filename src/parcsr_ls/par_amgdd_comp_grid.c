@@ -208,6 +208,57 @@ hypre_AMGDDCompGridMatvec( HYPRE_Complex alpha,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMGDDCompGridMatvecT
+ *
+ * Computes y = alpha*A^T*x + beta*y directly from the blocks of A. This is
+ * used to apply R = P^T without storing a transposed copy of P.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AMGDDCompGridMatvecT( HYPRE_Complex alpha,
+                            hypre_AMGDDCompGridMatrix *A,
+                            hypre_AMGDDCompGridVector *x,
+                            HYPRE_Complex beta,
+                            hypre_AMGDDCompGridVector *y )
+{
+   hypre_CSRMatrix *owned_diag    = hypre_AMGDDCompGridMatrixOwnedDiag(A);
+   hypre_CSRMatrix *owned_offd    = hypre_AMGDDCompGridMatrixOwnedOffd(A);
+   hypre_CSRMatrix *nonowned_diag = hypre_AMGDDCompGridMatrixNonOwnedDiag(A);
+   hypre_CSRMatrix *nonowned_offd = hypre_AMGDDCompGridMatrixNonOwnedOffd(A);
+
+   hypre_Vector *x_owned    = hypre_AMGDDCompGridVectorOwned(x);
+   hypre_Vector *x_nonowned = hypre_AMGDDCompGridVectorNonOwned(x);
+   hypre_Vector *y_owned    = hypre_AMGDDCompGridVectorOwned(y);
+   hypre_Vector *y_nonowned = hypre_AMGDDCompGridVectorNonOwned(y);
+
+   HYPRE_Int     num_nonowned = hypre_VectorSize(x_nonowned);
+
+   /* Owned range of A^T: transposes of the owned and nonowned offd blocks */
+   hypre_CSRMatrixMatvecT(alpha, owned_diag, x_owned, beta, y_owned);
+
+   if (nonowned_offd && num_nonowned)
+   {
+      hypre_CSRMatrixMatvecT(alpha, nonowned_offd, x_nonowned, 1.0, y_owned);
+   }
+
+   /* Nonowned range of A^T */
+   if (nonowned_diag && num_nonowned)
+   {
+      hypre_CSRMatrixMatvecT(alpha, nonowned_diag, x_nonowned, beta, y_nonowned);
+      if (owned_offd)
+      {
+         hypre_CSRMatrixMatvecT(alpha, owned_offd, x_owned, 1.0, y_nonowned);
+      }
+   }
+   else if (owned_offd)
+   {
+      hypre_CSRMatrixMatvecT(alpha, owned_offd, x_owned, beta, y_nonowned);
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_AMGDDCompGridRealMatvec( HYPRE_Complex alpha,
                                hypre_AMGDDCompGridMatrix *A,
@@ -1495,35 +1546,8 @@ HYPRE_Int hypre_AMGDDCompGridFinalize( hypre_ParAMGDDData *amgdd_data )
       hypre_TFree(new_indices, memory_location);
    }
 
-   // Setup R = P^T if R not specified
-   if (!hypre_ParAMGDataRestriction(amg_data))
-   {
-      for (level = start_level; level < num_levels - 1; level++)
-      {
-         // !!! TODO: if BoomerAMG explicitly stores R = P^T, use those matrices in
-         hypre_AMGDDCompGridR(compGrid[level]) = hypre_AMGDDCompGridMatrixCreate();
-         hypre_AMGDDCompGridMatrixOwnsOwnedMatrices(hypre_AMGDDCompGridR(compGrid[level])) = 1;
-         hypre_CSRMatrixTranspose(hypre_AMGDDCompGridMatrixOwnedDiag(hypre_AMGDDCompGridP(compGrid[level])),
-                                  &hypre_AMGDDCompGridMatrixOwnedDiag(hypre_AMGDDCompGridR(compGrid[level])), 1);
-
-         if (hypre_AMGDDCompGridNumNonOwnedNodes(compGrid[level]))
-         {
-            hypre_CSRMatrixTranspose(hypre_AMGDDCompGridMatrixNonOwnedOffd(hypre_AMGDDCompGridP(
-                                                                              compGrid[level])),
-                                     &hypre_AMGDDCompGridMatrixOwnedOffd(hypre_AMGDDCompGridR(compGrid[level])), 1);
-         }
-
-         hypre_CSRMatrixTranspose(hypre_AMGDDCompGridMatrixOwnedOffd(hypre_AMGDDCompGridP(compGrid[level])),
-                                  &hypre_AMGDDCompGridMatrixNonOwnedOffd(hypre_AMGDDCompGridR(compGrid[level])), 1);
-
-         if (hypre_AMGDDCompGridNumNonOwnedNodes(compGrid[level]))
-         {
-            hypre_CSRMatrixTranspose(hypre_AMGDDCompGridMatrixNonOwnedDiag(hypre_AMGDDCompGridP(
-                                                                              compGrid[level])),
-                                     &hypre_AMGDDCompGridMatrixNonOwnedDiag(hypre_AMGDDCompGridR(compGrid[level])), 1);
-         }
-      }
-   }
+   // NOTE: if R is not specified, R = P^T is applied through hypre_AMGDDCompGridMatvecT
+   // with the composite grid P, so no transposed copies of P are stored
 
    // Finish up comm pkg
    if (amgddCommPkg)
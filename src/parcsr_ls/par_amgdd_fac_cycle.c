@@ -145,9 +145,18 @@ hypre_BoomerAMGDD_FAC_Restrict( hypre_AMGDDCompGrid *compGrid_f,
    // If we need to preserve the updates on the next level
    if (hypre_AMGDDCompGridS(compGrid_c))
    {
-      hypre_AMGDDCompGridMatvec(1.0, hypre_AMGDDCompGridR(compGrid_f),
-                                hypre_AMGDDCompGridS(compGrid_f),
-                                0.0, hypre_AMGDDCompGridS(compGrid_c));
+      if (hypre_AMGDDCompGridR(compGrid_f))
+      {
+         hypre_AMGDDCompGridMatvec(1.0, hypre_AMGDDCompGridR(compGrid_f),
+                                   hypre_AMGDDCompGridS(compGrid_f),
+                                   0.0, hypre_AMGDDCompGridS(compGrid_c));
+      }
+      else
+      {
+         hypre_AMGDDCompGridMatvecT(1.0, hypre_AMGDDCompGridP(compGrid_f),
+                                    hypre_AMGDDCompGridS(compGrid_f),
+                                    0.0, hypre_AMGDDCompGridS(compGrid_c));
+      }
 
       // Subtract restricted update from recalculated residual: f_{l+1} <- f_{l+1} - s_{l+1}
       hypre_AMGDDCompGridVectorAxpy(-1.0, hypre_AMGDDCompGridS(compGrid_c),
@@ -156,9 +165,18 @@ hypre_BoomerAMGDD_FAC_Restrict( hypre_AMGDDCompGrid *compGrid_f,
    else
    {
       // Restrict and subtract update from recalculated residual: f_{l+1} <- f_{l+1} - P_l^Ts_l
-      hypre_AMGDDCompGridMatvec(-1.0, hypre_AMGDDCompGridR(compGrid_f),
-                                hypre_AMGDDCompGridS(compGrid_f),
-                                1.0, hypre_AMGDDCompGridF(compGrid_c));
+      if (hypre_AMGDDCompGridR(compGrid_f))
+      {
+         hypre_AMGDDCompGridMatvec(-1.0, hypre_AMGDDCompGridR(compGrid_f),
+                                   hypre_AMGDDCompGridS(compGrid_f),
+                                   1.0, hypre_AMGDDCompGridF(compGrid_c));
+      }
+      else
+      {
+         hypre_AMGDDCompGridMatvecT(-1.0, hypre_AMGDDCompGridP(compGrid_f),
+                                    hypre_AMGDDCompGridS(compGrid_f),
+                                    1.0, hypre_AMGDDCompGridF(compGrid_c));
+      }
    }
 
    // Zero out initial guess on coarse grid
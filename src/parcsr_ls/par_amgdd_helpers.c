@@ -123,11 +123,13 @@ hypre_BoomerAMGDD_AddToSendAndRequestDofs( hypre_ParCSRMatrix     *A,
                                            HYPRE_Int            ***req_dofs,
                                            HYPRE_Int            ***req_dof_dist )
 {
-   HYPRE_Int  *req_cnt;
-   HYPRE_Int   neighbor_global_index;
-   HYPRE_Int   recv_proc;
+   hypre_ParCSRCommPkg *commPkg = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            proc_id = hypre_AMGDDCommPkgSendProcs(compGridCommPkg)[level][send_proc];
+   HYPRE_Int           *req_cnt;
+   HYPRE_Int            neighbor_global_index;
+   HYPRE_Int            recv_proc;
 
-   HYPRE_Int   i, idx;
+   HYPRE_Int            i, idx;
 
    for (i = 0; i < hypre_ParCSRMatrixNumRows(A); i++)
    {
@@ -158,21 +160,21 @@ hypre_BoomerAMGDD_AddToSendAndRequestDofs( hypre_ParCSRMatrix     *A,
          }
       }
    }
-   // Count request dofs and alloc/realloc req_dofs and req_dof_dist
+   // Count request dofs and alloc/realloc req_dofs and req_dof_dist.
+   // The offd columns received from each proc are contiguous, so loop over the recv procs directly.
    req_cnt = hypre_CTAlloc(HYPRE_Int, num_csr_recv_procs, HYPRE_MEMORY_HOST);
-   for (i = 0; i < num_csr_recv_procs; i++)
-   {
-      req_cnt[i] = num_req_dofs[i][send_proc];
-   }
-   for (i = 0; i < hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)); i++)
+   for (recv_proc = 0; recv_proc < num_csr_recv_procs; recv_proc++)
    {
-      if (add_flag_requests[i])
+      req_cnt[recv_proc] = num_req_dofs[recv_proc][send_proc];
+      if (hypre_AMGDDCommPkgRecvProcs(compGridCommPkg)[level][recv_proc] != proc_id)
       {
-         recv_proc = hypre_BoomerAMGDD_GetDofRecvProc(i, A);
-         if (hypre_AMGDDCommPkgRecvProcs(compGridCommPkg)[level][recv_proc] != hypre_AMGDDCommPkgSendProcs(
-                compGridCommPkg)[level][send_proc])
+         for (i = hypre_ParCSRCommPkgRecvVecStart(commPkg, recv_proc);
+              i < hypre_ParCSRCommPkgRecvVecStart(commPkg, recv_proc + 1); i++)
          {
-            num_req_dofs[recv_proc][send_proc]++;
+            if (add_flag_requests[i])
+            {
+               num_req_dofs[recv_proc][send_proc]++;
+            }
          }
       }
    }
@@ -196,18 +198,20 @@ hypre_BoomerAMGDD_AddToSendAndRequestDofs( hypre_ParCSRMatrix     *A,
       }
    }
    // Fill the req dof info
-   for (i = 0; i < hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)); i++)
+   for (recv_proc = 0; recv_proc < num_csr_recv_procs; recv_proc++)
    {
-      if (add_flag_requests[i])
+      if (hypre_AMGDDCommPkgRecvProcs(compGridCommPkg)[level][recv_proc] != proc_id)
       {
-         neighbor_global_index = hypre_ParCSRMatrixColMapOffd(A)[i];
-         recv_proc = hypre_BoomerAMGDD_GetDofRecvProc(i, A);
-         if (hypre_AMGDDCommPkgRecvProcs(compGridCommPkg)[level][recv_proc] != hypre_AMGDDCommPkgSendProcs(
-                compGridCommPkg)[level][send_proc])
+         for (i = hypre_ParCSRCommPkgRecvVecStart(commPkg, recv_proc);
+              i < hypre_ParCSRCommPkgRecvVecStart(commPkg, recv_proc + 1); i++)
          {
-            req_dofs[recv_proc][send_proc][ req_cnt[recv_proc] ] = neighbor_global_index;
-            req_dof_dist[recv_proc][send_proc][ req_cnt[recv_proc] ] = add_flag_requests[i];
-            req_cnt[recv_proc]++;
+            if (add_flag_requests[i])
+            {
+               neighbor_global_index = hypre_ParCSRMatrixColMapOffd(A)[i];
+               req_dofs[recv_proc][send_proc][ req_cnt[recv_proc] ] = neighbor_global_index;
+               req_dof_dist[recv_proc][send_proc][ req_cnt[recv_proc] ] = add_flag_requests[i];
+               req_cnt[recv_proc]++;
+            }
          }
       }
    }
@@ -258,45 +262,54 @@ hypre_BoomerAMGDD_FindNeighborProcessors( hypre_ParCSRMatrix      *A,
                                       HYPRE_MEMORY_HOST);
    }
 
-   HYPRE_Int *add_flag = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRMatrixNumRows(A), HYPRE_MEMORY_HOST);
-   HYPRE_Int *add_flag_requests = hypre_CTAlloc(HYPRE_Int,
-                                                hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)), HYPRE_MEMORY_HOST);
-
-   // Recursively search through the operator stencil to find longer distance neighboring dofs
-   // Loop over longdistance send procs
-   for (i = 0; i < hypre_AMGDDCommPkgNumSendProcs(compGridCommPkg)[level]; i++)
+   // Recursively search through the operator stencil to find longer distance neighboring dofs.
+   // The searches for different longdistance send procs only touch data belonging to that send
+   // proc, so they are done in parallel with thread-private add flags.
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, j)
+#endif
    {
-      if (num_starting_dofs[i])
+      HYPRE_Int *add_flag = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRMatrixNumRows(A), HYPRE_MEMORY_HOST);
+      HYPRE_Int *add_flag_requests = hypre_CTAlloc(HYPRE_Int,
+                                                   hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for schedule(dynamic)
+#endif
+      for (i = 0; i < hypre_AMGDDCommPkgNumSendProcs(compGridCommPkg)[level]; i++)
       {
-         // Initialize the add_flag at the starting dofs
-         for (j = 0; j < num_starting_dofs[i]; j++)
-         {
-            HYPRE_Int idx = starting_dofs[i][j];
-            HYPRE_Int send_dof = hypre_AMGDDCommPkgSendFlag(compGridCommPkg)[level][i][level][idx];
-            add_flag[send_dof] = distances[i][idx];
-         }
-         // Recursively search for longer distance dofs
-         for (j = 0; j < num_starting_dofs[i]; j++)
+         if (num_starting_dofs[i])
          {
-            HYPRE_Int idx = starting_dofs[i][j];
-            HYPRE_Int send_dof = hypre_AMGDDCommPkgSendFlag(compGridCommPkg)[level][i][level][idx];
-            hypre_BoomerAMGDD_RecursivelyFindNeighborNodes(send_dof, distances[i][idx] - 1, A, add_flag,
-                                                           add_flag_requests);
+            // Initialize the add_flag at the starting dofs
+            for (j = 0; j < num_starting_dofs[i]; j++)
+            {
+               HYPRE_Int idx = starting_dofs[i][j];
+               HYPRE_Int send_dof = hypre_AMGDDCommPkgSendFlag(compGridCommPkg)[level][i][level][idx];
+               add_flag[send_dof] = distances[i][idx];
+            }
+            // Recursively search for longer distance dofs
+            for (j = 0; j < num_starting_dofs[i]; j++)
+            {
+               HYPRE_Int idx = starting_dofs[i][j];
+               HYPRE_Int send_dof = hypre_AMGDDCommPkgSendFlag(compGridCommPkg)[level][i][level][idx];
+               hypre_BoomerAMGDD_RecursivelyFindNeighborNodes(send_dof, distances[i][idx] - 1, A, add_flag,
+                                                              add_flag_requests);
+            }
+            num_starting_dofs[i] = 0;
+            hypre_TFree(starting_dofs[i], HYPRE_MEMORY_HOST);
+            starting_dofs[i] = NULL;
+            // Update the send flag and request dofs
+            hypre_BoomerAMGDD_AddToSendAndRequestDofs(A, add_flag, add_flag_requests, level, i, compGridCommPkg,
+                                                      distances, send_dof_maps, send_dof_capacities, csr_num_recvs, num_req_dofs, req_dofs, req_dof_dist);
+            // Reset add flags
+            hypre_Memset(add_flag, 0, sizeof(HYPRE_Int)*hypre_ParCSRMatrixNumRows(A), HYPRE_MEMORY_HOST);
+            hypre_Memset(add_flag_requests, 0,
+                         sizeof(HYPRE_Int)*hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)), HYPRE_MEMORY_HOST);
          }
-         num_starting_dofs[i] = 0;
-         hypre_TFree(starting_dofs[i], HYPRE_MEMORY_HOST);
-         starting_dofs[i] = NULL;
-         // Update the send flag and request dofs
-         hypre_BoomerAMGDD_AddToSendAndRequestDofs(A, add_flag, add_flag_requests, level, i, compGridCommPkg,
-                                                   distances, send_dof_maps, send_dof_capacities, csr_num_recvs, num_req_dofs, req_dofs, req_dof_dist);
-         // Reset add flags
-         hypre_Memset(add_flag, 0, sizeof(HYPRE_Int)*hypre_ParCSRMatrixNumRows(A), HYPRE_MEMORY_HOST);
-         hypre_Memset(add_flag_requests, 0,
-                      sizeof(HYPRE_Int)*hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)), HYPRE_MEMORY_HOST);
       }
+      hypre_TFree(add_flag, HYPRE_MEMORY_HOST);
+      hypre_TFree(add_flag_requests, HYPRE_MEMORY_HOST);
    }
-   hypre_TFree(add_flag, HYPRE_MEMORY_HOST);
-   hypre_TFree(add_flag_requests, HYPRE_MEMORY_HOST);
 
    //////////////////////////////////////////////////
    // Communicate newly connected longer-distance processors to send procs:
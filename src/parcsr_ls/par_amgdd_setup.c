@@ -203,7 +203,10 @@ hypre_BoomerAMGDDSetup( void               *amgdd_vdata,
          send_flag_buffer = hypre_CTAlloc(HYPRE_Int*, num_send_procs, HYPRE_MEMORY_HOST);
          send_flag_buffer_size = hypre_CTAlloc(HYPRE_Int, num_send_procs, HYPRE_MEMORY_HOST);
 
-         // Pack send buffers
+         // Pack send buffers (independent for each send proc)
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i) schedule(dynamic)
+#endif
          for (i = 0; i < num_send_procs; i++)
          {
             send_buffer[i] = hypre_BoomerAMGDD_PackSendBuffer(amgdd_data, i, level, padding,
@@ -250,7 +253,14 @@ hypre_BoomerAMGDDSetup( void               *amgdd_vdata,
 
          hypre_BoomerAMGDD_UnpackRecvBuffer(amgdd_data, recv_buffer[i], A_tmp_info,
                                             &(recv_map_send_buffer_size[i]), nodes_added_on_level, level, i);
+      }
 
+      // Pack the recv map send buffers (independent for each recv proc)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_recv_procs; i++)
+      {
          recv_map_send_buffer[i] = hypre_CTAlloc(HYPRE_Int, recv_map_send_buffer_size[i], HYPRE_MEMORY_HOST);
          hypre_BoomerAMGDD_PackRecvMapSendBuffer(recv_map_send_buffer[i], recv_red_marker[level][i],
                                                  num_recv_nodes[level][i], &(recv_buffer_size[level][i]), level, num_levels);
@@ -283,7 +293,10 @@ hypre_BoomerAMGDDSetup( void               *amgdd_vdata,
       // wait for maps to be received
       hypre_MPI_Waitall(num_requests, requests, status);
 
-      // unpack and setup the send flag arrays
+      // unpack and setup the send flag arrays (independent for each send proc)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for (i = 0; i < num_send_procs; i++)
       {
          hypre_BoomerAMGDD_UnpackSendFlagBuffer(compGrid, send_flag_buffer[i], send_flag[level][i],
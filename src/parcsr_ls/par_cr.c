@@ -46,8 +46,12 @@ hypre_BoomerAMGCoarsenCR1( hypre_ParCSRMatrix    *A,
 
    if (CRaddCpoints == 0)
    {
-      *CF_marker_ptr = hypre_IntArrayCreate(num_variables);
-      hypre_IntArrayInitialize(*CF_marker_ptr);
+      /* Allocate CF_marker if not done before */
+      if (*CF_marker_ptr == NULL)
+      {
+         *CF_marker_ptr = hypre_IntArrayCreate(num_variables);
+         hypre_IntArrayInitialize(*CF_marker_ptr);
+      }
       hypre_IntArraySetConstantValues(*CF_marker_ptr, fpt);
    }
    CF_marker = hypre_IntArrayData(*CF_marker_ptr);
@@ -1648,8 +1652,13 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
    HYPRE_Int          *CF_marker_offd;
 
    HYPRE_Real         *measure_array;
-   HYPRE_Int          *graph_array;
-   HYPRE_Int          *graph_array_offd;
+   HYPRE_Int          *graph_array, *graph_array2;
+   HYPRE_Int          *graph_array_offd, *graph_array_offd2;
+   HYPRE_Int          *prefix_sum_workspace;
+   HYPRE_Int          *temp;
+#ifdef HYPRE_USING_OPENMP
+   HYPRE_Int          *measure_array_temp;
+#endif
    HYPRE_Int           graph_size;
    HYPRE_Int           graph_offd_size;
    HYPRE_BigInt        global_graph_size;
@@ -1777,6 +1786,42 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
    }
 
    /* calculate the local part for the local nodes */
+#ifdef HYPRE_USING_OPENMP
+   measure_array_temp = hypre_CTAlloc(HYPRE_Int, num_variables + num_cols_offd,
+                                      HYPRE_MEMORY_HOST);
+
+   #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+   for (i = 0; i < num_variables; i++)
+   {
+      if (CF_marker[i] < 1)
+      {
+         for (j = S_diag_i[i]; j < S_diag_i[i + 1]; j++)
+         {
+            if (CF_marker[S_diag_j[j]] < 1)
+            {
+               #pragma omp atomic
+               measure_array_temp[S_diag_j[j]]++;
+            }
+         }
+         for (j = S_offd_i[i]; j < S_offd_i[i + 1]; j++)
+         {
+            if (CF_marker_offd[S_offd_j[j]] < 1)
+            {
+               #pragma omp atomic
+               measure_array_temp[num_variables + S_offd_j[j]]++;
+            }
+         }
+      }
+   }
+
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables + num_cols_offd)
+   for (i = 0; i < num_variables + num_cols_offd; i++)
+   {
+      measure_array[i] = (HYPRE_Real) measure_array_temp[i];
+   }
+
+   hypre_TFree(measure_array_temp, HYPRE_MEMORY_HOST);
+#else
    for (i = 0; i < num_variables; i++)
    {
       if (CF_marker[i] < 1)
@@ -1797,6 +1842,7 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
          }
       }
    }
+#endif /* HYPRE_USING_OPENMP */
 
    /* now send those locally calculated values for the external nodes to the neighboring processors */
    if (num_procs > 1)
@@ -1843,10 +1889,12 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
    if (num_cols_offd)
    {
       graph_array_offd = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
+      graph_array_offd2 = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
    }
    else
    {
       graph_array_offd = NULL;
+      graph_array_offd2 = NULL;
    }
 
    for (ig = 0; ig < num_cols_offd; ig++)
@@ -1858,6 +1906,7 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
 
    /* now the local part of the graph array, and the local CF_marker array */
    graph_array = hypre_CTAlloc(HYPRE_Int,  num_variables, HYPRE_MEMORY_HOST);
+   graph_array2 = hypre_CTAlloc(HYPRE_Int,  num_variables, HYPRE_MEMORY_HOST);
 
    if (CF_init == 1)
    {
@@ -1982,6 +2031,9 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
             graph_size,
             graph_array_offd, graph_offd_size,
             CF_marker, CF_marker_offd);*/
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(graph_size)
+#endif
          for (ig = 0; ig < graph_size; ig++)
          {
             i = graph_array[ig];
@@ -1990,6 +2042,9 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
                CF_marker[i] = 1;
             }
          }
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(graph_offd_size)
+#endif
          for (ig = 0; ig < graph_offd_size; ig++)
          {
             i = graph_array_offd[ig];
@@ -2001,7 +2056,9 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
          /*-------------------------------------------------------
           * Remove nodes from the initial independent set
           *-------------------------------------------------------*/
-
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ig, i, jS, j, jj) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(graph_size)
+#endif
          for (ig = 0; ig < graph_size; ig++)
          {
             i = graph_array[ig];
@@ -2090,7 +2147,9 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
       /*------------------------------------------------
        * Set C-pts and F-pts.
        *------------------------------------------------*/
-
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ig, i, jS, j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(graph_size)
+#endif
       for (ig = 0; ig < graph_size; ig++)
       {
          i = graph_array[ig];
@@ -2177,40 +2236,92 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
 
       /*------------------------------------------------
        * Update subgraph
+       *
+       * The remaining points are compacted in order into
+       * graph_array2; the independent set loops above do
+       * not depend on the order of the subgraph.
        *------------------------------------------------*/
 
-      for (ig = 0; ig < graph_size; ig++)
+      prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, 2 * (hypre_NumThreads() + 1),
+                                          HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(ig, i) HYPRE_SMP_IF(graph_size + graph_offd_size)
+#endif
       {
-         i = graph_array[ig];
+         HYPRE_Int private_graph_size_cnt = 0;
+         HYPRE_Int private_graph_offd_size_cnt = 0;
 
-         if (CF_marker[i] != 0) /* C or F point */
+         HYPRE_Int ig_begin, ig_end;
+         hypre_GetSimpleThreadPartition(&ig_begin, &ig_end, graph_size);
+
+         HYPRE_Int ig_offd_begin, ig_offd_end;
+         hypre_GetSimpleThreadPartition(&ig_offd_begin, &ig_offd_end, graph_offd_size);
+
+         for (ig = ig_begin; ig < ig_end; ig++)
          {
-            /* the independent set subroutine needs measure 0 for
-               removed nodes */
-            measure_array[i] = 0;
-            /* take point out of the subgraph */
-            graph_size--;
-            graph_array[ig] = graph_array[graph_size];
-            graph_array[graph_size] = i;
-            ig--;
+            i = graph_array[ig];
+
+            if (CF_marker[i] != 0) /* C or F point */
+            {
+               /* the independent set subroutine needs measure 0 for
+                  removed nodes */
+               measure_array[i] = 0;
+            }
+            else
+            {
+               private_graph_size_cnt++;
+            }
          }
-      }
-      for (ig = 0; ig < graph_offd_size; ig++)
-      {
-         i = graph_array_offd[ig];
 
-         if (CF_marker_offd[i] != 0) /* C or F point */
+         for (ig = ig_offd_begin; ig < ig_offd_end; ig++)
          {
-            /* the independent set subroutine needs measure 0 for
-               removed nodes */
-            measure_array[i + num_variables] = 0;
-            /* take point out of the subgraph */
-            graph_offd_size--;
-            graph_array_offd[ig] = graph_array_offd[graph_offd_size];
-            graph_array_offd[graph_offd_size] = i;
-            ig--;
+            i = graph_array_offd[ig];
+
+            if (CF_marker_offd[i] != 0) /* C or F point */
+            {
+               /* the independent set subroutine needs measure 0 for
+                  removed nodes */
+               measure_array[i + num_variables] = 0;
+            }
+            else
+            {
+               private_graph_offd_size_cnt++;
+            }
          }
-      }
+
+         hypre_prefix_sum_pair(&private_graph_size_cnt, &graph_size,
+                               &private_graph_offd_size_cnt, &graph_offd_size,
+                               prefix_sum_workspace);
+
+         for (ig = ig_begin; ig < ig_end; ig++)
+         {
+            i = graph_array[ig];
+            if (CF_marker[i] == 0)
+            {
+               graph_array2[private_graph_size_cnt++] = i;
+            }
+         }
+
+         for (ig = ig_offd_begin; ig < ig_offd_end; ig++)
+         {
+            i = graph_array_offd[ig];
+            if (CF_marker_offd[i] == 0)
+            {
+               graph_array_offd2[private_graph_offd_size_cnt++] = i;
+            }
+         }
+      } /* omp parallel */
+
+      temp = graph_array;
+      graph_array = graph_array2;
+      graph_array2 = temp;
+
+      temp = graph_array_offd;
+      graph_array_offd = graph_array_offd2;
+      graph_array_offd2 = temp;
+
+      hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
 
    } /* end while */
 
@@ -2231,7 +2342,9 @@ hypre_BoomerAMGIndepPMIS( hypre_ParCSRMatrix    *S,
 
    hypre_TFree(measure_array, HYPRE_MEMORY_HOST);
    hypre_TFree(graph_array, HYPRE_MEMORY_HOST);
-   if (num_cols_offd) { hypre_TFree(graph_array_offd, HYPRE_MEMORY_HOST); }
+   hypre_TFree(graph_array2, HYPRE_MEMORY_HOST);
+   hypre_TFree(graph_array_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(graph_array_offd2, HYPRE_MEMORY_HOST);
    hypre_TFree(buf_data, HYPRE_MEMORY_HOST);
    hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
    hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
@@ -2839,6 +2952,69 @@ hypre_BoomerAMGIndepPMISa( hypre_ParCSRMatrix    *S,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCRRelaxFPoints
+ *
+ * One compatible relaxation sweep on the F-points.  The hybrid Gauss-Seidel
+ * types partition the local rows among the OpenMP threads, so the relaxed
+ * error, and with it the candidate set, changes with the thread count.  When
+ * reproducible reductions are requested (HYPRE_SetReproducibleReductions),
+ * these types sweep the local rows sequentially instead, which together with
+ * the binned inner products gives a C/F splitting that is bitwise identical
+ * for any number of threads.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGCRRelaxFPoints( hypre_ParCSRMatrix *A,
+                               hypre_ParVector    *f,
+                               HYPRE_Int          *CF_marker,
+                               HYPRE_Int           rlx_type,
+                               HYPRE_Real          relax_weight,
+                               HYPRE_Real          omega,
+                               hypre_ParVector    *u,
+                               hypre_ParVector    *Vtemp,
+                               hypre_ParVector    *Ztemp )
+{
+   HYPRE_Int skip_diag = (relax_weight == 1.0 && omega == 1.0) ? 0 : 1;
+
+   if (hypre_HandleReproducibleReductions(hypre_handle()))
+   {
+      switch (rlx_type)
+      {
+         case 3:
+            return hypre_BoomerAMGRelaxHybridSOR(A, f, CF_marker, fpt, relax_weight, omega,
+                                                 NULL, u, Vtemp, Ztemp, 1, 0, 1, 1);
+         case 4:
+            return hypre_BoomerAMGRelaxHybridSOR(A, f, CF_marker, fpt, relax_weight, omega,
+                                                 NULL, u, Vtemp, Ztemp, -1, 0, 1, 1);
+         case 6:
+            return hypre_BoomerAMGRelaxHybridSOR(A, f, CF_marker, fpt, relax_weight, omega,
+                                                 NULL, u, Vtemp, Ztemp, 1, 1, 1, 1);
+         case 8:
+         case 88:
+            return hypre_BoomerAMGRelaxHybridSOR(A, f, CF_marker, fpt, relax_weight, omega,
+                                                 NULL, u, Vtemp, Ztemp, 1, 1, skip_diag, 1);
+         case 13:
+            return hypre_BoomerAMGRelaxHybridSOR(A, f, CF_marker, fpt, relax_weight, omega,
+                                                 NULL, u, Vtemp, Ztemp, 1, 0, skip_diag, 1);
+         case 14:
+            return hypre_BoomerAMGRelaxHybridSOR(A, f, CF_marker, fpt, relax_weight, omega,
+                                                 NULL, u, Vtemp, Ztemp, -1, 0, skip_diag, 1);
+         case 89:
+            hypre_BoomerAMGRelaxHybridSOR(A, f, CF_marker, fpt, relax_weight, omega,
+                                          NULL, u, Vtemp, Ztemp, 1, 0, skip_diag, 1);
+            return hypre_BoomerAMGRelaxHybridSOR(A, f, CF_marker, fpt, relax_weight, omega,
+                                                 NULL, u, Vtemp, Ztemp, -1, 0, skip_diag, 1);
+         default:
+            break;
+      }
+   }
+
+   return hypre_BoomerAMGRelax(A, f, CF_marker, rlx_type, fpt, relax_weight, omega, NULL,
+                               u, Vtemp, Ztemp);
+}
+
 HYPRE_Int
 hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
                           hypre_IntArray   **CF_marker_ptr,
@@ -2910,17 +3086,17 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
    global_num_variables = hypre_ParCSRMatrixGlobalNumRows(A);
    /*if(CRaddCpoints == 0)
      {*/
-   if (num_functions == 1)
+   if (num_functions > 1)
    {
-      *CF_marker_ptr = hypre_IntArrayCreate(num_variables);
+      sum = hypre_CTAlloc(HYPRE_Real,  num_nodes, HYPRE_MEMORY_HOST);
    }
-   else
+
+   /* Allocate CF_marker if not done before */
+   if (*CF_marker_ptr == NULL)
    {
-      num_nodes = num_variables / num_functions;
-      sum = hypre_CTAlloc(HYPRE_Real,  num_nodes, HYPRE_MEMORY_HOST);
       *CF_marker_ptr = hypre_IntArrayCreate(num_nodes);
+      hypre_IntArrayInitialize(*CF_marker_ptr);
    }
-   hypre_IntArrayInitialize(*CF_marker_ptr);
    hypre_IntArraySetConstantValues(*CF_marker_ptr, fpt);
    CF_marker = hypre_IntArrayData(*CF_marker_ptr);
    /*}
@@ -2983,6 +3159,9 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
       hypre_fprintf(stdout, "-----------------------\n");
    }
 
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
    for (i = 0; i < num_variables; i++)
    {
       e1[i] = 1.0e0;
@@ -2996,6 +3175,9 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
       {
          if (num_functions == 1)
          {
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
             for (i = 0; i < num_variables; i++)
             {
                Vtemp_data[i] = 0.0e0;
@@ -3063,16 +3245,20 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
          while (rho >= 0.1 * theta && (i < num_CR_relax_steps || relrho >= 0.1))
             /*for (i=0;i<num_CR_relax_steps;i++)*/
          {
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
             for (j = 0; j < num_variables; j++)
                if (CF_marker[j] == fpt) { e0[j] = e1[j]; }
-            hypre_BoomerAMGRelax(A, Vtemp, CF_marker,
-                                 rlx_type, fpt,
-                                 relax_weight, omega, NULL,
-                                 e1_vec, e0_vec,
-                                 Relax_temp);
+            hypre_BoomerAMGCRRelaxFPoints(A, Vtemp, CF_marker, rlx_type,
+                                          relax_weight, omega,
+                                          e1_vec, e0_vec, Relax_temp);
             /*if (i==num_CR_relax_steps-1) */
             if (i == 1)
             {
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
                for (j = 0; j < num_variables; j++)
                   if (CF_marker[j] == fpt) { e2[j] = e1[j]; }
             }
@@ -3093,12 +3279,18 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
       /*rho0 = hypre_ParVectorInnerProd(e0_vec,e0_vec);
         rho1 = hypre_ParVectorInnerProd(e1_vec,e1_vec);
         rho = hypre_sqrt(rho1)/hypre_sqrt(rho0);*/
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
       for (j = 0; j < num_variables; j++)
          if (CF_marker[j] == fpt) { e1[j] = e2[j]; }
       if (rho > theta)
       {
          if (useCG)
          {
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
             for (i = 0; i < num_variables; i++)
             {
                if (CF_marker[i] ==  fpt)
@@ -3133,6 +3325,9 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
                else
                {
                   beta = gamma / gammaold;
+#ifdef HYPRE_USING_OPENMP
+                  #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
                   for (j = 0; j < num_variables; j++)
                      if (CF_marker[j] == fpt)
                      {
@@ -3142,6 +3337,9 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
                hypre_ParCSRMatrixMatvec_FF(1.0, A, Ptemp, 0.0, Qtemp, CF_marker, fpt);
                alpha = gamma / hypre_ParVectorInnerProd(Ptemp, Qtemp);
                hypre_ParVectorAxpy(-alpha, Qtemp, Rtemp);
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
                for (j = 0; j < num_variables; j++)
                   if (CF_marker[j] == fpt) { e0[j] = e1[j]; }
                hypre_ParVectorAxpy(-alpha, Ptemp, e1_vec);
@@ -3168,6 +3366,9 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
             /*if(CRaddCpoints == 0)*/
          {
             local_max = 0.0;
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i) reduction(max:local_max) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
             for (i = 0; i < num_variables; i++)
                if (hypre_abs(e1[i]) > local_max)
                {
@@ -3176,10 +3377,13 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
          }
          else
          {
-            jj = 0;
             local_max = 0.0;
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, j, jj) reduction(max:local_max) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
             for (i = 0; i < num_nodes; i++)
             {
+               jj = i * num_functions;
                /*CF_marker[jj] = CFN_marker[i];*/
                sum[i] = hypre_abs(e1[jj++]);
                for (j = 1; j < num_functions; j++)
@@ -3198,6 +3402,9 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
          if (num_functions == 1)
             /*if(CRaddCpoints == 0)*/
          {
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, candmeas) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
             for (i = 0; i < num_variables; i++)
             {
                if (CF_marker[i] == fpt)
@@ -3248,6 +3455,9 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
             AN_i = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(AN));
             AN_offd_i     = hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(AN));
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, candmeas) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_nodes)
+#endif
             for (i = 0; i < num_nodes; i++)
             {
                /*if (CFN_marker[i] == fpt)*/
@@ -3288,7 +3498,8 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
 
          if (my_id == 0) hypre_fprintf(stdout, "  %d \t%2.3f  \t%2.3f \n",
                                           nstages, rho, (HYPRE_Real)global_nc / (HYPRE_Real)global_num_variables);
-         /* update for next sweep */
+         /* update for next sweep; this loop stays sequential so that the
+            random restart vector is drawn in index order */
          num_coarse = 0;
          if (num_functions == 1)
             /*if(CRaddCpoints == 0)*/
@@ -3366,6 +3577,9 @@ hypre_BoomerAMGCoarsenCR( hypre_ParCSRMatrix    *A,
 
    if (my_id == 0) { hypre_fprintf(stdout, "\n... Done \n\n"); }
    coarse_size = 0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) reduction(+:coarse_size) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_variables)
+#endif
    for ( i = 0 ; i < num_variables; i++)
    {
       if ( CF_marker[i] == cpt)
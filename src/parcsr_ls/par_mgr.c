@@ -151,6 +151,10 @@ hypre_MGRCreate(void)
 
    (mgr_data -> GSElimData) = NULL;
 
+   (mgr_data -> reuse_setup) = 0;
+   (mgr_data -> num_reuse_levels) = 0;
+   (mgr_data -> reuse_data) = NULL;
+
    return (void *) mgr_data;
 }
 
@@ -479,6 +483,9 @@ hypre_MGRDestroy( void *data )
       hypre_TFree(mgr_data -> GSElimData, HYPRE_MEMORY_HOST);
    }
 
+   /* Free setup reuse data */
+   hypre_MGRDestroyReuseData(mgr_data);
+
    /* Free the data path filename */
    hypre_TFree(mgr_data -> data_path, HYPRE_MEMORY_HOST);
 
@@ -545,6 +552,54 @@ hypre_MGRDestroyGSElimData( void *data )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_MGRDestroyReuseData
+ *
+ * Frees the symbolic data kept for setup reuse. Called by the setters of
+ * the options that determine the C/F splitting, the interpolation or the
+ * restriction, so the next setup is a full one.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MGRDestroyReuseData( void *mgr_vdata )
+{
+   hypre_ParMGRData         *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+   hypre_MGRLevelReuseData  *level_data;
+   HYPRE_Int                 i;
+
+   if (mgr_data -> reuse_data)
+   {
+      for (i = 0; i < (mgr_data -> num_reuse_levels); i++)
+      {
+         level_data = (mgr_data -> reuse_data)[i];
+         if (level_data)
+         {
+            hypre_TFree(level_data -> CF_marker_offd, HYPRE_MEMORY_HOST);
+            hypre_TFree(level_data -> col_map_offd, HYPRE_MEMORY_HOST);
+            hypre_ParCSRMatrixDestroy(level_data -> A_FF);
+            hypre_ParCSRMatrixDestroy(level_data -> A_FC);
+            hypre_ParCSRMatrixDestroy(level_data -> A_CF);
+            hypre_ParCSRMatrixDestroy(level_data -> A_CC);
+            if (level_data -> P_comm_pkg)
+            {
+               hypre_MatvecCommPkgDestroy(level_data -> P_comm_pkg);
+            }
+            hypre_TFree(level_data -> P_col_map_offd, HYPRE_MEMORY_HOST);
+            if (level_data -> RAP_comm_pkg)
+            {
+               hypre_MatvecCommPkgDestroy(level_data -> RAP_comm_pkg);
+            }
+            hypre_TFree(level_data -> RAP_col_map_offd, HYPRE_MEMORY_HOST);
+            hypre_TFree(level_data, HYPRE_MEMORY_HOST);
+         }
+      }
+      hypre_TFree(mgr_data -> reuse_data, HYPRE_MEMORY_HOST);
+   }
+   (mgr_data -> num_reuse_levels) = 0;
+
+   return hypre_error_flag;
+}
+
 /* Create data for V-cycle F-relaxtion */
 void *
 hypre_MGRCreateFrelaxVcycleData( void )
@@ -673,6 +728,8 @@ hypre_MGRSetNonCpointsToFpoints( void      *mgr_vdata, HYPRE_Int nonCptToFptFlag
    hypre_ParMGRData *mgr_data = (hypre_ParMGRData*) mgr_vdata;
    (mgr_data -> set_non_Cpoints_to_F) = nonCptToFptFlag;
 
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -683,6 +740,8 @@ hypre_MGRSetReservedCpointsLevelToKeep(void *mgr_vdata, HYPRE_Int level)
    hypre_ParMGRData *mgr_data = (hypre_ParMGRData*) mgr_vdata;
    (mgr_data -> lvl_to_keep_cpoints) = level;
 
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -714,6 +773,9 @@ hypre_MGRSetCpointsByContiguousBlock( void  *mgr_vdata,
                               block_coarse_indexes);
    (mgr_data -> idx_array) = index_array;
    (mgr_data -> set_c_points_method) = 1;
+
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -782,6 +844,8 @@ hypre_MGRSetCpointsByBlock( void      *mgr_vdata,
    (mgr_data -> block_cf_marker) = block_cf_marker;
    (mgr_data -> set_c_points_method) = 0;
 
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -850,6 +914,8 @@ hypre_MGRSetCpointsByPointMarkerArray( void      *mgr_vdata,
    (mgr_data -> point_marker_array) = point_marker_array;
    (mgr_data -> set_c_points_method) = 2;
 
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -882,6 +948,8 @@ hypre_MGRSetReservedCoarseNodes(void      *mgr_vdata,
    (mgr_data -> reserved_coarse_size) = reserved_coarse_size;
    (mgr_data -> reserved_coarse_indexes) = reserved_coarse_indexes;
 
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -1185,246 +1253,6 @@ hypre_MGRApproximateInverse(hypre_ParCSRMatrix      *A,
    return hypre_error_flag;
 }
 
-/*--------------------------------------------------------------------------
- * hypre_blas_smat_inv_n2
- *
- * TODO (VPM): move this function to seq_ls
- *--------------------------------------------------------------------------*/
-
-void hypre_blas_smat_inv_n2 (HYPRE_Real *a)
-{
-   const HYPRE_Real a11 = a[0], a12 = a[1];
-   const HYPRE_Real a21 = a[2], a22 = a[3];
-   const HYPRE_Real det_inv = 1.0 / (a11 * a22 - a12 * a21);
-
-   a[0] =  a22 * det_inv;
-   a[1] = -a12 * det_inv;
-   a[2] = -a21 * det_inv;
-   a[3] =  a11 * det_inv;
-}
-
-/*--------------------------------------------------------------------------
- * hypre_blas_smat_inv_n3
- *
- * TODO (VPM): move this function to seq_ls
- *--------------------------------------------------------------------------*/
-
-void hypre_blas_smat_inv_n3 (HYPRE_Real *a)
-{
-   const HYPRE_Real a11 = a[0],  a12 = a[1],  a13 = a[2];
-   const HYPRE_Real a21 = a[3],  a22 = a[4],  a23 = a[5];
-   const HYPRE_Real a31 = a[6],  a32 = a[7],  a33 = a[8];
-
-   const HYPRE_Real det = a11 * a22 * a33 - a11 * a23 * a32 -
-                          a12 * a21 * a33 + a12 * a23 * a31 +
-                          a13 * a21 * a32 - a13 * a22 * a31;
-   const HYPRE_Real det_inv = 1.0 / det;
-
-   a[0] = (a22 * a33 - a23 * a32) * det_inv;
-   a[1] = (a13 * a32 - a12 * a33) * det_inv;
-   a[2] = (a12 * a23 - a13 * a22) * det_inv;
-   a[3] = (a23 * a31 - a21 * a33) * det_inv;
-   a[4] = (a11 * a33 - a13 * a31) * det_inv;
-   a[5] = (a13 * a21 - a11 * a23) * det_inv;
-   a[6] = (a21 * a32 - a22 * a31) * det_inv;
-   a[7] = (a12 * a31 - a11 * a32) * det_inv;
-   a[8] = (a11 * a22 - a12 * a21) * det_inv;
-}
-
-/*--------------------------------------------------------------------------
- * hypre_blas_smat_inv_n4
- *
- * TODO (VPM): move this function to seq_ls
- *--------------------------------------------------------------------------*/
-
-void hypre_blas_smat_inv_n4 (HYPRE_Real *a)
-{
-   const HYPRE_Real a11 = a[0],  a12 = a[1],  a13 = a[2],  a14 = a[3];
-   const HYPRE_Real a21 = a[4],  a22 = a[5],  a23 = a[6],  a24 = a[7];
-   const HYPRE_Real a31 = a[8],  a32 = a[9],  a33 = a[10], a34 = a[11];
-   const HYPRE_Real a41 = a[12], a42 = a[13], a43 = a[14], a44 = a[15];
-
-   const HYPRE_Real M11 = a22 * a33 * a44 + a23 * a34 * a42 +
-                          a24 * a32 * a43 - a22 * a34 * a43 -
-                          a23 * a32 * a44 - a24 * a33 * a42;
-
-   const HYPRE_Real M12 = a12 * a34 * a43 + a13 * a32 * a44 +
-                          a14 * a33 * a42 - a12 * a33 * a44 -
-                          a13 * a34 * a42 - a14 * a32 * a43;
-
-   const HYPRE_Real M13 = a12 * a23 * a44 + a13 * a24 * a42 +
-                          a14 * a22 * a43 - a12 * a24 * a43 -
-                          a13 * a22 * a44 - a14 * a23 * a42;
-
-   const HYPRE_Real M14 = a12 * a24 * a33 + a13 * a22 * a34 +
-                          a14 * a23 * a32 - a12 * a23 * a34 -
-                          a13 * a24 * a32 - a14 * a22 * a33;
-
-   const HYPRE_Real M21 = a21 * a34 * a43 + a23 * a31 * a44 +
-                          a24 * a33 * a41 - a21 * a33 * a44 -
-                          a23 * a34 * a41 - a24 * a31 * a43;
-
-   const HYPRE_Real M22 = a11 * a33 * a44 + a13 * a34 * a41 +
-                          a14 * a31 * a43 - a11 * a34 * a43 -
-                          a13 * a31 * a44 - a14 * a33 * a41;
-
-   const HYPRE_Real M23 = a11 * a24 * a43 + a13 * a21 * a44 +
-                          a14 * a23 * a41 - a11 * a23 * a44 -
-                          a13 * a24 * a41 - a14 * a21 * a43;
-
-   const HYPRE_Real M24 = a11 * a23 * a34 + a13 * a24 * a31 +
-                          a14 * a21 * a33 - a11 * a24 * a33 -
-                          a13 * a21 * a34 - a14 * a23 * a31;
-
-   const HYPRE_Real M31 = a21 * a32 * a44 + a22 * a34 * a41 +
-                          a24 * a31 * a42 - a21 * a34 * a42 -
-                          a22 * a31 * a44 - a24 * a32 * a41;
-
-   const HYPRE_Real M32 = a11 * a34 * a42 + a12 * a31 * a44 +
-                          a14 * a32 * a41 - a11 * a32 * a44 -
-                          a12 * a34 * a41 - a14 * a31 * a42;
-
-   const HYPRE_Real M33 = a11 * a22 * a44 + a12 * a24 * a41 +
-                          a14 * a21 * a42 - a11 * a24 * a42 -
-                          a12 * a21 * a44 - a14 * a22 * a41;
-
-   const HYPRE_Real M34 = a11 * a24 * a32 + a12 * a21 * a34 +
-                          a14 * a22 * a31 - a11 * a22 * a34 -
-                          a12 * a24 * a31 - a14 * a21 * a32;
-
-   const HYPRE_Real M41 = a21 * a33 * a42 + a22 * a31 * a43 +
-                          a23 * a32 * a41 - a21 * a32 * a43 -
-                          a22 * a33 * a41 - a23 * a31 * a42;
-
-   const HYPRE_Real M42 = a11 * a32 * a43 + a12 * a33 * a41 +
-                          a13 * a31 * a42 - a11 * a33 * a42 -
-                          a12 * a31 * a43 - a13 * a32 * a41;
-
-   const HYPRE_Real M43 = a11 * a23 * a42 + a12 * a21 * a43 +
-                          a13 * a22 * a41 - a11 * a22 * a43 -
-                          a12 * a23 * a41 - a13 * a21 * a42;
-
-   const HYPRE_Real M44 = a11 * a22 * a33 + a12 * a23 * a31 +
-                          a13 * a21 * a32 - a11 * a23 * a32 -
-                          a12 * a21 * a33 - a13 * a22 * a31;
-
-   const HYPRE_Real det = a11 * M11 + a12 * M21 + a13 * M31 + a14 * M41;
-   HYPRE_Real       det_inv = 1.0 / det;
-
-   //if ( hypre_abs(det) < 1e-22 ) {
-   //hypre_printf("### WARNING: Matrix is nearly singular! det = %e\n", det);
-   /*
-   printf("##----------------------------------------------\n");
-   printf("## %12.5e %12.5e %12.5e \n", a0, a1, a2);
-   printf("## %12.5e %12.5e %12.5e \n", a3, a4, a5);
-   printf("## %12.5e %12.5e %12.5e \n", a5, a6, a7);
-   printf("##----------------------------------------------\n");
-   getchar();
-   */
-   //}
-
-   a[0]  = M11 * det_inv; a[1]  = M12 * det_inv; a[2]  = M13 * det_inv; a[3]  = M14 * det_inv;
-   a[4]  = M21 * det_inv; a[5]  = M22 * det_inv; a[6]  = M23 * det_inv; a[7]  = M24 * det_inv;
-   a[8]  = M31 * det_inv; a[9]  = M32 * det_inv; a[10] = M33 * det_inv; a[11] = M34 * det_inv;
-   a[12] = M41 * det_inv; a[13] = M42 * det_inv; a[14] = M43 * det_inv; a[15] = M44 * det_inv;
-}
-
-/*--------------------------------------------------------------------------
- * hypre_MGRSmallBlkInverse
- *
- * TODO (VPM): move this function to seq_ls
- *--------------------------------------------------------------------------*/
-
-void hypre_MGRSmallBlkInverse(HYPRE_Real *mat,
-                              HYPRE_Int   blk_size)
-{
-   if (blk_size == 2)
-   {
-      hypre_blas_smat_inv_n2(mat);
-   }
-   else if (blk_size == 3)
-   {
-      hypre_blas_smat_inv_n3(mat);
-   }
-   else if (blk_size == 4)
-   {
-      hypre_blas_smat_inv_n4(mat);
-   }
-}
-
-/*--------------------------------------------------------------------------
- * hypre_MGRSmallBlkInverse
- *
- * TODO (VPM): move this function to seq_ls
- *--------------------------------------------------------------------------*/
-
-void hypre_blas_mat_inv(HYPRE_Real *a,
-                        HYPRE_Int n)
-{
-   HYPRE_Int i, j, k, l, u, kn, in;
-   HYPRE_Real alinv;
-   if (n == 4)
-   {
-      hypre_blas_smat_inv_n4(a);
-   }
-   else
-   {
-      for (k = 0; k < n; ++k)
-      {
-         kn = k * n;
-         l  = kn + k;
-
-         //if (hypre_abs(a[l]) < HYPRE_REAL_MIN) {
-         //   printf("### WARNING: Diagonal entry is close to zero!");
-         //   printf("### WARNING: diag_%d=%e\n", k, a[l]);
-         //   a[l] = HYPRE_REAL_MIN;
-         //}
-         alinv = 1.0 / a[l];
-         a[l] = alinv;
-
-         for (j = 0; j < k; ++j)
-         {
-            u = kn + j; a[u] *= alinv;
-         }
-
-         for (j = k + 1; j < n; ++j)
-         {
-            u = kn + j; a[u] *= alinv;
-         }
-
-         for (i = 0; i < k; ++i)
-         {
-            in = i * n;
-            for (j = 0; j < n; ++j)
-               if (j != k)
-               {
-                  u = in + j; a[u] -= a[in + k] * a[kn + j];
-               } // end if (j!=k)
-         }
-
-         for (i = k + 1; i < n; ++i)
-         {
-            in = i * n;
-            for (j = 0; j < n; ++j)
-               if (j != k)
-               {
-                  u = in + j; a[u] -= a[in + k] * a[kn + j];
-               } // end if (j!=k)
-         }
-
-         for (i = 0; i < k; ++i)
-         {
-            u = i * n + k; a[u] *= -alinv;
-         }
-
-         for (i = k + 1; i < n; ++i)
-         {
-            u = i * n + k; a[u] *= -alinv;
-         }
-      } // end for (k=0; k<n; ++k)
-   }// end if
-}
-
 HYPRE_Int
 hypre_block_jacobi_solve( hypre_ParCSRMatrix *A,
                           hypre_ParVector    *f,
@@ -1666,7 +1494,6 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
    hypre_ParCSRCommPkg  *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    hypre_ParCSRCommHandle *comm_handle = NULL;
 
-   HYPRE_Int        n       = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
 
    hypre_Vector    *u_local = hypre_ParVectorLocalVector(u);
@@ -1731,77 +1558,79 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
                                                   Vext_data);
    }
 
-   /*-----------------------------------------------------------------
-   * Copy current approximation into temporary vector.
-   *-----------------------------------------------------------------*/
-
-#if 0
-#ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
-#endif
-   for (i = 0; i < n; i++)
-   {
-      Vtemp_data[i] = u_data[i];
-      //printf("u_old[%d] = %e\n",i,Vtemp_data[i]);
-   }
    if (num_procs > 1)
    {
       hypre_ParCSRCommHandleDestroy(comm_handle);
       comm_handle = NULL;
    }
 
-   /*-----------------------------------------------------------------
-   * Relax points block by block
-   *-----------------------------------------------------------------*/
-   for (i = 0; i < n_block; i++)
+   if (method == 1)
    {
-      bidxm1 = i * blk_size;
-      for (j = 0; j < blk_size; j++)
+      /*-----------------------------------------------------------------
+       * Relax points block by block (Gauss-Seidel for diagonal part)
+       *-----------------------------------------------------------------*/
+
+      for (i = 0; i < n_block; i++)
       {
-         bidx = bidxm1 + j;
-         res[j] = f_data[bidx];
-         for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
+         bidxm1 = i * blk_size;
+         for (j = 0; j < blk_size; j++)
          {
-            ii = A_diag_j[jj];
-            if (method == 0)
+            bidx = bidxm1 + j;
+            res[j] = f_data[bidx];
+            for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
             {
-               // Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
-            }
-            else if (method == 1)
-            {
-               // Gauss-Seidel for diagonal part
+               ii = A_diag_j[jj];
                res[j] -= A_diag_data[jj] * u_data[ii];
             }
-            else
+            for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
             {
-               // Default do Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
+               // always do Jacobi for off-diagonal part
+               ii = A_offd_j[jj];
+               res[j] -= A_offd_data[jj] * Vext_data[ii];
             }
-            //printf("%d: Au= %e * %e =%e\n",ii,A_diag_data[jj],Vtemp_data[ii], res[j]);
          }
-         for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
+
+         for (j = 0; j < blk_size; j++)
          {
-            // always do Jacobi for off-diagonal part
-            ii = A_offd_j[jj];
-            res[j] -= A_offd_data[jj] * Vext_data[ii];
+            bidx1 = bidxm1 + j;
+            for (k = 0; k < blk_size; k++)
+            {
+               bidx  = i * nb2 + j * blk_size + k;
+               u_data[bidx1] += res[k] * diaginv[bidx];
+            }
          }
-         //printf("%d: res = %e\n",bidx,res[j]);
       }
+   }
+   else
+   {
+      /*-----------------------------------------------------------------
+       * Block Jacobi (default): compute the residual of all points in
+       * Vtemp, then apply the inverted diagonal blocks at once
+       *-----------------------------------------------------------------*/
 
-      for (j = 0; j < blk_size; j++)
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i, ii, jj) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_block * blk_size; i++)
       {
-         bidx1 = bidxm1 + j;
-         for (k = 0; k < blk_size; k++)
+         HYPRE_Real res_i = f_data[i];
+
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
          {
-            bidx  = i * nb2 + j * blk_size + k;
-            u_data[bidx1] += res[k] * diaginv[bidx];
-            //printf("u[%d] = %e, diaginv[%d] = %e\n",bidx1,u_data[bidx1],bidx,diaginv[bidx]);
+            ii = A_diag_j[jj];
+            res_i -= A_diag_data[jj] * u_data[ii];
          }
-         //printf("u[%d] = %e\n",bidx1,u_data[bidx1]);
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res_i -= A_offd_data[jj] * Vext_data[ii];
+         }
+         Vtemp_data[i] = res_i;
       }
+
+      hypre_DenseBlockMatvecBatched(n_block, blk_size, 1.0, diaginv, Vtemp_data, u_data);
    }
+
    if (num_procs > 1)
    {
       hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
@@ -1814,57 +1643,33 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
 /*--------------------------------------------------------------------------
  * hypre_BlockDiagInvLapack
  *
+ * Inverts in-place the (flattened) diagonal blocks of size blk_size of a
+ * matrix with N rows. The last block is smaller if N is not a multiple of
+ * blk_size.
+ *
  * TODO (VPM): move this function to seq_ls
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
 hypre_BlockDiagInvLapack(HYPRE_Real *diag, HYPRE_Int N, HYPRE_Int blk_size)
 {
-   HYPRE_Int nblock, left_size, i;
-   //HYPRE_Int *IPIV = hypre_CTAlloc(HYPRE_Int, blk_size, HYPRE_MEMORY_HOST);
-   HYPRE_Int LWORK = blk_size * blk_size;
-   HYPRE_Real *WORK = hypre_CTAlloc(HYPRE_Real, LWORK, HYPRE_MEMORY_HOST);
-   HYPRE_Int INFO;
-
-   HYPRE_Real wall_time;
-   HYPRE_Int my_id;
-   MPI_Comm comm = hypre_MPI_COMM_WORLD;
-   hypre_MPI_Comm_rank(comm, &my_id);
+   HYPRE_Int nblock, left_size;
 
-   nblock = N / blk_size;
-   left_size = N - blk_size * nblock;
-   i = nblock;
-   HYPRE_Int *IPIV = hypre_CTAlloc(HYPRE_Int, blk_size, HYPRE_MEMORY_HOST);
-
-   wall_time = time_getWallclockSeconds();
-   if (blk_size >= 2 && blk_size <= 4)
-   {
-      for (i = 0; i < nblock; i++)
-      {
-         hypre_MGRSmallBlkInverse(diag + i * LWORK, blk_size);
-         //hypre_blas_smat_inv_n2(diag+i*LWORK);
-      }
-   }
-   else if (blk_size > 4)
+   if (blk_size < 2)
    {
-      for (i = 0; i < nblock; i++)
-      {
-         hypre_dgetrf(&blk_size, &blk_size, diag + i * LWORK, &blk_size, IPIV, &INFO);
-         hypre_dgetri(&blk_size, diag + i * LWORK, &blk_size, IPIV, WORK, &LWORK, &INFO);
-      }
+      return hypre_error_flag;
    }
 
+   nblock    = N / blk_size;
+   left_size = N - blk_size * nblock;
+
+   hypre_DenseBlockInvertBatched(nblock, blk_size, diag);
+
    // Left size
    if (left_size > 0)
    {
-      hypre_dgetrf(&left_size, &left_size, diag + i * LWORK, &left_size, IPIV, &INFO);
-      hypre_dgetri(&left_size, diag + i * LWORK, &left_size, IPIV, WORK, &LWORK, &INFO);
+      hypre_DenseBlockInvertBatched(1, left_size, diag + nblock * blk_size * blk_size);
    }
-   wall_time = time_getWallclockSeconds() - wall_time;
-   //if (my_id == 0) hypre_printf("Proc = %d, Compute inverse time: %1.5f\n", my_id, wall_time);
-
-   hypre_TFree(IPIV, HYPRE_MEMORY_HOST);
-   hypre_TFree(WORK, HYPRE_MEMORY_HOST);
 
    return hypre_error_flag;
 }
@@ -2444,11 +2249,8 @@ hypre_MGRBlockRelaxSetup( hypre_ParCSRMatrix *A,
    *-----------------------------------------------------------------*/
    if (blk_size > 1)
    {
-      for (i = 0; i < n_block; i++)
-      {
-         hypre_blas_mat_inv(diaginv + i * nb2, blk_size);
-      }
-      hypre_blas_mat_inv(diaginv + (HYPRE_Int)(blk_size * nb2), left_size);
+      hypre_DenseBlockInvertBatched(n_block, blk_size, diaginv);
+      hypre_DenseBlockInvertBatched(1, left_size, diaginv + (HYPRE_Int)(blk_size * nb2));
    }
    else
    {
@@ -2590,11 +2392,8 @@ hypre_blockRelax(hypre_ParCSRMatrix *A,
    *-----------------------------------------------------------------*/
    if (blk_size > 1)
    {
-      for (i = 0; i < n_block; i++)
-      {
-         hypre_blas_mat_inv(diaginv + i * nb2, blk_size);
-      }
-      hypre_blas_mat_inv(diaginv + (HYPRE_Int)(blk_size * nb2), left_size);
+      hypre_DenseBlockInvertBatched(n_block, blk_size, diaginv);
+      hypre_DenseBlockInvertBatched(1, left_size, diaginv + (HYPRE_Int)(blk_size * nb2));
       /*
       for (i = 0;i < n_block; i++)
       {
@@ -2736,6 +2535,8 @@ hypre_MGRSetMaxCoarseLevels( void *mgr_vdata, HYPRE_Int maxcoarselevs )
    hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
    (mgr_data -> max_num_coarse_levels) = maxcoarselevs;
 
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -2746,6 +2547,8 @@ hypre_MGRSetBlockSize( void *mgr_vdata, HYPRE_Int bsize )
    hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
    (mgr_data -> block_size) = bsize;
 
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -3044,6 +2847,9 @@ hypre_MGRSetLevelRestrictType( void *mgr_vdata, HYPRE_Int *restrict_type)
       }
    }
    (mgr_data -> restrict_type) = level_restrict_type;
+
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -3067,6 +2873,9 @@ hypre_MGRSetRestrictType( void *mgr_vdata, HYPRE_Int restrict_type)
       level_restrict_type[i] = restrict_type;
    }
    (mgr_data -> restrict_type) = level_restrict_type;
+
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -3101,6 +2910,9 @@ hypre_MGRSetInterpType( void *mgr_vdata, HYPRE_Int interpType)
       level_interp_type[i] = interpType;
    }
    (mgr_data -> interp_type) = level_interp_type;
+
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -3131,6 +2943,9 @@ hypre_MGRSetLevelInterpType( void *mgr_vdata, HYPRE_Int *interpType)
       }
    }
    (mgr_data -> interp_type) = level_interp_type;
+
+   hypre_MGRDestroyReuseData(mgr_data);
+
    return hypre_error_flag;
 }
 
@@ -3156,6 +2971,21 @@ hypre_MGRSetTruncateCoarseGridThreshold( void *mgr_vdata, HYPRE_Real threshold)
    return hypre_error_flag;
 }
 
+/* Reuse the symbolic data (C/F splitting, C/F block patterns and
+ * communication packages) of the previous setup in subsequent setups */
+HYPRE_Int
+hypre_MGRSetReuse( void *mgr_vdata, HYPRE_Int reuse )
+{
+   hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+
+   if (!reuse)
+   {
+      hypre_MGRDestroyReuseData(mgr_data);
+   }
+   (mgr_data -> reuse_setup) = reuse;
+   return hypre_error_flag;
+}
+
 /* Set block size for block Jacobi Interp/Relax */
 HYPRE_Int
 hypre_MGRSetBlockJacobiBlockSize( void *mgr_vdata, HYPRE_Int blk_size)
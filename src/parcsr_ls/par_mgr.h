@@ -8,6 +8,42 @@
 #ifndef hypre_ParMGR_DATA_HEADER
 #define hypre_ParMGR_DATA_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_MGRLevelReuseData
+ *
+ * Symbolic data of a MGR level kept across setups when setup reuse is
+ * enabled (see hypre_MGRSetReuse). The C/F splitting of the level lives in
+ * CF_marker_array and is not duplicated here.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* Partitionings of the level matrix and of its C/F points */
+   HYPRE_BigInt          row_starts[2];
+   HYPRE_BigInt          row_starts_cpts[2];
+   HYPRE_BigInt          row_starts_fpts[2];
+
+   /* C/F marker of the off-diagonal columns of the level matrix */
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int            *CF_marker_offd;
+   HYPRE_BigInt         *col_map_offd;
+
+   /* Sparsity patterns (no values) of the C/F blocks of the level matrix */
+   hypre_ParCSRMatrix   *A_FF;
+   hypre_ParCSRMatrix   *A_FC;
+   hypre_ParCSRMatrix   *A_CF;
+   hypre_ParCSRMatrix   *A_CC;
+
+   /* Communication packages of the interpolation and of the coarse level
+      matrix from the previous setup, with the col_map_offd they were built for */
+   hypre_ParCSRCommPkg  *P_comm_pkg;
+   HYPRE_Int             P_num_cols_offd;
+   HYPRE_BigInt         *P_col_map_offd;
+   hypre_ParCSRCommPkg  *RAP_comm_pkg;
+   HYPRE_Int             RAP_num_cols_offd;
+   HYPRE_BigInt         *RAP_col_map_offd;
+} hypre_MGRLevelReuseData;
+
 /*--------------------------------------------------------------------------
  * hypre_ParMGRData
  *--------------------------------------------------------------------------*/
@@ -149,6 +185,11 @@ typedef struct
 
    /* Data for Gaussian elimination F-relaxation */
    hypre_ParAMGData    **GSElimData;
+
+   /* Reuse symbolic setup data across setups of matrices with the same pattern */
+   HYPRE_Int                  reuse_setup;
+   HYPRE_Int                  num_reuse_levels;
+   hypre_MGRLevelReuseData  **reuse_data;
 } hypre_ParMGRData;
 
 /*--------------------------------------------------------------------------
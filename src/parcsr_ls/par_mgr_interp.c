@@ -2571,23 +2571,7 @@ hypre_MGRBlockColLumpedRestrict(hypre_ParCSRMatrix  *A,
     * 3) b_FF = inv(approx(A_FF))          (invert in-place)
     *-------------------------------------------------------*/
 
-#if defined (HYPRE_USING_GPU)
-   if (hypre_GetExecPolicy1(hypre_DenseBlockMatrixMemoryLocation(b_FF)) == HYPRE_EXEC_DEVICE)
-   {
-      /* TODO (VPM): GPU version */
-      hypre_DenseBlockMatrixMigrate(b_FF, HYPRE_MEMORY_HOST);
-      hypre_BlockDiagInvLapack(hypre_DenseBlockMatrixData(b_FF),
-                               hypre_DenseBlockMatrixNumRows(b_FF),
-                               hypre_DenseBlockMatrixNumRowsBlock(b_FF));
-      hypre_DenseBlockMatrixMigrate(b_FF, HYPRE_MEMORY_DEVICE);
-   }
-   else
-#endif
-   {
-      hypre_BlockDiagInvLapack(hypre_DenseBlockMatrixData(b_FF),
-                               hypre_DenseBlockMatrixNumRows(b_FF),
-                               hypre_DenseBlockMatrixNumRowsBlock(b_FF));
-   }
+   hypre_DenseBlockMatrixInvert(b_FF);
 
    /*-------------------------------------------------------
     * 4) Wr = - approx(A_CF) * inv(approx(A_FF))
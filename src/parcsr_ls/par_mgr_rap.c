@@ -664,6 +664,14 @@ hypre_MGRBuildCoarseOperator(void                *mgr_vdata,
       }
    }
 
+   /* Reuse the communication package of the previous setup if possible */
+   if ((mgr_data -> reuse_data) && (mgr_data -> reuse_data)[level] && !rebuild_commpkg)
+   {
+      hypre_MGRReuseCommPkg(RAP, &((mgr_data -> reuse_data)[level] -> RAP_comm_pkg),
+                            &((mgr_data -> reuse_data)[level] -> RAP_num_cols_offd),
+                            &((mgr_data -> reuse_data)[level] -> RAP_col_map_offd));
+   }
+
    /* Compute/rebuild communication package */
    if (rebuild_commpkg)
    {
@@ -9,6 +9,301 @@
 #include "par_mgr.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_MGRSetupCheckReuse
+ *
+ * Returns 1 (on all ranks) if the symbolic data of the previous setup can be
+ * reused to set up MGR for A, 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_MGRSetupCheckReuse( hypre_ParMGRData   *mgr_data,
+                          hypre_ParCSRMatrix *A,
+                          HYPRE_Int           max_num_coarse_levels )
+{
+   MPI_Comm                   comm            = hypre_ParCSRMatrixComm(A);
+   hypre_MGRLevelReuseData  **reuse_data      = (mgr_data -> reuse_data);
+   hypre_IntArray           **CF_marker_array = (mgr_data -> CF_marker_array);
+   HYPRE_Int                  num_levels      = (mgr_data -> num_coarse_levels);
+   HYPRE_BigInt              *row_starts      = hypre_ParCSRMatrixRowStarts(A);
+   HYPRE_Int                  reuse, global_reuse;
+   HYPRE_Int                  i;
+
+   if (!(mgr_data -> reuse_setup))
+   {
+      return 0;
+   }
+
+   reuse = (reuse_data && CF_marker_array && num_levels > 0 &&
+            (mgr_data -> num_reuse_levels) == max_num_coarse_levels &&
+            hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_HOST);
+
+   for (i = 0; reuse && i < num_levels; i++)
+   {
+      if (!reuse_data[i] || !CF_marker_array[i])
+      {
+         reuse = 0;
+      }
+   }
+
+   if (reuse)
+   {
+      reuse = ((reuse_data[0] -> row_starts)[0] == row_starts[0] &&
+               (reuse_data[0] -> row_starts)[1] == row_starts[1]);
+   }
+
+   hypre_MPI_Allreduce(&reuse, &global_reuse, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   return global_reuse;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRStashCommPkg
+ *
+ * Moves the communication package and col_map_offd of a matrix that is about
+ * to be destroyed to the given pointers, so they can be handed over to its
+ * replacement with hypre_MGRReuseCommPkg.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_MGRStashCommPkg( hypre_ParCSRMatrix    *A,
+                       hypre_ParCSRCommPkg  **comm_pkg_ptr,
+                       HYPRE_Int             *num_cols_offd_ptr,
+                       HYPRE_BigInt         **col_map_offd_ptr )
+{
+   if (*comm_pkg_ptr)
+   {
+      hypre_MatvecCommPkgDestroy(*comm_pkg_ptr);
+   }
+   hypre_TFree(*col_map_offd_ptr, HYPRE_MEMORY_HOST);
+
+   *comm_pkg_ptr      = hypre_ParCSRMatrixCommPkg(A);
+   *num_cols_offd_ptr = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   *col_map_offd_ptr  = hypre_ParCSRMatrixColMapOffd(A);
+
+   hypre_ParCSRMatrixCommPkg(A)   = NULL;
+   hypre_ParCSRMatrixColMapOffd(A) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRReuseCommPkg
+ *
+ * Hands a communication package stashed by hypre_MGRStashCommPkg over to A if
+ * A does not have one and its col_map_offd is the one the package was built
+ * for. The stashed data is consumed in any case.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MGRReuseCommPkg( hypre_ParCSRMatrix    *A,
+                       hypre_ParCSRCommPkg  **comm_pkg_ptr,
+                       HYPRE_Int             *num_cols_offd_ptr,
+                       HYPRE_BigInt         **col_map_offd_ptr )
+{
+   HYPRE_Int      num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_BigInt  *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int      i;
+
+   if (*comm_pkg_ptr && !hypre_ParCSRMatrixCommPkg(A) &&
+       *num_cols_offd_ptr == num_cols_offd)
+   {
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         if ((*col_map_offd_ptr)[i] != col_map_offd[i])
+         {
+            break;
+         }
+      }
+
+      if (i == num_cols_offd)
+      {
+         hypre_ParCSRMatrixCommPkg(A) = *comm_pkg_ptr;
+         *comm_pkg_ptr = NULL;
+      }
+   }
+
+   if (*comm_pkg_ptr)
+   {
+      hypre_MatvecCommPkgDestroy(*comm_pkg_ptr);
+      *comm_pkg_ptr = NULL;
+   }
+   hypre_TFree(*col_map_offd_ptr, HYPRE_MEMORY_HOST);
+   *num_cols_offd_ptr = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRSetLevelReuseData
+ *
+ * Saves the symbolic data of a MGR level: partitionings, off-diagonal C/F
+ * marker and the sparsity patterns of the C/F blocks of A.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_MGRSetLevelReuseData( hypre_ParCSRMatrix        *A,
+                            HYPRE_Int                 *CF_marker,
+                            HYPRE_BigInt              *row_starts_cpts,
+                            HYPRE_BigInt              *row_starts_fpts,
+                            hypre_ParCSRMatrix        *A_FF,
+                            hypre_ParCSRMatrix        *A_FC,
+                            hypre_ParCSRMatrix        *A_CF,
+                            hypre_ParCSRMatrix        *A_CC,
+                            hypre_MGRLevelReuseData  **level_data_ptr )
+{
+   hypre_MGRLevelReuseData  *level_data = *level_data_ptr;
+   hypre_ParCSRMatrix       *blocks[4];
+   hypre_ParCSRMatrix      **patterns[4];
+   hypre_ParCSRCommPkg      *comm_pkg;
+   hypre_ParCSRCommHandle   *comm_handle;
+   HYPRE_Int                 num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Int                 num_sends, num_elmts_send;
+   HYPRE_Int                *int_buf_data;
+   HYPRE_Int                 i;
+
+   if (!level_data)
+   {
+      level_data = hypre_CTAlloc(hypre_MGRLevelReuseData, 1, HYPRE_MEMORY_HOST);
+      *level_data_ptr = level_data;
+   }
+
+   /* Partitionings */
+   for (i = 0; i < 2; i++)
+   {
+      (level_data -> row_starts)[i]      = hypre_ParCSRMatrixRowStarts(A)[i];
+      (level_data -> row_starts_cpts)[i] = row_starts_cpts[i];
+      (level_data -> row_starts_fpts)[i] = row_starts_fpts[i];
+   }
+
+   /* C/F marker of the off-diagonal columns */
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg       = hypre_ParCSRMatrixCommPkg(A);
+   num_sends      = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_elmts_send = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   int_buf_data   = hypre_TAlloc(HYPRE_Int, num_elmts_send, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_elmts_send; i++)
+   {
+      int_buf_data[i] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+   hypre_TFree(level_data -> CF_marker_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(level_data -> col_map_offd, HYPRE_MEMORY_HOST);
+   (level_data -> num_cols_offd)  = num_cols_offd;
+   (level_data -> CF_marker_offd) = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   (level_data -> col_map_offd)   = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(level_data -> col_map_offd, hypre_ParCSRMatrixColMapOffd(A),
+                 HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data,
+                                              level_data -> CF_marker_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+
+   /* Sparsity patterns of the C/F blocks. Values are not needed */
+   blocks[0] = A_FF; patterns[0] = &(level_data -> A_FF);
+   blocks[1] = A_FC; patterns[1] = &(level_data -> A_FC);
+   blocks[2] = A_CF; patterns[2] = &(level_data -> A_CF);
+   blocks[3] = A_CC; patterns[3] = &(level_data -> A_CC);
+   for (i = 0; i < 4; i++)
+   {
+      hypre_ParCSRMatrixDestroy(*patterns[i]);
+      *patterns[i] = hypre_ParCSRMatrixClone(blocks[i], 0);
+      hypre_TFree(hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(*patterns[i])), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(*patterns[i])), HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRUpdateFFFC
+ *
+ * Computes the C/F blocks of A from the sparsity patterns saved by
+ * hypre_MGRSetLevelReuseData, without communication. If the pattern of A has
+ * changed on any rank, the output pointers are set to NULL.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_MGRUpdateFFFC( hypre_ParCSRMatrix        *A,
+                     HYPRE_Int                 *CF_marker,
+                     hypre_MGRLevelReuseData   *level_data,
+                     hypre_ParCSRMatrix       **A_FF_ptr,
+                     hypre_ParCSRMatrix       **A_FC_ptr,
+                     hypre_ParCSRMatrix       **A_CF_ptr,
+                     hypre_ParCSRMatrix       **A_CC_ptr )
+{
+   MPI_Comm             comm           = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int            num_rows       = hypre_ParCSRMatrixNumRows(A);
+   HYPRE_Int            num_cols_offd  = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_BigInt        *col_map_offd   = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int           *CF_marker_offd = (level_data -> CF_marker_offd);
+   HYPRE_Int           *FC_marker;
+   HYPRE_Int           *FC_marker_offd;
+   hypre_ParCSRMatrix  *A_FF, *A_FC, *A_CF, *A_CC;
+   HYPRE_Int            i, mismatch;
+
+   A_FF = hypre_ParCSRMatrixClone(level_data -> A_FF, 0);
+   A_FC = hypre_ParCSRMatrixClone(level_data -> A_FC, 0);
+   A_CF = hypre_ParCSRMatrixClone(level_data -> A_CF, 0);
+   A_CC = hypre_ParCSRMatrixClone(level_data -> A_CC, 0);
+
+   /* Pattern mismatches are reported through the error code */
+   hypre_error_code_save();
+
+   mismatch = (num_cols_offd != (level_data -> num_cols_offd));
+   for (i = 0; i < num_cols_offd && !mismatch; i++)
+   {
+      mismatch = (col_map_offd[i] != (level_data -> col_map_offd)[i]);
+   }
+
+   if (mismatch)
+   {
+      hypre_error(HYPRE_ERROR_GENERIC);
+   }
+   else
+   {
+      FC_marker      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+      FC_marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_rows; i++)
+      {
+         FC_marker[i] = -CF_marker[i];
+      }
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         FC_marker_offd[i] = -CF_marker_offd[i];
+      }
+
+      hypre_ParCSRMatrixUpdateFFFCHost(A, CF_marker, CF_marker_offd, A_FC, A_FF);
+      hypre_ParCSRMatrixUpdateFFFCHost(A, FC_marker, FC_marker_offd, A_CF, A_CC);
+
+      hypre_TFree(FC_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(FC_marker_offd, HYPRE_MEMORY_HOST);
+   }
+
+   mismatch = HYPRE_GetGlobalError(comm);
+   hypre_error_code_restore();
+
+   if (mismatch)
+   {
+      hypre_ParCSRMatrixDestroy(A_FF); A_FF = NULL;
+      hypre_ParCSRMatrixDestroy(A_FC); A_FC = NULL;
+      hypre_ParCSRMatrixDestroy(A_CF); A_CF = NULL;
+      hypre_ParCSRMatrixDestroy(A_CC); A_CC = NULL;
+   }
+
+   *A_FF_ptr = A_FF;
+   *A_FC_ptr = A_FC;
+   *A_CF_ptr = A_CF;
+   *A_CC_ptr = A_CC;
+
+   return hypre_error_flag;
+}
+
 /* Setup MGR data */
 HYPRE_Int
 hypre_MGRSetup( void               *mgr_vdata,
@@ -75,7 +370,7 @@ hypre_MGRSetup( void               *mgr_vdata,
    hypre_ParCSRMatrix  **P_FF_array = (mgr_data -> P_FF_array);
 #endif
    hypre_ParCSRMatrix  **P_array = (mgr_data -> P_array);
-   hypre_ParCSRMatrix  **R_array = (mgr_data -> RT_array);
+   hypre_ParCSRMatrix  **R_array = (mgr_data -> R_array);
    hypre_ParCSRMatrix  **RT_array = (mgr_data -> RT_array);
 
    hypre_ParCSRMatrix  *A_FF = NULL;
@@ -83,6 +378,9 @@ hypre_MGRSetup( void               *mgr_vdata,
    hypre_ParCSRMatrix  *A_CF = NULL;
    hypre_ParCSRMatrix  *A_CC = NULL;
 
+   HYPRE_Int                  reuse = 0;
+   hypre_MGRLevelReuseData  **reuse_data;
+
    hypre_Solver         *aff_base;
    HYPRE_Solver        **aff_solver = (mgr_data -> aff_solver);
    hypre_ParCSRMatrix  **A_ff_array = (mgr_data -> A_ff_array);
@@ -153,6 +451,7 @@ hypre_MGRSetup( void               *mgr_vdata,
 
    HYPRE_Int **level_coarse_indexes = NULL;
    HYPRE_Int *level_coarse_size = NULL;
+   HYPRE_Int reserved_cpoints_eliminated = 0;
    HYPRE_Int setNonCpointToF = (mgr_data -> set_non_Cpoints_to_F);
    HYPRE_BigInt *reserved_coarse_indexes = (mgr_data -> reserved_coarse_indexes);
    HYPRE_BigInt *idx_array = (mgr_data -> idx_array);
@@ -232,142 +531,162 @@ hypre_MGRSetup( void               *mgr_vdata,
       max_num_coarse_levels++;
    }
 
-   /* Initialize local indexes of coarse sets at different levels */
-   level_coarse_indexes = hypre_CTAlloc(HYPRE_Int*, max_num_coarse_levels, HYPRE_MEMORY_HOST);
-   for (i = 0; i < max_num_coarse_levels; i++)
+   /* Check whether the symbolic data of the previous setup can be reused */
+   reuse = hypre_MGRSetupCheckReuse(mgr_data, A, max_num_coarse_levels);
+   if (!reuse)
    {
-      level_coarse_indexes[i] = hypre_CTAlloc(HYPRE_Int, nloc, HYPRE_MEMORY_HOST);
+      hypre_MGRDestroyReuseData(mgr_data);
+      if ((mgr_data -> reuse_setup) &&
+          hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+      {
+         (mgr_data -> reuse_data) = hypre_CTAlloc(hypre_MGRLevelReuseData*,
+                                                  max_num_coarse_levels,
+                                                  HYPRE_MEMORY_HOST);
+         (mgr_data -> num_reuse_levels) = max_num_coarse_levels;
+      }
    }
+   reuse_data = (mgr_data -> reuse_data);
 
-   level_coarse_size = hypre_CTAlloc(HYPRE_Int, max_num_coarse_levels, HYPRE_MEMORY_HOST);
-   HYPRE_Int reserved_cpoints_eliminated = 0;
-
-   /* TODO: move this to par_mgr_coarsen.c and port to GPUs (VPM) */
-   for (i = 0; i < max_num_coarse_levels; i++)
+   /* The C/F splitting of the previous setup is kept when reusing */
+   if (!reuse)
    {
-      // if we want to reduce the reserved Cpoints, set the current level
-      // coarse indices the same as the previous level
-      if (i == lvl_to_keep_cpoints && i > 0)
+      /* Initialize local indexes of coarse sets at different levels */
+      level_coarse_indexes = hypre_CTAlloc(HYPRE_Int*, max_num_coarse_levels, HYPRE_MEMORY_HOST);
+      for (i = 0; i < max_num_coarse_levels; i++)
       {
-         reserved_cpoints_eliminated++;
-         for (j = 0; j < final_coarse_size; j++)
-         {
-            level_coarse_indexes[i][j] = level_coarse_indexes[i - 1][j];
-         }
-         level_coarse_size[i] = final_coarse_size;
-         continue;
+         level_coarse_indexes[i] = hypre_CTAlloc(HYPRE_Int, nloc, HYPRE_MEMORY_HOST);
       }
-      final_coarse_size = 0;
-      if (set_c_points_method == 0) // interleaved ordering, i.e. s1,p1,s2,p2,...
+
+      level_coarse_size = hypre_CTAlloc(HYPRE_Int, max_num_coarse_levels, HYPRE_MEMORY_HOST);
+      reserved_cpoints_eliminated = 0;
+
+      /* TODO: move this to par_mgr_coarsen.c and port to GPUs (VPM) */
+      for (i = 0; i < max_num_coarse_levels; i++)
       {
-         // loop over rows
-         for (row = ilower; row <= iupper; row++)
+         // if we want to reduce the reserved Cpoints, set the current level
+         // coarse indices the same as the previous level
+         if (i == lvl_to_keep_cpoints && i > 0)
          {
-            idx = row % block_size;
-            if (block_cf_marker[i - reserved_cpoints_eliminated][idx] == CMRK)
+            reserved_cpoints_eliminated++;
+            for (j = 0; j < final_coarse_size; j++)
             {
-               level_coarse_indexes[i][final_coarse_size++] = (HYPRE_Int)(row - ilower);
+               level_coarse_indexes[i][j] = level_coarse_indexes[i - 1][j];
             }
+            level_coarse_size[i] = final_coarse_size;
+            continue;
          }
-      }
-      else if (set_c_points_method == 1) // block ordering s1,s2,...,p1,p2,...
-      {
-         for (j = 0; j < block_size; j++)
+         final_coarse_size = 0;
+         if (set_c_points_method == 0) // interleaved ordering, i.e. s1,p1,s2,p2,...
          {
-            if (block_cf_marker[i - reserved_cpoints_eliminated][j] == CMRK)
+            // loop over rows
+            for (row = ilower; row <= iupper; row++)
             {
-               if (j == block_size - 1)
-               {
-                  end_idx = iupper + 1;
-               }
-               else
-               {
-                  end_idx = idx_array[j + 1];
-               }
-               for (row = idx_array[j]; row < end_idx; row++)
+               idx = row % block_size;
+               if (block_cf_marker[i - reserved_cpoints_eliminated][idx] == CMRK)
                {
                   level_coarse_indexes[i][final_coarse_size++] = (HYPRE_Int)(row - ilower);
                }
             }
          }
-         //hypre_printf("Level %d, # of coarse points %d\n", i, final_coarse_size);
-      }
-      else if (set_c_points_method == 2)
-      {
-         HYPRE_Int isCpoint;
-         // row start from 0 since point_marker_array is local
-         for (row = 0; row < nloc; row++)
+         else if (set_c_points_method == 1) // block ordering s1,s2,...,p1,p2,...
          {
-            isCpoint = 0;
-            for (j = 0; j < block_num_coarse_indexes[i]; j++)
+            for (j = 0; j < block_size; j++)
             {
-               if (point_marker_array[row] == block_cf_marker[i][j])
+               if (block_cf_marker[i - reserved_cpoints_eliminated][j] == CMRK)
                {
-                  isCpoint = 1;
-                  break;
+                  if (j == block_size - 1)
+                  {
+                     end_idx = iupper + 1;
+                  }
+                  else
+                  {
+                     end_idx = idx_array[j + 1];
+                  }
+                  for (row = idx_array[j]; row < end_idx; row++)
+                  {
+                     level_coarse_indexes[i][final_coarse_size++] = (HYPRE_Int)(row - ilower);
+                  }
                }
             }
-            if (isCpoint)
+            //hypre_printf("Level %d, # of coarse points %d\n", i, final_coarse_size);
+         }
+         else if (set_c_points_method == 2)
+         {
+            HYPRE_Int isCpoint;
+            // row start from 0 since point_marker_array is local
+            for (row = 0; row < nloc; row++)
             {
-               level_coarse_indexes[i][final_coarse_size++] = row;
-               //printf("%d\n",row);
+               isCpoint = 0;
+               for (j = 0; j < block_num_coarse_indexes[i]; j++)
+               {
+                  if (point_marker_array[row] == block_cf_marker[i][j])
+                  {
+                     isCpoint = 1;
+                     break;
+                  }
+               }
+               if (isCpoint)
+               {
+                  level_coarse_indexes[i][final_coarse_size++] = row;
+                  //printf("%d\n",row);
+               }
             }
          }
-      }
-      else
-      {
-         if (my_id == 0)
+         else
          {
-            hypre_printf("ERROR! Unknown method for setting C points.");
+            if (my_id == 0)
+            {
+               hypre_printf("ERROR! Unknown method for setting C points.");
+            }
+            exit(-1); // TODO: Fix error handling (VPM)
          }
-         exit(-1); // TODO: Fix error handling (VPM)
+         level_coarse_size[i] = final_coarse_size;
       }
-      level_coarse_size[i] = final_coarse_size;
-   }
 
-   /* Set reserved coarse indexes to be kept to the coarsest level of the MGR solver */
-   hypre_TFree((mgr_data -> reserved_Cpoint_local_indexes), HYPRE_MEMORY_HOST);
+      /* Set reserved coarse indexes to be kept to the coarsest level of the MGR solver */
+      hypre_TFree((mgr_data -> reserved_Cpoint_local_indexes), HYPRE_MEMORY_HOST);
 
-   if (reserved_coarse_size > 0)
-   {
-      (mgr_data -> reserved_Cpoint_local_indexes) = hypre_CTAlloc(HYPRE_Int,
-                                                                  reserved_coarse_size,
-                                                                  HYPRE_MEMORY_HOST);
-      reserved_Cpoint_local_indexes = (mgr_data -> reserved_Cpoint_local_indexes);
-      for (i = 0; i < reserved_coarse_size; i++)
+      if (reserved_coarse_size > 0)
       {
-         row = reserved_coarse_indexes[i];
-         HYPRE_Int local_row = (HYPRE_Int)(row - ilower);
-         reserved_Cpoint_local_indexes[i] = local_row;
-         HYPRE_Int lvl = lvl_to_keep_cpoints == 0 ? max_num_coarse_levels : lvl_to_keep_cpoints;
-         if (set_c_points_method < 2)
+         (mgr_data -> reserved_Cpoint_local_indexes) = hypre_CTAlloc(HYPRE_Int,
+                                                                     reserved_coarse_size,
+                                                                     HYPRE_MEMORY_HOST);
+         reserved_Cpoint_local_indexes = (mgr_data -> reserved_Cpoint_local_indexes);
+         for (i = 0; i < reserved_coarse_size; i++)
          {
-            idx = row % block_size;
-            for (j = 0; j < lvl; j++)
+            row = reserved_coarse_indexes[i];
+            HYPRE_Int local_row = (HYPRE_Int)(row - ilower);
+            reserved_Cpoint_local_indexes[i] = local_row;
+            HYPRE_Int lvl = lvl_to_keep_cpoints == 0 ? max_num_coarse_levels : lvl_to_keep_cpoints;
+            if (set_c_points_method < 2)
             {
-               if (block_cf_marker[j][idx] != CMRK)
+               idx = row % block_size;
+               for (j = 0; j < lvl; j++)
                {
-                  level_coarse_indexes[j][level_coarse_size[j]++] = local_row;
+                  if (block_cf_marker[j][idx] != CMRK)
+                  {
+                     level_coarse_indexes[j][level_coarse_size[j]++] = local_row;
+                  }
                }
             }
-         }
-         else
-         {
-            HYPRE_Int isCpoint = 0;
-            for (j = 0; j < lvl; j++)
+            else
             {
-               HYPRE_Int k;
-               for (k = 0; k < block_num_coarse_indexes[j]; k++)
+               HYPRE_Int isCpoint = 0;
+               for (j = 0; j < lvl; j++)
                {
-                  if (point_marker_array[local_row] == block_cf_marker[j][k])
+                  HYPRE_Int k;
+                  for (k = 0; k < block_num_coarse_indexes[j]; k++)
                   {
-                     isCpoint = 1;
-                     break;
+                     if (point_marker_array[local_row] == block_cf_marker[j][k])
+                     {
+                        isCpoint = 1;
+                        break;
+                     }
+                  }
+                  if (!isCpoint)
+                  {
+                     level_coarse_indexes[j][level_coarse_size[j]++] = local_row;
                   }
-               }
-               if (!isCpoint)
-               {
-                  level_coarse_indexes[j][level_coarse_size[j]++] = local_row;
                }
             }
          }
@@ -385,6 +704,13 @@ hypre_MGRSetup( void               *mgr_vdata,
       {
          if (A_array[j])
          {
+            if (reuse)
+            {
+               hypre_MGRStashCommPkg(A_array[j],
+                                     &(reuse_data[j - 1] -> RAP_comm_pkg),
+                                     &(reuse_data[j - 1] -> RAP_num_cols_offd),
+                                     &(reuse_data[j - 1] -> RAP_col_map_offd));
+            }
             hypre_ParCSRMatrixDestroy(A_array[j]);
             A_array[j] = NULL;
          }
@@ -406,6 +732,13 @@ hypre_MGRSetup( void               *mgr_vdata,
 
          if (P_array[j])
          {
+            if (reuse)
+            {
+               hypre_MGRStashCommPkg(P_array[j],
+                                     &(reuse_data[j] -> P_comm_pkg),
+                                     &(reuse_data[j] -> P_num_cols_offd),
+                                     &(reuse_data[j] -> P_col_map_offd));
+            }
             hypre_ParCSRMatrixDestroy(P_array[j]);
             P_array[j] = NULL;
          }
@@ -422,7 +755,7 @@ hypre_MGRSetup( void               *mgr_vdata,
             RT_array[j] = NULL;
          }
 
-         if (CF_marker_array[j])
+         if (CF_marker_array[j] && !reuse)
          {
             hypre_IntArrayDestroy(CF_marker_array[j]);
             CF_marker_array[j] = NULL;
@@ -433,7 +766,10 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_TFree(P_array, HYPRE_MEMORY_HOST);
       hypre_TFree(R_array, HYPRE_MEMORY_HOST);
       hypre_TFree(RT_array, HYPRE_MEMORY_HOST);
-      hypre_TFree(CF_marker_array, HYPRE_MEMORY_HOST);
+      if (!reuse)
+      {
+         hypre_TFree(CF_marker_array, HYPRE_MEMORY_HOST);
+      }
    }
 
 #if defined(HYPRE_USING_GPU)
@@ -494,6 +830,14 @@ hypre_MGRSetup( void               *mgr_vdata,
    /* destroy final coarse grid matrix, if not previously destroyed */
    if ((mgr_data -> RAP))
    {
+      if (reuse)
+      {
+         j = old_num_coarse_levels - 1;
+         hypre_MGRStashCommPkg((mgr_data -> RAP),
+                               &(reuse_data[j] -> RAP_comm_pkg),
+                               &(reuse_data[j] -> RAP_num_cols_offd),
+                               &(reuse_data[j] -> RAP_col_map_offd));
+      }
       hypre_ParCSRMatrixDestroy((mgr_data -> RAP));
       (mgr_data -> RAP) = NULL;
    }
@@ -525,37 +869,31 @@ hypre_MGRSetup( void               *mgr_vdata,
       {
          if ((mgr_data -> l1_norms)[j])
          {
-            hypre_SeqVectorDestroy((mgr_data -> l1_norms)[i]);
+            hypre_SeqVectorDestroy((mgr_data -> l1_norms)[j]);
             (mgr_data -> l1_norms)[j] = NULL;
          }
       }
       hypre_TFree((mgr_data -> l1_norms), HYPRE_MEMORY_HOST);
    }
 
-   if ((mgr_data -> frelax_diaginv))
+   if (frelax_diaginv)
    {
       for (j = 0; j < (old_num_coarse_levels); j++)
       {
-         if ((mgr_data -> frelax_diaginv)[j])
-         {
-            hypre_TFree((mgr_data -> frelax_diaginv)[j], HYPRE_MEMORY_HOST);
-            (mgr_data -> frelax_diaginv)[j] = NULL;
-         }
+         hypre_TFree(frelax_diaginv[j], HYPRE_MEMORY_HOST);
       }
-      hypre_TFree((mgr_data -> frelax_diaginv), HYPRE_MEMORY_HOST);
+      hypre_TFree(frelax_diaginv, HYPRE_MEMORY_HOST);
+      (mgr_data -> frelax_diaginv) = NULL;
    }
 
-   if ((mgr_data -> level_diaginv))
+   if (level_diaginv)
    {
       for (j = 0; j < (old_num_coarse_levels); j++)
       {
-         if ((mgr_data -> level_diaginv)[j])
-         {
-            hypre_TFree((mgr_data -> level_diaginv)[j], HYPRE_MEMORY_HOST);
-            (mgr_data -> level_diaginv)[j] = NULL;
-         }
+         hypre_TFree(level_diaginv[j], HYPRE_MEMORY_HOST);
       }
-      hypre_TFree((mgr_data -> level_diaginv), HYPRE_MEMORY_HOST);
+      hypre_TFree(level_diaginv, HYPRE_MEMORY_HOST);
+      (mgr_data -> level_diaginv) = NULL;
    }
 
    /* setup temporary storage */
@@ -585,7 +923,8 @@ hypre_MGRSetup( void               *mgr_vdata,
       (mgr_data -> residual) = NULL;
    }
    hypre_TFree((mgr_data -> rel_res_norms), HYPRE_MEMORY_HOST);
-   hypre_TFree((mgr_data -> blk_size), HYPRE_MEMORY_HOST);
+   hypre_TFree(blk_size, HYPRE_MEMORY_HOST);
+   (mgr_data -> blk_size) = NULL;
 
    Vtemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
                                  hypre_ParCSRMatrixGlobalNumRows(A),
@@ -1080,7 +1419,7 @@ hypre_MGRSetup( void               *mgr_vdata,
 
                if (print_level)
                {
-                  hypre_ParPrintf(comm, "Setting l1_norms for global relax at MGR level %d\n", i);
+                  hypre_ParPrintf(comm, "Setting l1_norms for global relax at MGR level %d\n", lev);
                }
             }
          }
@@ -1094,20 +1433,36 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_GpuProfilingPushRange(region_name);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
       cflag = last_level || setNonCpointToF;
-      if (interp_type[lev] == 3 || interp_type[lev] == 5 ||
-          interp_type[lev] == 6 || interp_type[lev] == 7 || !cflag)
+
+      /* S is needed by the coarsening (unless its result is reused) and by all
+         interpolation types built on BoomerAMG interpolation kernels */
+      if (!(interp_type[lev] < 3 || interp_type[lev] == 4 || interp_type[lev] == 12) ||
+          (!cflag && !reuse))
       {
          hypre_BoomerAMGCreateS(A_array[lev], strong_threshold, max_row_sum, 1, NULL, &S);
       }
 
-      /* Coarsen: Build CF_marker array based on rows of A */
-      hypre_MGRCoarsen(S, A_array[lev], level_coarse_size[lev], level_coarse_indexes[lev],
-                       debug_flag, &CF_marker_array[lev], cflag);
-      CF_marker = hypre_IntArrayData(CF_marker_array[lev]);
+      if (reuse)
+      {
+         /* Reuse the C/F splitting and partitionings of the previous setup */
+         CF_marker = hypre_IntArrayData(CF_marker_array[lev]);
+         for (i = 0; i < 2; i++)
+         {
+            coarse_pnts_global[i] = (reuse_data[lev] -> row_starts_cpts)[i];
+            row_starts_fpts[i]    = (reuse_data[lev] -> row_starts_fpts)[i];
+         }
+      }
+      else
+      {
+         /* Coarsen: Build CF_marker array based on rows of A */
+         hypre_MGRCoarsen(S, A_array[lev], level_coarse_size[lev], level_coarse_indexes[lev],
+                          debug_flag, &CF_marker_array[lev], cflag);
+         CF_marker = hypre_IntArrayData(CF_marker_array[lev]);
 
-      /* Get global fine/coarse partitionings. TODO: generate dof_func */
-      hypre_MGRCoarseParms(comm, nloc, CF_marker_array[lev],
-                           coarse_pnts_global, row_starts_fpts);
+         /* Get global fine/coarse partitionings. TODO: generate dof_func */
+         hypre_MGRCoarseParms(comm, nloc, CF_marker_array[lev],
+                              coarse_pnts_global, row_starts_fpts);
+      }
       hypre_GpuProfilingPopRange();
       HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
@@ -1128,10 +1483,27 @@ hypre_MGRSetup( void               *mgr_vdata,
       FC_marker = hypre_IntArrayCloneDeep(CF_marker_array[lev]);
       hypre_IntArrayNegate(FC_marker);
 
-      hypre_ParCSRMatrixGenerateFFFC(A_array[lev], CF_marker, coarse_pnts_global,
-                                     NULL, &A_FC, &A_FF);
-      hypre_ParCSRMatrixGenerateFFFC(A_array[lev], hypre_IntArrayData(FC_marker), row_starts_fpts,
-                                     NULL, &A_CF, &A_CC);
+      /* When reusing, only the values of the C/F blocks need to be computed */
+      if (reuse)
+      {
+         hypre_MGRUpdateFFFC(A_array[lev], CF_marker, reuse_data[lev],
+                             &A_FF, &A_FC, &A_CF, &A_CC);
+      }
+
+      if (!A_FF)
+      {
+         hypre_ParCSRMatrixGenerateFFFC(A_array[lev], CF_marker, coarse_pnts_global,
+                                        NULL, &A_FC, &A_FF);
+         hypre_ParCSRMatrixGenerateFFFC(A_array[lev], hypre_IntArrayData(FC_marker),
+                                        row_starts_fpts, NULL, &A_CF, &A_CC);
+
+         if (reuse_data)
+         {
+            hypre_MGRSetLevelReuseData(A_array[lev], CF_marker, coarse_pnts_global,
+                                       row_starts_fpts, A_FF, A_FC, A_CF, A_CC,
+                                       &reuse_data[lev]);
+         }
+      }
 
       /* Build interpolation operator */
       hypre_MGRBuildInterp(A_array[lev], A_FF, A_FC, S, CF_marker_array[lev],
@@ -1139,6 +1511,12 @@ hypre_MGRSetup( void               *mgr_vdata,
                            block_jacobi_bsize, interp_type[lev], num_interp_sweeps,
                            &Wp, &P);
       P_array[lev] = P;
+      if (reuse && P)
+      {
+         hypre_MGRReuseCommPkg(P, &(reuse_data[lev] -> P_comm_pkg),
+                               &(reuse_data[lev] -> P_num_cols_offd),
+                               &(reuse_data[lev] -> P_col_map_offd));
+      }
 
       /* Build Restriction operator */
       if (block_jacobi_bsize == 1 && restrict_type[lev] == 12)
@@ -1360,7 +1738,7 @@ hypre_MGRSetup( void               *mgr_vdata,
 
       /* TODO: move this to par_mgr_coarsen.c and port to GPUs (VPM) */
       /* Update coarse level indexes for next levels */
-      if (lev < num_coarsening_levs - 1)
+      if (lev < num_coarsening_levs - 1 && !reuse)
       {
          for (i = lev + 1; i < max_num_coarse_levels; i++)
          {
@@ -1410,7 +1788,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       /* Update reserved coarse indexes to be kept to coarsest level
        * first mark indexes to be updated
        * skip if we reduce the reserved C-points before the coarse grid solve */
-      if (mgr_data -> lvl_to_keep_cpoints == 0)
+      if (mgr_data -> lvl_to_keep_cpoints == 0 && !reuse)
       {
          memory_location = hypre_IntArrayMemoryLocation(CF_marker_array[lev]);
          if (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE)
@@ -1529,7 +1907,7 @@ hypre_MGRSetup( void               *mgr_vdata,
    }
 
    /* keep reserved coarse indexes to coarsest grid */
-   if (reserved_coarse_size > 0 && lvl_to_keep_cpoints == 0)
+   if (reserved_coarse_size > 0 && lvl_to_keep_cpoints == 0 && !reuse)
    {
       ilower = hypre_ParCSRMatrixFirstRowIndex(A_array[num_c_levels]);
       for (i = 0; i < reserved_coarse_size; i++)
@@ -13,213 +13,6 @@
  * operators, based on the original Galerkin coarse grid
  */
 
-/* Take all of the indices from indices[start, start+1, start+2, ..., end]
- * and take the corresponding entries in array and place them in-order in output.
- * Assumptions:
- *      output is of length end-start+1
- *      indices never contains an index that goes out of bounds in array
- * */
-HYPRE_Int
-hypre_GrabSubArray(HYPRE_Int * indices,
-                   HYPRE_Int start,
-                   HYPRE_Int end,
-                   HYPRE_BigInt * array,
-                   HYPRE_BigInt * output)
-{
-   HYPRE_Int i, length;
-   length = end - start + 1;
-
-   for (i = 0; i < length; i++)
-   {
-      output[i] = array[indices[start + i]];
-   }
-
-   return hypre_error_flag;
-}
-
-/* Compute the intersection of x and y, placing
- * the intersection in z.  Additionally, the array
- * x_data is associated with x, i.e., the entries
- * that we grab from x, we also grab from x_data.
- * If x[k] is placed in z[m], then x_data[k] goes to
- * output_x_data[m].
- *
- * Assumptions:
- *      z is of length min(x_length, y_length)
- *      x and y are sorted
- *      x_length and y_length are similar in size, otherwise,
- *          looping over the smaller array and doing binary search
- *          in the longer array is faster.
- * */
-HYPRE_Int
-hypre_IntersectTwoArrays(HYPRE_Int *x,
-                         HYPRE_Real *x_data,
-                         HYPRE_Int  x_length,
-                         HYPRE_Int *y,
-                         HYPRE_Int  y_length,
-                         HYPRE_Int *z,
-                         HYPRE_Real *output_x_data,
-                         HYPRE_Int  *intersect_length)
-{
-   HYPRE_Int x_index = 0;
-   HYPRE_Int y_index = 0;
-   *intersect_length = 0;
-
-   /* Compute Intersection, looping over each array */
-   while ( (x_index < x_length) && (y_index < y_length) )
-   {
-      if (x[x_index] > y[y_index])
-      {
-         y_index = y_index + 1;
-      }
-      else if (x[x_index] < y[y_index])
-      {
-         x_index = x_index + 1;
-      }
-      else
-      {
-         z[*intersect_length] = x[x_index];
-         output_x_data[*intersect_length] = x_data[x_index];
-         x_index = x_index + 1;
-         y_index = y_index + 1;
-         *intersect_length = *intersect_length + 1;
-      }
-   }
-
-   return 1;
-}
-
-HYPRE_Int
-hypre_IntersectTwoBigArrays(HYPRE_BigInt *x,
-                            HYPRE_Real *x_data,
-                            HYPRE_Int  x_length,
-                            HYPRE_BigInt *y,
-                            HYPRE_Int  y_length,
-                            HYPRE_BigInt *z,
-                            HYPRE_Real *output_x_data,
-                            HYPRE_Int  *intersect_length)
-{
-   HYPRE_Int x_index = 0;
-   HYPRE_Int y_index = 0;
-   *intersect_length = 0;
-
-   /* Compute Intersection, looping over each array */
-   while ( (x_index < x_length) && (y_index < y_length) )
-   {
-      if (x[x_index] > y[y_index])
-      {
-         y_index = y_index + 1;
-      }
-      else if (x[x_index] < y[y_index])
-      {
-         x_index = x_index + 1;
-      }
-      else
-      {
-         z[*intersect_length] = x[x_index];
-         output_x_data[*intersect_length] = x_data[x_index];
-         x_index = x_index + 1;
-         y_index = y_index + 1;
-         *intersect_length = *intersect_length + 1;
-      }
-   }
-
-   return 1;
-}
-
-/* Copy CSR matrix A to CSR matrix B.  The column indices are
- * assumed to be sorted, and the sparsity pattern of B is a subset
- * of the sparsity pattern of A.
- *
- * Assumptions:
- *      Column indices of A and B are sorted
- *      Sparsity pattern of B is a subset of A's
- *      A and B are the same size and have same data layout
- **/
-HYPRE_Int
-hypre_SortedCopyParCSRData(hypre_ParCSRMatrix  *A,
-                           hypre_ParCSRMatrix  *B)
-{
-   /* Grab off A and B's data structures */
-   hypre_CSRMatrix     *A_diag               = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Int           *A_diag_i             = hypre_CSRMatrixI(A_diag);
-   HYPRE_Int           *A_diag_j             = hypre_CSRMatrixJ(A_diag);
-   HYPRE_Real          *A_diag_data          = hypre_CSRMatrixData(A_diag);
-
-   hypre_CSRMatrix     *A_offd               = hypre_ParCSRMatrixOffd(A);
-   HYPRE_Int           *A_offd_i             = hypre_CSRMatrixI(A_offd);
-   HYPRE_Int           *A_offd_j             = hypre_CSRMatrixJ(A_offd);
-   HYPRE_Real          *A_offd_data          = hypre_CSRMatrixData(A_offd);
-
-   hypre_CSRMatrix     *B_diag               = hypre_ParCSRMatrixDiag(B);
-   HYPRE_Int           *B_diag_i             = hypre_CSRMatrixI(B_diag);
-   HYPRE_Int           *B_diag_j             = hypre_CSRMatrixJ(B_diag);
-   HYPRE_Real          *B_diag_data          = hypre_CSRMatrixData(B_diag);
-
-   hypre_CSRMatrix     *B_offd               = hypre_ParCSRMatrixOffd(B);
-   HYPRE_Int           *B_offd_i             = hypre_CSRMatrixI(B_offd);
-   HYPRE_Int           *B_offd_j             = hypre_CSRMatrixJ(B_offd);
-   HYPRE_Real          *B_offd_data          = hypre_CSRMatrixData(B_offd);
-
-   HYPRE_Int            num_variables        = hypre_CSRMatrixNumRows(A_diag);
-   HYPRE_Int            *temp_int_array      = NULL;
-   HYPRE_Int            temp_int_array_length = 0;
-   HYPRE_Int            i, length, offset_A, offset_B;
-
-   for (i = 0; i < num_variables; i++)
-   {
-
-      /* Deal with the first row entries, which may be diagonal elements */
-      if ( A_diag_j[A_diag_i[i]] == i)
-      {   offset_A = 1; }
-      else
-      {   offset_A = 0; }
-      if ( B_diag_j[B_diag_i[i]] == i)
-      {   offset_B = 1; }
-      else
-      {   offset_B = 0; }
-      if ( (offset_B == 1) && (offset_A == 1) )
-      {   B_diag_data[B_diag_i[i]] = A_diag_data[A_diag_i[i]]; }
-
-      /* This finds the intersection of the column indices, and
-       * also copies the matching data in A to the data array in B
-       **/
-      if ( (A_diag_i[i + 1] - A_diag_i[i] - offset_A) > temp_int_array_length )
-      {
-         hypre_TFree(temp_int_array, HYPRE_MEMORY_HOST);
-         temp_int_array_length = (A_diag_i[i + 1] - A_diag_i[i] - offset_A);
-         temp_int_array = hypre_CTAlloc(HYPRE_Int,  temp_int_array_length, HYPRE_MEMORY_HOST);
-      }
-      hypre_IntersectTwoArrays(&(A_diag_j[A_diag_i[i] + offset_A]),
-                               &(A_diag_data[A_diag_i[i] + offset_A]),
-                               A_diag_i[i + 1] - A_diag_i[i] - offset_A,
-                               &(B_diag_j[B_diag_i[i] + offset_B]),
-                               B_diag_i[i + 1] - B_diag_i[i] - offset_B,
-                               temp_int_array,
-                               &(B_diag_data[B_diag_i[i] + offset_B]),
-                               &length);
-
-      if ( (A_offd_i[i + 1] - A_offd_i[i]) > temp_int_array_length )
-      {
-         hypre_TFree(temp_int_array, HYPRE_MEMORY_HOST);
-         temp_int_array_length = (A_offd_i[i + 1] - A_offd_i[i]);
-         temp_int_array = hypre_CTAlloc(HYPRE_Int,  temp_int_array_length, HYPRE_MEMORY_HOST);
-      }
-      hypre_IntersectTwoArrays(&(A_offd_j[A_offd_i[i]]),
-                               &(A_offd_data[A_offd_i[i]]),
-                               A_offd_i[i + 1] - A_offd_i[i],
-                               &(B_offd_j[B_offd_i[i]]),
-                               B_offd_i[i + 1] - B_offd_i[i],
-                               temp_int_array,
-                               &(B_offd_data[B_offd_i[i]]),
-                               &length);
-   }
-
-   if (temp_int_array)
-   {    hypre_TFree(temp_int_array, HYPRE_MEMORY_HOST); }
-   return 1;
-}
-
 /*
  * Equivalent to hypre_BoomerAMGCreateS, except, the data array of S
  * is not Null and contains the data entries from A.
@@ -595,363 +388,15 @@ hypre_BoomerAMG_MyCreateS(hypre_ParCSRMatrix  *A,
    return (ierr);
 }
 
-/**
- * Initialize the IJBuffer counters
- **/
-HYPRE_Int
-hypre_NonGalerkinIJBufferInit( HYPRE_Int
-                               *ijbuf_cnt,           /* See NonGalerkinIJBufferWrite for parameter descriptions */
-                               HYPRE_Int     *ijbuf_rowcounter,
-                               HYPRE_Int     *ijbuf_numcols )
-{
-   HYPRE_Int                ierr = 0;
-
-   (*ijbuf_cnt)         = 0;
-   (*ijbuf_rowcounter)  = 1; /*Always points to the next row*/
-   ijbuf_numcols[0]     = 0;
-
-   return ierr;
-}
-
-
-/**
- * Initialize the IJBuffer counters
- **/
-HYPRE_Int
-hypre_NonGalerkinIJBigBufferInit( HYPRE_Int
-                                  *ijbuf_cnt,           /* See NonGalerkinIJBufferWrite for parameter descriptions */
-                                  HYPRE_Int     *ijbuf_rowcounter,
-                                  HYPRE_BigInt     *ijbuf_numcols )
-{
-   HYPRE_Int                ierr = 0;
-
-   (*ijbuf_cnt)         = 0;
-   (*ijbuf_rowcounter)  = 1; /*Always points to the next row*/
-   ijbuf_numcols[0]     = 0;
-
-   return ierr;
-}
-
-
-
-/**
- * Update the buffer counters
- **/
-HYPRE_Int
-hypre_NonGalerkinIJBufferNewRow(HYPRE_BigInt
-                                *ijbuf_rownums, /* See NonGalerkinIJBufferWrite for parameter descriptions */
-                                HYPRE_Int     *ijbuf_numcols,
-                                HYPRE_Int     *ijbuf_rowcounter,
-                                HYPRE_BigInt   new_row)
-{
-   HYPRE_Int                ierr = 0;
-
-   /* First check to see if the previous row was empty, and if so, overwrite that row */
-   if ( ijbuf_numcols[(*ijbuf_rowcounter) - 1] == 0 )
-   {
-      ijbuf_rownums[(*ijbuf_rowcounter) - 1] = new_row;
-   }
-   else
-   {
-      /* Move to the next row */
-      ijbuf_rownums[(*ijbuf_rowcounter)] = new_row;
-      ijbuf_numcols[(*ijbuf_rowcounter)] = 0;
-      (*ijbuf_rowcounter)++;
-   }
-
-   return ierr;
-}
-
-/**
- * Compress the current row in an IJ Buffer by removing duplicate entries
- **/
-HYPRE_Int
-hypre_NonGalerkinIJBufferCompressRow( HYPRE_Int
-                                      *ijbuf_cnt,      /* See NonGalerkinIJBufferWrite for parameter descriptions */
-                                      HYPRE_Int      ijbuf_rowcounter,
-                                      HYPRE_Real     *ijbuf_data,
-                                      HYPRE_BigInt   *ijbuf_cols,
-                                      HYPRE_BigInt   *ijbuf_rownums,
-                                      HYPRE_Int      *ijbuf_numcols)
-{
-   HYPRE_UNUSED_VAR(ijbuf_rownums);
-
-   HYPRE_Int                ierr = 0;
-   HYPRE_Int                nentries, i, nduplicate;
-
-   /* Compress the current row by removing any repeat entries,
-    * making sure to decrement ijbuf_cnt by nduplicate */
-   nentries = ijbuf_numcols[ ijbuf_rowcounter - 1 ];
-   nduplicate = 0;
-   hypre_BigQsort1(ijbuf_cols, ijbuf_data, (*ijbuf_cnt) - nentries, (*ijbuf_cnt) - 1 );
-
-   for (i = (*ijbuf_cnt) - nentries + 1; i <= (*ijbuf_cnt) - 1; i++)
-   {
-      if ( ijbuf_cols[i] == ijbuf_cols[i - 1] )
-      {
-         /* Shift duplicate entry down */
-         nduplicate++;
-         ijbuf_data[i - nduplicate] += ijbuf_data[i];
-      }
-      else if (nduplicate > 0)
-      {
-         ijbuf_data[i - nduplicate] = ijbuf_data[i];
-         ijbuf_cols[i - nduplicate] = ijbuf_cols[i];
-      }
-   }
-   (*ijbuf_cnt) -= nduplicate;
-   ijbuf_numcols[ ijbuf_rowcounter - 1 ] -= nduplicate;
-
-   return ierr;
-}
-
-
-
-/**
- * Compress the entire buffer, removing duplicate rows
- **/
-HYPRE_Int
-hypre_NonGalerkinIJBufferCompress( HYPRE_MemoryLocation memory_location,
-                                   HYPRE_Int            ijbuf_size,
-                                   HYPRE_Int           *ijbuf_cnt,      /* See NonGalerkinIJBufferWrite for parameter descriptions */
-                                   HYPRE_Int           *ijbuf_rowcounter,
-                                   HYPRE_Real         **ijbuf_data,
-                                   HYPRE_BigInt       **ijbuf_cols,
-                                   HYPRE_BigInt       **ijbuf_rownums,
-                                   HYPRE_Int          **ijbuf_numcols)
-{
-   HYPRE_Int                ierr       = 0;
-   HYPRE_Int                *indys     = hypre_CTAlloc(HYPRE_Int,  (*ijbuf_rowcounter),
-                                                       HYPRE_MEMORY_HOST);
-
-   HYPRE_Int                i, duplicate, cnt_new, rowcounter_new;
-   HYPRE_Int                row_loc;
-   HYPRE_BigInt             row_start, row_stop, row, prev_row, j;
-
-   HYPRE_Real               *data_new;
-   HYPRE_BigInt             *cols_new;
-   HYPRE_BigInt             *rownums_new;
-   HYPRE_Int                *numcols_new;
-
-   /* Do a sort on rownums, but store the original order in indys.
-    * Then see if there are any duplicate rows */
-   for (i = 0; i < (*ijbuf_rowcounter); i++)
-   {
-      indys[i] = i;
-   }
-   hypre_BigQsortbi((*ijbuf_rownums), indys, 0, (*ijbuf_rowcounter) - 1);
-   duplicate = 0;
-   for (i = 1; i < (*ijbuf_rowcounter); i++)
-   {
-      if (indys[i] != (indys[i - 1] + 1))
-      {
-         duplicate = 1;
-         break;
-      }
-   }
-
-   /* Compress duplicate rows */
-   if (duplicate)
-   {
-      /* Accumulate numcols, so that it functions like a CSR row-pointer */
-      for (i = 1; i < (*ijbuf_rowcounter); i++)
-      {   (*ijbuf_numcols)[i] += (*ijbuf_numcols)[i - 1]; }
-
-      /* Initialize new buffer */
-      prev_row         = -1;
-      rowcounter_new   = 0;
-      cnt_new          = 0;
-      data_new         = hypre_CTAlloc(HYPRE_Real,   ijbuf_size, memory_location);
-      cols_new         = hypre_CTAlloc(HYPRE_BigInt, ijbuf_size, memory_location);
-      rownums_new      = hypre_CTAlloc(HYPRE_BigInt, ijbuf_size, memory_location);
-      numcols_new      = hypre_CTAlloc(HYPRE_Int,    ijbuf_size, memory_location);
-      numcols_new[0]   = 0;
-
-      /* Cycle through each row */
-      for (i = 0; i < (*ijbuf_rowcounter); i++)
-      {
-
-         /* Find which row this is in local and global numberings, and where
-          * this row's data starts and stops in the buffer*/
-         row_loc = indys[i];
-         row = (*ijbuf_rownums)[i];
-         if (row_loc > 0)
-         {
-            row_start = (HYPRE_BigInt) (*ijbuf_numcols)[row_loc - 1];
-            row_stop  = (HYPRE_BigInt) (*ijbuf_numcols)[row_loc];
-         }
-         else
-         {
-            row_start = 0;
-            row_stop  = (HYPRE_BigInt) (*ijbuf_numcols)[row_loc];
-         }
-
-         /* Is this a new row?  If so, compress previous row, and add a new
-          * one.  Noting that prev_row = -1 is a special value */
-         if (row != prev_row)
-         {
-            if (prev_row != -1)
-            {
-               /* Compress previous row */
-               hypre_NonGalerkinIJBufferCompressRow(&cnt_new, rowcounter_new, data_new,
-                                                    cols_new, rownums_new, numcols_new);
-            }
-            prev_row = row;
-            numcols_new[rowcounter_new] = 0;
-            rownums_new[rowcounter_new] = row;
-            rowcounter_new++;
-         }
-
-         /* Copy row into new buffer */
-         for (j = row_start; j < row_stop; j++)
-         {
-            data_new[cnt_new] = (*ijbuf_data)[j];
-            cols_new[cnt_new] = (*ijbuf_cols)[j];
-            numcols_new[rowcounter_new - 1]++;
-            cnt_new++;
-         }
-      }
-
-      /* Compress the final row */
-      if (i > 1)
-      {
-         hypre_NonGalerkinIJBufferCompressRow(&cnt_new, rowcounter_new, data_new,
-                                              cols_new, rownums_new, numcols_new);
-      }
-
-      *ijbuf_cnt = cnt_new;
-      *ijbuf_rowcounter = rowcounter_new;
-
-      /* Point to the new buffer */
-      hypre_TFree(*ijbuf_data,    memory_location);
-      hypre_TFree(*ijbuf_cols,    memory_location);
-      hypre_TFree(*ijbuf_rownums, memory_location);
-      hypre_TFree(*ijbuf_numcols, memory_location);
-      (*ijbuf_data)    = data_new;
-      (*ijbuf_cols)    = cols_new;
-      (*ijbuf_rownums) = rownums_new;
-      (*ijbuf_numcols) = numcols_new;
-   }
-
-   hypre_TFree(indys, HYPRE_MEMORY_HOST);
-
-   return ierr;
-}
-
-
-/**
- * Do a buffered write to an IJ matrix.
- * That is, write to the buffer, until the buffer is full. Then when the
- * buffer is full, write to the IJ matrix and reset the buffer counters
- * In effect, this buffers this operation
- *  A[row_to_write, col_to_write] += val_to_write
- **/
-HYPRE_Int
-hypre_NonGalerkinIJBufferWrite( HYPRE_IJMatrix
-                                B,                 /* Unassembled matrix to add an entry to */
-                                HYPRE_Int    *ijbuf_cnt,          /* current buffer size */
-                                HYPRE_Int     ijbuf_size,         /* max buffer size */
-                                HYPRE_Int    *ijbuf_rowcounter,   /* num of rows in rownums, (i.e., size of rownums) */
-                                /* This counter will increase as you call this function for multiple rows */
-                                HYPRE_Real   **ijbuf_data,         /* Array of values, of size ijbuf_size */
-                                HYPRE_BigInt **ijbuf_cols,         /* Array of col indices, of size ijbuf_size */
-                                HYPRE_BigInt
-                                **ijbuf_rownums,      /* Holds row-indices that with numcols makes for a CSR-like data structure*/
-                                HYPRE_Int
-                                **ijbuf_numcols,      /* rownums[i] is the row num, and numcols holds the number of entries being added */
-                                /* for that row. Note numcols is not cumulative like an actual CSR data structure*/
-                                HYPRE_BigInt  row_to_write,       /* Entry to add to the buffer */
-                                HYPRE_BigInt  col_to_write,       /*          Ditto             */
-                                HYPRE_Real    val_to_write )      /*          Ditto             */
-{
-   HYPRE_Int                ierr = 0;
-
-   HYPRE_MemoryLocation memory_location = hypre_IJMatrixMemoryLocation(B);
-
-   if ( (*ijbuf_cnt) == 0 )
-   {
-      /* brand new buffer: increment buffer structures for the new row */
-      hypre_NonGalerkinIJBufferNewRow((*ijbuf_rownums), (*ijbuf_numcols), ijbuf_rowcounter, row_to_write);
-
-   }
-   else if ((*ijbuf_rownums)[ (*ijbuf_rowcounter) - 1 ] != row_to_write)
-   {
-      /* If this is a new row, compress the previous row */
-      hypre_NonGalerkinIJBufferCompressRow(ijbuf_cnt, (*ijbuf_rowcounter), (*ijbuf_data),
-                                           (*ijbuf_cols), (*ijbuf_rownums), (*ijbuf_numcols));
-      /* increment buffer structures for the new row */
-      hypre_NonGalerkinIJBufferNewRow( (*ijbuf_rownums), (*ijbuf_numcols), ijbuf_rowcounter,
-                                       row_to_write);
-   }
-
-   /* Add new entry to buffer */
-   (*ijbuf_cols)[(*ijbuf_cnt)] = col_to_write;
-   (*ijbuf_data)[(*ijbuf_cnt)] = val_to_write;
-   (*ijbuf_numcols)[ (*ijbuf_rowcounter) - 1 ]++;
-   (*ijbuf_cnt)++;
-
-   /* Buffer is full, write to the matrix object */
-   if ( (*ijbuf_cnt) == (ijbuf_size - 1) )
-   {
-      /* If the last row is empty, decrement rowcounter */
-      if ( (*ijbuf_numcols)[ (*ijbuf_rowcounter) - 1 ] == 0)
-      {    (*ijbuf_rowcounter)--; }
-
-      /* Compress and Add Entries */
-      hypre_NonGalerkinIJBufferCompressRow(ijbuf_cnt, (*ijbuf_rowcounter), (*ijbuf_data),
-                                           (*ijbuf_cols), (*ijbuf_rownums), (*ijbuf_numcols));
-      hypre_NonGalerkinIJBufferCompress(memory_location, ijbuf_size, ijbuf_cnt, ijbuf_rowcounter,
-                                        ijbuf_data,
-                                        ijbuf_cols, ijbuf_rownums, ijbuf_numcols);
-      ierr += HYPRE_IJMatrixAddToValues(B, *ijbuf_rowcounter, (*ijbuf_numcols), (*ijbuf_rownums),
-                                        (*ijbuf_cols), (*ijbuf_data));
-
-      /* Reinitialize the buffer */
-      hypre_NonGalerkinIJBufferInit( ijbuf_cnt, ijbuf_rowcounter, (*ijbuf_numcols));
-      hypre_NonGalerkinIJBufferNewRow((*ijbuf_rownums), (*ijbuf_numcols), ijbuf_rowcounter, row_to_write);
-   }
-
-   return ierr;
-}
-
-
-/**
- * Empty the IJ Buffer with a final AddToValues.
- **/
-HYPRE_Int
-hypre_NonGalerkinIJBufferEmpty(HYPRE_IJMatrix
-                               B, /* See NonGalerkinIJBufferWrite for parameter descriptions */
-                               HYPRE_Int      ijbuf_size,
-                               HYPRE_Int      *ijbuf_cnt,
-                               HYPRE_Int      ijbuf_rowcounter,
-                               HYPRE_Real     **ijbuf_data,
-                               HYPRE_BigInt   **ijbuf_cols,
-                               HYPRE_BigInt   **ijbuf_rownums,
-                               HYPRE_Int      **ijbuf_numcols)
-{
-   HYPRE_Int                ierr = 0;
-   HYPRE_MemoryLocation memory_location = hypre_IJMatrixMemoryLocation(B);
-
-   if ( (*ijbuf_cnt) > 0)
-   {
-      /* Compress the last row and then write */
-      hypre_NonGalerkinIJBufferCompressRow(ijbuf_cnt, ijbuf_rowcounter, (*ijbuf_data),
-                                           (*ijbuf_cols), (*ijbuf_rownums), (*ijbuf_numcols));
-      hypre_NonGalerkinIJBufferCompress(memory_location, ijbuf_size, ijbuf_cnt, &ijbuf_rowcounter,
-                                        ijbuf_data,
-                                        ijbuf_cols, ijbuf_rownums, ijbuf_numcols);
-      ierr += HYPRE_IJMatrixAddToValues(B, ijbuf_rowcounter, (*ijbuf_numcols), (*ijbuf_rownums),
-                                        (*ijbuf_cols), (*ijbuf_data));
-   }
-   (*ijbuf_cnt = 0);
-
-   return ierr;
-}
-
+/*--------------------------------------------------------------------------
+ * hypre_NonGalerkinSparsityPattern
+ *
+ * Construct sparsity pattern based on R_I A P, plus entries required by drop
+ * tolerance.  The pattern is assembled directly in diag/offd form, with all
+ * values equal to one; only its structure is used.  With symmetric
+ * collapsing, the pattern is symmetrized by adding its transpose.
+ *--------------------------------------------------------------------------*/
 
-/*
- * Construct sparsity pattern based on R_I A P, plus entries required by drop tolerance
- */
 hypre_ParCSRMatrix *
 hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
                                  hypre_ParCSRMatrix *RAP,
@@ -963,8 +408,6 @@ hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
    /* MPI Communicator */
    MPI_Comm            comm               = hypre_ParCSRMatrixComm(RAP);
 
-   HYPRE_MemoryLocation memory_location_RAP = hypre_ParCSRMatrixMemoryLocation(RAP);
-
    /* Declare R_IAP */
    hypre_CSRMatrix    *R_IAP_diag         = hypre_ParCSRMatrixDiag(R_IAP);
    HYPRE_Int          *R_IAP_diag_i       = hypre_CSRMatrixI(R_IAP_diag);
@@ -974,15 +417,14 @@ hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
    HYPRE_Int          *R_IAP_offd_i       = hypre_CSRMatrixI(R_IAP_offd);
    HYPRE_Int          *R_IAP_offd_j       = hypre_CSRMatrixJ(R_IAP_offd);
    HYPRE_BigInt       *col_map_offd_R_IAP = hypre_ParCSRMatrixColMapOffd(R_IAP);
+   HYPRE_Int           num_cols_R_IAP_offd = hypre_CSRMatrixNumCols(R_IAP_offd);
 
    /* Declare RAP */
    hypre_CSRMatrix    *RAP_diag           = hypre_ParCSRMatrixDiag(RAP);
    HYPRE_Int          *RAP_diag_i         = hypre_CSRMatrixI(RAP_diag);
    HYPRE_Real         *RAP_diag_data      = hypre_CSRMatrixData(RAP_diag);
    HYPRE_Int          *RAP_diag_j         = hypre_CSRMatrixJ(RAP_diag);
-   HYPRE_BigInt        first_col_diag_RAP = hypre_ParCSRMatrixFirstColDiag(RAP);
    HYPRE_Int           num_cols_diag_RAP  = hypre_CSRMatrixNumCols(RAP_diag);
-   HYPRE_BigInt        last_col_diag_RAP  = first_col_diag_RAP + (HYPRE_BigInt)num_cols_diag_RAP - 1;
 
    hypre_CSRMatrix    *RAP_offd           = hypre_ParCSRMatrixOffd(RAP);
    HYPRE_Int          *RAP_offd_i         = hypre_CSRMatrixI(RAP_offd);
@@ -996,28 +438,22 @@ hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
    /* Declare A */
    HYPRE_Int           num_fine_variables = hypre_CSRMatrixNumRows(R_IAP_diag);
 
-   /* Declare IJ matrices */
-   HYPRE_IJMatrix      Pattern;
-   hypre_ParCSRMatrix *Pattern_CSR        = NULL;
-
-   /* Buffered IJAddToValues */
-   HYPRE_Int           ijbuf_cnt, ijbuf_size, ijbuf_rowcounter;
-   HYPRE_Real         *ijbuf_data;
-   HYPRE_BigInt       *ijbuf_cols, *ijbuf_rownums;
-   HYPRE_Int          *ijbuf_numcols;
-
-   /* Buffered IJAddToValues for Symmetric Entries */
-   HYPRE_Int           ijbuf_sym_cnt, ijbuf_sym_rowcounter;
-   HYPRE_Real         *ijbuf_sym_data;
-   HYPRE_BigInt       *ijbuf_sym_cols, *ijbuf_sym_rownums;
-   HYPRE_Int          *ijbuf_sym_numcols;
+   /* Declare Pattern, and its transpose if collapsing symmetrically */
+   hypre_ParCSRMatrix *Pattern            = NULL;
+   hypre_ParCSRMatrix *PatternT           = NULL;
+   hypre_ParCSRMatrix *Pattern_sym        = NULL;
+   HYPRE_Int          *Pattern_diag_i, *Pattern_diag_j;
+   HYPRE_Int          *Pattern_offd_i, *Pattern_offd_j;
+   HYPRE_Real         *Pattern_diag_data, *Pattern_offd_data;
+   HYPRE_BigInt       *col_map_offd_Pattern;
+   HYPRE_Int           num_cols_Pattern_offd;
+   HYPRE_Int          *R_IAP_to_Pattern, *RAP_to_Pattern;
+   HYPRE_Int          *diag_marker, *offd_marker;
 
    /* Other Declarations */
    HYPRE_Real          max_entry         = 0.0;
    HYPRE_Real          max_entry_offd    = 0.0;
-   HYPRE_Int          *rownz             = NULL;
-   HYPRE_Int           i, j, Cpt, row_start, row_end;
-   HYPRE_BigInt        global_row, global_col;
+   HYPRE_Int           i, j, Cpt, col, nnz_diag, nnz_offd;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
@@ -1027,110 +463,84 @@ hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
       RAP_offd_data = hypre_CSRMatrixData(RAP_offd);
    }
 
-   /*
-    * Initialize the IJ matrix, leveraging our rough knowledge of the
-    * nonzero structure of Pattern based on RAP
-    *
-    *                         ilower,             iupper,            jlower,             jupper */
-   HYPRE_IJMatrixCreate(comm, first_col_diag_RAP, last_col_diag_RAP, first_col_diag_RAP,
-                        last_col_diag_RAP, &Pattern);
-   HYPRE_IJMatrixSetObjectType(Pattern, HYPRE_PARCSR);
-   rownz = hypre_CTAlloc(HYPRE_Int,  num_variables, HYPRE_MEMORY_HOST);
+   /* The offd columns of Pattern are those of R_IAP and RAP */
+   col_map_offd_Pattern = hypre_TAlloc(HYPRE_BigInt, num_cols_R_IAP_offd + num_cols_RAP_offd,
+                                       HYPRE_MEMORY_HOST);
+   R_IAP_to_Pattern     = hypre_TAlloc(HYPRE_Int, num_cols_R_IAP_offd, HYPRE_MEMORY_HOST);
+   RAP_to_Pattern       = hypre_TAlloc(HYPRE_Int, num_cols_RAP_offd, HYPRE_MEMORY_HOST);
+   hypre_union2(num_cols_R_IAP_offd, col_map_offd_R_IAP,
+                num_cols_RAP_offd, col_map_offd_RAP,
+                &num_cols_Pattern_offd, col_map_offd_Pattern,
+                R_IAP_to_Pattern, RAP_to_Pattern);
+
+   /* Each row of Pattern holds at most the entries of the R_IAP row at its
+    * C-point and those of its RAP row */
+   Pattern_diag_i = hypre_CTAlloc(HYPRE_Int, num_variables + 1, HYPRE_MEMORY_HOST);
+   Pattern_offd_i = hypre_CTAlloc(HYPRE_Int, num_variables + 1, HYPRE_MEMORY_HOST);
+   nnz_diag = nnz_offd = 0;
+   Cpt = -1; /* Cpt contains the fine grid index of the i-th Cpt */
    for (i = 0; i < num_variables; i++)
    {
-      rownz[i] = (HYPRE_Int)(1.2 * (RAP_diag_i[i + 1] - RAP_diag_i[i]) +
-                             1.2 * (RAP_offd_i[i + 1] - RAP_offd_i[i]));
+      /* Find the next Coarse Point in CF_marker */
+      for (j = Cpt + 1; j < num_fine_variables; j++)
+      {
+         if (CF_marker[j] == 1)  /* Found Next C-point */
+         {
+            Cpt = j;
+            break;
+         }
+      }
+      nnz_diag += (R_IAP_diag_i[Cpt + 1] - R_IAP_diag_i[Cpt]) +
+                  (RAP_diag_i[i + 1] - RAP_diag_i[i]);
+      nnz_offd += (R_IAP_offd_i[Cpt + 1] - R_IAP_offd_i[Cpt]) +
+                  (RAP_offd_i[i + 1] - RAP_offd_i[i]);
    }
-   HYPRE_IJMatrixSetRowSizes(Pattern, rownz);
-   HYPRE_IJMatrixInitialize(Pattern);
-   hypre_TFree(rownz, HYPRE_MEMORY_HOST);
+   Pattern_diag_j = hypre_TAlloc(HYPRE_Int, nnz_diag, HYPRE_MEMORY_HOST);
+   Pattern_offd_j = hypre_TAlloc(HYPRE_Int, nnz_offd, HYPRE_MEMORY_HOST);
 
-   /*
-    * For efficiency, we do a buffered IJAddToValues.
-    * Here, we initialize the buffer and then initialize the buffer counters
-    */
-   ijbuf_size       = 1000;
-   ijbuf_data       = hypre_CTAlloc(HYPRE_Real,   ijbuf_size, memory_location_RAP);
-   ijbuf_cols       = hypre_CTAlloc(HYPRE_BigInt, ijbuf_size, memory_location_RAP);
-   ijbuf_rownums    = hypre_CTAlloc(HYPRE_BigInt, ijbuf_size, memory_location_RAP);
-   ijbuf_numcols    = hypre_CTAlloc(HYPRE_Int,    ijbuf_size, memory_location_RAP);
-   hypre_NonGalerkinIJBigBufferInit(&ijbuf_cnt, &ijbuf_rowcounter, ijbuf_cols);
-   if (sym_collapse)
+   diag_marker = hypre_TAlloc(HYPRE_Int, num_cols_diag_RAP, HYPRE_MEMORY_HOST);
+   offd_marker = hypre_TAlloc(HYPRE_Int, num_cols_Pattern_offd, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_cols_diag_RAP; j++)
    {
-      ijbuf_sym_data    = hypre_CTAlloc(HYPRE_Real,    ijbuf_size, memory_location_RAP);
-      ijbuf_sym_cols    = hypre_CTAlloc(HYPRE_BigInt,  ijbuf_size, memory_location_RAP);
-      ijbuf_sym_rownums = hypre_CTAlloc(HYPRE_BigInt,  ijbuf_size, memory_location_RAP);
-      ijbuf_sym_numcols = hypre_CTAlloc(HYPRE_Int,     ijbuf_size, memory_location_RAP);
-      hypre_NonGalerkinIJBigBufferInit(&ijbuf_sym_cnt, &ijbuf_sym_rowcounter, ijbuf_sym_cols);
+      diag_marker[j] = -1;
+   }
+   for (j = 0; j < num_cols_Pattern_offd; j++)
+   {
+      offd_marker[j] = -1;
    }
 
-   /*
-    * Place entries in R_IAP into Pattern
-    */
-   Cpt = -1; /* Cpt contains the fine grid index of the i-th Cpt */
+   nnz_diag = nnz_offd = 0;
+   Cpt = -1;
    for (i = 0; i < num_variables; i++)
    {
-      global_row = i + first_col_diag_RAP;
-
-      /* Find the next Coarse Point in CF_marker */
       for (j = Cpt + 1; j < num_fine_variables; j++)
       {
-         if (CF_marker[j] == 1)  /* Found Next C-point */
+         if (CF_marker[j] == 1)
          {
             Cpt = j;
             break;
          }
       }
 
-      /* Diag Portion */
-      row_start = R_IAP_diag_i[Cpt];
-      row_end = R_IAP_diag_i[Cpt + 1];
-      for (j = row_start; j < row_end; j++)
+      /* Place entries in R_IAP into Pattern */
+      for (j = R_IAP_diag_i[Cpt]; j < R_IAP_diag_i[Cpt + 1]; j++)
       {
-         global_col = R_IAP_diag_j[j] + first_col_diag_RAP;
-         /* This call adds a                       1 x 1 to  i            j           data */
-         hypre_NonGalerkinIJBufferWrite(Pattern, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                        &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols,
-                                        global_row, global_col, 1.0);
-         if (sym_collapse)
+         col = R_IAP_diag_j[j];
+         if (diag_marker[col] != i)
          {
-            hypre_NonGalerkinIJBufferWrite(Pattern, &ijbuf_sym_cnt,
-                                           ijbuf_size, &ijbuf_sym_rowcounter, &ijbuf_sym_data,
-                                           &ijbuf_sym_cols, &ijbuf_sym_rownums, &ijbuf_sym_numcols,
-                                           global_col, global_row, 1.0);
+            diag_marker[col] = i;
+            Pattern_diag_j[nnz_diag++] = col;
          }
       }
-
-      /* Offdiag Portion */
-      row_start = R_IAP_offd_i[Cpt];
-      row_end = R_IAP_offd_i[Cpt + 1];
-      for (j = row_start; j < row_end; j++)
+      for (j = R_IAP_offd_i[Cpt]; j < R_IAP_offd_i[Cpt + 1]; j++)
       {
-         global_col = col_map_offd_R_IAP[R_IAP_offd_j[j]];
-         /* This call adds a                       1 x 1 to  i            j           data */
-         hypre_NonGalerkinIJBufferWrite(Pattern, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                        &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols,
-                                        global_row, global_col, 1.0);
-
-         if (sym_collapse)
+         col = R_IAP_to_Pattern[R_IAP_offd_j[j]];
+         if (offd_marker[col] != i)
          {
-            hypre_NonGalerkinIJBufferWrite(Pattern, &ijbuf_sym_cnt,
-                                           ijbuf_size, &ijbuf_sym_rowcounter, &ijbuf_sym_data,
-                                           &ijbuf_sym_cols, &ijbuf_sym_rownums, &ijbuf_sym_numcols,
-                                           global_col, global_row, 1.0);
+            offd_marker[col] = i;
+            Pattern_offd_j[nnz_offd++] = col;
          }
       }
-   }
-
-   /*
-    * Use drop-tolerance to compute new entries for sparsity pattern
-    */
-   /*#ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i,j,max_entry,max_entry_offd,global_col,global_row) HYPRE_SMP_SCHEDULE
-   #endif  */
-   for (i = 0; i < num_variables; i++)
-   {
-      global_row = i + first_col_diag_RAP;
 
       /* Compute the drop tolerance for this row, which is just
        *  abs(max of row i)*droptol  */
@@ -1142,105 +552,141 @@ hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
       }
       for (j = RAP_offd_i[i]; j < RAP_offd_i[i + 1]; j++)
       {
-         {
-            if ( max_entry < hypre_abs(RAP_offd_data[j]) )
-            {   max_entry = hypre_abs(RAP_offd_data[j]); }
-         }
+         if ( max_entry < hypre_abs(RAP_offd_data[j]) )
+         {   max_entry = hypre_abs(RAP_offd_data[j]); }
       }
       max_entry *= droptol;
       max_entry_offd = max_entry * collapse_beta;
 
-      /* Loop over diag portion, adding all entries that are "strong" */
+      /* Add all entries of RAP that are "strong" */
       for (j = RAP_diag_i[i]; j < RAP_diag_i[i + 1]; j++)
       {
-         if ( hypre_abs(RAP_diag_data[j]) > max_entry )
+         col = RAP_diag_j[j];
+         if (hypre_abs(RAP_diag_data[j]) > max_entry && diag_marker[col] != i)
          {
-            global_col = RAP_diag_j[j] + first_col_diag_RAP;
-            /*#ifdef HYPRE_USING_OPENMP
-            #pragma omp critical (IJAdd)
-            #endif
-            {*/
-            /* For efficiency, we do a buffered IJAddToValues
-             * A[global_row, global_col] += 1.0 */
-            hypre_NonGalerkinIJBufferWrite(Pattern, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                           &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols,
-                                           global_row, global_col, 1.0);
-            if (sym_collapse)
-            {
-               hypre_NonGalerkinIJBufferWrite(Pattern, &ijbuf_sym_cnt,
-                                              ijbuf_size, &ijbuf_sym_rowcounter, &ijbuf_sym_data,
-                                              &ijbuf_sym_cols, &ijbuf_sym_rownums, &ijbuf_sym_numcols,
-                                              global_col, global_row, 1.0);
-            }
-            /*}*/
+            diag_marker[col] = i;
+            Pattern_diag_j[nnz_diag++] = col;
          }
       }
-
-      /* Loop over offd portion, adding all entries that are "strong" */
       for (j = RAP_offd_i[i]; j < RAP_offd_i[i + 1]; j++)
       {
-         if ( hypre_abs(RAP_offd_data[j]) > max_entry_offd )
+         col = RAP_to_Pattern[RAP_offd_j[j]];
+         if (hypre_abs(RAP_offd_data[j]) > max_entry_offd && offd_marker[col] != i)
          {
-            global_col = col_map_offd_RAP[ RAP_offd_j[j] ];
-            /*#ifdef HYPRE_USING_OPENMP
-            #pragma omp critical (IJAdd)
-            #endif
-            {*/
-            /* For efficiency, we do a buffered IJAddToValues
-             * A[global_row, global_col] += 1.0 */
-            hypre_NonGalerkinIJBufferWrite(Pattern, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                           &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols,
-                                           global_row, global_col, 1.0);
-            if (sym_collapse)
-            {
-               hypre_NonGalerkinIJBufferWrite(Pattern, &ijbuf_sym_cnt,
-                                              ijbuf_size, &ijbuf_sym_rowcounter, &ijbuf_sym_data,
-                                              &ijbuf_sym_cols, &ijbuf_sym_rownums, &ijbuf_sym_numcols,
-                                              global_col, global_row, 1.0);
-            }
-            /*}*/
+            offd_marker[col] = i;
+            Pattern_offd_j[nnz_offd++] = col;
          }
       }
 
+      Pattern_diag_i[i + 1] = nnz_diag;
+      Pattern_offd_i[i + 1] = nnz_offd;
    }
 
-   /* For efficiency, we do a buffered IJAddToValues.
-    * This empties the buffer of any remaining values */
-   hypre_NonGalerkinIJBufferEmpty(Pattern, ijbuf_size, &ijbuf_cnt, ijbuf_rowcounter,
-                                  &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols);
-   if (sym_collapse)
+   Pattern_diag_data = hypre_TAlloc(HYPRE_Real, nnz_diag, HYPRE_MEMORY_HOST);
+   Pattern_offd_data = hypre_TAlloc(HYPRE_Real, nnz_offd, HYPRE_MEMORY_HOST);
+   for (j = 0; j < nnz_diag; j++)
    {
-      hypre_NonGalerkinIJBufferEmpty(Pattern, ijbuf_size, &ijbuf_sym_cnt, ijbuf_sym_rowcounter,
-                                     &ijbuf_sym_data, &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                     &ijbuf_sym_numcols);
+      Pattern_diag_data[j] = 1.0;
+   }
+   for (j = 0; j < nnz_offd; j++)
+   {
+      Pattern_offd_data[j] = 1.0;
    }
 
-   /* Finalize Construction of Pattern */
-   HYPRE_IJMatrixAssemble(Pattern);
-   HYPRE_IJMatrixGetObject(Pattern, (void**) &Pattern_CSR);
-
-   /* Deallocate */
-   HYPRE_IJMatrixSetObjectType(Pattern, -1);
-   HYPRE_IJMatrixDestroy(Pattern);
-   hypre_TFree(ijbuf_data,    memory_location_RAP);
-   hypre_TFree(ijbuf_cols,    memory_location_RAP);
-   hypre_TFree(ijbuf_rownums, memory_location_RAP);
-   hypre_TFree(ijbuf_numcols, memory_location_RAP);
+   Pattern = hypre_ParCSRMatrixCreate(comm,
+                                      hypre_ParCSRMatrixGlobalNumRows(RAP),
+                                      hypre_ParCSRMatrixGlobalNumCols(RAP),
+                                      hypre_ParCSRMatrixRowStarts(RAP),
+                                      hypre_ParCSRMatrixColStarts(RAP),
+                                      num_cols_Pattern_offd, nnz_diag, nnz_offd);
+   hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(Pattern))    = Pattern_diag_i;
+   hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(Pattern))    = Pattern_diag_j;
+   hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(Pattern)) = Pattern_diag_data;
+   hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(Pattern))    = Pattern_offd_i;
+   hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(Pattern))    = Pattern_offd_j;
+   hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(Pattern)) = Pattern_offd_data;
+   hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixDiag(Pattern)) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixOffd(Pattern)) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRMatrixColMapOffd(Pattern) = col_map_offd_Pattern;
 
    if (sym_collapse)
    {
-      hypre_TFree(ijbuf_sym_data,    memory_location_RAP);
-      hypre_TFree(ijbuf_sym_cols,    memory_location_RAP);
-      hypre_TFree(ijbuf_sym_rownums, memory_location_RAP);
-      hypre_TFree(ijbuf_sym_numcols, memory_location_RAP);
+      hypre_ParCSRMatrixTranspose(Pattern, &PatternT, 1);
+      hypre_ParCSRMatrixAdd(1.0, Pattern, 1.0, PatternT, &Pattern_sym);
+      hypre_ParCSRMatrixDestroy(Pattern);
+      hypre_ParCSRMatrixDestroy(PatternT);
+      Pattern = Pattern_sym;
    }
 
+   /* Deallocate */
+   hypre_TFree(R_IAP_to_Pattern, HYPRE_MEMORY_HOST);
+   hypre_TFree(RAP_to_Pattern, HYPRE_MEMORY_HOST);
+   hypre_TFree(diag_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_marker, HYPRE_MEMORY_HOST);
+
    HYPRE_ANNOTATE_FUNC_END;
 
-   return Pattern_CSR;
+   return Pattern;
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_NonGalerkinRowAdd
+ *
+ * Accumulate (own_value, mirror_value, lump_value) into column col of the row
+ * that is being built in work_j/own/mirror/lump[row_start, *row_end).
+ * pos[col] caches the slot of col; it is trusted only if it lies inside the
+ * current row and still holds col, so pos never has to be reset between rows.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_NonGalerkinRowAdd( HYPRE_Int   col,
+                         HYPRE_Real  own_value,
+                         HYPRE_Real  mirror_value,
+                         HYPRE_Real  lump_value,
+                         HYPRE_Int   row_start,
+                         HYPRE_Int  *row_end,
+                         HYPRE_Int  *pos,
+                         HYPRE_Int  *work_j,
+                         HYPRE_Real *work_own,
+                         HYPRE_Real *work_mirror,
+                         HYPRE_Real *work_lump )
+{
+   HYPRE_Int p = pos[col];
+
+   if (p < row_start || p >= *row_end || work_j[p] != col)
+   {
+      p = (*row_end)++;
+      pos[col]       = p;
+      work_j[p]      = col;
+      work_own[p]    = 0.0;
+      work_mirror[p] = 0.0;
+      work_lump[p]   = 0.0;
+   }
+   work_own[p]    += own_value;
+   work_mirror[p] += mirror_value;
+   work_lump[p]   += lump_value;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildNonGalerkinCoarseOperator
+ *
+ * Sparsify RAP onto the non-Galerkin pattern, lumping the dropped entries
+ * onto strongly connected neighbors that remain in the pattern.
+ *
+ * The new operator is assembled directly in diag/offd CSR form: each local
+ * row is built independently (and in parallel) in a slot range sized from
+ * the Pattern and RAP row lengths, with pattern membership tested through
+ * per-thread row markers.  Off-processor columns are translated once, up
+ * front, into Pattern's column numbering (the lumping plan), so no sorting
+ * or set intersection is needed in the row loop.  With symmetric collapsing,
+ * the mirror updates (t,i) are carried alongside the own updates (i,t) and
+ * delivered with a single transpose, while the mirror diagonal updates
+ * (t,t) are kept per slot, gathered in row order and summed across
+ * processors.  The rows of the result are sorted, so the operator does not
+ * depend on the number of threads.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int
 hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
                                                hypre_ParCSRMatrix *AP,
@@ -1256,43 +702,15 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
    MPI_Comm            comm                  = hypre_ParCSRMatrixComm(*RAP_ptr);
    hypre_ParCSRMatrix  *S                    = NULL;
    hypre_ParCSRMatrix  *RAP                  = *RAP_ptr;
-   HYPRE_Int           i, j, k, row_start, row_end, num_cols_offd_Sext, num_procs;
+   HYPRE_Int           i, j, k, num_cols_offd_Sext, num_procs;
    HYPRE_Int           S_ext_diag_size, S_ext_offd_size;
    HYPRE_BigInt        last_col_diag_RAP;
    HYPRE_Int           cnt_offd, cnt_diag, cnt;
-   HYPRE_Int           col_indx_Pattern, current_Pattern_j, col_indx_RAP;
    HYPRE_BigInt        value;
    HYPRE_BigInt       *temp                = NULL;
 
    HYPRE_MemoryLocation memory_location_RAP = hypre_ParCSRMatrixMemoryLocation(RAP);
 
-   /* Lumping related variables */
-   HYPRE_IJMatrix      ijmatrix;
-   HYPRE_BigInt        * Pattern_offd_indices          = NULL;
-   HYPRE_BigInt        * S_offd_indices                = NULL;
-   HYPRE_BigInt        * offd_intersection             = NULL;
-   HYPRE_Real          * offd_intersection_data        = NULL;
-   HYPRE_Int           * diag_intersection             = NULL;
-   HYPRE_Real          * diag_intersection_data        = NULL;
-   HYPRE_Int           Pattern_offd_indices_len        = 0;
-   HYPRE_Int           Pattern_offd_indices_allocated_len = 0;
-   HYPRE_Int           S_offd_indices_len              = 0;
-   HYPRE_Int           S_offd_indices_allocated_len    = 0;
-   HYPRE_Int           offd_intersection_len           = 0;
-   HYPRE_Int           offd_intersection_allocated_len = 0;
-   HYPRE_Int           diag_intersection_len           = 0;
-   HYPRE_Int           diag_intersection_allocated_len = 0;
-   HYPRE_Real          intersection_len                = 0;
-   HYPRE_Int           * Pattern_indices_ptr           = NULL;
-   HYPRE_Int           Pattern_diag_indices_len        = 0;
-   HYPRE_Int           global_row                      = 0;
-   HYPRE_Int           has_row_ended                   = 0;
-   HYPRE_Real          lump_value                      = 0.;
-   HYPRE_Real          diagonal_lump_value             = 0.;
-   HYPRE_Real          neg_lump_value                  = 0.;
-   HYPRE_Real          sum_strong_neigh                = 0.;
-   HYPRE_Int           * rownz                         = NULL;
-
    /* offd and diag portions of RAP */
    hypre_CSRMatrix     *RAP_diag             = hypre_ParCSRMatrixDiag(RAP);
    HYPRE_Int           *RAP_diag_i           = hypre_CSRMatrixI(RAP_diag);
@@ -1322,7 +740,6 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
    HYPRE_BigInt        *col_map_offd_S       = NULL;
 
    HYPRE_Int            num_cols_offd_S;
-   /* HYPRE_Int         num_nonzeros_S_diag; */
 
    /* off processor portions of S */
    hypre_CSRMatrix    *S_ext                 = NULL;
@@ -1338,41 +755,77 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
    HYPRE_Real         *S_ext_offd_data       = NULL;
    HYPRE_Int          *S_ext_offd_j          = NULL;
    HYPRE_BigInt       *col_map_offd_Sext     = NULL;
-   /* HYPRE_Int            num_nonzeros_S_ext_diag;
-      HYPRE_Int            num_nonzeros_S_ext_offd;
-      HYPRE_Int            num_rows_Sext         = 0; */
-   HYPRE_Int           row_indx_Sext         = 0;
-
 
    /* offd and diag portions of Pattern */
    hypre_ParCSRMatrix  *Pattern              = NULL;
    hypre_CSRMatrix     *Pattern_diag         = NULL;
    HYPRE_Int           *Pattern_diag_i       = NULL;
-   HYPRE_Real          *Pattern_diag_data    = NULL;
    HYPRE_Int           *Pattern_diag_j       = NULL;
 
    hypre_CSRMatrix     *Pattern_offd         = NULL;
    HYPRE_Int           *Pattern_offd_i       = NULL;
-   HYPRE_Real          *Pattern_offd_data    = NULL;
    HYPRE_Int           *Pattern_offd_j       = NULL;
    HYPRE_BigInt        *col_map_offd_Pattern = NULL;
 
    HYPRE_Int            num_cols_Pattern_offd;
    HYPRE_Int            my_id;
 
-   /* Buffered IJAddToValues */
-   HYPRE_Int           ijbuf_cnt, ijbuf_size, ijbuf_rowcounter;
-   HYPRE_Real          *ijbuf_data;
-   HYPRE_BigInt        *ijbuf_cols, *ijbuf_rownums;
-   HYPRE_Int           *ijbuf_numcols;
-
-   /* Buffered IJAddToValues for Symmetric Entries */
-   HYPRE_Int           ijbuf_sym_cnt, ijbuf_sym_rowcounter;
-   HYPRE_Real          *ijbuf_sym_data;
-   HYPRE_BigInt        *ijbuf_sym_cols, *ijbuf_sym_rownums;
-   HYPRE_Int           *ijbuf_sym_numcols;
+   /* Off-processor lumping plan: offd columns of RAP, S and S_ext mapped
+    * into Pattern's offd numbering (-1 if absent), and Pattern and RAP offd
+    * columns mapped into the offd numbering of the new operator */
+   HYPRE_Int            num_cols_offd_C      = 0;
+   HYPRE_BigInt        *col_map_offd_C       = NULL;
+   HYPRE_Int           *Pattern_to_C         = NULL;
+   HYPRE_Int           *RAP_to_C             = NULL;
+   HYPRE_Int           *RAP_to_Pattern       = NULL;
+   HYPRE_Int           *S_to_Pattern         = NULL;
+   HYPRE_Int           *Sext_to_Pattern      = NULL;
+
+   /* Row workspace, with an upper bound on the length of each row */
+   HYPRE_Int           *work_diag_i          = NULL;
+   HYPRE_Int           *work_diag_end        = NULL;
+   HYPRE_Int           *work_diag_j          = NULL;
+   HYPRE_Real          *work_diag_own        = NULL;
+   HYPRE_Real          *work_diag_mirror     = NULL;
+   HYPRE_Real          *work_diag_lump       = NULL;
+   HYPRE_Int           *work_offd_i          = NULL;
+   HYPRE_Int           *work_offd_end        = NULL;
+   HYPRE_Int           *work_offd_j          = NULL;
+   HYPRE_Real          *work_offd_own        = NULL;
+   HYPRE_Real          *work_offd_mirror     = NULL;
+   HYPRE_Real          *work_offd_lump       = NULL;
+
+   /* Mirror diagonal updates, for local and offd columns */
+   HYPRE_Real          *dvec                 = NULL;
+   HYPRE_Real          *dvec_offd            = NULL;
+
+   /* The new operator, and the mirror entries to be transposed into it */
+   hypre_ParCSRMatrix  *C                    = NULL;
+   hypre_ParCSRMatrix  *Mirror               = NULL;
+   hypre_ParCSRMatrix  *MirrorT              = NULL;
+   hypre_CSRMatrix     *C_diag, *C_offd, *Mirror_diag, *Mirror_offd;
+   HYPRE_Int           *C_diag_i, *C_diag_j, *C_offd_i, *C_offd_j;
+   HYPRE_Real          *C_diag_data, *C_offd_data;
+   HYPRE_Int           *Mirror_diag_i        = NULL;
+   HYPRE_Int           *Mirror_diag_j        = NULL;
+   HYPRE_Int           *Mirror_offd_i        = NULL;
+   HYPRE_Int           *Mirror_offd_j        = NULL;
+   HYPRE_Real          *Mirror_diag_data     = NULL;
+   HYPRE_Real          *Mirror_offd_data     = NULL;
+   HYPRE_Int           *offd_C_map           = NULL;
+   HYPRE_BigInt        *col_map_offd_new     = NULL;
+   HYPRE_Int            num_cols_offd_new;
+   HYPRE_Int            nnz_diag, nnz_offd, mnz_diag, mnz_offd;
+
+   hypre_ParCSRCommPkg    *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Real             *dvec_offd_new    = NULL;
+   HYPRE_Real             *dvec_buf         = NULL;
+   HYPRE_Int               num_sends;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   HYPRE_UNUSED_VAR(num_functions);
+   HYPRE_UNUSED_VAR(dof_func_value);
 
    /* Further Initializations */
    if (num_cols_RAP_offd)
@@ -1385,7 +838,6 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
                                                                  sym_collapse, collapse_beta);
    Pattern_diag               = hypre_ParCSRMatrixDiag(Pattern);
    Pattern_diag_i             = hypre_CSRMatrixI(Pattern_diag);
-   Pattern_diag_data          = hypre_CSRMatrixData(Pattern_diag);
    Pattern_diag_j             = hypre_CSRMatrixJ(Pattern_diag);
 
    Pattern_offd               = hypre_ParCSRMatrixOffd(Pattern);
@@ -1394,69 +846,14 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
    col_map_offd_Pattern       = hypre_ParCSRMatrixColMapOffd(Pattern);
 
    num_cols_Pattern_offd      = hypre_CSRMatrixNumCols(Pattern_offd);
-   if (num_cols_Pattern_offd)
-   {   Pattern_offd_data = hypre_CSRMatrixData(Pattern_offd); }
-
-   /**
-    * Fill in the entries of Pattern with entries from RAP
-    **/
 
-   /* First, sort column indices in RAP and Pattern */
-   for (i = 0; i < num_variables; i++)
-   {
-      /* The diag matrices store the diagonal as first element in each row.
-       * We maintain that for the case of Pattern and RAP, because the
-       * strength of connection routine relies on it and we need to ignore
-       * diagonal entries in Pattern later during set intersections.
-       * */
-
-      /* Sort diag portion of RAP */
-      row_start = RAP_diag_i[i];
-      if ( RAP_diag_j[row_start] == i)
-      {   row_start = row_start + 1; }
-      row_end = RAP_diag_i[i + 1];
-      hypre_qsort1(RAP_diag_j, RAP_diag_data, row_start, row_end - 1 );
-
-      /* Sort diag portion of Pattern */
-      row_start = Pattern_diag_i[i];
-
-      if ( Pattern_diag_j[row_start] == i)
-      {   row_start = row_start + 1; }
-      row_end = Pattern_diag_i[i + 1];
-      hypre_qsort1(Pattern_diag_j, Pattern_diag_data, row_start, row_end - 1 );
-
-      /* Sort offd portion of RAP */
-      row_start = RAP_offd_i[i];
-      row_end = RAP_offd_i[i + 1];
-      hypre_qsort1(RAP_offd_j, RAP_offd_data, row_start, row_end - 1 );
-
-      /* Sort offd portion of Pattern */
-      /* Be careful to map coarse dof i with CF_marker into Pattern */
-      row_start = Pattern_offd_i[i];
-      row_end = Pattern_offd_i[i + 1];
-      hypre_qsort1(Pattern_offd_j, Pattern_offd_data, row_start, row_end - 1 );
-
-   }
+   /* Create Strength matrix based on RAP.  Passing in "1, NULL" because
+    * dof_array is not needed because we assume that the number of functions
+    * is 1.  Like RAP, each row of S keeps the order of the row it came
+    * from; nothing below depends on sorted rows. */
+   hypre_BoomerAMG_MyCreateS(RAP, strong_threshold, max_row_sum,
+                             1, NULL, &S);
 
-
-   /* Create Strength matrix based on RAP or Pattern.  If Pattern is used,
-    * then the SortedCopyParCSRData(...) function call must also be commented
-    * back in */
-   /* hypre_SortedCopyParCSRData(RAP, Pattern); */
-   if (0)
-   {
-      /* hypre_BoomerAMG_MyCreateS(Pattern, strong_threshold, max_row_sum, */
-      hypre_BoomerAMG_MyCreateS(RAP, strong_threshold, max_row_sum,
-                                num_functions, dof_func_value, &S);
-   }
-   else
-   {
-      /* Passing in "1, NULL" because dof_array is not needed
-       * because we assume that  the number of functions is 1 */
-      /* hypre_BoomerAMG_MyCreateS(Pattern, strong_threshold, max_row_sum,*/
-      hypre_BoomerAMG_MyCreateS(RAP, strong_threshold, max_row_sum,
-                                1, NULL, &S);
-   }
    /* Grab diag and offd parts of S */
    S_diag               = hypre_ParCSRMatrixDiag(S);
    S_diag_i             = hypre_CSRMatrixI(S_diag);
@@ -1470,10 +867,6 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
    col_map_offd_S       = hypre_ParCSRMatrixColMapOffd(S);
 
    num_cols_offd_S      = hypre_CSRMatrixNumCols(S_offd);
-   /* num_nonzeros_S_diag  = S_diag_i[num_variables]; */
-
-
-
 
    /* Grab part of S that is distance one away from the local rows
     * This is needed later for the stencil collapsing.  This section
@@ -1648,667 +1041,525 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
       S_ext = NULL;
    }
 
-   /* Need to sort column indices in S and S_ext */
-   for (i = 0; i < num_variables; i++)
-   {
-      /* Re-Sort diag portion of Pattern, placing the diagonal entry in a
-       * sorted position */
-      row_start = Pattern_diag_i[i];
-      row_end = Pattern_diag_i[i + 1];
-      hypre_qsort1(Pattern_diag_j, Pattern_diag_data, row_start, row_end - 1 );
-
-      /* Sort diag portion of S, noting that no diagonal entry */
-      /* S has not "data" array...it's just NULL */
-      row_start = S_diag_i[i];
-      row_end = S_diag_i[i + 1];
-      hypre_qsort1(S_diag_j, S_diag_data, row_start, row_end - 1 );
-
-      /* Sort offd portion of S */
-      /* S has no "data" array...it's just NULL */
-      row_start = S_offd_i[i];
-      row_end = S_offd_i[i + 1];
-      hypre_qsort1(S_offd_j, S_offd_data, row_start, row_end - 1 );
-   }
-
-   /* Sort S_ext
-    * num_cols_RAP_offd  equals  num_rows for S_ext*/
-   for (i = 0; i < num_cols_RAP_offd; i++)
-   {
-      /* Sort diag portion of S_ext */
-      row_start = S_ext_diag_i[i];
-      row_end = S_ext_diag_i[i + 1];
-      hypre_qsort1(S_ext_diag_j, S_ext_diag_data, row_start, row_end - 1 );
-
-      /* Sort offd portion of S_ext */
-      row_start = S_ext_offd_i[i];
-      row_end = S_ext_offd_i[i + 1];
-      hypre_qsort1(S_ext_offd_j, S_ext_offd_data, row_start, row_end - 1 );
-
-   }
-
    /*
     * Now, for the fun stuff -- Computing the Non-Galerkin Operator
     */
 
-   /* Initialize the ijmatrix, leveraging our knowledge of the nonzero
-    * structure in Pattern */
-   HYPRE_IJMatrixCreate(comm, first_col_diag_RAP, last_col_diag_RAP,
-                        first_col_diag_RAP, last_col_diag_RAP, &ijmatrix);
-   HYPRE_IJMatrixSetObjectType(ijmatrix, HYPRE_PARCSR);
-   rownz = hypre_CTAlloc(HYPRE_Int,  num_variables, HYPRE_MEMORY_HOST);
-   for (i = 0; i < num_variables; i++)
+   /* Build the off-processor lumping plan */
+   col_map_offd_C  = hypre_TAlloc(HYPRE_BigInt, num_cols_Pattern_offd + num_cols_RAP_offd,
+                                  HYPRE_MEMORY_HOST);
+   Pattern_to_C    = hypre_TAlloc(HYPRE_Int, num_cols_Pattern_offd, HYPRE_MEMORY_HOST);
+   RAP_to_C        = hypre_TAlloc(HYPRE_Int, num_cols_RAP_offd, HYPRE_MEMORY_HOST);
+   RAP_to_Pattern  = hypre_TAlloc(HYPRE_Int, num_cols_RAP_offd, HYPRE_MEMORY_HOST);
+   S_to_Pattern    = hypre_TAlloc(HYPRE_Int, num_cols_offd_S, HYPRE_MEMORY_HOST);
+   Sext_to_Pattern = hypre_TAlloc(HYPRE_Int, num_cols_offd_Sext, HYPRE_MEMORY_HOST);
+
+   hypre_union2(num_cols_Pattern_offd, col_map_offd_Pattern,
+                num_cols_RAP_offd, col_map_offd_RAP,
+                &num_cols_offd_C, col_map_offd_C, Pattern_to_C, RAP_to_C);
+
+   for (i = 0; i < num_cols_RAP_offd; i++)
    {
-      rownz[i] = (HYPRE_Int)(1.2 * (Pattern_diag_i[i + 1] - Pattern_diag_i[i]) +
-                             1.2 * (Pattern_offd_i[i + 1] - Pattern_offd_i[i]));
+      RAP_to_Pattern[i] = hypre_BigBinarySearch(col_map_offd_Pattern, col_map_offd_RAP[i],
+                                                num_cols_Pattern_offd);
+   }
+   for (i = 0; i < num_cols_offd_S; i++)
+   {
+      S_to_Pattern[i] = hypre_BigBinarySearch(col_map_offd_Pattern, col_map_offd_S[i],
+                                              num_cols_Pattern_offd);
+   }
+   for (i = 0; i < num_cols_offd_Sext; i++)
+   {
+      Sext_to_Pattern[i] = hypre_BigBinarySearch(col_map_offd_Pattern, col_map_offd_Sext[i],
+                                                 num_cols_Pattern_offd);
    }
-   HYPRE_IJMatrixSetRowSizes(ijmatrix, rownz);
-   HYPRE_IJMatrixInitialize(ijmatrix);
-   hypre_TFree(rownz, HYPRE_MEMORY_HOST);
 
-   /*
-    *For efficiency, we do a buffered IJAddToValues.
-    * Here, we initialize the buffer and then initialize the buffer counters
-    */
-   ijbuf_size       = 1000;
-   ijbuf_data       = hypre_CTAlloc(HYPRE_Real,   ijbuf_size, memory_location_RAP);
-   ijbuf_cols       = hypre_CTAlloc(HYPRE_BigInt, ijbuf_size, memory_location_RAP);
-   ijbuf_rownums    = hypre_CTAlloc(HYPRE_BigInt, ijbuf_size, memory_location_RAP);
-   ijbuf_numcols    = hypre_CTAlloc(HYPRE_Int,    ijbuf_size, memory_location_RAP);
-   hypre_NonGalerkinIJBigBufferInit( &ijbuf_cnt, &ijbuf_rowcounter, ijbuf_cols );
-   if (sym_collapse)
+   /* Every entry of row i lies in {i}, Pattern row i or RAP row i, which
+    * bounds the number of slots each row needs */
+   work_diag_i   = hypre_TAlloc(HYPRE_Int, num_variables + 1, HYPRE_MEMORY_HOST);
+   work_diag_end = hypre_TAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+   work_offd_i   = hypre_TAlloc(HYPRE_Int, num_variables + 1, HYPRE_MEMORY_HOST);
+   work_offd_end = hypre_TAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+   work_diag_i[0] = 0;
+   work_offd_i[0] = 0;
+   for (i = 0; i < num_variables; i++)
    {
-      ijbuf_sym_data   = hypre_CTAlloc(HYPRE_Real,   ijbuf_size, memory_location_RAP);
-      ijbuf_sym_cols   = hypre_CTAlloc(HYPRE_BigInt, ijbuf_size, memory_location_RAP);
-      ijbuf_sym_rownums = hypre_CTAlloc(HYPRE_BigInt, ijbuf_size, memory_location_RAP);
-      ijbuf_sym_numcols = hypre_CTAlloc(HYPRE_Int,    ijbuf_size, memory_location_RAP);
-      hypre_NonGalerkinIJBigBufferInit( &ijbuf_sym_cnt, &ijbuf_sym_rowcounter, ijbuf_sym_cols );
+      work_diag_i[i + 1] = work_diag_i[i] + 1 +
+                           (Pattern_diag_i[i + 1] - Pattern_diag_i[i]) +
+                           (RAP_diag_i[i + 1] - RAP_diag_i[i]);
+      work_offd_i[i + 1] = work_offd_i[i] +
+                           (Pattern_offd_i[i + 1] - Pattern_offd_i[i]) +
+                           (RAP_offd_i[i + 1] - RAP_offd_i[i]);
    }
+   work_diag_j      = hypre_TAlloc(HYPRE_Int,  work_diag_i[num_variables], HYPRE_MEMORY_HOST);
+   work_diag_own    = hypre_TAlloc(HYPRE_Real, work_diag_i[num_variables], HYPRE_MEMORY_HOST);
+   work_diag_mirror = hypre_TAlloc(HYPRE_Real, work_diag_i[num_variables], HYPRE_MEMORY_HOST);
+   work_diag_lump   = hypre_TAlloc(HYPRE_Real, work_diag_i[num_variables], HYPRE_MEMORY_HOST);
+   work_offd_j      = hypre_TAlloc(HYPRE_Int,  work_offd_i[num_variables], HYPRE_MEMORY_HOST);
+   work_offd_own    = hypre_TAlloc(HYPRE_Real, work_offd_i[num_variables], HYPRE_MEMORY_HOST);
+   work_offd_mirror = hypre_TAlloc(HYPRE_Real, work_offd_i[num_variables], HYPRE_MEMORY_HOST);
+   work_offd_lump   = hypre_TAlloc(HYPRE_Real, work_offd_i[num_variables], HYPRE_MEMORY_HOST);
 
    /*
-    * Eliminate Entries In RAP_diag
+    * Eliminate entries of RAP, one row at a time.  The diagonal always goes
+    * first in the row.  For each nonzero (i, c) of RAP that is not in the
+    * Pattern, the targets t are the strong connections of row c that are in
+    * Pattern row i.  The diagonal of Pattern row i is not a target when it
+    * is the smallest column of the row.
     * */
-   for (i = 0; i < num_variables; i++)
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, j, k)
+#endif
    {
-      global_row = (HYPRE_BigInt) i + first_col_diag_RAP;
-      row_start = RAP_diag_i[i];
-      row_end = RAP_diag_i[i + 1];
-      has_row_ended = 0;
+      HYPRE_Int  *pattern_diag_marker = hypre_TAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+      HYPRE_Int  *pattern_offd_marker = hypre_TAlloc(HYPRE_Int, num_cols_Pattern_offd,
+                                                     HYPRE_MEMORY_HOST);
+      HYPRE_Int  *pos_diag = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+      HYPRE_Int  *pos_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd_C, HYPRE_MEMORY_HOST);
+      HYPRE_Int   diag_start, diag_end, offd_start, offd_end;
+      HYPRE_Int   diag_len, row_len, skip_diag, is_offd, col, t;
+      HYPRE_Int   Sd_start, Sd_end, So_start, So_end, intersection_len;
+      HYPRE_Int  *Sd_j, *So_j, *So_to_Pattern;
+      HYPRE_Real *Sd_data, *So_data;
+      HYPRE_Real  rap_value, sum_strong_neigh, lump_value, diagonal_lump_value;
 
-      /* Only do work if row has nonzeros */
-      if ( row_start < row_end)
+      for (i = 0; i < num_variables; i++)
       {
-         /* Grab pointer to current entry in Pattern_diag */
-         current_Pattern_j = Pattern_diag_i[i];
-         col_indx_Pattern = Pattern_diag_j[current_Pattern_j];
-
-         /* Grab this row's indices out of Pattern offd and diag.  This will
-          * be for computing index set intersections for lumping */
-         /* Ensure adequate length */
-         Pattern_offd_indices_len = Pattern_offd_i[i + 1] - Pattern_offd_i[i];
-         if (Pattern_offd_indices_allocated_len < Pattern_offd_indices_len)
+         pattern_diag_marker[i] = -1;
+      }
+      for (i = 0; i < num_cols_Pattern_offd; i++)
+      {
+         pattern_offd_marker[i] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_variables; i++)
+      {
+         diag_start = work_diag_i[i];
+         diag_end   = diag_start;
+         offd_start = work_offd_i[i];
+         offd_end   = offd_start;
+         hypre_NonGalerkinRowAdd(i, 0.0, 0.0, 0.0, diag_start, &diag_end, pos_diag, work_diag_j,
+                                 work_diag_own, work_diag_mirror, work_diag_lump);
+
+         /* Mark Pattern row i */
+         skip_diag = 0;
+         for (j = Pattern_diag_i[i]; j < Pattern_diag_i[i + 1]; j++)
          {
-            hypre_TFree(Pattern_offd_indices, HYPRE_MEMORY_HOST);
-            Pattern_offd_indices = hypre_CTAlloc(HYPRE_BigInt,  Pattern_offd_indices_len, HYPRE_MEMORY_HOST);
-            Pattern_offd_indices_allocated_len = Pattern_offd_indices_len;
+            pattern_diag_marker[Pattern_diag_j[j]] = i;
+            if (Pattern_diag_j[j] == i)
+            {
+               skip_diag = 1;
+            }
          }
-         /* Grab sub array from col_map, corresponding to the slice of Pattern_offd_j */
-         hypre_GrabSubArray(Pattern_offd_j,
-                            Pattern_offd_i[i], Pattern_offd_i[i + 1] - 1,
-                            col_map_offd_Pattern, Pattern_offd_indices);
-         /* No need to grab info out of Pattern_diag_j[...], here we just start from
-          * Pattern_diag_i[i] and end at index Pattern_diag_i[i+1] - 1.  We do need to
-          * ignore the diagonal entry in Pattern, because we don't lump entries there */
-         if ( Pattern_diag_j[Pattern_diag_i[i]] == i )
+         for (j = Pattern_diag_i[i]; j < Pattern_diag_i[i + 1]; j++)
          {
-            Pattern_indices_ptr = &( Pattern_diag_j[Pattern_diag_i[i] + 1]);
-            Pattern_diag_indices_len = Pattern_diag_i[i + 1] - Pattern_diag_i[i] - 1;
+            if (Pattern_diag_j[j] < i)
+            {
+               skip_diag = 0;
+            }
          }
-         else
+         for (j = Pattern_offd_i[i]; j < Pattern_offd_i[i + 1]; j++)
          {
-            Pattern_indices_ptr = &( Pattern_diag_j[Pattern_diag_i[i]]);
-            Pattern_diag_indices_len = Pattern_diag_i[i + 1] - Pattern_diag_i[i];
+            pattern_offd_marker[Pattern_offd_j[j]] = i;
          }
-      }
 
-      for (j = row_start; j < row_end; j++)
-      {
-         col_indx_RAP = RAP_diag_j[j];
-
-         /* Ignore zero entries in RAP */
-         if ( RAP_diag_data[j] != 0.0)
+         /* Loop over the diag and then the offd entries of RAP row i */
+         diag_len = RAP_diag_i[i + 1] - RAP_diag_i[i];
+         row_len  = diag_len + RAP_offd_i[i + 1] - RAP_offd_i[i];
+         for (j = 0; j < row_len; j++)
          {
-            /* Don't change the diagonal, just write it */
-            if (col_indx_RAP == i)
+            if (j < diag_len)
             {
-               /*#ifdef HY   PRE_USING_OPENMP
-               #pragma omp    critical (IJAdd)
-               #endif
-               {*/
-               /* For efficiency, we do a buffered IJAddToValues.
-                * A[global_row, global_row] += RAP_diag_data[j] */
-               hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                               &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row,
-                                               global_row, RAP_diag_data[j] );
-               /*}*/
+               is_offd   = 0;
+               col       = RAP_diag_j[RAP_diag_i[i] + j];
+               rap_value = RAP_diag_data[RAP_diag_i[i] + j];
+
+               /* Ignore zero entries in RAP */
+               if (rap_value == 0.0)
+               {
+                  continue;
+               }
+
+               /* Keep the diagonal and the entries that appear in Pattern */
+               if (col == i || pattern_diag_marker[col] == i)
+               {
+                  hypre_NonGalerkinRowAdd(col, rap_value, 0.0, 0.0, diag_start, &diag_end, pos_diag,
+                                          work_diag_j, work_diag_own, work_diag_mirror,
+                                          work_diag_lump);
+                  continue;
+               }
 
+               /* Lump with the strong connections of local row col */
+               Sd_j          = S_diag_j;
+               Sd_data       = S_diag_data;
+               Sd_start      = S_diag_i[col];
+               Sd_end        = S_diag_i[col + 1];
+               So_j          = S_offd_j;
+               So_data       = S_offd_data;
+               So_start      = S_offd_i[col];
+               So_end        = S_offd_i[col + 1];
+               So_to_Pattern = S_to_Pattern;
             }
-            /* The entry in RAP does not appear in Pattern, so LUMP it */
-            else if ( (col_indx_RAP < col_indx_Pattern) || has_row_ended)
+            else
             {
-               /* Lump entry (i, col_indx_RAP) in RAP */
+               is_offd   = 1;
+               k         = RAP_offd_i[i] + j - diag_len;
+               rap_value = RAP_offd_data[k];
 
-               /* Grab the indices for row col_indx_RAP of S_offd and diag.  This will
-                * be for computing lumping locations */
-               S_offd_indices_len = S_offd_i[col_indx_RAP + 1] - S_offd_i[col_indx_RAP];
-               if (S_offd_indices_allocated_len < S_offd_indices_len)
+               if (rap_value == 0.0)
                {
-                  hypre_TFree(S_offd_indices, HYPRE_MEMORY_HOST);
-                  S_offd_indices = hypre_CTAlloc(HYPRE_BigInt,  S_offd_indices_len, HYPRE_MEMORY_HOST);
-                  S_offd_indices_allocated_len = S_offd_indices_len;
+                  continue;
                }
-               /* Grab sub array from col_map, corresponding to the slice of S_offd_j */
-               hypre_GrabSubArray(S_offd_j, S_offd_i[col_indx_RAP], S_offd_i[col_indx_RAP + 1] - 1,
-                                  col_map_offd_S, S_offd_indices);
-               /* No need to grab info out of S_diag_j[...], here we just start from
-                * S_diag_i[col_indx_RAP] and end at index S_diag_i[col_indx_RAP+1] - 1 */
-
-               /* Intersect the diag and offd pieces, remembering that the
-                * diag array will need to have the offset +first_col_diag_RAP */
-               cnt = hypre_max(S_offd_indices_len, Pattern_offd_indices_len);
-               if (offd_intersection_allocated_len < cnt)
+
+               t   = RAP_to_Pattern[RAP_offd_j[k]];
+               col = RAP_to_C[RAP_offd_j[k]];
+               if (t > -1 && pattern_offd_marker[t] == i)
                {
-                  hypre_TFree(offd_intersection, HYPRE_MEMORY_HOST);
-                  hypre_TFree(offd_intersection_data, HYPRE_MEMORY_HOST);
-                  offd_intersection = hypre_CTAlloc(HYPRE_BigInt,  cnt, HYPRE_MEMORY_HOST);
-                  offd_intersection_data = hypre_CTAlloc(HYPRE_Real,  cnt, HYPRE_MEMORY_HOST);
-                  offd_intersection_allocated_len = cnt;
+                  hypre_NonGalerkinRowAdd(col, rap_value, 0.0, 0.0, offd_start, &offd_end, pos_offd,
+                                          work_offd_j, work_offd_own, work_offd_mirror,
+                                          work_offd_lump);
+                  continue;
                }
-               /* This intersection also tracks S_offd_data and assumes that
-                * S_offd_indices is the first argument here */
-               hypre_IntersectTwoBigArrays(S_offd_indices,
-                                           &(S_offd_data[ S_offd_i[col_indx_RAP] ]),
-                                           S_offd_indices_len,
-                                           Pattern_offd_indices,
-                                           Pattern_offd_indices_len,
-                                           offd_intersection,
-                                           offd_intersection_data,
-                                           &offd_intersection_len);
-
-
-               /* Now, intersect the indices for the diag block.  Note that S_diag_j does
-                * not have a diagonal entry, so no lumping occurs to the diagonal. */
-               cnt = hypre_max(Pattern_diag_indices_len,
-                               S_diag_i[col_indx_RAP + 1] - S_diag_i[col_indx_RAP] );
-               if (diag_intersection_allocated_len < cnt)
+
+               /* Lump with the strong connections of off-processor row
+                * RAP_offd_j[k], as found in S_ext */
+               Sd_j          = S_ext_diag_j;
+               Sd_data       = S_ext_diag_data;
+               Sd_start      = S_ext_diag_i[RAP_offd_j[k]];
+               Sd_end        = S_ext_diag_i[RAP_offd_j[k] + 1];
+               So_j          = S_ext_offd_j;
+               So_data       = S_ext_offd_data;
+               So_start      = S_ext_offd_i[RAP_offd_j[k]];
+               So_end        = S_ext_offd_i[RAP_offd_j[k] + 1];
+               So_to_Pattern = Sext_to_Pattern;
+            }
+
+            /* Sum the strength-of-connection values of the lumping targets.
+             * This will give us our collapsing weights. */
+            intersection_len = 0;
+            sum_strong_neigh = 0.0;
+            for (k = Sd_start; k < Sd_end; k++)
+            {
+               t = Sd_j[k];
+               if (pattern_diag_marker[t] == i && !(t == i && skip_diag))
                {
-                  hypre_TFree(diag_intersection, HYPRE_MEMORY_HOST);
-                  hypre_TFree(diag_intersection_data, HYPRE_MEMORY_HOST);
-                  diag_intersection = hypre_CTAlloc(HYPRE_Int,  cnt, HYPRE_MEMORY_HOST);
-                  diag_intersection_data = hypre_CTAlloc(HYPRE_Real,  cnt, HYPRE_MEMORY_HOST);
-                  diag_intersection_allocated_len = cnt;
+                  sum_strong_neigh += hypre_abs(Sd_data[k]);
+                  intersection_len++;
                }
-               /* There is no diagonal entry in first position of S */
-               hypre_IntersectTwoArrays( &(S_diag_j[S_diag_i[col_indx_RAP]]),
-                                         &(S_diag_data[ S_diag_i[col_indx_RAP] ]),
-                                         S_diag_i[col_indx_RAP + 1] - S_diag_i[col_indx_RAP],
-                                         Pattern_indices_ptr,
-                                         Pattern_diag_indices_len,
-                                         diag_intersection,
-                                         diag_intersection_data,
-                                         &diag_intersection_len);
-
-               /* Loop over these intersections, and lump a constant fraction of
-                * RAP_diag_data[j] to each entry */
-               intersection_len = diag_intersection_len + offd_intersection_len;
-               if (intersection_len > 0)
+            }
+            for (k = So_start; k < So_end; k++)
+            {
+               t = So_to_Pattern[So_j[k]];
+               if (t > -1 && pattern_offd_marker[t] == i)
                {
-                  /* Sum the strength-of-connection values from row
-                   * col_indx_RAP in S, corresponding to the indices we are
-                   * collapsing to in row i This will give us our collapsing
-                   * weights. */
-                  sum_strong_neigh = 0.0;
-                  for (k = 0; k < diag_intersection_len; k++)
-                  {   sum_strong_neigh += hypre_abs(diag_intersection_data[k]); }
-                  for (k = 0; k < offd_intersection_len; k++)
-                  {   sum_strong_neigh += hypre_abs(offd_intersection_data[k]); }
-                  sum_strong_neigh = RAP_diag_data[j] / sum_strong_neigh;
-
-                  /* When lumping with the diag_intersection, must offset column index */
-                  for (k = 0; k < diag_intersection_len; k++)
-                  {
-                     lump_value = lump_percent * hypre_abs(diag_intersection_data[k]) * sum_strong_neigh;
-                     diagonal_lump_value = (1.0 - lump_percent) * hypre_abs(diag_intersection_data[k]) *
-                                           sum_strong_neigh;
-                     neg_lump_value = -1.0 * lump_value;
-                     cnt = diag_intersection[k] + first_col_diag_RAP;
-
-                     /*#ifdef HY   PRE_USING_OPENMP
-                     #pragma omp    critical (IJAdd)
-                     #endif
-                     {*/
-                     /* For efficiency, we do a buffered IJAddToValues.
-                      * A[global_row, cnt] += RAP_diag_data[j] */
-                     hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                     &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row,
-                                                     cnt, lump_value );
-                     if (lump_percent < 1.0)
-                     {
-                        /* Preserve row sum by updating diagonal */
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                        &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row,
-                                                        global_row, diagonal_lump_value );
-                     }
-
-                     /* Update mirror entries, if symmetric collapsing */
-                     if (sym_collapse)
-                     {
-                        /* Update mirror entry */
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                        &ijbuf_sym_cnt, ijbuf_size, &ijbuf_sym_rowcounter,
-                                                        &ijbuf_sym_data, &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                        &ijbuf_sym_numcols, cnt, global_row, lump_value );
-                        /* Update mirror entry diagonal */
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                        &ijbuf_sym_cnt, ijbuf_size, &ijbuf_sym_rowcounter,
-                                                        &ijbuf_sym_data, &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                        &ijbuf_sym_numcols, cnt, cnt, neg_lump_value );
-                     }
-                     /*}*/
-                  }
+                  sum_strong_neigh += hypre_abs(So_data[k]);
+                  intersection_len++;
+               }
+            }
 
-                  /* The offd_intersection has global column indices, i.e., the
-                   * col_map arrays contain global indices */
-                  for (k = 0; k < offd_intersection_len; k++)
-                  {
-                     lump_value = lump_percent * hypre_abs(offd_intersection_data[k]) * sum_strong_neigh;
-                     diagonal_lump_value = (1.0 - lump_percent) * hypre_abs(offd_intersection_data[k]) *
-                                           sum_strong_neigh;
-                     neg_lump_value = -1.0 * lump_value;
-
-                     hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                     &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row,
-                                                     offd_intersection[k], lump_value );
-
-                     if (lump_percent < 1.0)
-                     {
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                        &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row,
-                                                        global_row, diagonal_lump_value );
-                     }
-
-                     /* Update mirror entries, if symmetric collapsing */
-                     if (sym_collapse)
-                     {
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                        &ijbuf_sym_cnt, ijbuf_size, &ijbuf_sym_rowcounter,
-                                                        &ijbuf_sym_data, &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                        &ijbuf_sym_numcols, offd_intersection[k],
-                                                        global_row, lump_value );
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                        &ijbuf_sym_cnt, ijbuf_size, &ijbuf_sym_rowcounter,
-                                                        &ijbuf_sym_data, &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                        &ijbuf_sym_numcols, offd_intersection[k],
-                                                        offd_intersection[k], neg_lump_value );
-                     }
-                  }
+            /* If intersection is empty, do not eliminate entry */
+            if (intersection_len == 0)
+            {
+               /* Don't forget to update mirror entry if collapsing symmetrically */
+               lump_value = sym_collapse ? 0.5 * rap_value : rap_value;
+               if (is_offd)
+               {
+                  hypre_NonGalerkinRowAdd(col, lump_value, sym_collapse ? lump_value : 0.0, 0.0,
+                                          offd_start, &offd_end, pos_offd, work_offd_j,
+                                          work_offd_own, work_offd_mirror, work_offd_lump);
                }
-               /* If intersection is empty, do not eliminate entry */
                else
                {
-                  /* Don't forget to update mirror entry if collapsing symmetrically */
-                  if (sym_collapse)
-                  {   lump_value = 0.5 * RAP_diag_data[j]; }
-                  else
-                  {   lump_value = RAP_diag_data[j]; }
-
-                  cnt = col_indx_RAP + first_col_diag_RAP;
-                  hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                  &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row,
-                                                  cnt, lump_value );
-                  if (sym_collapse)
-                  {
-                     hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                     &ijbuf_sym_cnt, ijbuf_size, &ijbuf_sym_rowcounter,
-                                                     &ijbuf_sym_data, &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                     &ijbuf_sym_numcols, cnt, global_row, lump_value );
-                  }
+                  hypre_NonGalerkinRowAdd(col, lump_value, sym_collapse ? lump_value : 0.0, 0.0,
+                                          diag_start, &diag_end, pos_diag, work_diag_j,
+                                          work_diag_own, work_diag_mirror, work_diag_lump);
                }
+               continue;
             }
-            /* The entry in RAP appears in Pattern, so keep it */
-            else if (col_indx_RAP == col_indx_Pattern)
-            {
-               cnt = col_indx_RAP + first_col_diag_RAP;
-               hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                               &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row,
-                                               cnt, RAP_diag_data[j] );
 
-               /* Only go to the next entry in Pattern, if this is not the end of a row */
-               if ( current_Pattern_j < Pattern_diag_i[i + 1] - 1 )
+            /* Lump a constant fraction of rap_value to each target, updating
+             * the mirror entry (t,i) and its diagonal (t,t) if collapsing
+             * symmetrically */
+            sum_strong_neigh = rap_value / sum_strong_neigh;
+            for (k = Sd_start; k < Sd_end; k++)
+            {
+               t = Sd_j[k];
+               if (pattern_diag_marker[t] == i && !(t == i && skip_diag))
                {
-                  current_Pattern_j += 1;
-                  col_indx_Pattern = Pattern_diag_j[current_Pattern_j];
+                  lump_value = lump_percent * hypre_abs(Sd_data[k]) * sum_strong_neigh;
+                  hypre_NonGalerkinRowAdd(t, lump_value, sym_collapse ? lump_value : 0.0,
+                                          sym_collapse ? lump_value : 0.0,
+                                          diag_start, &diag_end, pos_diag, work_diag_j,
+                                          work_diag_own, work_diag_mirror, work_diag_lump);
+                  if (lump_percent < 1.0)
+                  {
+                     /* Preserve row sum by updating diagonal */
+                     diagonal_lump_value = (1.0 - lump_percent) * hypre_abs(Sd_data[k]) *
+                                           sum_strong_neigh;
+                     hypre_NonGalerkinRowAdd(i, diagonal_lump_value, 0.0, 0.0, diag_start,
+                                             &diag_end, pos_diag, work_diag_j, work_diag_own,
+                                             work_diag_mirror, work_diag_lump);
+                  }
                }
-               else
-               {   has_row_ended = 1;}
             }
-            /* Increment col_indx_Pattern, and repeat this loop iter for current
-             * col_ind_RAP value */
-            else if (col_indx_RAP > col_indx_Pattern)
+            for (k = So_start; k < So_end; k++)
             {
-               for (; current_Pattern_j < Pattern_diag_i[i + 1]; current_Pattern_j++)
+               t = So_to_Pattern[So_j[k]];
+               if (t > -1 && pattern_offd_marker[t] == i)
                {
-                  col_indx_Pattern = Pattern_diag_j[current_Pattern_j];
-                  if (col_indx_RAP <= col_indx_Pattern)
-                  {   break;}
+                  lump_value = lump_percent * hypre_abs(So_data[k]) * sum_strong_neigh;
+                  hypre_NonGalerkinRowAdd(Pattern_to_C[t], lump_value,
+                                          sym_collapse ? lump_value : 0.0,
+                                          sym_collapse ? lump_value : 0.0,
+                                          offd_start, &offd_end, pos_offd, work_offd_j,
+                                          work_offd_own, work_offd_mirror, work_offd_lump);
+                  if (lump_percent < 1.0)
+                  {
+                     diagonal_lump_value = (1.0 - lump_percent) * hypre_abs(So_data[k]) *
+                                           sum_strong_neigh;
+                     hypre_NonGalerkinRowAdd(i, diagonal_lump_value, 0.0, 0.0, diag_start,
+                                             &diag_end, pos_diag, work_diag_j, work_diag_own,
+                                             work_diag_mirror, work_diag_lump);
+                  }
                }
-
-               /* If col_indx_RAP is still greater (i.e., we've reached a row end), then
-                * we need to lump everything else in this row */
-               if (col_indx_RAP > col_indx_Pattern)
-               {   has_row_ended = 1; }
-
-               /* Decrement j, in order to repeat this loop iteration for the current
-                * col_indx_RAP value */
-               j--;
             }
          }
+
+         work_diag_end[i] = diag_end;
+         work_offd_end[i] = offd_end;
       }
 
-   }
+      hypre_TFree(pattern_diag_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern_offd_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(pos_diag, HYPRE_MEMORY_HOST);
+      hypre_TFree(pos_offd, HYPRE_MEMORY_HOST);
+   } /* omp parallel */
 
-   /*
-    * Eliminate Entries In RAP_offd
-    * Structure of this for-loop is very similar to the RAP_diag for-loop
-    * But, not so similar that these loops should be combined into a single fuction.
-    * */
-   if (num_cols_RAP_offd)
+   /* Gather the mirror diagonal updates (t,t) in row order, so that their
+    * sum does not depend on the number of threads */
+   if (sym_collapse)
    {
+      dvec      = hypre_CTAlloc(HYPRE_Real, num_variables, HYPRE_MEMORY_HOST);
+      dvec_offd = hypre_CTAlloc(HYPRE_Real, num_cols_offd_C, HYPRE_MEMORY_HOST);
       for (i = 0; i < num_variables; i++)
       {
-         global_row = i + first_col_diag_RAP;
-         row_start = RAP_offd_i[i];
-         row_end = RAP_offd_i[i + 1];
-         has_row_ended = 0;
-
-         /* Only do work if row has nonzeros */
-         if ( row_start < row_end)
+         for (j = work_diag_i[i]; j < work_diag_end[i]; j++)
          {
-            current_Pattern_j = Pattern_offd_i[i];
-            Pattern_offd_indices_len = Pattern_offd_i[i + 1] - Pattern_offd_i[i];
-            if ( (Pattern_offd_j != NULL) && (Pattern_offd_indices_len > 0) )
-            {   col_indx_Pattern = col_map_offd_Pattern[ Pattern_offd_j[current_Pattern_j] ]; }
-            else
-            {
-               /* if Pattern_offd_j is not allocated or this is a zero length row,
-                then all entries need to be lumped.
-                This is an analagous situation to has_row_ended=1. */
-               col_indx_Pattern = -1;
-               has_row_ended = 1;
-            }
-
-            /* Grab this row's indices out of Pattern offd and diag.  This will
-             * be for computing index set intersections for lumping.  The above
-             * loop over RAP_diag ensures adequate length of Pattern_offd_indices */
-            /* Ensure adequate length */
-            hypre_GrabSubArray(Pattern_offd_j,
-                               Pattern_offd_i[i], Pattern_offd_i[i + 1] - 1,
-                               col_map_offd_Pattern, Pattern_offd_indices);
-            /* No need to grab info out of Pattern_diag_j[...], here we just start from
-             * Pattern_diag_i[i] and end at index Pattern_diag_i[i+1] - 1.  We do need to
-             * ignore the diagonal entry in Pattern, because we don't lump entries there */
-            if ( Pattern_diag_j[Pattern_diag_i[i]] == i )
-            {
-               Pattern_indices_ptr = &( Pattern_diag_j[Pattern_diag_i[i] + 1]);
-               Pattern_diag_indices_len = Pattern_diag_i[i + 1] - Pattern_diag_i[i] - 1;
-            }
-            else
-            {
-               Pattern_indices_ptr = &( Pattern_diag_j[Pattern_diag_i[i]]);
-               Pattern_diag_indices_len = Pattern_diag_i[i + 1] - Pattern_diag_i[i];
-            }
-
+            dvec[work_diag_j[j]] -= work_diag_lump[j];
          }
-
-         for (j = row_start; j < row_end; j++)
+         for (j = work_offd_i[i]; j < work_offd_end[i]; j++)
          {
+            dvec_offd[work_offd_j[j]] -= work_offd_lump[j];
+         }
+      }
+   }
 
-            /* Ignore zero entries in RAP */
-            if ( RAP_offd_data[j] != 0.0)
-            {
-
-               /* In general for all the offd_j arrays, we have to indirectly
-                * index with the col_map_offd array to get a global index */
-               col_indx_RAP = col_map_offd_RAP[ RAP_offd_j[j] ];
+   /* Drop the offd columns of C that were never touched */
+   offd_C_map = hypre_CTAlloc(HYPRE_Int, num_cols_offd_C, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_variables; i++)
+   {
+      for (j = work_offd_i[i]; j < work_offd_end[i]; j++)
+      {
+         offd_C_map[work_offd_j[j]] = 1;
+      }
+   }
+   num_cols_offd_new = 0;
+   for (i = 0; i < num_cols_offd_C; i++)
+   {
+      if (offd_C_map[i])
+      {
+         offd_C_map[i] = num_cols_offd_new++;
+      }
+      else
+      {
+         offd_C_map[i] = -1;
+      }
+   }
+   col_map_offd_new = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_new, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_C; i++)
+   {
+      if (offd_C_map[i] > -1)
+      {
+         col_map_offd_new[offd_C_map[i]] = col_map_offd_C[i];
+      }
+   }
 
-               /* The entry in RAP does not appear in Pattern, so LUMP it */
-               if ( (col_indx_RAP < col_indx_Pattern) || has_row_ended)
-               {
-                  /* The row_indx_Sext would be found with:
-                   row_indx_Sext     = hypre_BinarySearch(col_map_offd_RAP, col_indx_RAP, num_cols_RAP_offd);
-                   But, we already know the answer to this with, */
-                  row_indx_Sext        = RAP_offd_j[j];
-
-                  /* Grab the indices for row row_indx_Sext from the offd and diag parts.  This will
-                   * be for computing lumping locations */
-                  S_offd_indices_len = S_ext_offd_i[row_indx_Sext + 1] - S_ext_offd_i[row_indx_Sext];
-                  if (S_offd_indices_allocated_len < S_offd_indices_len)
-                  {
-                     hypre_TFree(S_offd_indices, HYPRE_MEMORY_HOST);
-                     S_offd_indices = hypre_CTAlloc(HYPRE_BigInt,  S_offd_indices_len, HYPRE_MEMORY_HOST);
-                     S_offd_indices_allocated_len = S_offd_indices_len;
-                  }
-                  /* Grab sub array from col_map, corresponding to the slice of S_ext_offd_j */
-                  hypre_GrabSubArray(S_ext_offd_j, S_ext_offd_i[row_indx_Sext], S_ext_offd_i[row_indx_Sext + 1] - 1,
-                                     col_map_offd_Sext, S_offd_indices);
-                  /* No need to grab info out of S_ext_diag_j[...], here we just start from
-                   * S_ext_diag_i[row_indx_Sext] and end at index S_ext_diag_i[row_indx_Sext+1] - 1 */
-
-                  /* Intersect the diag and offd pieces, remembering that the
-                   * diag array will need to have the offset +first_col_diag_RAP */
-                  cnt = hypre_max(S_offd_indices_len, Pattern_offd_indices_len);
-                  if (offd_intersection_allocated_len < cnt)
-                  {
-                     hypre_TFree(offd_intersection, HYPRE_MEMORY_HOST);
-                     hypre_TFree(offd_intersection_data, HYPRE_MEMORY_HOST);
-                     offd_intersection = hypre_CTAlloc(HYPRE_BigInt,  cnt, HYPRE_MEMORY_HOST);
-                     offd_intersection_data = hypre_CTAlloc(HYPRE_Real,  cnt, HYPRE_MEMORY_HOST);
-                     offd_intersection_allocated_len = cnt;
-                  }
-                  hypre_IntersectTwoBigArrays(S_offd_indices,
-                                              &(S_ext_offd_data[ S_ext_offd_i[row_indx_Sext] ]),
-                                              S_offd_indices_len,
-                                              Pattern_offd_indices,
-                                              Pattern_offd_indices_len,
-                                              offd_intersection,
-                                              offd_intersection_data,
-                                              &offd_intersection_len);
-
-                  /* Now, intersect the indices for the diag block. */
-                  cnt = hypre_max(Pattern_diag_indices_len,
-                                  S_ext_diag_i[row_indx_Sext + 1] - S_ext_diag_i[row_indx_Sext] );
-                  if (diag_intersection_allocated_len < cnt)
-                  {
-                     hypre_TFree(diag_intersection, HYPRE_MEMORY_HOST);
-                     hypre_TFree(diag_intersection_data, HYPRE_MEMORY_HOST);
-                     diag_intersection = hypre_CTAlloc(HYPRE_Int,  cnt, HYPRE_MEMORY_HOST);
-                     diag_intersection_data = hypre_CTAlloc(HYPRE_Real,  cnt, HYPRE_MEMORY_HOST);
-                     diag_intersection_allocated_len = cnt;
-                  }
-                  hypre_IntersectTwoArrays( &(S_ext_diag_j[S_ext_diag_i[row_indx_Sext]]),
-                                            &(S_ext_diag_data[ S_ext_diag_i[row_indx_Sext] ]),
-                                            S_ext_diag_i[row_indx_Sext + 1] - S_ext_diag_i[row_indx_Sext],
-                                            Pattern_indices_ptr,
-                                            Pattern_diag_indices_len,
-                                            diag_intersection,
-                                            diag_intersection_data,
-                                            &diag_intersection_len);
-
-                  /* Loop over these intersections, and lump a constant fraction of
-                   * RAP_offd_data[j] to each entry */
-                  intersection_len = diag_intersection_len + offd_intersection_len;
-                  if (intersection_len > 0)
-                  {
-                     /* Sum the strength-of-connection values from row
-                      * row_indx_Sext in S, corresponding to the indices we are
-                      * collapsing to in row i. This will give us our collapsing
-                      * weights. */
-                     sum_strong_neigh = 0.0;
-                     for (k = 0; k < diag_intersection_len; k++)
-                     {   sum_strong_neigh += hypre_abs(diag_intersection_data[k]); }
-                     for (k = 0; k < offd_intersection_len; k++)
-                     {   sum_strong_neigh += hypre_abs(offd_intersection_data[k]); }
-                     sum_strong_neigh = RAP_offd_data[j] / sum_strong_neigh;
-
-                     /* When lumping with the diag_intersection, must offset column index */
-                     for (k = 0; k < diag_intersection_len; k++)
-                     {
-                        lump_value = lump_percent * hypre_abs(diag_intersection_data[k]) * sum_strong_neigh;
-                        diagonal_lump_value = (1.0 - lump_percent) * hypre_abs(diag_intersection_data[k]) *
-                                              sum_strong_neigh;
-                        neg_lump_value = -1.0 * lump_value;
-                        cnt = diag_intersection[k] + first_col_diag_RAP;
-
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                        &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row, cnt, lump_value );
-                        if (lump_percent < 1.0)
-                        {
-                           hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                           &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row, global_row,
-                                                           diagonal_lump_value );
-                        }
-
-                        /* Update mirror entries, if symmetric collapsing */
-                        if (sym_collapse)
-                        {
-                           hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                           &ijbuf_sym_cnt, ijbuf_size,
-                                                           &ijbuf_sym_rowcounter, &ijbuf_sym_data,
-                                                           &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                           &ijbuf_sym_numcols, cnt, global_row, lump_value);
-                           hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                           &ijbuf_sym_cnt, ijbuf_size,
-                                                           &ijbuf_sym_rowcounter, &ijbuf_sym_data,
-                                                           &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                           &ijbuf_sym_numcols, cnt, cnt, neg_lump_value );
-                        }
-                     }
-
-                     /* The offd_intersection has global column indices, i.e., the
-                      * col_map arrays contain global indices */
-                     for (k = 0; k < offd_intersection_len; k++)
-                     {
-                        lump_value = lump_percent * hypre_abs(offd_intersection_data[k]) * sum_strong_neigh;
-                        diagonal_lump_value = (1.0 - lump_percent) * hypre_abs(offd_intersection_data[k]) *
-                                              sum_strong_neigh;
-                        neg_lump_value = -1.0 * lump_value;
-
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                        &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row,
-                                                        offd_intersection[k], lump_value );
-                        if (lump_percent < 1.0)
-                        {
-                           hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                           &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row, global_row,
-                                                           diagonal_lump_value );
-                        }
-
-
-                        /* Update mirror entries, if symmetric collapsing */
-                        if (sym_collapse)
-                        {
-                           hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                           &ijbuf_sym_cnt, ijbuf_size,
-                                                           &ijbuf_sym_rowcounter, &ijbuf_sym_data,
-                                                           &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                           &ijbuf_sym_numcols, offd_intersection[k],
-                                                           global_row, lump_value );
-                           hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                           &ijbuf_sym_cnt, ijbuf_size,
-                                                           &ijbuf_sym_rowcounter, &ijbuf_sym_data,
-                                                           &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                           &ijbuf_sym_numcols, offd_intersection[k],
-                                                           offd_intersection[k], neg_lump_value );
-                        }
-                     }
-                  }
-                  /* If intersection is empty, do not eliminate entry */
-                  else
-                  {
-                     /* Don't forget to update mirror entry if collapsing symmetrically */
-                     if (sym_collapse)
-                     {   lump_value = 0.5 * RAP_offd_data[j]; }
-                     else
-                     {   lump_value = RAP_offd_data[j]; }
-
-                     hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                     &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row, col_indx_RAP,
-                                                     lump_value );
-                     if (sym_collapse)
-                     {
-                        hypre_NonGalerkinIJBufferWrite( ijmatrix,
-                                                        &ijbuf_sym_cnt, ijbuf_size, &ijbuf_sym_rowcounter,
-                                                        &ijbuf_sym_data, &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                                        &ijbuf_sym_numcols, col_indx_RAP, global_row,
-                                                        lump_value );
-                     }
-                  }
-               }
-               /* The entry in RAP appears in Pattern, so keep it */
-               else if (col_indx_RAP == col_indx_Pattern)
-               {
-                  /* For the offd structure, col_indx_RAP is a global dof number */
-                  hypre_NonGalerkinIJBufferWrite( ijmatrix, &ijbuf_cnt, ijbuf_size, &ijbuf_rowcounter,
-                                                  &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols, global_row, col_indx_RAP,
-                                                  RAP_offd_data[j]);
+   /* Compact the row workspace into C, and the mirror entries into Mirror */
+   nnz_diag = nnz_offd = mnz_diag = mnz_offd = 0;
+   for (i = 0; i < num_variables; i++)
+   {
+      nnz_diag += work_diag_end[i] - work_diag_i[i];
+      nnz_offd += work_offd_end[i] - work_offd_i[i];
+      for (j = work_diag_i[i]; j < work_diag_end[i]; j++)
+      {
+         if (work_diag_mirror[j] != 0.0)
+         {
+            mnz_diag++;
+         }
+      }
+      for (j = work_offd_i[i]; j < work_offd_end[i]; j++)
+      {
+         if (work_offd_mirror[j] != 0.0)
+         {
+            mnz_offd++;
+         }
+      }
+   }
 
-                  /* Only go to the next entry in Pattern, if this is not the end of a row */
-                  if ( current_Pattern_j < Pattern_offd_i[i + 1] - 1 )
-                  {
-                     current_Pattern_j += 1;
-                     col_indx_Pattern = col_map_offd_Pattern[ Pattern_offd_j[current_Pattern_j] ];
-                  }
-                  else
-                  {   has_row_ended = 1;}
-               }
-               /* Increment col_indx_Pattern, and repeat this loop iter for current
-                * col_ind_RAP value */
-               else if (col_indx_RAP > col_indx_Pattern)
-               {
-                  for (; current_Pattern_j < Pattern_offd_i[i + 1]; current_Pattern_j++)
-                  {
-                     col_indx_Pattern = col_map_offd_Pattern[ Pattern_offd_j[current_Pattern_j] ];
-                     if (col_indx_RAP <= col_indx_Pattern)
-                     {   break;}
-                  }
+   C = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumRows(RAP),
+                                hypre_ParCSRMatrixGlobalNumCols(RAP),
+                                hypre_ParCSRMatrixRowStarts(RAP),
+                                hypre_ParCSRMatrixColStarts(RAP),
+                                num_cols_offd_new, nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(C, HYPRE_MEMORY_HOST);
+   C_diag      = hypre_ParCSRMatrixDiag(C);
+   C_diag_i    = hypre_CSRMatrixI(C_diag);
+   C_diag_j    = hypre_CSRMatrixJ(C_diag);
+   C_diag_data = hypre_CSRMatrixData(C_diag);
+   C_offd      = hypre_ParCSRMatrixOffd(C);
+   C_offd_i    = hypre_CSRMatrixI(C_offd);
+   C_offd_j    = hypre_CSRMatrixJ(C_offd);
+   C_offd_data = hypre_CSRMatrixData(C_offd);
+   hypre_TMemcpy(hypre_ParCSRMatrixColMapOffd(C), col_map_offd_new, HYPRE_BigInt,
+                 num_cols_offd_new, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
 
-                  /* If col_indx_RAP is still greater (i.e., we've reached a row end), then
-                   * we need to lump everything else in this row */
-                  if (col_indx_RAP > col_indx_Pattern)
-                  {   has_row_ended = 1; }
+   if (sym_collapse)
+   {
+      Mirror = hypre_ParCSRMatrixCreate(comm,
+                                        hypre_ParCSRMatrixGlobalNumRows(RAP),
+                                        hypre_ParCSRMatrixGlobalNumCols(RAP),
+                                        hypre_ParCSRMatrixRowStarts(RAP),
+                                        hypre_ParCSRMatrixColStarts(RAP),
+                                        num_cols_offd_new, mnz_diag, mnz_offd);
+      hypre_ParCSRMatrixInitialize_v2(Mirror, HYPRE_MEMORY_HOST);
+      Mirror_diag      = hypre_ParCSRMatrixDiag(Mirror);
+      Mirror_diag_i    = hypre_CSRMatrixI(Mirror_diag);
+      Mirror_diag_j    = hypre_CSRMatrixJ(Mirror_diag);
+      Mirror_diag_data = hypre_CSRMatrixData(Mirror_diag);
+      Mirror_offd      = hypre_ParCSRMatrixOffd(Mirror);
+      Mirror_offd_i    = hypre_CSRMatrixI(Mirror_offd);
+      Mirror_offd_j    = hypre_CSRMatrixJ(Mirror_offd);
+      Mirror_offd_data = hypre_CSRMatrixData(Mirror_offd);
+      hypre_TMemcpy(hypre_ParCSRMatrixColMapOffd(Mirror), col_map_offd_new, HYPRE_BigInt,
+                    num_cols_offd_new, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
 
-                  /* Decrement j, in order to repeat this loop iteration for the current
-                   * col_indx_RAP value */
-                  j--;
-               }
-            }
+   cnt_diag = cnt_offd = 0;
+   nnz_diag = nnz_offd = 0;
+   for (i = 0; i < num_variables; i++)
+   {
+      for (j = work_diag_i[i]; j < work_diag_end[i]; j++)
+      {
+         C_diag_j[nnz_diag]      = work_diag_j[j];
+         C_diag_data[nnz_diag++] = work_diag_own[j];
+         if (sym_collapse && work_diag_mirror[j] != 0.0)
+         {
+            Mirror_diag_j[cnt_diag]      = work_diag_j[j];
+            Mirror_diag_data[cnt_diag++] = work_diag_mirror[j];
          }
       }
+      for (j = work_offd_i[i]; j < work_offd_end[i]; j++)
+      {
+         C_offd_j[nnz_offd]      = offd_C_map[work_offd_j[j]];
+         C_offd_data[nnz_offd++] = work_offd_own[j];
+         if (sym_collapse && work_offd_mirror[j] != 0.0)
+         {
+            Mirror_offd_j[cnt_offd]      = offd_C_map[work_offd_j[j]];
+            Mirror_offd_data[cnt_offd++] = work_offd_mirror[j];
+         }
+      }
+      C_diag_i[i + 1] = nnz_diag;
+      C_offd_i[i + 1] = nnz_offd;
+      if (sym_collapse)
+      {
+         Mirror_diag_i[i + 1] = cnt_diag;
+         Mirror_offd_i[i + 1] = cnt_offd;
+      }
    }
 
-   /* For efficiency, we do a buffered IJAddToValues.
-    * This empties the buffer of any remaining values */
-   hypre_NonGalerkinIJBufferEmpty(ijmatrix, ijbuf_size, &ijbuf_cnt, ijbuf_rowcounter,
-                                  &ijbuf_data, &ijbuf_cols, &ijbuf_rownums, &ijbuf_numcols);
    if (sym_collapse)
    {
-      hypre_NonGalerkinIJBufferEmpty(ijmatrix, ijbuf_size, &ijbuf_sym_cnt, ijbuf_sym_rowcounter,
-                                     &ijbuf_sym_data, &ijbuf_sym_cols, &ijbuf_sym_rownums,
-                                     &ijbuf_sym_numcols);
+      /* Return the mirror diagonal updates of offd columns to their owners,
+       * and add all of them to the diagonal, which is first in each row */
+      hypre_MatvecCommPkgCreate(C);
+      comm_pkg  = hypre_ParCSRMatrixCommPkg(C);
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      dvec_offd_new = hypre_CTAlloc(HYPRE_Real, num_cols_offd_new, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_C; i++)
+      {
+         if (offd_C_map[i] > -1)
+         {
+            dvec_offd_new[offd_C_map[i]] = dvec_offd[i];
+         }
+      }
+      dvec_buf = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                               HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(2, comm_pkg, dvec_offd_new, dvec_buf);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+      {
+         dvec[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)] += dvec_buf[i];
+      }
+      for (i = 0; i < num_variables; i++)
+      {
+         C_diag_data[C_diag_i[i]] += dvec[i];
+      }
+
+      /* Deliver the mirror entries (t,i) with a transpose.  Mirror has the
+       * same offd columns as C, so it can borrow C's communication package */
+      hypre_ParCSRMatrixCommPkg(Mirror) = comm_pkg;
+      hypre_ParCSRMatrixTranspose(Mirror, &MirrorT, 1);
+      hypre_ParCSRMatrixCommPkg(Mirror) = NULL;
+
+      /* C's entries come first in each row of the sum, so the diagonal
+       * stays in front */
+      hypre_ParCSRMatrixAdd(1.0, C, 1.0, MirrorT, RAP_ptr);
+
+      hypre_ParCSRMatrixDestroy(C);
+      hypre_ParCSRMatrixDestroy(Mirror);
+      hypre_ParCSRMatrixDestroy(MirrorT);
+      hypre_TFree(dvec_offd_new, HYPRE_MEMORY_HOST);
+      hypre_TFree(dvec_buf, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      hypre_ParCSRMatrixSetNumNonzeros(C);
+      hypre_ParCSRMatrixDNumNonzeros(C) = (HYPRE_Real) hypre_ParCSRMatrixNumNonzeros(C);
+      *RAP_ptr = C;
    }
 
-   /* Assemble non-Galerkin Matrix, and overwrite current RAP*/
-   HYPRE_IJMatrixAssemble(ijmatrix);
-   HYPRE_IJMatrixGetObject(ijmatrix, (void**) RAP_ptr);
+   /* Put each row in canonical order: the diagonal first, then increasing
+    * column indices, as RAP itself is stored.  The order of the rows on the
+    * next level then does not depend on the order of the lumping above. */
+   C_diag      = hypre_ParCSRMatrixDiag(*RAP_ptr);
+   C_diag_i    = hypre_CSRMatrixI(C_diag);
+   C_diag_j    = hypre_CSRMatrixJ(C_diag);
+   C_diag_data = hypre_CSRMatrixData(C_diag);
+   C_offd      = hypre_ParCSRMatrixOffd(*RAP_ptr);
+   C_offd_i    = hypre_CSRMatrixI(C_offd);
+   C_offd_j    = hypre_CSRMatrixJ(C_offd);
+   C_offd_data = hypre_CSRMatrixData(C_offd);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_variables; i++)
+   {
+      if (C_diag_i[i + 1] - C_diag_i[i] > 2)
+      {
+         hypre_qsort1(C_diag_j, C_diag_data, C_diag_i[i] + 1, C_diag_i[i + 1] - 1);
+      }
+      if (C_offd_i[i + 1] - C_offd_i[i] > 1)
+      {
+         hypre_qsort1(C_offd_j, C_offd_data, C_offd_i[i], C_offd_i[i + 1] - 1);
+      }
+   }
+   hypre_ParCSRMatrixMigrate(*RAP_ptr, memory_location_RAP);
 
    /* Optional diagnostic matrix printing */
 #if 0
@@ -2327,36 +1578,39 @@ hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
 #endif
 
    /* Free matrices and variables and arrays */
-   hypre_TFree(ijbuf_data,    memory_location_RAP);
-   hypre_TFree(ijbuf_cols,    memory_location_RAP);
-   hypre_TFree(ijbuf_rownums, memory_location_RAP);
-   hypre_TFree(ijbuf_numcols, memory_location_RAP);
-   if (sym_collapse)
-   {
-      hypre_TFree(ijbuf_sym_data,    memory_location_RAP);
-      hypre_TFree(ijbuf_sym_cols,    memory_location_RAP);
-      hypre_TFree(ijbuf_sym_rownums, memory_location_RAP);
-      hypre_TFree(ijbuf_sym_numcols, memory_location_RAP);
-   }
-   hypre_TFree(Pattern_offd_indices, HYPRE_MEMORY_HOST);
    hypre_TFree(S_ext_diag_i, HYPRE_MEMORY_HOST);
    hypre_TFree(S_ext_offd_i, HYPRE_MEMORY_HOST);
-   hypre_TFree(S_offd_indices, HYPRE_MEMORY_HOST);
-   hypre_TFree(offd_intersection, HYPRE_MEMORY_HOST);
-   hypre_TFree(offd_intersection_data, HYPRE_MEMORY_HOST);
-   hypre_TFree(diag_intersection, HYPRE_MEMORY_HOST);
-   hypre_TFree(diag_intersection_data, HYPRE_MEMORY_HOST);
    hypre_TFree(S_ext_diag_j, HYPRE_MEMORY_HOST);
    hypre_TFree(S_ext_diag_data, HYPRE_MEMORY_HOST);
    hypre_TFree(S_ext_offd_j, HYPRE_MEMORY_HOST);
    hypre_TFree(S_ext_offd_data, HYPRE_MEMORY_HOST);
    hypre_TFree(col_map_offd_Sext, HYPRE_MEMORY_HOST);
+   hypre_TFree(col_map_offd_C, HYPRE_MEMORY_HOST);
+   hypre_TFree(Pattern_to_C, HYPRE_MEMORY_HOST);
+   hypre_TFree(RAP_to_C, HYPRE_MEMORY_HOST);
+   hypre_TFree(RAP_to_Pattern, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_to_Pattern, HYPRE_MEMORY_HOST);
+   hypre_TFree(Sext_to_Pattern, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_diag_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_diag_end, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_diag_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_diag_own, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_diag_mirror, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_diag_lump, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_offd_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_offd_end, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_offd_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_offd_own, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_offd_mirror, HYPRE_MEMORY_HOST);
+   hypre_TFree(work_offd_lump, HYPRE_MEMORY_HOST);
+   hypre_TFree(dvec, HYPRE_MEMORY_HOST);
+   hypre_TFree(dvec_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_C_map, HYPRE_MEMORY_HOST);
+   hypre_TFree(col_map_offd_new, HYPRE_MEMORY_HOST);
 
    hypre_ParCSRMatrixDestroy(Pattern);
    hypre_ParCSRMatrixDestroy(RAP);
    hypre_ParCSRMatrixDestroy(S);
-   HYPRE_IJMatrixSetObjectType(ijmatrix, -1);
-   HYPRE_IJMatrixDestroy(ijmatrix);
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -0,0 +1,355 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Subdomain deflation operator for PCG (see hypre_PCGSetDeflationOperator)
+ *
+ * Subdomain s is the set of rows owned by ranks [s*P/k, (s+1)*P/k), and
+ * its deflation vector W_s is the indicator of those rows.  W is never
+ * stored: on each rank W is a single column of ones.  A W has nonzeros
+ * only in the rows of a subdomain and in the rows coupled to it, so the
+ * local rows of A W are kept as a CSR matrix whose columns index the few
+ * subdomains reached by the local rows.  W^T r is then a local sum, and
+ * (A W)^T z a sparse product, followed by one reduction of 2k values.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+typedef struct
+{
+   MPI_Comm          comm;
+   HYPRE_Int         num_subdomains;  /* k */
+   HYPRE_Int         my_subdomain;
+   HYPRE_Int         num_touched;     /* subdomains reached by the local rows of A W */
+   HYPRE_Int        *touched;         /* their ids, sorted */
+   hypre_CSRMatrix  *AW;              /* local rows of A W, columns index touched */
+   HYPRE_Real       *sums;            /* [local, global] partial sums, 4k */
+
+} hypre_ParPCGSubdomainDeflationData;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParPCGSubdomainDeflationCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ParPCGSubdomainDeflationCreate( MPI_Comm   comm,
+                                      HYPRE_Int  num_subdomains )
+{
+   hypre_ParPCGSubdomainDeflationData *defl_data;
+
+   defl_data = hypre_CTAlloc(hypre_ParPCGSubdomainDeflationData, 1, HYPRE_MEMORY_HOST);
+
+   defl_data -> comm           = comm;
+   defl_data -> num_subdomains = num_subdomains;
+   defl_data -> sums           = hypre_CTAlloc(HYPRE_Real, 4 * num_subdomains,
+                                               HYPRE_MEMORY_HOST);
+
+   return (void *) defl_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParPCGSubdomainDeflationDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParPCGSubdomainDeflationDestroy( void *data )
+{
+   hypre_ParPCGSubdomainDeflationData *defl_data = (hypre_ParPCGSubdomainDeflationData *) data;
+
+   if (defl_data)
+   {
+      hypre_TFree(defl_data -> touched, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(defl_data -> AW);
+      hypre_TFree(defl_data -> sums, HYPRE_MEMORY_HOST);
+      hypre_TFree(defl_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParPCGSubdomainDeflationSetup
+ *
+ * Forms the local rows of A W and E = W^T A W.  Since all local rows lie
+ * in my_subdomain, each rank contributes only to row my_subdomain of E.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParPCGSubdomainDeflationSetup( void       *data,
+                                     void       *A_vdata,
+                                     HYPRE_Real *E )
+{
+   hypre_ParPCGSubdomainDeflationData *defl_data = (hypre_ParPCGSubdomainDeflationData *) data;
+   hypre_ParCSRMatrix   *A              = (hypre_ParCSRMatrix *) A_vdata;
+   MPI_Comm              comm           = (defl_data -> comm);
+   HYPRE_Int             k              = (defl_data -> num_subdomains);
+
+   hypre_CSRMatrix      *A_diag         = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int            *A_diag_i       = hypre_CSRMatrixI(A_diag);
+   HYPRE_Real           *A_diag_data    = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix      *A_offd         = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int            *A_offd_i       = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int            *A_offd_j       = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real           *A_offd_data    = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int             num_rows       = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int             num_cols_offd  = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             num_recvs;
+   HYPRE_Int            *recv_procs;
+   HYPRE_Int            *recv_vec_starts;
+
+   hypre_CSRMatrix      *AW;
+   HYPRE_Int            *AW_i, *AW_j;
+   HYPRE_Real           *AW_data;
+   HYPRE_Int             num_touched, my_index;
+   HYPRE_Int            *touched, *col_index, *marker;
+   HYPRE_Real           *E_local;
+   HYPRE_Int             num_procs, my_id, my_subdomain;
+   HYPRE_Int             i, j, p, t, cnt, row_start;
+
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "PCG deflation is only available on the host");
+      hypre_Memset(E, 0, (size_t) k * k * sizeof(HYPRE_Real), HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+   my_subdomain = (HYPRE_Int) (((HYPRE_BigInt) my_id * k) / num_procs);
+
+   comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+
+   /* Subdomains reached by the local rows: mine and those of the ranks
+      owning the off-diagonal columns */
+   touched = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   touched[0] = my_subdomain;
+   for (p = 0; p < num_recvs; p++)
+   {
+      touched[p + 1] = (HYPRE_Int) (((HYPRE_BigInt) recv_procs[p] * k) / num_procs);
+   }
+   hypre_qsort0(touched, 0, num_recvs);
+   num_touched = 1;
+   for (p = 1; p < num_recvs + 1; p++)
+   {
+      if (touched[p] != touched[num_touched - 1])
+      {
+         touched[num_touched++] = touched[p];
+      }
+   }
+   my_index = hypre_BinarySearch(touched, my_subdomain, num_touched);
+
+   col_index = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_recvs; p++)
+   {
+      t = hypre_BinarySearch(touched,
+                             (HYPRE_Int) (((HYPRE_BigInt) recv_procs[p] * k) / num_procs),
+                             num_touched);
+      for (j = recv_vec_starts[p]; j < recv_vec_starts[p + 1]; j++)
+      {
+         col_index[j] = t;
+      }
+   }
+
+   /* Local rows of A W.  Row i has at most one entry per subdomain reached
+      by row i of A; exact zeros, such as the row sums of interior rows of
+      a diffusion operator, are not stored. */
+   AW      = hypre_CSRMatrixCreate(num_rows, num_touched,
+                                   num_rows + hypre_CSRMatrixNumNonzeros(A_offd));
+   hypre_CSRMatrixInitialize_v2(AW, 0, HYPRE_MEMORY_HOST);
+   AW_i    = hypre_CSRMatrixI(AW);
+   AW_j    = hypre_CSRMatrixJ(AW);
+   AW_data = hypre_CSRMatrixData(AW);
+   marker  = hypre_TAlloc(HYPRE_Int, num_touched, HYPRE_MEMORY_HOST);
+   for (t = 0; t < num_touched; t++)
+   {
+      marker[t] = -1;
+   }
+
+   cnt = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row_start = cnt;
+      AW_i[i] = cnt;
+      marker[my_index] = cnt;
+      AW_j[cnt] = my_index;
+      AW_data[cnt] = 0.0;
+      cnt++;
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         AW_data[row_start] += A_diag_data[j];
+      }
+      for (j = A_offd_i[i]; j < A_offd_i[i + 1]; j++)
+      {
+         t = col_index[A_offd_j[j]];
+         if (marker[t] < 0)
+         {
+            marker[t] = cnt;
+            AW_j[cnt] = t;
+            AW_data[cnt] = 0.0;
+            cnt++;
+         }
+         AW_data[marker[t]] += A_offd_data[j];
+      }
+
+      /* reset the marker and drop exact zeros */
+      p = row_start;
+      for (j = row_start; j < cnt; j++)
+      {
+         marker[AW_j[j]] = -1;
+         if (AW_data[j] != 0.0)
+         {
+            AW_j[p] = AW_j[j];
+            AW_data[p] = AW_data[j];
+            p++;
+         }
+      }
+      cnt = p;
+   }
+   AW_i[num_rows] = cnt;
+   hypre_CSRMatrixNumNonzeros(AW) = cnt;
+
+   /* Row my_subdomain of E = W^T A W is the sum of the local rows of A W */
+   E_local = hypre_CTAlloc(HYPRE_Real, k * k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < cnt; j++)
+   {
+      E_local[my_subdomain * k + touched[AW_j[j]]] += AW_data[j];
+   }
+   hypre_MPI_Allreduce(E_local, E, k * k, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   hypre_TFree(E_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(col_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(defl_data -> touched, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(defl_data -> AW);
+
+   defl_data -> my_subdomain = my_subdomain;
+   defl_data -> num_touched  = num_touched;
+   defl_data -> touched      = touched;
+   defl_data -> AW           = AW;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParPCGSubdomainDeflationDotpTwo
+ *
+ * mu_r = W^T r and mu_z = (A W)^T z with a single reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParPCGSubdomainDeflationDotpTwo( void       *data,
+                                       void       *r_vdata,
+                                       void       *z_vdata,
+                                       HYPRE_Real *mu_r,
+                                       HYPRE_Real *mu_z )
+{
+   hypre_ParPCGSubdomainDeflationData *defl_data = (hypre_ParPCGSubdomainDeflationData *) data;
+   HYPRE_Int          k            = (defl_data -> num_subdomains);
+   HYPRE_Int          my_subdomain = (defl_data -> my_subdomain);
+   HYPRE_Int          num_touched  = (defl_data -> num_touched);
+   HYPRE_Int         *touched      = (defl_data -> touched);
+   hypre_CSRMatrix   *AW           = (defl_data -> AW);
+   HYPRE_Int         *AW_i         = hypre_CSRMatrixI(AW);
+   HYPRE_Int         *AW_j         = hypre_CSRMatrixJ(AW);
+   HYPRE_Real        *AW_data      = hypre_CSRMatrixData(AW);
+   HYPRE_Int          num_rows     = hypre_CSRMatrixNumRows(AW);
+   HYPRE_Real        *local        = (defl_data -> sums);
+   HYPRE_Real        *global       = (defl_data -> sums) + 2 * k;
+   HYPRE_Complex     *r_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) r_vdata));
+   HYPRE_Complex     *z_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) z_vdata));
+   HYPRE_Real         r_sum = 0.0;
+   HYPRE_Int          i, j, t;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) reduction(+:r_sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      r_sum += r_data[i];
+   }
+   local[my_subdomain] = r_sum;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = AW_i[i]; j < AW_i[i + 1]; j++)
+      {
+         local[k + touched[AW_j[j]]] += AW_data[j] * z_data[i];
+      }
+   }
+
+   hypre_MPI_Allreduce(local, global, 2 * k, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       defl_data -> comm);
+
+   hypre_TMemcpy(mu_r, global, HYPRE_Real, k, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(mu_z, global + k, HYPRE_Real, k, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   /* only the touched entries of local are nonzero */
+   local[my_subdomain] = 0.0;
+   for (t = 0; t < num_touched; t++)
+   {
+      local[k + touched[t]] = 0.0;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParPCGSubdomainDeflationUpdate
+ *
+ * x += W mu_r, r -= A W mu_r, z -= W mu_z
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParPCGSubdomainDeflationUpdate( void       *data,
+                                      HYPRE_Real *mu_r,
+                                      HYPRE_Real *mu_z,
+                                      void       *x_vdata,
+                                      void       *r_vdata,
+                                      void       *z_vdata )
+{
+   hypre_ParPCGSubdomainDeflationData *defl_data = (hypre_ParPCGSubdomainDeflationData *) data;
+   HYPRE_Int          my_subdomain = (defl_data -> my_subdomain);
+   HYPRE_Int         *touched      = (defl_data -> touched);
+   hypre_CSRMatrix   *AW           = (defl_data -> AW);
+   HYPRE_Int         *AW_i         = hypre_CSRMatrixI(AW);
+   HYPRE_Int         *AW_j         = hypre_CSRMatrixJ(AW);
+   HYPRE_Real        *AW_data      = hypre_CSRMatrixData(AW);
+   HYPRE_Int          num_rows     = hypre_CSRMatrixNumRows(AW);
+   HYPRE_Complex     *x_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) x_vdata));
+   HYPRE_Complex     *r_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) r_vdata));
+   HYPRE_Complex     *z_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) z_vdata));
+   HYPRE_Real         mu_x_my      = mu_r[my_subdomain];
+   HYPRE_Real         mu_z_my      = mu_z[my_subdomain];
+   HYPRE_Int          i, j;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      x_data[i] += mu_x_my;
+      z_data[i] -= mu_z_my;
+      for (j = AW_i[i]; j < AW_i[i + 1]; j++)
+      {
+         r_data[i] -= AW_data[j] * mu_r[touched[AW_j[j]]];
+      }
+   }
+
+   return hypre_error_flag;
+}
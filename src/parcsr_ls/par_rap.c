@@ -2092,3 +2092,77 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperatorAdaptive
+ *
+ * Computes the Galerkin coarse operator P^T A P with a bound on its size.
+ * While the coarse operator has more than max_growth times the nonzeros of
+ * A, P is truncated further and the product is recomputed. trunc_factor and
+ * P_max_elmts are the truncation parameters P was built with.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperatorAdaptive( hypre_ParCSRMatrix  *A,
+                                            hypre_ParCSRMatrix  *P,
+                                            HYPRE_Int            keepTranspose,
+                                            HYPRE_Int            modularized,
+                                            HYPRE_Real           max_growth,
+                                            HYPRE_Real           trunc_factor,
+                                            HYPRE_Int            P_max_elmts,
+                                            hypre_ParCSRMatrix **RAP_ptr )
+{
+   hypre_ParCSRMatrix *RAP = NULL;
+   HYPRE_Real          nnz_A;
+   HYPRE_Int           num_retrunc = 0;
+   const HYPRE_Int     max_num_retrunc = 4;
+
+   hypre_ParCSRMatrixSetDNumNonzeros(A);
+   nnz_A = hypre_ParCSRMatrixDNumNonzeros(A);
+
+   while (1)
+   {
+      if (modularized)
+      {
+         RAP = hypre_ParCSRMatrixRAPKT(P, A, P, keepTranspose);
+      }
+      else
+      {
+         hypre_BoomerAMGBuildCoarseOperatorKT(P, A, P, keepTranspose, &RAP);
+      }
+      hypre_ParCSRMatrixSetDNumNonzeros(RAP);
+
+      /* stop if within budget or if P cannot be truncated any further */
+      if (hypre_ParCSRMatrixDNumNonzeros(RAP) <= max_growth * nnz_A ||
+          num_retrunc == max_num_retrunc ||
+          (P_max_elmts > 0 && P_max_elmts <= 2))
+      {
+         break;
+      }
+
+      P_max_elmts  = (P_max_elmts > 0) ? (P_max_elmts - 1) : 4;
+      trunc_factor = (trunc_factor > 0.0) ? hypre_min(2.0 * trunc_factor, 0.5) : 0.1;
+
+      hypre_ParCSRMatrixDestroy(RAP);
+      RAP = NULL;
+
+      /* transposes of P kept from the previous product are no longer valid */
+      if (hypre_ParCSRMatrixDiagT(P))
+      {
+         hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P));
+         hypre_ParCSRMatrixDiagT(P) = NULL;
+      }
+      if (hypre_ParCSRMatrixOffdT(P))
+      {
+         hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P));
+         hypre_ParCSRMatrixOffdT(P) = NULL;
+      }
+
+      hypre_BoomerAMGInterpTruncation(P, trunc_factor, P_max_elmts);
+      num_retrunc++;
+   }
+
+   *RAP_ptr = RAP;
+
+   return hypre_error_flag;
+}
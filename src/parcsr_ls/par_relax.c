@@ -733,6 +733,7 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    HYPRE_Int           *proc_ordering = NULL;
 
    const HYPRE_Real     one_minus_omega  = 1.0 - omega;
+   const HYPRE_Int      num_vectors      = hypre_VectorNumVectors(f_local);
    HYPRE_Int            num_procs, my_id, num_threads, j, num_sends;
 
 #if defined(HYPRE_USING_PERSISTENT_COMM)
@@ -747,12 +748,26 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_rank(comm, &my_id);
    num_threads = forced_seq ? 1 : hypre_NumThreads();
 
-   /* Sanity check */
-   if (hypre_ParVectorNumVectors(f) > 1)
+   /* Sanity check: the components of u, f and Vtemp must be laid out alike */
+   if (num_vectors > 1)
    {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
       hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                         "Hybrid GS relaxation doesn't support multicomponent vectors");
       return hypre_error_flag;
+#endif
+      if (Topo_order ||
+          hypre_VectorNumVectors(u_local)   != num_vectors ||
+          hypre_VectorIndexStride(u_local)  != hypre_VectorIndexStride(f_local) ||
+          hypre_VectorVectorStride(u_local) != hypre_VectorVectorStride(f_local) ||
+          (Vtemp_local &&
+           (hypre_VectorIndexStride(Vtemp_local)  != hypre_VectorIndexStride(u_local) ||
+            hypre_VectorVectorStride(Vtemp_local) != hypre_VectorVectorStride(u_local))))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Hybrid GS relaxation requires multicomponent vectors with equal layouts");
+         return hypre_error_flag;
+      }
    }
 
    /* GS order: forward or backward */
@@ -784,6 +799,11 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          comm_pkg = hypre_ParCSRMatrixCommPkg(A);
       }
 
+      /* Send all components of the interleaved vector at once */
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, num_vectors,
+                                         hypre_VectorVectorStride(u_local),
+                                         hypre_VectorIndexStride(u_local));
+
       num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
 #if defined(HYPRE_USING_PERSISTENT_COMM)
@@ -794,7 +814,7 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       v_buf_data = hypre_CTAlloc(HYPRE_Real,
                                  hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
                                  HYPRE_MEMORY_HOST);
-      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
 #endif
 
       HYPRE_Int begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
@@ -859,13 +879,40 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
 #endif
-      for (j = 0; j < num_rows; j++)
+      for (j = 0; j < num_rows * num_vectors; j++)
       {
          Vtemp_data[j] = u_data[j];
       }
    }
 
-   if (num_threads > 1)
+   if (num_vectors > 1)
+   {
+      const HYPRE_Int num_parts = num_threads > 1 ? num_threads : 1;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < num_parts; j++)
+      {
+         HYPRE_Int ns, ne, sweep;
+         hypre_partition1D(num_rows, num_parts, j, &ns, &ne);
+
+         for (sweep = 0; sweep < num_sweeps; sweep++)
+         {
+            const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+            const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+            const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
+
+            hypre_HybridGaussSeidelMultiVec(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                            f_data, cf_marker, relax_points, non_scale, relax_weight, omega,
+                                            one_minus_omega, prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                            num_vectors, hypre_VectorIndexStride(u_local),
+                                            hypre_VectorVectorStride(u_local),
+                                            ns, ne, ibegin, iend, iorder, Skip_diag);
+         }
+      }
+   }
+   else if (num_threads > 1)
    {
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
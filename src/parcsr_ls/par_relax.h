@@ -508,4 +508,141 @@ hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
    } /* for ( i = ...) */
 }
 
+#define HYPRE_RELAX_VEC_BLOCK 8
+
+/* Multivector version: component v of row i of u, f and v_tmp is stored at
+   i * idxstride + v * vecstride, while v_ext holds the num_vectors components
+   of each external row together. Each matrix entry is loaded once for a block
+   of up to HYPRE_RELAX_VEC_BLOCK components. Columns outside [ns, ne) are
+   taken from v_tmp; the non-scale and scaled variants match the scalar
+   kernels above component by component */
+static inline void
+hypre_HybridGaussSeidelMultiVec( HYPRE_Int     *A_diag_i,
+                                 HYPRE_Int     *A_diag_j,
+                                 HYPRE_Complex *A_diag_data,
+                                 HYPRE_Int     *A_offd_i,
+                                 HYPRE_Int     *A_offd_j,
+                                 HYPRE_Complex *A_offd_data,
+                                 HYPRE_Complex *f_data,
+                                 HYPRE_Int     *cf_marker,
+                                 HYPRE_Int      relax_points,
+                                 HYPRE_Int      non_scale,
+                                 HYPRE_Real     relax_weight,
+                                 HYPRE_Real     omega,
+                                 HYPRE_Real     one_minus_omega,
+                                 HYPRE_Real     prod,
+                                 HYPRE_Complex *l1_norms,
+                                 HYPRE_Complex *u_data,
+                                 HYPRE_Complex *v_tmp_data,
+                                 HYPRE_Complex *v_ext_data,
+                                 HYPRE_Int      num_vectors,
+                                 HYPRE_Int      idxstride,
+                                 HYPRE_Int      vecstride,
+                                 HYPRE_Int      ns,
+                                 HYPRE_Int      ne,
+                                 HYPRE_Int      ibegin,
+                                 HYPRE_Int      iend,
+                                 HYPRE_Int      iorder,
+                                 HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int i;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         HYPRE_Int jj, v, v0, nv;
+         HYPRE_Complex res[HYPRE_RELAX_VEC_BLOCK];
+         HYPRE_Complex res0[HYPRE_RELAX_VEC_BLOCK];
+         HYPRE_Complex res2[HYPRE_RELAX_VEC_BLOCK];
+
+         for (v0 = 0; v0 < num_vectors; v0 += HYPRE_RELAX_VEC_BLOCK)
+         {
+            HYPRE_Complex *u_i = u_data + i * idxstride + v0 * vecstride;
+
+            nv = hypre_min(HYPRE_RELAX_VEC_BLOCK, num_vectors - v0);
+            for (v = 0; v < nv; v++)
+            {
+               res[v]  = f_data[i * idxstride + (v0 + v) * vecstride];
+               res0[v] = 0.0;
+               res2[v] = 0.0;
+            }
+
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               const HYPRE_Int     ii = A_diag_j[jj];
+               const HYPRE_Complex a  = A_diag_data[jj];
+               const HYPRE_Int     k  = ii * idxstride + v0 * vecstride;
+
+               if (ii >= ns && ii < ne)
+               {
+                  if (non_scale)
+                  {
+                     for (v = 0; v < nv; v++)
+                     {
+                        res[v] -= a * u_data[k + v * vecstride];
+                     }
+                  }
+                  else
+                  {
+                     for (v = 0; v < nv; v++)
+                     {
+                        res0[v] -= a * u_data[k + v * vecstride];
+                        res2[v] += a * v_tmp_data[k + v * vecstride];
+                     }
+                  }
+               }
+               else
+               {
+                  for (v = 0; v < nv; v++)
+                  {
+                     res[v] -= a * v_tmp_data[k + v * vecstride];
+                  }
+               }
+            }
+
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               const HYPRE_Complex a = A_offd_data[jj];
+               const HYPRE_Int     k = A_offd_j[jj] * num_vectors + v0;
+
+               for (v = 0; v < nv; v++)
+               {
+                  res[v] -= a * v_ext_data[k + v];
+               }
+            }
+
+            if (non_scale)
+            {
+               for (v = 0; v < nv; v++)
+               {
+                  if (Skip_diag)
+                  {
+                     u_i[v * vecstride] = res[v] / diag;
+                  }
+                  else
+                  {
+                     u_i[v * vecstride] += res[v] / diag;
+                  }
+               }
+            }
+            else
+            {
+               for (v = 0; v < nv; v++)
+               {
+                  if (Skip_diag)
+                  {
+                     u_i[v * vecstride] *= prod;
+                  }
+                  u_i[v * vecstride] += relax_weight * (omega * res[v] + res0[v] + one_minus_omega * res2[v]) / diag;
+               }
+            }
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 #endif /* #ifndef HYPRE_PAR_RELAX_HEADER */
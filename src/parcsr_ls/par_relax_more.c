@@ -395,6 +395,417 @@ hypre_ParCSRMaxEigEstimateCGHost( hypre_ParCSRMatrix *A,     /* matrix to relax
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMaxEigInnerProds
+ *
+ * Computes the inner products dots[d] = <x[d],y[d]>, d = 0, ..., num_dots-1,
+ * of local vectors living on comm with one MPI_Allreduce. In reproducible
+ * reduction mode (bins != NULL), the exact bins of each product are reduced
+ * instead of the rounded local results, as in hypre_ParVectorInnerProd.
+ * local_dots holds num_dots entries, bins and local_bins num_dots bin sets.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMaxEigInnerProds( MPI_Comm       comm,
+                              HYPRE_Int      num_dots,
+                              hypre_Vector **x,
+                              hypre_Vector **y,
+                              HYPRE_Real    *local_dots,
+                              HYPRE_Real    *local_bins,
+                              HYPRE_Real    *bins,
+                              HYPRE_Real    *dots )
+{
+   HYPRE_Int  d;
+
+   if (bins)
+   {
+      for (d = 0; d < num_dots; d++)
+      {
+         hypre_SeqVectorInnerProdReproBins(x[d], y[d], &local_bins[d * hypre_REPRO_BINS_SIZE]);
+      }
+      hypre_MPI_Allreduce(local_bins, bins, num_dots * hypre_REPRO_BINS_SIZE,
+                          HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+      for (d = 0; d < num_dots; d++)
+      {
+         dots[d] = hypre_ReproBinsToReal(&bins[d * hypre_REPRO_BINS_SIZE]);
+      }
+   }
+   else
+   {
+      for (d = 0; d < num_dots; d++)
+      {
+         local_dots[d] = hypre_SeqVectorInnerProd(x[d], y[d]);
+      }
+      hypre_MPI_Allreduce(local_dots, dots, num_dots, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   }
+
+   return hypre_error_flag;
+}
+
+/**
+ *  @brief Runs the CG eigenvalue estimation for several matrices in lock-step
+ *
+ *  The iterations of all matrices advance together, so that the inner products
+ *  of every matrix are reduced with a single MPI_Allreduce per step instead of
+ *  two reductions per step and matrix. The estimates are the same as the ones
+ *  of hypre_ParCSRMaxEigEstimateCG, also in reproducible reduction mode.
+ *  Matrices living on a different communicator than the first active one, or
+ *  in device memory, are estimated separately.
+ *
+ *  @param[in] num_levels Number of matrices
+ *  @param[in] A_array Matrices
+ *  @param[in] active Estimate the eigenvalues of A_array[j] only if active[j] (NULL: all)
+ *  @param[in] scale Gets the eigenvalue est of D^{-1/2} A D^{-1/2}
+ *  @param[in] max_iter Maximum number of iterations for CG
+ *  @param[in,out] start Optional warm start vectors, one per matrix. If start[j]
+ *                 matches the layout of A_array[j], it is added to the random
+ *                 initial residual. On return, it holds the last search direction
+ *                 p (of the scaled matrix if scale is set).
+ *  @param[out] max_eig Estimated max eigenvalues
+ *  @param[out] min_eig Estimated min eigenvalues
+ */
+HYPRE_Int
+hypre_ParCSRMaxEigEstimateCGLevels( HYPRE_Int            num_levels,
+                                    hypre_ParCSRMatrix **A_array,
+                                    HYPRE_Int           *active,
+                                    HYPRE_Int            scale,
+                                    HYPRE_Int            max_iter,
+                                    hypre_ParVector    **start,
+                                    HYPRE_Real          *max_eig,
+                                    HYPRE_Real          *min_eig )
+{
+   MPI_Comm            comm = hypre_MPI_COMM_NULL;
+   hypre_ParCSRMatrix *A;
+   hypre_ParVector   **r, **p, **s, **ds, **u;
+   HYPRE_Real        **tridiag, **trioffd;
+   HYPRE_Real         *gamma, *local_dots, *dots;
+   HYPRE_Real         *local_bins = NULL, *bins = NULL;
+   hypre_Vector      **dot_x, **dot_y;
+   HYPRE_Int          *level_max_iter, *num_iter, *running, *levels;
+   HYPRE_Int           num_lock_levels = 0, num_running, num_active, num_warm;
+   HYPRE_Int          *warm;
+   HYPRE_Int           i, j, k, n, local_size, err;
+   HYPRE_Real          beta, alpha, alphainv, sdotp, gamma_old;
+   HYPRE_Real         *s_data, *p_data, *ds_data, *u_data;
+
+   levels = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+
+   /* select the matrices estimated in lock-step, do the other ones separately */
+   for (j = 0; j < num_levels; j++)
+   {
+      if (active && !active[j])
+      {
+         continue;
+      }
+
+      A = A_array[j];
+#if defined(HYPRE_USING_GPU)
+      if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_DEVICE)
+      {
+         hypre_ParCSRMaxEigEstimateCG(A, scale, max_iter, &max_eig[j], &min_eig[j]);
+         continue;
+      }
+#endif
+      if (num_lock_levels == 0)
+      {
+         comm = hypre_ParCSRMatrixComm(A);
+      }
+      if (hypre_ParCSRMatrixComm(A) != comm)
+      {
+         hypre_ParCSRMaxEigEstimateCG(A, scale, max_iter, &max_eig[j], &min_eig[j]);
+         continue;
+      }
+      levels[num_lock_levels++] = j;
+   }
+
+   if (num_lock_levels == 0)
+   {
+      hypre_TFree(levels, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   n              = num_lock_levels;
+   r              = hypre_CTAlloc(hypre_ParVector *, n, HYPRE_MEMORY_HOST);
+   p              = hypre_CTAlloc(hypre_ParVector *, n, HYPRE_MEMORY_HOST);
+   s              = hypre_CTAlloc(hypre_ParVector *, n, HYPRE_MEMORY_HOST);
+   ds             = hypre_CTAlloc(hypre_ParVector *, n, HYPRE_MEMORY_HOST);
+   u              = hypre_CTAlloc(hypre_ParVector *, n, HYPRE_MEMORY_HOST);
+   tridiag        = hypre_CTAlloc(HYPRE_Real *, n, HYPRE_MEMORY_HOST);
+   trioffd        = hypre_CTAlloc(HYPRE_Real *, n, HYPRE_MEMORY_HOST);
+   gamma          = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   warm           = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   local_dots     = hypre_CTAlloc(HYPRE_Real, 2 * n, HYPRE_MEMORY_HOST);
+   dots           = hypre_CTAlloc(HYPRE_Real, 2 * n, HYPRE_MEMORY_HOST);
+   dot_x          = hypre_CTAlloc(hypre_Vector *, 2 * n, HYPRE_MEMORY_HOST);
+   dot_y          = hypre_CTAlloc(hypre_Vector *, 2 * n, HYPRE_MEMORY_HOST);
+   level_max_iter = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   num_iter       = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   running        = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   /* set up the iteration of each matrix as in hypre_ParCSRMaxEigEstimateCGHost */
+   num_warm = 0;
+   for (k = 0; k < n; k++)
+   {
+      A = A_array[levels[k]];
+
+      level_max_iter[k] = max_iter;
+      if (hypre_ParCSRMatrixGlobalNumRows(A) < (HYPRE_BigInt) max_iter)
+      {
+         level_max_iter[k] = (HYPRE_Int) hypre_ParCSRMatrixGlobalNumRows(A);
+      }
+
+      r[k] = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                   hypre_ParCSRMatrixRowStarts(A));
+      p[k] = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                   hypre_ParCSRMatrixRowStarts(A));
+      s[k] = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                   hypre_ParCSRMatrixRowStarts(A));
+      ds[k] = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A));
+      u[k] = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                   hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize(r[k]);
+      hypre_ParVectorInitialize(p[k]);
+      hypre_ParVectorInitialize(s[k]);
+      hypre_ParVectorInitialize(ds[k]);
+      hypre_ParVectorInitialize(u[k]);
+
+      tridiag[k] = hypre_CTAlloc(HYPRE_Real, level_max_iter[k] + 1, HYPRE_MEMORY_HOST);
+      trioffd[k] = hypre_CTAlloc(HYPRE_Real, level_max_iter[k] + 1, HYPRE_MEMORY_HOST);
+
+      /* set residual to random */
+      hypre_ParVectorSetRandomValues(r[k], 1);
+
+      if (scale)
+      {
+         hypre_CSRMatrixExtractDiagonal(hypre_ParCSRMatrixDiag(A),
+                                        hypre_VectorData(hypre_ParVectorLocalVector(ds[k])), 4);
+      }
+      else
+      {
+         hypre_ParVectorSetConstantValues(ds[k], 1.0);
+      }
+
+      /* norms needed to blend in the warm start vector */
+      if (start && start[levels[k]] &&
+          hypre_ParVectorGlobalSize(start[levels[k]]) == hypre_ParCSRMatrixGlobalNumRows(A) &&
+          hypre_ParVectorLocalSize(start[levels[k]])  == hypre_ParCSRMatrixNumRows(A))
+      {
+         warm[k] = 1;
+         dot_x[2 * num_warm]     = dot_y[2 * num_warm]     = hypre_ParVectorLocalVector(r[k]);
+         dot_x[2 * num_warm + 1] = dot_y[2 * num_warm + 1] =
+                                      hypre_ParVectorLocalVector(start[levels[k]]);
+         num_warm++;
+      }
+
+      running[k] = (level_max_iter[k] > 0);
+   }
+
+   /* all the inner products use the reproducible algorithm or none does */
+   if (hypre_SeqVectorUseReproInnerProd(hypre_ParVectorLocalVector(r[0]),
+                                        hypre_ParVectorLocalVector(r[0])))
+   {
+      local_bins = hypre_TAlloc(HYPRE_Real, 2 * n * hypre_REPRO_BINS_SIZE, HYPRE_MEMORY_HOST);
+      bins       = hypre_TAlloc(HYPRE_Real, 2 * n * hypre_REPRO_BINS_SIZE, HYPRE_MEMORY_HOST);
+   }
+
+   /* r += (|r| / |w|) w for the warm started matrices */
+   if (num_warm > 0)
+   {
+      hypre_ParCSRMaxEigInnerProds(comm, 2 * num_warm, dot_x, dot_y,
+                                   local_dots, local_bins, bins, dots);
+      num_warm = 0;
+      for (k = 0; k < n; k++)
+      {
+         if (warm[k])
+         {
+            if (dots[2 * num_warm + 1] > 0.0)
+            {
+               hypre_ParVectorAxpy(hypre_sqrt(dots[2 * num_warm] / dots[2 * num_warm + 1]),
+                                   start[levels[k]], r[k]);
+            }
+            num_warm++;
+         }
+      }
+   }
+
+   /* CG iterations, advancing all matrices by one step at a time */
+   for (i = 0; i < max_iter; i++)
+   {
+      /* gamma = <r,Cr> */
+      num_running = 0;
+      for (k = 0; k < n; k++)
+      {
+         if (running[k])
+         {
+            /* s = C*r */
+            hypre_ParVectorCopy(r[k], s[k]);
+            dot_x[num_running]   = hypre_ParVectorLocalVector(r[k]);
+            dot_y[num_running++] = hypre_ParVectorLocalVector(s[k]);
+         }
+      }
+      if (num_running == 0)
+      {
+         break;
+      }
+      hypre_ParCSRMaxEigInnerProds(comm, num_running, dot_x, dot_y,
+                                   local_dots, local_bins, bins, dots);
+
+      /* s = A*p */
+      num_running = num_active = 0;
+      for (k = 0; k < n; k++)
+      {
+         if (!running[k])
+         {
+            continue;
+         }
+
+         local_size = hypre_ParVectorLocalSize(r[k]);
+         s_data  = hypre_VectorData(hypre_ParVectorLocalVector(s[k]));
+         p_data  = hypre_VectorData(hypre_ParVectorLocalVector(p[k]));
+         ds_data = hypre_VectorData(hypre_ParVectorLocalVector(ds[k]));
+         u_data  = hypre_VectorData(hypre_ParVectorLocalVector(u[k]));
+
+         gamma_old = gamma[k];
+         gamma[k]  = dots[num_running++];
+         if (gamma[k] < HYPRE_REAL_EPSILON)
+         {
+            running[k] = 0;
+            continue;
+         }
+
+         if (i == 0)
+         {
+            beta = 1.0;
+            hypre_ParVectorCopy(s[k], p[k]);
+         }
+         else
+         {
+            beta = gamma[k] / gamma_old;
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+            for (j = 0; j < local_size; j++)
+            {
+               p_data[j] = s_data[j] + beta * p_data[j];
+            }
+         }
+         tridiag[k][num_iter[k]] *= beta;
+         trioffd[k][num_iter[k]] *= hypre_sqrt(beta);
+
+         if (scale)
+         {
+            /* s = D^{-1/2}A*D^{-1/2}*p */
+            for (j = 0; j < local_size; j++)
+            {
+               u_data[j] = ds_data[j] * p_data[j];
+            }
+            hypre_ParCSRMatrixMatvec(1.0, A_array[levels[k]], u[k], 0.0, s[k]);
+            for (j = 0; j < local_size; j++)
+            {
+               s_data[j] = ds_data[j] * s_data[j];
+            }
+         }
+         else
+         {
+            hypre_ParCSRMatrixMatvec(1.0, A_array[levels[k]], p[k], 0.0, s[k]);
+         }
+
+         /* <s,p> */
+         dot_x[num_active]   = hypre_ParVectorLocalVector(s[k]);
+         dot_y[num_active++] = hypre_ParVectorLocalVector(p[k]);
+      }
+      if (num_active == 0)
+      {
+         break;
+      }
+      hypre_ParCSRMaxEigInnerProds(comm, num_active, dot_x, dot_y,
+                                   local_dots, local_bins, bins, dots);
+
+      /* update the tridiagonal matrices and the residuals */
+      num_active = 0;
+      for (k = 0; k < n; k++)
+      {
+         if (!running[k])
+         {
+            continue;
+         }
+
+         sdotp    = dots[num_active++];
+         alpha    = gamma[k] / sdotp;
+         alphainv = 1.0 / alpha;
+
+         tridiag[k][num_iter[k] + 1]  = alphainv;
+         tridiag[k][num_iter[k]]     += alphainv;
+         trioffd[k][num_iter[k] + 1]  = alphainv;
+
+         /* r = r - alpha*s */
+         hypre_ParVectorAxpy(-alpha, s[k], r[k]);
+
+         num_iter[k]++;
+         if (num_iter[k] >= level_max_iter[k])
+         {
+            running[k] = 0;
+         }
+      }
+   }
+
+   /* eispack routine - eigenvalues return in tridiag and ordered */
+   for (k = 0; k < n; k++)
+   {
+      j = levels[k];
+      if (num_iter[k] > 0)
+      {
+         hypre_LINPACKcgtql1(&num_iter[k], tridiag[k], trioffd[k], &err);
+         max_eig[j] = tridiag[k][num_iter[k] - 1];
+         min_eig[j] = tridiag[k][0];
+      }
+      else
+      {
+         max_eig[j] = 0.0;
+         min_eig[j] = 0.0;
+      }
+
+      /* keep the last search direction for the next estimation */
+      if (start && num_iter[k] > 0)
+      {
+         hypre_ParVectorDestroy(start[j]);
+         start[j] = p[k];
+         p[k] = NULL;
+      }
+
+      hypre_TFree(tridiag[k], HYPRE_MEMORY_HOST);
+      hypre_TFree(trioffd[k], HYPRE_MEMORY_HOST);
+      hypre_ParVectorDestroy(r[k]);
+      hypre_ParVectorDestroy(s[k]);
+      hypre_ParVectorDestroy(p[k]);
+      hypre_ParVectorDestroy(ds[k]);
+      hypre_ParVectorDestroy(u[k]);
+   }
+
+   hypre_TFree(r, HYPRE_MEMORY_HOST);
+   hypre_TFree(p, HYPRE_MEMORY_HOST);
+   hypre_TFree(s, HYPRE_MEMORY_HOST);
+   hypre_TFree(ds, HYPRE_MEMORY_HOST);
+   hypre_TFree(u, HYPRE_MEMORY_HOST);
+   hypre_TFree(tridiag, HYPRE_MEMORY_HOST);
+   hypre_TFree(trioffd, HYPRE_MEMORY_HOST);
+   hypre_TFree(gamma, HYPRE_MEMORY_HOST);
+   hypre_TFree(warm, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_dots, HYPRE_MEMORY_HOST);
+   hypre_TFree(dots, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_bins, HYPRE_MEMORY_HOST);
+   hypre_TFree(bins, HYPRE_MEMORY_HOST);
+   hypre_TFree(dot_x, HYPRE_MEMORY_HOST);
+   hypre_TFree(dot_y, HYPRE_MEMORY_HOST);
+   hypre_TFree(level_max_iter, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_iter, HYPRE_MEMORY_HOST);
+   hypre_TFree(running, HYPRE_MEMORY_HOST);
+   hypre_TFree(levels, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
 Chebyshev relaxation
 
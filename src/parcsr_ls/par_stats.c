@@ -1376,6 +1376,123 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGThreadingStats
+ *
+ * Times num_reps matvecs with the operator of each level, once with the
+ * threaded kernels and once on the calling thread only (see
+ * HYPRE_SetOMPMinWork), and the cost of an empty OpenMP parallel region.
+ * Levels where the serial matvec is faster are dominated by the
+ * fork/join overhead.  Times are per matvec, maximum over the ranks.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGThreadingStats( void      *amg_vdata,
+                               HYPRE_Int  num_reps )
+{
+   hypre_ParAMGData     *amg_data       = (hypre_ParAMGData *) amg_vdata;
+   HYPRE_Int             num_levels     = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix  **A_array        = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int             min_work       = hypre_HandleOMPMinWork(hypre_handle());
+   HYPRE_BigInt          suggested_work = 0;
+
+   hypre_ParCSRMatrix   *A;
+   hypre_ParVector      *x, *y;
+   MPI_Comm              comm;
+   HYPRE_BigInt          work, work_max;
+   HYPRE_Real            t[3], t_max[3];
+   HYPRE_Int             my_id, level, pass, k;
+   HYPRE_Int             num_forked = 0;
+
+   if (!A_array || num_reps < 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParCSRMatrixComm(A_array[0]);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\nBoomerAMG level matvec times (%d threads, %d reps, max over ranks):\n",
+                   hypre_NumThreads(), num_reps);
+      hypre_printf("lev         rows          nnz     threaded       serial    fork/join\n");
+   }
+
+   for (level = 0; level < num_levels; level++)
+   {
+      A = A_array[level];
+      x = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixRowStarts(A));
+      y = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize_v2(x, hypre_ParCSRMatrixMemoryLocation(A));
+      hypre_ParVectorInitialize_v2(y, hypre_ParCSRMatrixMemoryLocation(A));
+      hypre_ParVectorSetConstantValues(x, 1.0);
+      hypre_ParCSRMatrixSetNumNonzeros(A);
+
+      /* the work estimate the threaded kernels compare to min_work */
+      work = (HYPRE_BigInt) hypre_ParCSRMatrixNumRows(A) +
+             hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+             hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+
+      /* pass 0: threaded, pass 1: serial */
+      for (pass = 0; pass < 2; pass++)
+      {
+         hypre_SetOMPMinWork(pass == 0 ? 0 : HYPRE_INT_MAX);
+         hypre_ParCSRMatrixMatvec(1.0, A, x, 0.0, y);
+         hypre_MPI_Barrier(comm);
+         t[pass] = hypre_MPI_Wtime();
+         for (k = 0; k < num_reps; k++)
+         {
+            hypre_ParCSRMatrixMatvec(1.0, A, x, 0.0, y);
+         }
+         t[pass] = (hypre_MPI_Wtime() - t[pass]) / (HYPRE_Real) num_reps;
+      }
+      hypre_SetOMPMinWork(min_work);
+
+      /* fork/join only; the reduction keeps the region from being elided */
+      t[2] = hypre_MPI_Wtime();
+      for (k = 0; k < num_reps; k++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel reduction(+:num_forked)
+         {
+            num_forked++;
+         }
+#endif
+      }
+      t[2] = (hypre_MPI_Wtime() - t[2]) / (HYPRE_Real) num_reps;
+
+      hypre_MPI_Allreduce(t, t_max, 3, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+      hypre_MPI_Allreduce(&work, &work_max, 1, HYPRE_MPI_BIG_INT, hypre_MPI_MAX, comm);
+      if (t_max[1] < t_max[0])
+      {
+         suggested_work = hypre_max(suggested_work, work_max + 1);
+      }
+
+      if (my_id == 0)
+      {
+         hypre_printf("%3d %12b %12b %12.3e %12.3e %12.3e\n", level,
+                      hypre_ParCSRMatrixGlobalNumRows(A), hypre_ParCSRMatrixNumNonzeros(A),
+                      t_max[0], t_max[1], t_max[2]);
+      }
+
+      hypre_ParVectorDestroy(x);
+      hypre_ParVectorDestroy(y);
+   }
+
+   if (my_id == 0)
+   {
+      hypre_printf("Min. work that keeps the levels with slower threaded matvecs serial: %b\n\n",
+                   suggested_work);
+   }
+   HYPRE_UNUSED_VAR(num_forked);
+
+   return hypre_error_flag;
+}
+
 /*---------------------------------------------------------------
  * hypre_BoomerAMGWriteSolverParams
  *---------------------------------------------------------------*/
@@ -50,6 +50,7 @@ struct _hypre_ParCSRCommPkg;
 typedef struct
 {
    struct _hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Int             job;
    HYPRE_MemoryLocation  send_memory_location;
    HYPRE_MemoryLocation  recv_memory_location;
    HYPRE_Int             num_send_bytes;
@@ -68,6 +69,8 @@ typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                          comm;
    HYPRE_Int                         num_components;
+   HYPRE_Int                         vecstride; /* multivector layout of send_map_elmts */
+   HYPRE_Int                         idxstride;
    HYPRE_Int                         num_sends;
    HYPRE_Int                        *send_procs;
    HYPRE_Int                        *send_map_starts;
@@ -79,6 +82,12 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
+   /* send HYPRE_Complex payloads of jobs 1 and 2 in single precision */
+   HYPRE_Int                         float_halo;
+   HYPRE_Real                        float_halo_bytes_saved;
+   hypre_float                      *float_halo_buffer; /* send and recv payloads, reused */
+   HYPRE_Int                         float_halo_buffer_size;
+   HYPRE_Int                         float_halo_buffer_busy;
 #ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
@@ -96,6 +105,8 @@ typedef struct _hypre_ParCSRCommPkg
 
 #define hypre_ParCSRCommPkgComm(comm_pkg)                (comm_pkg -> comm)
 #define hypre_ParCSRCommPkgNumComponents(comm_pkg)       (comm_pkg -> num_components)
+#define hypre_ParCSRCommPkgVecStride(comm_pkg)           (comm_pkg -> vecstride)
+#define hypre_ParCSRCommPkgIdxStride(comm_pkg)           (comm_pkg -> idxstride)
 #define hypre_ParCSRCommPkgNumSends(comm_pkg)            (comm_pkg -> num_sends)
 #define hypre_ParCSRCommPkgSendProcs(comm_pkg)           (comm_pkg -> send_procs)
 #define hypre_ParCSRCommPkgSendProc(comm_pkg, i)         (comm_pkg -> send_procs[i])
@@ -114,6 +125,11 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgFloatHalo(comm_pkg)           (comm_pkg -> float_halo)
+#define hypre_ParCSRCommPkgFloatHaloBytesSaved(comm_pkg) (comm_pkg -> float_halo_bytes_saved)
+#define hypre_ParCSRCommPkgFloatHaloBuffer(comm_pkg)     (comm_pkg -> float_halo_buffer)
+#define hypre_ParCSRCommPkgFloatHaloBufferSize(comm_pkg) (comm_pkg -> float_halo_buffer_size)
+#define hypre_ParCSRCommPkgFloatHaloBufferBusy(comm_pkg) (comm_pkg -> float_halo_buffer_busy)
 
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -151,6 +167,7 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
  *--------------------------------------------------------------------------*/
 
 #define hypre_ParCSRCommHandleCommPkg(comm_handle)                (comm_handle -> comm_pkg)
+#define hypre_ParCSRCommHandleJob(comm_handle)                    (comm_handle -> job)
 #define hypre_ParCSRCommHandleSendMemoryLocation(comm_handle)     (comm_handle -> send_memory_location)
 #define hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle)     (comm_handle -> recv_memory_location)
 #define hypre_ParCSRCommHandleNumSendBytes(comm_handle)           (comm_handle -> num_send_bytes)
@@ -254,6 +271,14 @@ typedef struct hypre_ParVector_struct
 
    hypre_IJAssumedPart  *assumed_partition; /* only populated if this partition needed
                                               (for setting off-proc elements, for example)*/
+
+   /* Optional ghost region for the off-processor entries needed by a matvec
+      with ghost_comm_pkg (see par_vector_ghost.c). Receives land directly in
+      ghost_vector, and ghost_send_data is the persistent send buffer. */
+   hypre_ParCSRCommPkg  *ghost_comm_pkg;
+   hypre_Vector         *ghost_vector;
+   HYPRE_Complex        *ghost_send_data;
+   HYPRE_Int             ghost_send_size;
 } hypre_ParVector;
 
 /*--------------------------------------------------------------------------
@@ -278,12 +303,50 @@ typedef struct hypre_ParVector_struct
 
 #define hypre_ParVectorAssumedPartition(vector) ((vector) -> assumed_partition)
 
+#define hypre_ParVectorGhostCommPkg(vector)     ((vector) -> ghost_comm_pkg)
+#define hypre_ParVectorGhostVector(vector)      ((vector) -> ghost_vector)
+#define hypre_ParVectorGhostSendData(vector)    ((vector) -> ghost_send_data)
+#define hypre_ParVectorGhostSendSize(vector)    ((vector) -> ghost_send_size)
+
 static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_MemoryLocation
 hypre_ParVectorMemoryLocation(hypre_ParVector *vector)
 {
    return hypre_VectorMemoryLocation(hypre_ParVectorLocalVector(vector));
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPool
+ *
+ * Work vectors that are lent to solvers while they are active.  A free vector
+ * is only lent to a request with the same communicator, partitioning, number
+ * of vectors and memory location, so solvers that are never active at the
+ * same time (e.g., the subspace solvers of AMS) can share their temporaries.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int          num_vectors;   /* number of vectors owned by the pool */
+   HYPRE_Int          alloc_size;
+   hypre_ParVector  **vectors;
+   HYPRE_Int         *lent;          /* is vectors[i] lent out? */
+
+   HYPRE_Int          num_lent;
+   HYPRE_Int          max_lent;      /* high-water mark of num_lent */
+
+} hypre_ParVectorPool;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the ParVectorPool structure
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParVectorPoolNumVectors(pool)     ((pool) -> num_vectors)
+#define hypre_ParVectorPoolAllocSize(pool)      ((pool) -> alloc_size)
+#define hypre_ParVectorPoolVectors(pool)        ((pool) -> vectors)
+#define hypre_ParVectorPoolVector(pool, i)      ((pool) -> vectors[i])
+#define hypre_ParVectorPoolLent(pool)           ((pool) -> lent)
+#define hypre_ParVectorPoolNumLent(pool)        ((pool) -> num_lent)
+#define hypre_ParVectorPoolMaxLent(pool)        ((pool) -> max_lent)
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -445,6 +508,125 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Read-only view of a local row of a ParCSRMatrix.
+ *
+ * The diag and offd spans point directly into the matrix storage, so no
+ * copies are made and any number of views (on any number of threads) may be
+ * active at the same time. The view is valid as long as the matrix is not
+ * modified or destroyed.
+ *
+ * Entries can also be traversed in the "merged" order used by
+ * hypre_ParCSRMatrixGetRow: the first offd_lower offd entries (global column
+ * below first_col_diag), followed by the diag entries, followed by the
+ * remaining offd entries. See hypre_ParCSRMatrixRowViewGlobalCol/Value.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             diag_size;
+   const HYPRE_Int      *diag_j;
+   const HYPRE_Complex  *diag_data;
+
+   HYPRE_Int             offd_size;
+   HYPRE_Int             offd_lower;
+   const HYPRE_Int      *offd_j;
+   const HYPRE_Complex  *offd_data;
+
+   HYPRE_BigInt          first_col_diag;
+   const HYPRE_BigInt   *col_map_offd;
+
+} hypre_ParCSRMatrixRowView;
+
+#define hypre_ParCSRMatrixRowViewDiagSize(view)      ((view) -> diag_size)
+#define hypre_ParCSRMatrixRowViewDiagJ(view)         ((view) -> diag_j)
+#define hypre_ParCSRMatrixRowViewDiagData(view)      ((view) -> diag_data)
+#define hypre_ParCSRMatrixRowViewOffdSize(view)      ((view) -> offd_size)
+#define hypre_ParCSRMatrixRowViewOffdLower(view)     ((view) -> offd_lower)
+#define hypre_ParCSRMatrixRowViewOffdJ(view)         ((view) -> offd_j)
+#define hypre_ParCSRMatrixRowViewOffdData(view)      ((view) -> offd_data)
+#define hypre_ParCSRMatrixRowViewFirstColDiag(view)  ((view) -> first_col_diag)
+#define hypre_ParCSRMatrixRowViewColMapOffd(view)    ((view) -> col_map_offd)
+
+#define hypre_ParCSRMatrixRowViewSize(view) \
+   (hypre_ParCSRMatrixRowViewDiagSize(view) + hypre_ParCSRMatrixRowViewOffdSize(view))
+
+/* Global column of the k-th entry of the view in merged order */
+static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_BigInt
+hypre_ParCSRMatrixRowViewGlobalCol(const hypre_ParCSRMatrixRowView *view,
+                                   HYPRE_Int                        k)
+{
+   HYPRE_Int lower = hypre_ParCSRMatrixRowViewOffdLower(view);
+   HYPRE_Int nd    = hypre_ParCSRMatrixRowViewDiagSize(view);
+
+   if (k < lower)
+   {
+      return view -> col_map_offd[view -> offd_j[k]];
+   }
+   else if (k < lower + nd)
+   {
+      return view -> first_col_diag + (HYPRE_BigInt) view -> diag_j[k - lower];
+   }
+
+   return view -> col_map_offd[view -> offd_j[k - nd]];
+}
+
+/* Value of the k-th entry of the view in merged order */
+static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_Complex
+hypre_ParCSRMatrixRowViewValue(const hypre_ParCSRMatrixRowView *view,
+                               HYPRE_Int                        k)
+{
+   HYPRE_Int lower = hypre_ParCSRMatrixRowViewOffdLower(view);
+   HYPRE_Int nd    = hypre_ParCSRMatrixRowViewDiagSize(view);
+
+   if (k < lower)
+   {
+      return view -> offd_data[k];
+   }
+   else if (k < lower + nd)
+   {
+      return view -> diag_data[k - lower];
+   }
+
+   return view -> offd_data[k - nd];
+}
+
+/*--------------------------------------------------------------------------
+ * Transpose plan of a ParCSRMatrix.
+ *
+ * Records how the nonzeros of A map onto the nonzeros of AT = A^T, so that
+ * AT can be refreshed when the values of A change but its sparsity pattern
+ * does not. Re-transposition then amounts to local value permutations and
+ * a single exchange of the offd values over the cached comm_pkg.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             diag_nnz;
+   HYPRE_Int            *diag_perm;   /* AT_diag data[k] = A_diag data[diag_perm[k]] */
+
+   HYPRE_Int             offd_nnz;
+   HYPRE_Int            *offd_perm;   /* send_data[k] = A_offd data[offd_perm[k]] */
+   HYPRE_Complex        *send_data;
+
+   HYPRE_Int             recv_size;
+   HYPRE_Int            *recv_perm;   /* AT_offd data[recv_perm[k]] = recv_data[k] */
+   HYPRE_Complex        *recv_data;
+
+   hypre_ParCSRCommPkg  *comm_pkg;    /* exchanges send_data into recv_data */
+
+} hypre_ParCSRTransposePlan;
+
+#define hypre_ParCSRTransposePlanDiagNnz(plan)    ((plan) -> diag_nnz)
+#define hypre_ParCSRTransposePlanDiagPerm(plan)   ((plan) -> diag_perm)
+#define hypre_ParCSRTransposePlanOffdNnz(plan)    ((plan) -> offd_nnz)
+#define hypre_ParCSRTransposePlanOffdPerm(plan)   ((plan) -> offd_perm)
+#define hypre_ParCSRTransposePlanSendData(plan)   ((plan) -> send_data)
+#define hypre_ParCSRTransposePlanRecvSize(plan)   ((plan) -> recv_size)
+#define hypre_ParCSRTransposePlanRecvPerm(plan)   ((plan) -> recv_perm)
+#define hypre_ParCSRTransposePlanRecvData(plan)   ((plan) -> recv_data)
+#define hypre_ParCSRTransposePlanCommPkg(plan)    ((plan) -> comm_pkg)
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -764,6 +946,9 @@ HYPRE_Int hypre_ParCSRMatrixGenerateFFFC( hypre_ParCSRMatrix *A, HYPRE_Int *CF_m
                                           HYPRE_BigInt *cpts_starts, hypre_ParCSRMatrix *S,
                                           hypre_ParCSRMatrix **A_FC_ptr,
                                           hypre_ParCSRMatrix **A_FF_ptr ) ;
+HYPRE_Int hypre_ParCSRMatrixUpdateFFFCHost( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
+                                            HYPRE_Int *CF_marker_offd, hypre_ParCSRMatrix *A_FC,
+                                            hypre_ParCSRMatrix *A_FF );
 HYPRE_Int hypre_ParCSRMatrixGenerateFFFC3(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
                                           HYPRE_BigInt *cpts_starts, hypre_ParCSRMatrix *S, hypre_ParCSRMatrix **A_FC_ptr,
                                           hypre_ParCSRMatrix **A_FF_ptr ) ;
@@ -981,6 +1166,11 @@ HYPRE_Int hypre_ParCSRMatrixTranspose ( hypre_ParCSRMatrix *A, hypre_ParCSRMatri
                                         HYPRE_Int data );
 HYPRE_Int hypre_ParCSRMatrixTransposeHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
                                             HYPRE_Int data );
+HYPRE_Int hypre_ParCSRTransposePlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
+                                            hypre_ParCSRTransposePlan **plan_ptr );
+HYPRE_Int hypre_ParCSRTransposePlanApply ( hypre_ParCSRTransposePlan *plan, hypre_ParCSRMatrix *A,
+                                           hypre_ParCSRMatrix *AT );
+HYPRE_Int hypre_ParCSRTransposePlanDestroy ( hypre_ParCSRTransposePlan *plan );
 HYPRE_Int hypre_ParCSRMatrixTransposeDevice ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
                                               HYPRE_Int data );
 void hypre_ParCSRMatrixGenSpanningTree ( hypre_ParCSRMatrix *G_csr, HYPRE_Int **indices,
@@ -1158,6 +1348,12 @@ HYPRE_Int hypre_ParCSRMatrixGetRow ( hypre_ParCSRMatrix *mat, HYPRE_BigInt row,
                                      HYPRE_BigInt **col_ind, HYPRE_Complex **values );
 HYPRE_Int hypre_ParCSRMatrixRestoreRow ( hypre_ParCSRMatrix *matrix, HYPRE_BigInt row,
                                          HYPRE_Int *size, HYPRE_BigInt **col_ind, HYPRE_Complex **values );
+HYPRE_Int hypre_ParCSRMatrixGetRowView ( hypre_ParCSRMatrix *mat, HYPRE_Int local_row,
+                                         hypre_ParCSRMatrixRowView *view );
+HYPRE_Int hypre_ParCSRMatrixRowViewCopy ( const hypre_ParCSRMatrixRowView *view,
+                                          HYPRE_BigInt *col_ind, HYPRE_Complex *values );
+hypre_CSRMatrix *hypre_ParCSRMatrixExtractRowBlock ( hypre_ParCSRMatrix *mat, HYPRE_Int row_start,
+                                                     HYPRE_Int row_end, HYPRE_Int want_data );
 hypre_ParCSRMatrix *hypre_CSRMatrixToParCSRMatrix ( MPI_Comm comm, hypre_CSRMatrix *A,
                                                     HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts );
 HYPRE_Int GenerateDiagAndOffd ( hypre_CSRMatrix *A, hypre_ParCSRMatrix *matrix,
@@ -1239,6 +1435,9 @@ hypre_ParCSRMatrix *hypre_ParCSRTMatMatKT( hypre_ParCSRMatrix  *A, hypre_ParCSRM
 hypre_ParCSRMatrix *hypre_ParCSRTMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B);
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A,
                                              hypre_ParCSRMatrix  *P, HYPRE_Int keepTranspose );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKTFused( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A,
+                                                  hypre_ParCSRMatrix  *P, HYPRE_Int keep_transpose,
+                                                  HYPRE_Int working_set );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A,
                                            hypre_ParCSRMatrix  *P );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTDevice( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
@@ -1314,6 +1513,21 @@ HYPRE_Int hypre_ParVectorElmdivpy( hypre_ParVector *x, hypre_ParVector *b, hypre
 HYPRE_Int hypre_ParVectorElmdivpyMarked( hypre_ParVector *x, hypre_ParVector *b,
                                          hypre_ParVector *y, HYPRE_Int *marker,
                                          HYPRE_Int marker_val );
+/* par_vector_ghost.c */
+HYPRE_Int hypre_ParVectorInitializeGhost ( hypre_ParVector *x, hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParVectorDestroyGhost ( hypre_ParVector *x );
+HYPRE_Int hypre_ParVectorGhostMatches ( hypre_ParVector *x, hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParVectorGhostPack ( hypre_ParVector *x );
+
+/* par_vector_pool.c */
+hypre_ParVectorPool *hypre_ParVectorPoolCreate ( void );
+HYPRE_Int hypre_ParVectorPoolDestroy ( hypre_ParVectorPool *pool );
+hypre_ParVector *hypre_ParVectorPoolAcquire ( hypre_ParVectorPool *pool, MPI_Comm comm,
+                                              HYPRE_BigInt global_size, HYPRE_BigInt *partitioning,
+                                              HYPRE_Int num_vectors,
+                                              HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_ParVectorPoolRelease ( hypre_ParVectorPool *pool, hypre_ParVector *vector );
+
 /* par_vector_device.c */
 HYPRE_Int hypre_ParVectorGetValuesDevice(hypre_ParVector *vector, HYPRE_Int num_values,
                                          HYPRE_BigInt *indices, HYPRE_BigInt base,
@@ -521,6 +521,226 @@ hypre_ParCSRMatrixGenerateFFFC( hypre_ParCSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixUpdateFFFCHost
+ *
+ * Recomputes the values of A_FC and A_FF, previously generated by
+ * hypre_ParCSRMatrixGenerateFFFC with S = NULL, from a matrix A that has the
+ * same sparsity pattern and C/F splitting as the one used to generate them.
+ * No communication is performed. CF_marker_offd holds the C/F marker of the
+ * off-diagonal columns of A.
+ *
+ * The sparsity pattern of A is checked against the one of A_FC and A_FF.
+ * If they differ, an error is set and the values of A_FC and A_FF are
+ * undefined.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixUpdateFFFCHost( hypre_ParCSRMatrix  *A,
+                                  HYPRE_Int           *CF_marker,
+                                  HYPRE_Int           *CF_marker_offd,
+                                  hypre_ParCSRMatrix  *A_FC,
+                                  hypre_ParCSRMatrix  *A_FF )
+{
+   /* diag part of A */
+   hypre_CSRMatrix    *A_diag         = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Complex      *A_diag_data    = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int          *A_diag_i       = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int          *A_diag_j       = hypre_CSRMatrixJ(A_diag);
+   /* off-diag part of A */
+   hypre_CSRMatrix    *A_offd         = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Complex      *A_offd_data    = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int          *A_offd_i       = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int          *A_offd_j       = hypre_CSRMatrixJ(A_offd);
+
+   HYPRE_Int           n_fine          = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int           num_cols_A_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   /* A_FF and A_FC */
+   hypre_CSRMatrix    *A_FF_diag      = hypre_ParCSRMatrixDiag(A_FF);
+   HYPRE_Int          *A_FF_diag_i    = hypre_CSRMatrixI(A_FF_diag);
+   HYPRE_Int          *A_FF_diag_j    = hypre_CSRMatrixJ(A_FF_diag);
+   HYPRE_Complex      *A_FF_diag_data = hypre_CSRMatrixData(A_FF_diag);
+   hypre_CSRMatrix    *A_FF_offd      = hypre_ParCSRMatrixOffd(A_FF);
+   HYPRE_Int          *A_FF_offd_i    = hypre_CSRMatrixI(A_FF_offd);
+   HYPRE_Int          *A_FF_offd_j    = hypre_CSRMatrixJ(A_FF_offd);
+   HYPRE_Complex      *A_FF_offd_data = hypre_CSRMatrixData(A_FF_offd);
+   hypre_CSRMatrix    *A_FC_diag      = hypre_ParCSRMatrixDiag(A_FC);
+   HYPRE_Int          *A_FC_diag_i    = hypre_CSRMatrixI(A_FC_diag);
+   HYPRE_Int          *A_FC_diag_j    = hypre_CSRMatrixJ(A_FC_diag);
+   HYPRE_Complex      *A_FC_diag_data = hypre_CSRMatrixData(A_FC_diag);
+   hypre_CSRMatrix    *A_FC_offd      = hypre_ParCSRMatrixOffd(A_FC);
+   HYPRE_Int          *A_FC_offd_i    = hypre_CSRMatrixI(A_FC_offd);
+   HYPRE_Int          *A_FC_offd_j    = hypre_CSRMatrixJ(A_FC_offd);
+   HYPRE_Complex      *A_FC_offd_data = hypre_CSRMatrixData(A_FC_offd);
+
+   HYPRE_Int          *fine_to_coarse;
+   HYPRE_Int          *fine_to_fine;
+   HYPRE_Int          *fine_to_coarse_offd = NULL;
+   HYPRE_Int          *fine_to_fine_offd = NULL;
+   HYPRE_Int          *marker_offd = NULL;
+
+   HYPRE_Int           i, j, jA, row;
+   HYPRE_Int           n_Fpts, n_Cpts, n_offd_FF, n_offd_FC;
+   HYPRE_Int           d_FF, d_FC, o_FF, o_FC;
+   HYPRE_Int           num_mismatches = 0;
+
+   fine_to_coarse = hypre_TAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+   fine_to_fine   = hypre_TAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+
+   /* Local C/F numbering (same as in hypre_ParCSRMatrixGenerateFFFCHost) */
+   n_Fpts = n_Cpts = 0;
+   for (i = 0; i < n_fine; i++)
+   {
+      if (CF_marker[i] > 0)
+      {
+         fine_to_coarse[i] = n_Cpts++;
+         fine_to_fine[i]   = -1;
+      }
+      else
+      {
+         fine_to_fine[i]   = n_Fpts++;
+         fine_to_coarse[i] = -1;
+      }
+   }
+
+   /* Off-diagonal C/F numbering: only columns referenced by F-rows are kept */
+   n_offd_FF = n_offd_FC = 0;
+   if (num_cols_A_offd)
+   {
+      marker_offd         = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+      fine_to_coarse_offd = hypre_TAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+      fine_to_fine_offd   = hypre_TAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < n_fine; i++)
+      {
+         if (CF_marker[i] < 0)
+         {
+            for (j = A_offd_i[i]; j < A_offd_i[i + 1]; j++)
+            {
+               marker_offd[A_offd_j[j]] = 1;
+            }
+         }
+      }
+
+      for (i = 0; i < num_cols_A_offd; i++)
+      {
+         fine_to_coarse_offd[i] = fine_to_fine_offd[i] = -1;
+         if (CF_marker_offd[i] > 0 && marker_offd[i] > 0)
+         {
+            fine_to_coarse_offd[i] = n_offd_FC++;
+         }
+         else if (CF_marker_offd[i] < 0 && marker_offd[i] > 0)
+         {
+            fine_to_fine_offd[i] = n_offd_FF++;
+         }
+      }
+   }
+
+   /* Check dimensions */
+   if (hypre_CSRMatrixNumRows(A_FF_diag) != n_Fpts ||
+       hypre_CSRMatrixNumRows(A_FC_diag) != n_Fpts ||
+       hypre_CSRMatrixNumCols(A_FC_diag) != n_Cpts ||
+       hypre_CSRMatrixNumCols(A_FF_offd) != n_offd_FF ||
+       hypre_CSRMatrixNumCols(A_FC_offd) != n_offd_FC)
+   {
+      num_mismatches++;
+   }
+
+   /* Gather values row by row, checking the sparsity pattern on the way */
+   if (!num_mismatches)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, jA, row, d_FF, d_FC, o_FF, o_FC) reduction(+:num_mismatches) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_fine; i++)
+      {
+         if (CF_marker[i] >= 0)
+         {
+            continue;
+         }
+
+         row  = fine_to_fine[i];
+         d_FF = A_FF_diag_i[row];
+         d_FC = A_FC_diag_i[row];
+         o_FF = A_FF_offd_i[row];
+         o_FC = A_FC_offd_i[row];
+
+         /* Diagonal part: first entry always goes to A_FF */
+         jA = A_diag_i[i];
+         if (jA == A_diag_i[i + 1] || d_FF == A_FF_diag_i[row + 1] ||
+             A_FF_diag_j[d_FF] != fine_to_fine[A_diag_j[jA]])
+         {
+            num_mismatches++;
+            continue;
+         }
+         A_FF_diag_data[d_FF++] = A_diag_data[jA];
+
+         for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+         {
+            j = A_diag_j[jA];
+            if (CF_marker[j] > 0)
+            {
+               if (d_FC == A_FC_diag_i[row + 1] || A_FC_diag_j[d_FC] != fine_to_coarse[j])
+               {
+                  break;
+               }
+               A_FC_diag_data[d_FC++] = A_diag_data[jA];
+            }
+            else
+            {
+               if (d_FF == A_FF_diag_i[row + 1] || A_FF_diag_j[d_FF] != fine_to_fine[j])
+               {
+                  break;
+               }
+               A_FF_diag_data[d_FF++] = A_diag_data[jA];
+            }
+         }
+
+         /* Off-diagonal part */
+         for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+         {
+            j = A_offd_j[jA];
+            if (CF_marker_offd[j] > 0)
+            {
+               if (o_FC == A_FC_offd_i[row + 1] || A_FC_offd_j[o_FC] != fine_to_coarse_offd[j])
+               {
+                  break;
+               }
+               A_FC_offd_data[o_FC++] = A_offd_data[jA];
+            }
+            else
+            {
+               if (o_FF == A_FF_offd_i[row + 1] || A_FF_offd_j[o_FF] != fine_to_fine_offd[j])
+               {
+                  break;
+               }
+               A_FF_offd_data[o_FF++] = A_offd_data[jA];
+            }
+         }
+
+         if (d_FF != A_FF_diag_i[row + 1] || d_FC != A_FC_diag_i[row + 1] ||
+             o_FF != A_FF_offd_i[row + 1] || o_FC != A_FC_offd_i[row + 1])
+         {
+            num_mismatches++;
+         }
+      }
+   }
+
+   if (num_mismatches)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Sparsity pattern of A does not match A_FF/A_FC!\n");
+   }
+
+   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_to_fine, HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_to_fine_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixGenerateFFFC3
  *
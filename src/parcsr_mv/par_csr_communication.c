@@ -403,13 +403,80 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
     * job = 22: similar to job = 2, but exchanges data of type HYPRE_BigInt (not HYPRE_Complex),
     *           requires send_data and recv_data to be ints
     *           recv_vec_starts and send_map_starts need to be set in comm_pkg.
+    * job = 31: similar to job = 1, but the payload is sent in single precision;
+    *           send_data and recv_data are HYPRE_Complex host arrays that are
+    *           converted on pack and unpack. Jobs 1 and 2 are promoted to 31
+    *           and 32 for host data when float_halo is set in comm_pkg.
+    * job = 32: similar to job = 2, but the payload is sent in single precision.
     * default: ignores send_data and recv_data, requires send_mpi_types
     *           and recv_mpi_types to be set in comm_pkg.
     *           datatypes need to point to absolute
     *           addresses, e.g. generated using hypre_MPI_Address .
     *--------------------------------------------------------------------*/
 
-   if (!hypre_GetGpuAwareMPI())
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE)
+   if ((job == 1 || job == 2) && hypre_ParCSRCommPkgFloatHalo(comm_pkg) &&
+       hypre_GetActualMemLocation(send_memory_location) == hypre_MEMORY_HOST &&
+       hypre_GetActualMemLocation(recv_memory_location) == hypre_MEMORY_HOST)
+   {
+      job += 30;
+   }
+#endif
+
+   if (job == 31 || job == 32)
+   {
+      HYPRE_Int       num_send_elmts, num_recv_elmts;
+      HYPRE_Complex  *d_send_data = (HYPRE_Complex *) send_data_in;
+      hypre_float    *f_send_data;
+
+      if (job == 31)
+      {
+         num_send_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+         num_recv_elmts = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+      }
+      else
+      {
+         num_send_elmts = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+         num_recv_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      }
+
+      /* The send and receive payloads share one buffer that is kept in
+         comm_pkg; a second exchange in flight on the same package gets
+         its own */
+      if (!hypre_ParCSRCommPkgFloatHaloBufferBusy(comm_pkg))
+      {
+         if (hypre_ParCSRCommPkgFloatHaloBufferSize(comm_pkg) < num_send_elmts + num_recv_elmts)
+         {
+            hypre_TFree(hypre_ParCSRCommPkgFloatHaloBuffer(comm_pkg), HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgFloatHaloBuffer(comm_pkg) =
+               hypre_TAlloc(hypre_float, num_send_elmts + num_recv_elmts, HYPRE_MEMORY_HOST);
+            hypre_ParCSRCommPkgFloatHaloBufferSize(comm_pkg) = num_send_elmts + num_recv_elmts;
+         }
+         hypre_ParCSRCommPkgFloatHaloBufferBusy(comm_pkg) = 1;
+         f_send_data = hypre_ParCSRCommPkgFloatHaloBuffer(comm_pkg);
+      }
+      else
+      {
+         f_send_data = hypre_TAlloc(hypre_float, num_send_elmts + num_recv_elmts,
+                                    HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_send_elmts)
+#endif
+      for (i = 0; i < num_send_elmts; i++)
+      {
+         f_send_data[i] = (hypre_float) hypre_creal(d_send_data[i]);
+      }
+
+      send_data      = f_send_data;
+      recv_data      = f_send_data + num_send_elmts;
+      num_send_bytes = num_send_elmts * (HYPRE_Int) sizeof(hypre_float);
+      num_recv_bytes = num_recv_elmts * (HYPRE_Int) sizeof(hypre_float);
+
+      hypre_ParCSRCommPkgFloatHaloBytesSaved(comm_pkg) +=
+         (HYPRE_Real) num_send_elmts * (HYPRE_Real) (sizeof(HYPRE_Complex) - sizeof(hypre_float));
+   }
+   else if (!hypre_GetGpuAwareMPI())
    {
       switch (job)
       {
@@ -616,6 +683,50 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          }
          break;
       }
+      case  31:
+      {
+         hypre_float *f_send_data = (hypre_float *) send_data;
+         hypre_float *f_recv_data = (hypre_float *) recv_data;
+         for (i = 0; i < num_recvs; i++)
+         {
+            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+            hypre_MPI_Irecv(&f_recv_data[vec_start], vec_len, hypre_MPI_FLOAT,
+                            ip, 0, comm, &requests[j++]);
+         }
+         for (i = 0; i < num_sends; i++)
+         {
+            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+            hypre_MPI_Isend(&f_send_data[vec_start], vec_len, hypre_MPI_FLOAT,
+                            ip, 0, comm, &requests[j++]);
+         }
+         break;
+      }
+      case  32:
+      {
+         hypre_float *f_send_data = (hypre_float *) send_data;
+         hypre_float *f_recv_data = (hypre_float *) recv_data;
+         for (i = 0; i < num_sends; i++)
+         {
+            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+            hypre_MPI_Irecv(&f_recv_data[vec_start], vec_len, hypre_MPI_FLOAT,
+                            ip, 0, comm, &requests[j++]);
+         }
+         for (i = 0; i < num_recvs; i++)
+         {
+            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+            hypre_MPI_Isend(&f_send_data[vec_start], vec_len, hypre_MPI_FLOAT,
+                            ip, 0, comm, &requests[j++]);
+         }
+         break;
+      }
    }
    /*--------------------------------------------------------------------
     * set up comm_handle and return
@@ -624,6 +735,7 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
 
    hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+   hypre_ParCSRCommHandleJob(comm_handle)                = job;
    hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = send_memory_location;
    hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = recv_memory_location;
    hypre_ParCSRCommHandleNumSendBytes(comm_handle)       = num_send_bytes;
@@ -666,7 +778,35 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
       hypre_TFree(status0, HYPRE_MEMORY_HOST);
    }
 
-   if (!hypre_GetGpuAwareMPI())
+   if (hypre_ParCSRCommHandleJob(comm_handle) == 31 ||
+       hypre_ParCSRCommHandleJob(comm_handle) == 32)
+   {
+      hypre_ParCSRCommPkg *comm_pkg  = hypre_ParCSRCommHandleCommPkg(comm_handle);
+      HYPRE_Int       i;
+      HYPRE_Int       num_recv_elmts = hypre_ParCSRCommHandleNumRecvBytes(comm_handle) /
+                                       (HYPRE_Int) sizeof(hypre_float);
+      HYPRE_Complex  *d_recv_data    = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvData(comm_handle);
+      hypre_float    *f_recv_data    = (hypre_float *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(num_recv_elmts)
+#endif
+      for (i = 0; i < num_recv_elmts; i++)
+      {
+         d_recv_data[i] = (HYPRE_Complex) f_recv_data[i];
+      }
+
+      if (hypre_ParCSRCommHandleSendDataBuffer(comm_handle) ==
+          (void *) hypre_ParCSRCommPkgFloatHaloBuffer(comm_pkg))
+      {
+         hypre_ParCSRCommPkgFloatHaloBufferBusy(comm_pkg) = 0;
+      }
+      else
+      {
+         hypre_TFree(hypre_ParCSRCommHandleSendDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
+      }
+   }
+   else if (!hypre_GetGpuAwareMPI())
    {
       hypre_MemoryLocation act_send_memory_location =
          hypre_GetActualMemLocation(hypre_ParCSRCommHandleSendMemoryLocation(comm_handle));
@@ -1022,6 +1162,13 @@ hypre_ParCSRCommPkgCreateAndFill( MPI_Comm              comm,
 
    /* Set default info */
    hypre_ParCSRCommPkgNumComponents(comm_pkg)      = 1;
+   hypre_ParCSRCommPkgVecStride(comm_pkg)          = 1;
+   hypre_ParCSRCommPkgIdxStride(comm_pkg)          = 1;
+   hypre_ParCSRCommPkgFloatHalo(comm_pkg)          = 0;
+   hypre_ParCSRCommPkgFloatHaloBytesSaved(comm_pkg) = 0.0;
+   hypre_ParCSRCommPkgFloatHaloBuffer(comm_pkg)     = NULL;
+   hypre_ParCSRCommPkgFloatHaloBufferSize(comm_pkg) = 0;
+   hypre_ParCSRCommPkgFloatHaloBufferBusy(comm_pkg) = 0;
    hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg) = NULL;
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_ParCSRCommPkgTmpData(comm_pkg)            = NULL;
@@ -1055,6 +1202,12 @@ hypre_ParCSRCommPkgCreateAndFill( MPI_Comm              comm,
 
 /*------------------------------------------------------------------
  * hypre_ParCSRCommPkgUpdateVecStarts
+ *
+ * Adapts send_map_starts, send_map_elmts and recv_vec_starts to a
+ * multivector with num_components_in components laid out with the given
+ * vector and index strides. Both column-wise (idxstride = 1) and
+ * interleaved (vecstride = 1) storage are supported. The element map is
+ * rebuilt whenever the number of components or the layout changes.
  *------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -1064,6 +1217,8 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
                                     HYPRE_Int            idxstride )
 {
    HYPRE_Int     num_components  = hypre_ParCSRCommPkgNumComponents(comm_pkg);
+   HYPRE_Int     old_idxstride   = hypre_ParCSRCommPkgIdxStride(comm_pkg);
+   HYPRE_Int     old_vecstride   = hypre_ParCSRCommPkgVecStride(comm_pkg);
    HYPRE_Int     num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
    HYPRE_Int     num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
    HYPRE_Int    *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
@@ -1071,67 +1226,40 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
    HYPRE_Int    *send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
 
    HYPRE_Int    *send_map_elmts_new;
+   HYPRE_Int     num_elmts, base;
 
    HYPRE_Int     i, j;
 
    hypre_assert(num_components > 0);
 
-   if (num_components_in != num_components)
+   if (num_components_in == 1)
    {
-      /* Update number of components in the communication package */
-      hypre_ParCSRCommPkgNumComponents(comm_pkg) = num_components_in;
+      vecstride = idxstride = 1;
+   }
+
+   if (num_components_in != num_components ||
+       (num_components_in > 1 && (vecstride != old_vecstride || idxstride != old_idxstride)))
+   {
+      /* Number of (scalar) elements sent */
+      num_elmts = send_map_starts[num_sends] / num_components;
 
       /* Allocate send_maps_elmts */
-      send_map_elmts_new = hypre_CTAlloc(HYPRE_Int,
-                                         send_map_starts[num_sends] * num_components_in,
+      send_map_elmts_new = hypre_CTAlloc(HYPRE_Int, num_elmts * num_components_in,
                                          HYPRE_MEMORY_HOST);
 
-      /* Update send_maps_elmts */
-      if (num_components_in > num_components)
-      {
-         if (num_components == 1)
-         {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
-            {
-               for (j = 0; j < num_components_in; j++)
-               {
-                  send_map_elmts_new[i * num_components_in + j] = send_map_elmts[i] * idxstride +
-                                                                  j * vecstride;
-               }
-            }
-         }
-         else
-         {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
-            {
-               for (j = 0; j < num_components_in; j++)
-               {
-                  send_map_elmts_new[i * num_components_in + j] =
-                     send_map_elmts[i * num_components] * idxstride + j * vecstride;
-               }
-            }
-         }
-      }
-      else
+      /* Recover the scalar index from the first component of each element and
+         expand it with the new layout */
+      for (i = 0; i < num_elmts; i++)
       {
-         /* num_components_in < num_components */
-         if (num_components_in == 1)
+         base = send_map_elmts[i * num_components];
+         if (num_components > 1)
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
-            {
-               send_map_elmts_new[i] = send_map_elmts[i * num_components];
-            }
+            base /= old_idxstride;
          }
-         else
+
+         for (j = 0; j < num_components_in; j++)
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
-            {
-               for (j = 0; j < num_components_in; j++)
-               {
-                  send_map_elmts_new[i * num_components_in + j] =
-                     send_map_elmts[i * num_components + j];
-               }
-            }
+            send_map_elmts_new[i * num_components_in + j] = base * idxstride + j * vecstride;
          }
       }
       hypre_ParCSRCommPkgSendMapElmts(comm_pkg) = send_map_elmts_new;
@@ -1147,14 +1275,19 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
       /* Update send_map_starts */
       for (i = 0; i < num_sends + 1; i++)
       {
-         send_map_starts[i] *= num_components_in / num_components;
+         send_map_starts[i] = (send_map_starts[i] / num_components) * num_components_in;
       }
 
       /* Update recv_vec_starts */
       for (i = 0; i < num_recvs + 1; i++)
       {
-         recv_vec_starts[i] *= num_components_in / num_components;
+         recv_vec_starts[i] = (recv_vec_starts[i] / num_components) * num_components_in;
       }
+
+      /* Update number of components and layout in the communication package */
+      hypre_ParCSRCommPkgNumComponents(comm_pkg) = num_components_in;
+      hypre_ParCSRCommPkgVecStride(comm_pkg)     = vecstride;
+      hypre_ParCSRCommPkgIdxStride(comm_pkg)     = idxstride;
    }
 
    return hypre_error_flag;
@@ -1238,6 +1371,7 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
    hypre_TFree(hypre_ParCSRCommPkgRecvVecStarts(comm_pkg), HYPRE_MEMORY_HOST);
    /* if (hypre_ParCSRCommPkgRecvMPITypes(comm_pkg))
       hypre_TFree(hypre_ParCSRCommPkgRecvMPITypes(comm_pkg), HYPRE_MEMORY_HOST); */
+   hypre_TFree(hypre_ParCSRCommPkgFloatHaloBuffer(comm_pkg), HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_TFree(hypre_ParCSRCommPkgTmpData(comm_pkg), HYPRE_MEMORY_DEVICE);
@@ -34,6 +34,7 @@ struct _hypre_ParCSRCommPkg;
 typedef struct
 {
    struct _hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Int             job;
    HYPRE_MemoryLocation  send_memory_location;
    HYPRE_MemoryLocation  recv_memory_location;
    HYPRE_Int             num_send_bytes;
@@ -52,6 +53,8 @@ typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                          comm;
    HYPRE_Int                         num_components;
+   HYPRE_Int                         vecstride; /* multivector layout of send_map_elmts */
+   HYPRE_Int                         idxstride;
    HYPRE_Int                         num_sends;
    HYPRE_Int                        *send_procs;
    HYPRE_Int                        *send_map_starts;
@@ -63,6 +66,12 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
+   /* send HYPRE_Complex payloads of jobs 1 and 2 in single precision */
+   HYPRE_Int                         float_halo;
+   HYPRE_Real                        float_halo_bytes_saved;
+   hypre_float                      *float_halo_buffer; /* send and recv payloads, reused */
+   HYPRE_Int                         float_halo_buffer_size;
+   HYPRE_Int                         float_halo_buffer_busy;
 #ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
@@ -80,6 +89,8 @@ typedef struct _hypre_ParCSRCommPkg
 
 #define hypre_ParCSRCommPkgComm(comm_pkg)                (comm_pkg -> comm)
 #define hypre_ParCSRCommPkgNumComponents(comm_pkg)       (comm_pkg -> num_components)
+#define hypre_ParCSRCommPkgVecStride(comm_pkg)           (comm_pkg -> vecstride)
+#define hypre_ParCSRCommPkgIdxStride(comm_pkg)           (comm_pkg -> idxstride)
 #define hypre_ParCSRCommPkgNumSends(comm_pkg)            (comm_pkg -> num_sends)
 #define hypre_ParCSRCommPkgSendProcs(comm_pkg)           (comm_pkg -> send_procs)
 #define hypre_ParCSRCommPkgSendProc(comm_pkg, i)         (comm_pkg -> send_procs[i])
@@ -98,6 +109,11 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgFloatHalo(comm_pkg)           (comm_pkg -> float_halo)
+#define hypre_ParCSRCommPkgFloatHaloBytesSaved(comm_pkg) (comm_pkg -> float_halo_bytes_saved)
+#define hypre_ParCSRCommPkgFloatHaloBuffer(comm_pkg)     (comm_pkg -> float_halo_buffer)
+#define hypre_ParCSRCommPkgFloatHaloBufferSize(comm_pkg) (comm_pkg -> float_halo_buffer_size)
+#define hypre_ParCSRCommPkgFloatHaloBufferBusy(comm_pkg) (comm_pkg -> float_halo_buffer_busy)
 
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -135,6 +151,7 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
  *--------------------------------------------------------------------------*/
 
 #define hypre_ParCSRCommHandleCommPkg(comm_handle)                (comm_handle -> comm_pkg)
+#define hypre_ParCSRCommHandleJob(comm_handle)                    (comm_handle -> job)
 #define hypre_ParCSRCommHandleSendMemoryLocation(comm_handle)     (comm_handle -> send_memory_location)
 #define hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle)     (comm_handle -> recv_memory_location)
 #define hypre_ParCSRCommHandleNumSendBytes(comm_handle)           (comm_handle -> num_send_bytes)
@@ -1849,13 +1849,17 @@ hypre_ParCSRMatrixExtractBExt( hypre_ParCSRMatrix *B,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_ParCSRMatrixTransposeHost
+ * hypre_ParCSRMatrixTransposeHostCore
+ *
+ * Computes AT = A^T. If plan is not NULL, it is filled with the information
+ * needed by hypre_ParCSRTransposePlanApply to refresh the values of AT.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
-                                 hypre_ParCSRMatrix **AT_ptr,
-                                 HYPRE_Int            data )
+static HYPRE_Int
+hypre_ParCSRMatrixTransposeHostCore( hypre_ParCSRMatrix         *A,
+                                     hypre_ParCSRMatrix        **AT_ptr,
+                                     HYPRE_Int                   data,
+                                     hypre_ParCSRTransposePlan  *plan )
 {
    MPI_Comm                 comm     = hypre_ParCSRMatrixComm(A);
    hypre_ParCSRCommPkg     *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
@@ -1867,6 +1871,8 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
    HYPRE_BigInt            *col_starts = hypre_ParCSRMatrixColStarts(A);
 
    HYPRE_Int                num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int                num_nnzs_diag = hypre_CSRMatrixI(A_diag)[hypre_CSRMatrixNumRows(A_diag)];
+   HYPRE_Int                num_nnzs_offd = hypre_CSRMatrixI(A_offd)[hypre_CSRMatrixNumRows(A_offd)];
    HYPRE_Int                num_sends = 0, num_recvs = 0, num_cols_offd_AT;
    HYPRE_Int                i, j, k, index, counter, j_row;
    HYPRE_BigInt             value;
@@ -1904,6 +1910,7 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
    HYPRE_Int               *send_map_elmts = NULL;
    HYPRE_Int               *tmp_recv_vec_starts;
    HYPRE_Int               *tmp_send_map_starts;
+   HYPRE_Int               *recv_perm = NULL;
    hypre_ParCSRCommPkg     *tmp_comm_pkg = NULL;
    hypre_ParCSRCommHandle  *comm_handle = NULL;
 
@@ -1931,7 +1938,20 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
 
    if (num_procs > 1)
    {
-      hypre_CSRMatrixTranspose (A_offd, &AT_tmp, data);
+      if (plan)
+      {
+         hypre_ParCSRTransposePlanOffdNnz(plan)  = num_nnzs_offd;
+         hypre_ParCSRTransposePlanOffdPerm(plan) = hypre_TAlloc(HYPRE_Int, num_nnzs_offd,
+                                                                HYPRE_MEMORY_HOST);
+         hypre_ParCSRTransposePlanSendData(plan) = hypre_TAlloc(HYPRE_Complex, num_nnzs_offd,
+                                                                HYPRE_MEMORY_HOST);
+         hypre_CSRMatrixTransposePermHost(A_offd, &AT_tmp, data,
+                                          hypre_ParCSRTransposePlanOffdPerm(plan));
+      }
+      else
+      {
+         hypre_CSRMatrixTranspose(A_offd, &AT_tmp, data);
+      }
 
       AT_tmp_i = hypre_CSRMatrixI(AT_tmp);
       AT_tmp_j = hypre_CSRMatrixJ(AT_tmp);
@@ -1954,9 +1974,11 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
          AT_big_j = hypre_CTAlloc(HYPRE_BigInt, AT_tmp_i[num_cols_offd], HYPRE_MEMORY_HOST);
       }
 
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(AT_tmp_i[num_cols_offd])
+#endif
       for (i = 0; i < AT_tmp_i[num_cols_offd]; i++)
       {
-         //AT_tmp_j[i] += first_row_index;
          AT_big_j[i] = (HYPRE_BigInt)AT_tmp_j[i] + first_row_index;
       }
 
@@ -1968,7 +1990,19 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
       comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg, AT_tmp_i, AT_buf_i);
    }
 
-   hypre_CSRMatrixTranspose(A_diag, &AT_diag, data);
+   if (plan)
+   {
+      hypre_ParCSRTransposePlanDiagNnz(plan)  = num_nnzs_diag;
+      hypre_ParCSRTransposePlanDiagPerm(plan) = hypre_TAlloc(HYPRE_Int, num_nnzs_diag,
+                                                             HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixTransposePermHost(A_diag, &AT_diag, data,
+                                       hypre_ParCSRTransposePlanDiagPerm(plan));
+      hypre_CSRMatrixSetPatternOnly(AT_diag, hypre_CSRMatrixPatternOnly(A_diag));
+   }
+   else
+   {
+      hypre_CSRMatrixTranspose(A_diag, &AT_diag, data);
+   }
 
    AT_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols + 1, memory_location);
 
@@ -2028,9 +2062,33 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
          comm_handle = NULL;
       }
 
-      hypre_TFree(tmp_recv_vec_starts, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_send_map_starts, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_comm_pkg, HYPRE_MEMORY_HOST);
+      if (plan)
+      {
+         /* Keep the communication package; the plan owns copies of the processor lists */
+         hypre_ParCSRCommPkgRecvProcs(tmp_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs,
+                                                                   HYPRE_MEMORY_HOST);
+         hypre_ParCSRCommPkgSendProcs(tmp_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends,
+                                                                   HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(tmp_comm_pkg), recv_procs, HYPRE_Int,
+                       num_recvs, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(tmp_comm_pkg), send_procs, HYPRE_Int,
+                       num_sends, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+         hypre_ParCSRTransposePlanCommPkg(plan)  = tmp_comm_pkg;
+         hypre_ParCSRTransposePlanRecvSize(plan) = tmp_send_map_starts[num_sends];
+         hypre_ParCSRTransposePlanRecvData(plan) = AT_buf_data;
+         hypre_ParCSRTransposePlanRecvPerm(plan) = hypre_TAlloc(HYPRE_Int,
+                                                                tmp_send_map_starts[num_sends],
+                                                                HYPRE_MEMORY_HOST);
+         recv_perm   = hypre_ParCSRTransposePlanRecvPerm(plan);
+         AT_buf_data = NULL;
+      }
+      else
+      {
+         hypre_TFree(tmp_recv_vec_starts, HYPRE_MEMORY_HOST);
+         hypre_TFree(tmp_send_map_starts, HYPRE_MEMORY_HOST);
+         hypre_TFree(tmp_comm_pkg, HYPRE_MEMORY_HOST);
+      }
       hypre_CSRMatrixDestroy(AT_tmp);
 
       if (AT_offd_i[num_cols])
@@ -2057,7 +2115,12 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
             index = AT_offd_i[j_row];
             for (k = 0; k < AT_buf_i[j]; k++)
             {
-               if (data)
+               if (recv_perm)
+               {
+                  recv_perm[counter] = index;
+                  AT_offd_data[index] = hypre_ParCSRTransposePlanRecvData(plan)[counter];
+               }
+               else if (data)
                {
                   AT_offd_data[index] = AT_buf_data[counter];
                }
@@ -2102,11 +2165,11 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
       }
       hypre_TFree(AT_buf_i, HYPRE_MEMORY_HOST);
       hypre_TFree(AT_buf_j, HYPRE_MEMORY_HOST);
-      if (data)
-      {
-         hypre_TFree(AT_buf_data, HYPRE_MEMORY_HOST);
-      }
+      hypre_TFree(AT_buf_data, HYPRE_MEMORY_HOST);
 
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(counter)
+#endif
       for (i = 0; i < counter; i++)
       {
          AT_offd_j[i] = hypre_BigBinarySearch(col_map_offd_AT, AT_big_j[i],
@@ -2166,6 +2229,156 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixTransposeHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
+                                 hypre_ParCSRMatrix **AT_ptr,
+                                 HYPRE_Int            data )
+{
+   return hypre_ParCSRMatrixTransposeHostCore(A, AT_ptr, data, NULL);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTransposePlanCreate
+ *
+ * Computes AT = A^T together with a plan that allows to recompute the
+ * values of AT, via hypre_ParCSRTransposePlanApply, after the values (but
+ * not the sparsity pattern) of A have changed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTransposePlanCreate( hypre_ParCSRMatrix          *A,
+                                 hypre_ParCSRMatrix         **AT_ptr,
+                                 hypre_ParCSRTransposePlan  **plan_ptr )
+{
+   hypre_ParCSRTransposePlan  *plan;
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Transpose plans are not supported on device!\n");
+      return hypre_error_flag;
+   }
+#endif
+
+   plan = hypre_CTAlloc(hypre_ParCSRTransposePlan, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixTransposeHostCore(A, AT_ptr, 1, plan);
+
+   *plan_ptr = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTransposePlanApply
+ *
+ * Refreshes the values of AT = A^T, where AT was created along with plan
+ * by hypre_ParCSRTransposePlanCreate and the sparsity pattern of A has not
+ * changed since then. The offd values are exchanged while the diag values
+ * are permuted.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTransposePlanApply( hypre_ParCSRTransposePlan  *plan,
+                                hypre_ParCSRMatrix         *A,
+                                hypre_ParCSRMatrix         *AT )
+{
+   hypre_ParCSRCommPkg     *comm_pkg     = hypre_ParCSRTransposePlanCommPkg(plan);
+   HYPRE_Int                diag_nnz     = hypre_ParCSRTransposePlanDiagNnz(plan);
+   HYPRE_Int               *diag_perm    = hypre_ParCSRTransposePlanDiagPerm(plan);
+   HYPRE_Int                offd_nnz     = hypre_ParCSRTransposePlanOffdNnz(plan);
+   HYPRE_Int               *offd_perm    = hypre_ParCSRTransposePlanOffdPerm(plan);
+   HYPRE_Complex           *send_data    = hypre_ParCSRTransposePlanSendData(plan);
+   HYPRE_Int                recv_size    = hypre_ParCSRTransposePlanRecvSize(plan);
+   HYPRE_Int               *recv_perm    = hypre_ParCSRTransposePlanRecvPerm(plan);
+   HYPRE_Complex           *recv_data    = hypre_ParCSRTransposePlanRecvData(plan);
+
+   HYPRE_Complex           *A_diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Complex           *A_offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Complex           *AT_diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(AT));
+   HYPRE_Complex           *AT_offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(AT));
+   hypre_CSRMatrix         *A_diag       = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix         *A_offd       = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix         *AT_offd      = hypre_ParCSRMatrixOffd(AT);
+
+   hypre_ParCSRCommHandle  *comm_handle  = NULL;
+   HYPRE_Int                i;
+
+   if (hypre_CSRMatrixI(A_diag)[hypre_CSRMatrixNumRows(A_diag)] != diag_nnz ||
+       (comm_pkg && hypre_CSRMatrixI(A_offd)[hypre_CSRMatrixNumRows(A_offd)] != offd_nnz) ||
+       (comm_pkg && hypre_CSRMatrixI(AT_offd)[hypre_CSRMatrixNumRows(AT_offd)] != recv_size))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrices do not match the transpose plan!\n");
+      return hypre_error_flag;
+   }
+
+   /* Start exchanging the offd values */
+   if (comm_pkg)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(offd_nnz)
+#endif
+      for (i = 0; i < offd_nnz; i++)
+      {
+         send_data[i] = A_offd_data[offd_perm[i]];
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(2, comm_pkg, send_data, recv_data);
+   }
+
+   /* Permute the diag values while communication is in flight */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(diag_nnz)
+#endif
+   for (i = 0; i < diag_nnz; i++)
+   {
+      AT_diag_data[i] = A_diag_data[diag_perm[i]];
+   }
+
+   /* Scatter the received offd values */
+   if (comm_handle)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(recv_size)
+#endif
+      for (i = 0; i < recv_size; i++)
+      {
+         AT_offd_data[recv_perm[i]] = recv_data[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTransposePlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTransposePlanDestroy( hypre_ParCSRTransposePlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(hypre_ParCSRTransposePlanDiagPerm(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTransposePlanOffdPerm(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTransposePlanSendData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTransposePlanRecvPerm(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTransposePlanRecvData(plan), HYPRE_MEMORY_HOST);
+      if (hypre_ParCSRTransposePlanCommPkg(plan))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_ParCSRTransposePlanCommPkg(plan));
+      }
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixTranspose
  *--------------------------------------------------------------------------*/
@@ -4375,9 +4588,6 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
    HYPRE_Real *dense_all = hypre_CTAlloc(HYPRE_Complex, num_blocks * blockSize * blockSize,
                                          HYPRE_MEMORY_HOST);
    HYPRE_Real *dense = dense_all;
-   HYPRE_Int *IPIV  = hypre_TAlloc(HYPRE_Int, blockSize, HYPRE_MEMORY_HOST);
-   HYPRE_Complex *dgetri_work = NULL;
-   HYPRE_Int      dgetri_lwork = -1, lapack_info;
 
    HYPRE_Int  num_cols_A_offd_new;
    HYPRE_BigInt *col_map_offd_A_new;
@@ -4565,29 +4775,30 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
          }
       }
 
-      /* 2. invert the dense matrix */
-      hypre_dgetrf(&s, &s, dense, &blockSize, IPIV, &lapack_info);
-
-      hypre_assert(lapack_info == 0);
-
-      if (lapack_info == 0)
+      /* pad the last block with the identity if it is incomplete */
+      for (i = s; i < blockSize; i++)
       {
-         HYPRE_Int query = -1;
-         HYPRE_Real lwork_opt;
-         /* query the optimal size of work */
-         hypre_dgetri(&s, dense, &blockSize, IPIV, &lwork_opt, &query, &lapack_info);
+         dense[i + i * blockSize] = 1.0;
+      }
 
-         hypre_assert(lapack_info == 0);
+      dense += blockSize * blockSize;
+   }
 
-         if (lwork_opt > dgetri_lwork)
-         {
-            dgetri_lwork = (HYPRE_Int)lwork_opt;
-            dgetri_work = hypre_TReAlloc(dgetri_work, HYPRE_Complex, dgetri_lwork, HYPRE_MEMORY_HOST);
-         }
+   /* 2. invert all the dense blocks */
+   hypre_DenseBlockInvertBatched(num_blocks, blockSize, dense_all);
 
-         hypre_dgetri(&s, dense, &blockSize, IPIV, dgetri_work, &dgetri_lwork, &lapack_info);
+   /* 3. filter and premultiply block by block */
+   dense = dense_all;
+   for (block_start = first_row_block; block_start < end_row_block;
+        block_start += (HYPRE_BigInt)blockSize)
+   {
+      block_end = hypre_min(block_start + (HYPRE_BigInt)blockSize, nrow_global);
+      s = (HYPRE_Int)(block_end - block_start);
 
-         hypre_assert(lapack_info == 0);
+      /* remove the padding */
+      for (i = s; i < blockSize; i++)
+      {
+         dense[i + i * blockSize] = 0.0;
       }
 
       /* filter out *zeros* */
@@ -4614,7 +4825,7 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
          }
       }
 
-      /* 3. premultiplication: one-pass dynamic allocation */
+      /* premultiplication: one-pass dynamic allocation */
       for (big_i = block_start; big_i < block_end; big_i++)
       {
          /* starting points of this row in j */
@@ -4897,8 +5108,6 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
    A->bdiaginv = dense_all;
 
    /* free workspace */
-   hypre_TFree(IPIV, HYPRE_MEMORY_HOST);
-   hypre_TFree(dgetri_work, HYPRE_MEMORY_HOST);
    hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
    hypre_TFree(marker_newoffd, HYPRE_MEMORY_HOST);
    hypre_TFree(offd2new, HYPRE_MEMORY_HOST);
@@ -1809,6 +1809,195 @@ hypre_ParCSRMatrixRestoreRow( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixGetRowView
+ *
+ * Fills a read-only view of local row "local_row" (0-based). Unlike
+ * hypre_ParCSRMatrixGetRow, no data is copied and the matrix is not modified,
+ * so this may be called concurrently from any number of threads. No matching
+ * restore call is needed. Host memory only.
+ *
+ * Returns -1 (without setting the hypre error flag) if the row is not local.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixGetRowView( hypre_ParCSRMatrix        *mat,
+                              HYPRE_Int                  local_row,
+                              hypre_ParCSRMatrixRowView *view )
+{
+   hypre_CSRMatrix  *diag = hypre_ParCSRMatrixDiag(mat);
+   hypre_CSRMatrix  *offd = hypre_ParCSRMatrixOffd(mat);
+   HYPRE_Int        *diag_i = hypre_CSRMatrixI(diag);
+   HYPRE_Int        *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Complex    *diag_a = hypre_CSRMatrixData(diag);
+   HYPRE_Complex    *offd_a = hypre_CSRMatrixData(offd);
+   HYPRE_BigInt     *col_map_offd = hypre_ParCSRMatrixColMapOffd(mat);
+   HYPRE_BigInt      first_col_diag = hypre_ParCSRMatrixFirstColDiag(mat);
+   HYPRE_Int         lower;
+
+   if (local_row < 0 || local_row >= hypre_CSRMatrixNumRows(diag))
+   {
+      return -1;
+   }
+
+   view -> diag_size      = diag_i[local_row + 1] - diag_i[local_row];
+   view -> diag_j         = hypre_CSRMatrixJ(diag) + diag_i[local_row];
+   view -> diag_data      = diag_a ? diag_a + diag_i[local_row] : NULL;
+   view -> offd_size      = offd_i[local_row + 1] - offd_i[local_row];
+   view -> offd_j         = hypre_CSRMatrixJ(offd) + offd_i[local_row];
+   view -> offd_data      = offd_a ? offd_a + offd_i[local_row] : NULL;
+   view -> first_col_diag = first_col_diag;
+   view -> col_map_offd   = col_map_offd;
+
+   /* Same split as hypre_ParCSRMatrixGetRowHost: leading offd entries with
+      global column below the diag block */
+   for (lower = 0; lower < view -> offd_size; lower++)
+   {
+      if (col_map_offd[view -> offd_j[lower]] >= first_col_diag)
+      {
+         break;
+      }
+   }
+   view -> offd_lower = lower;
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRowViewCopy
+ *
+ * Copies the entries of a row view in merged order (see
+ * hypre_ParCSRMatrixGetRow) into caller-owned arrays. Either col_ind or
+ * values may be NULL.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRowViewCopy( const hypre_ParCSRMatrixRowView *view,
+                               HYPRE_BigInt                    *col_ind,
+                               HYPRE_Complex                   *values )
+{
+   HYPRE_Int            lower     = hypre_ParCSRMatrixRowViewOffdLower(view);
+   HYPRE_Int            nd        = hypre_ParCSRMatrixRowViewDiagSize(view);
+   HYPRE_Int            no        = hypre_ParCSRMatrixRowViewOffdSize(view);
+   const HYPRE_Int     *diag_j    = hypre_ParCSRMatrixRowViewDiagJ(view);
+   const HYPRE_Int     *offd_j    = hypre_ParCSRMatrixRowViewOffdJ(view);
+   const HYPRE_BigInt  *cmap      = hypre_ParCSRMatrixRowViewColMapOffd(view);
+   HYPRE_BigInt         cstart    = hypre_ParCSRMatrixRowViewFirstColDiag(view);
+   HYPRE_Int            i;
+
+   if (col_ind)
+   {
+      for (i = 0; i < lower; i++)
+      {
+         col_ind[i] = cmap[offd_j[i]];
+      }
+      for (i = 0; i < nd; i++)
+      {
+         col_ind[lower + i] = cstart + (HYPRE_BigInt) diag_j[i];
+      }
+      for (i = lower; i < no; i++)
+      {
+         col_ind[nd + i] = cmap[offd_j[i]];
+      }
+   }
+
+   if (values)
+   {
+      const HYPRE_Complex *diag_a = hypre_ParCSRMatrixRowViewDiagData(view);
+      const HYPRE_Complex *offd_a = hypre_ParCSRMatrixRowViewOffdData(view);
+
+      for (i = 0; i < lower; i++)
+      {
+         values[i] = offd_a[i];
+      }
+      for (i = 0; i < nd; i++)
+      {
+         values[lower + i] = diag_a[i];
+      }
+      for (i = lower; i < no; i++)
+      {
+         values[nd + i] = offd_a[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixExtractRowBlock
+ *
+ * Extracts local rows [row_start, row_end) into a CSRMatrix with global
+ * column indices (BigJ), in one threaded pass. Each row is stored in the
+ * merged order of hypre_ParCSRMatrixGetRow. If want_data is zero, only the
+ * sparsity pattern is extracted. Host memory only.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix *
+hypre_ParCSRMatrixExtractRowBlock( hypre_ParCSRMatrix *mat,
+                                   HYPRE_Int           row_start,
+                                   HYPRE_Int           row_end,
+                                   HYPRE_Int           want_data )
+{
+   hypre_CSRMatrix  *diag = hypre_ParCSRMatrixDiag(mat);
+   hypre_CSRMatrix  *offd = hypre_ParCSRMatrixOffd(mat);
+   HYPRE_Int        *diag_i = hypre_CSRMatrixI(diag);
+   HYPRE_Int        *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(diag);
+
+   hypre_CSRMatrix  *B;
+   HYPRE_Int        *B_i;
+   HYPRE_BigInt     *B_j;
+   HYPRE_Complex    *B_a;
+   HYPRE_Int         nrows_B, nnz_B, base, i;
+
+   if (row_start < 0 || row_end > num_rows || row_start > row_end)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Invalid row range for ExtractRowBlock");
+      return NULL;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(mat)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "ExtractRowBlock requires a host matrix");
+      return NULL;
+   }
+
+   nrows_B = row_end - row_start;
+   base    = diag_i[row_start] + offd_i[row_start];
+   nnz_B   = diag_i[row_end] + offd_i[row_end] - base;
+
+   B = hypre_CSRMatrixCreate(nrows_B, hypre_ParCSRMatrixGlobalNumCols(mat), nnz_B);
+   hypre_CSRMatrixBigJ(B) = hypre_TAlloc(HYPRE_BigInt, nnz_B, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixI(B)    = hypre_TAlloc(HYPRE_Int, nrows_B + 1, HYPRE_MEMORY_HOST);
+   if (want_data)
+   {
+      hypre_CSRMatrixData(B) = hypre_TAlloc(HYPRE_Complex, nnz_B, HYPRE_MEMORY_HOST);
+   }
+   hypre_CSRMatrixMemoryLocation(B) = HYPRE_MEMORY_HOST;
+
+   B_i = hypre_CSRMatrixI(B);
+   B_j = hypre_CSRMatrixBigJ(B);
+   B_a = hypre_CSRMatrixData(B);
+
+   /* Row offsets are known from diag_i and offd_i, so each row is
+      independent and no scan is needed */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = row_start; i < row_end; i++)
+   {
+      hypre_ParCSRMatrixRowView view;
+      HYPRE_Int                 pos = diag_i[i] + offd_i[i] - base;
+
+      B_i[i - row_start] = pos;
+      hypre_ParCSRMatrixGetRowView(mat, i, &view);
+      hypre_ParCSRMatrixRowViewCopy(&view, B_j + pos, B_a ? B_a + pos : NULL);
+   }
+   B_i[nrows_B] = nnz_B;
+
+   return B;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixToParCSRMatrix:
  *
@@ -158,6 +158,125 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Read-only view of a local row of a ParCSRMatrix.
+ *
+ * The diag and offd spans point directly into the matrix storage, so no
+ * copies are made and any number of views (on any number of threads) may be
+ * active at the same time. The view is valid as long as the matrix is not
+ * modified or destroyed.
+ *
+ * Entries can also be traversed in the "merged" order used by
+ * hypre_ParCSRMatrixGetRow: the first offd_lower offd entries (global column
+ * below first_col_diag), followed by the diag entries, followed by the
+ * remaining offd entries. See hypre_ParCSRMatrixRowViewGlobalCol/Value.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             diag_size;
+   const HYPRE_Int      *diag_j;
+   const HYPRE_Complex  *diag_data;
+
+   HYPRE_Int             offd_size;
+   HYPRE_Int             offd_lower;
+   const HYPRE_Int      *offd_j;
+   const HYPRE_Complex  *offd_data;
+
+   HYPRE_BigInt          first_col_diag;
+   const HYPRE_BigInt   *col_map_offd;
+
+} hypre_ParCSRMatrixRowView;
+
+#define hypre_ParCSRMatrixRowViewDiagSize(view)      ((view) -> diag_size)
+#define hypre_ParCSRMatrixRowViewDiagJ(view)         ((view) -> diag_j)
+#define hypre_ParCSRMatrixRowViewDiagData(view)      ((view) -> diag_data)
+#define hypre_ParCSRMatrixRowViewOffdSize(view)      ((view) -> offd_size)
+#define hypre_ParCSRMatrixRowViewOffdLower(view)     ((view) -> offd_lower)
+#define hypre_ParCSRMatrixRowViewOffdJ(view)         ((view) -> offd_j)
+#define hypre_ParCSRMatrixRowViewOffdData(view)      ((view) -> offd_data)
+#define hypre_ParCSRMatrixRowViewFirstColDiag(view)  ((view) -> first_col_diag)
+#define hypre_ParCSRMatrixRowViewColMapOffd(view)    ((view) -> col_map_offd)
+
+#define hypre_ParCSRMatrixRowViewSize(view) \
+   (hypre_ParCSRMatrixRowViewDiagSize(view) + hypre_ParCSRMatrixRowViewOffdSize(view))
+
+/* Global column of the k-th entry of the view in merged order */
+static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_BigInt
+hypre_ParCSRMatrixRowViewGlobalCol(const hypre_ParCSRMatrixRowView *view,
+                                   HYPRE_Int                        k)
+{
+   HYPRE_Int lower = hypre_ParCSRMatrixRowViewOffdLower(view);
+   HYPRE_Int nd    = hypre_ParCSRMatrixRowViewDiagSize(view);
+
+   if (k < lower)
+   {
+      return view -> col_map_offd[view -> offd_j[k]];
+   }
+   else if (k < lower + nd)
+   {
+      return view -> first_col_diag + (HYPRE_BigInt) view -> diag_j[k - lower];
+   }
+
+   return view -> col_map_offd[view -> offd_j[k - nd]];
+}
+
+/* Value of the k-th entry of the view in merged order */
+static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_Complex
+hypre_ParCSRMatrixRowViewValue(const hypre_ParCSRMatrixRowView *view,
+                               HYPRE_Int                        k)
+{
+   HYPRE_Int lower = hypre_ParCSRMatrixRowViewOffdLower(view);
+   HYPRE_Int nd    = hypre_ParCSRMatrixRowViewDiagSize(view);
+
+   if (k < lower)
+   {
+      return view -> offd_data[k];
+   }
+   else if (k < lower + nd)
+   {
+      return view -> diag_data[k - lower];
+   }
+
+   return view -> offd_data[k - nd];
+}
+
+/*--------------------------------------------------------------------------
+ * Transpose plan of a ParCSRMatrix.
+ *
+ * Records how the nonzeros of A map onto the nonzeros of AT = A^T, so that
+ * AT can be refreshed when the values of A change but its sparsity pattern
+ * does not. Re-transposition then amounts to local value permutations and
+ * a single exchange of the offd values over the cached comm_pkg.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             diag_nnz;
+   HYPRE_Int            *diag_perm;   /* AT_diag data[k] = A_diag data[diag_perm[k]] */
+
+   HYPRE_Int             offd_nnz;
+   HYPRE_Int            *offd_perm;   /* send_data[k] = A_offd data[offd_perm[k]] */
+   HYPRE_Complex        *send_data;
+
+   HYPRE_Int             recv_size;
+   HYPRE_Int            *recv_perm;   /* AT_offd data[recv_perm[k]] = recv_data[k] */
+   HYPRE_Complex        *recv_data;
+
+   hypre_ParCSRCommPkg  *comm_pkg;    /* exchanges send_data into recv_data */
+
+} hypre_ParCSRTransposePlan;
+
+#define hypre_ParCSRTransposePlanDiagNnz(plan)    ((plan) -> diag_nnz)
+#define hypre_ParCSRTransposePlanDiagPerm(plan)   ((plan) -> diag_perm)
+#define hypre_ParCSRTransposePlanOffdNnz(plan)    ((plan) -> offd_nnz)
+#define hypre_ParCSRTransposePlanOffdPerm(plan)   ((plan) -> offd_perm)
+#define hypre_ParCSRTransposePlanSendData(plan)   ((plan) -> send_data)
+#define hypre_ParCSRTransposePlanRecvSize(plan)   ((plan) -> recv_size)
+#define hypre_ParCSRTransposePlanRecvPerm(plan)   ((plan) -> recv_perm)
+#define hypre_ParCSRTransposePlanRecvData(plan)   ((plan) -> recv_data)
+#define hypre_ParCSRTransposePlanCommPkg(plan)    ((plan) -> comm_pkg)
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -46,6 +46,7 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    HYPRE_Int                ierr = 0;
 
    HYPRE_Int                i;
+   HYPRE_Int                use_ghost = 0;
    HYPRE_Int                idxstride    = hypre_VectorIndexStride(x_local);
    HYPRE_Int                num_vectors  = hypre_VectorNumVectors(x_local);
    HYPRE_Complex           *x_local_data = hypre_VectorData(x_local);
@@ -84,17 +85,6 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
-   if (num_vectors == 1)
-   {
-      x_tmp = hypre_SeqVectorCreate(num_cols_offd);
-   }
-   else
-   {
-      hypre_assert(num_vectors > 1);
-      x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
-      hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
-   }
-
    /*---------------------------------------------------------------------
     * If there exists no CommPkg for A, a CommPkg is generated using
     * equally load balanced partitionings
@@ -105,6 +95,27 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
       comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    }
 
+   /* If x carries a ghost region for this comm_pkg, receive into it and
+      send from its persistent buffer (see par_vector_ghost.c) */
+#if !defined(HYPRE_USING_PERSISTENT_COMM)
+   use_ghost = (num_vectors == 1) && hypre_ParVectorGhostMatches(x, comm_pkg);
+#endif
+
+   if (use_ghost)
+   {
+      x_tmp = hypre_ParVectorGhostVector(x);
+   }
+   else if (num_vectors == 1)
+   {
+      x_tmp = hypre_SeqVectorCreate(num_cols_offd);
+   }
+   else
+   {
+      hypre_assert(num_vectors > 1);
+      x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+      hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+   }
+
    /* Update send_map_starts, send_map_elmts, and recv_vec_starts when doing
       sparse matrix/multivector product  */
    hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, num_vectors,
@@ -141,7 +152,10 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    hypre_SeqVectorSetDataOwner(x_tmp, 0);
 #endif
 
-   hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+   if (!use_ghost)
+   {
+      hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+   }
    x_tmp_data = hypre_VectorData(x_tmp);
 
    /*---------------------------------------------------------------------
@@ -152,9 +166,16 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    x_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
 
 #else
-   x_buf_data = hypre_TAlloc(HYPRE_Complex,
-                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                             HYPRE_MEMORY_HOST);
+   if (use_ghost)
+   {
+      x_buf_data = hypre_ParVectorGhostSendData(x);
+   }
+   else
+   {
+      x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+   }
 #endif
 
    /* The assert is because this code has been tested for column-wise vector storage only. */
@@ -164,14 +185,21 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
     * Pack send data
     *--------------------------------------------------------------------*/
 
+   if (use_ghost)
+   {
+      hypre_ParVectorGhostPack(x);
+   }
+   else
+   {
 #if defined(HYPRE_USING_OPENMP)
-   #pragma omp parallel for HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for HYPRE_SMP_SCHEDULE
 #endif
-   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
-        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-        i++)
-   {
-      x_buf_data[i] = x_local_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+           i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+           i++)
+      {
+         x_buf_data[i] = x_local_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
    }
 
 #ifdef HYPRE_PROFILE
@@ -220,11 +248,13 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    /*---------------------------------------------------------------------
     * Free memory
     *--------------------------------------------------------------------*/
-   hypre_SeqVectorDestroy(x_tmp);
-
+   if (!use_ghost)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
 #if !defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
 #endif
+   }
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -965,6 +965,94 @@ hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix  *R,
    return C;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKTFused
+ *
+ * Computes "C = R * A * P" like hypre_ParCSRMatrixRAPKT. On a single MPI
+ * task with host execution, each row of C is formed directly from rows of
+ * R^T, A and P (see hypre_CSRMatrixTripleMultiplyHost), so the intermediate
+ * product A * P is never stored. Otherwise, this is hypre_ParCSRMatrixRAPKT.
+ *
+ * If R^T is neither stored in R nor to be kept, it is formed in row blocks
+ * of at most working_set nonzeros (see hypre_CSRMatrixTripleMultiplyTHost).
+ * A working_set of 0 means no limit.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPKTFused( hypre_ParCSRMatrix  *R,
+                              hypre_ParCSRMatrix  *A,
+                              hypre_ParCSRMatrix  *P,
+                              HYPRE_Int            keep_transpose,
+                              HYPRE_Int            working_set )
+{
+   MPI_Comm               comm    = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix       *R_diag  = hypre_ParCSRMatrixDiag(R);
+   hypre_CSRMatrix       *RT_diag = hypre_ParCSRMatrixDiagT(R);
+   hypre_CSRMatrix       *A_diag  = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix       *P_diag  = hypre_ParCSRMatrixDiag(P);
+   HYPRE_ExecutionPolicy  exec    = HYPRE_EXEC_HOST;
+
+   hypre_ParCSRMatrix    *C;
+   hypre_CSRMatrix       *C_diag;
+   hypre_CSRMatrix       *C_offd;
+   HYPRE_Int              num_procs;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+#if defined(HYPRE_USING_GPU)
+   exec = hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(R),
+                                hypre_ParCSRMatrixMemoryLocation(A) );
+#endif
+
+   if (num_procs > 1 || exec == HYPRE_EXEC_DEVICE)
+   {
+      return hypre_ParCSRMatrixRAPKT(R, A, P, keep_transpose);
+   }
+
+   if (hypre_ParCSRMatrixGlobalNumRows(R) != hypre_ParCSRMatrixGlobalNumRows(A) ||
+       hypre_ParCSRMatrixGlobalNumCols(A) != hypre_ParCSRMatrixGlobalNumRows(P))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, " Error! Incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (RT_diag)
+   {
+      C_diag = hypre_CSRMatrixTripleMultiplyHost(RT_diag, A_diag, P_diag);
+   }
+   else if (keep_transpose)
+   {
+      hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+      C_diag = hypre_CSRMatrixTripleMultiplyHost(RT_diag, A_diag, P_diag);
+      hypre_ParCSRMatrixDiagT(R) = RT_diag;
+   }
+   else
+   {
+      C_diag = hypre_CSRMatrixTripleMultiplyTHost(R_diag, A_diag, P_diag, working_set);
+   }
+
+   C_offd = hypre_CSRMatrixCreate(hypre_CSRMatrixNumRows(C_diag), 0, 0);
+   hypre_CSRMatrixInitialize_v2(C_offd, 0, hypre_CSRMatrixMemoryLocation(C_diag));
+
+   C = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumCols(R),
+                                hypre_ParCSRMatrixGlobalNumCols(P),
+                                hypre_ParCSRMatrixColStarts(R),
+                                hypre_ParCSRMatrixColStarts(P),
+                                0, 0, 0);
+
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(C));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(C));
+   hypre_ParCSRMatrixDiag(C) = C_diag;
+   hypre_ParCSRMatrixOffd(C) = C_offd;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return C;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixRAP
  *
@@ -106,6 +106,8 @@ hypre_ParVectorDestroy( hypre_ParVector *vector )
          hypre_AssumedPartitionDestroy(hypre_ParVectorAssumedPartition(vector));
       }
 
+      hypre_ParVectorDestroyGhost(vector);
+
       hypre_TFree(vector, HYPRE_MEMORY_HOST);
    }
 
@@ -550,7 +552,29 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
 
    HYPRE_Real result = 0.0;
-   HYPRE_Real local_result = hypre_SeqVectorInnerProd(x_local, y_local);
+   HYPRE_Real local_result;
+
+   if (hypre_SeqVectorUseReproInnerProd(x_local, y_local))
+   {
+      /* Sum the exact bins instead of the rounded local results */
+      HYPRE_Real local_bins[hypre_REPRO_BINS_SIZE];
+      HYPRE_Real bins[hypre_REPRO_BINS_SIZE];
+
+      hypre_SeqVectorInnerProdReproBins(x_local, y_local, local_bins);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+      hypre_MPI_Allreduce(local_bins, bins, hypre_REPRO_BINS_SIZE, HYPRE_MPI_REAL,
+                          hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+      return hypre_ReproBinsToReal(bins);
+   }
+
+   local_result = hypre_SeqVectorInnerProd(x_local, y_local);
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
@@ -42,6 +42,14 @@ typedef struct hypre_ParVector_struct
 
    hypre_IJAssumedPart  *assumed_partition; /* only populated if this partition needed
                                               (for setting off-proc elements, for example)*/
+
+   /* Optional ghost region for the off-processor entries needed by a matvec
+      with ghost_comm_pkg (see par_vector_ghost.c). Receives land directly in
+      ghost_vector, and ghost_send_data is the persistent send buffer. */
+   hypre_ParCSRCommPkg  *ghost_comm_pkg;
+   hypre_Vector         *ghost_vector;
+   HYPRE_Complex        *ghost_send_data;
+   HYPRE_Int             ghost_send_size;
 } hypre_ParVector;
 
 /*--------------------------------------------------------------------------
@@ -66,10 +74,48 @@ typedef struct hypre_ParVector_struct
 
 #define hypre_ParVectorAssumedPartition(vector) ((vector) -> assumed_partition)
 
+#define hypre_ParVectorGhostCommPkg(vector)     ((vector) -> ghost_comm_pkg)
+#define hypre_ParVectorGhostVector(vector)      ((vector) -> ghost_vector)
+#define hypre_ParVectorGhostSendData(vector)    ((vector) -> ghost_send_data)
+#define hypre_ParVectorGhostSendSize(vector)    ((vector) -> ghost_send_size)
+
 static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_MemoryLocation
 hypre_ParVectorMemoryLocation(hypre_ParVector *vector)
 {
    return hypre_VectorMemoryLocation(hypre_ParVectorLocalVector(vector));
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPool
+ *
+ * Work vectors that are lent to solvers while they are active.  A free vector
+ * is only lent to a request with the same communicator, partitioning, number
+ * of vectors and memory location, so solvers that are never active at the
+ * same time (e.g., the subspace solvers of AMS) can share their temporaries.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int          num_vectors;   /* number of vectors owned by the pool */
+   HYPRE_Int          alloc_size;
+   hypre_ParVector  **vectors;
+   HYPRE_Int         *lent;          /* is vectors[i] lent out? */
+
+   HYPRE_Int          num_lent;
+   HYPRE_Int          max_lent;      /* high-water mark of num_lent */
+
+} hypre_ParVectorPool;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the ParVectorPool structure
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParVectorPoolNumVectors(pool)     ((pool) -> num_vectors)
+#define hypre_ParVectorPoolAllocSize(pool)      ((pool) -> alloc_size)
+#define hypre_ParVectorPoolVectors(pool)        ((pool) -> vectors)
+#define hypre_ParVectorPoolVector(pool, i)      ((pool) -> vectors[i])
+#define hypre_ParVectorPoolLent(pool)           ((pool) -> lent)
+#define hypre_ParVectorPoolNumLent(pool)        ((pool) -> num_lent)
+#define hypre_ParVectorPoolMaxLent(pool)        ((pool) -> max_lent)
+
 #endif
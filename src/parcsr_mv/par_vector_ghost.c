@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Ghost region of hypre_ParVector
+ *
+ * A ParVector may carry persistent storage for the off-processor entries
+ * that a matvec with a given communication package needs. The host matvec
+ * then receives directly into the ghost region and sends from the persistent
+ * send buffer, instead of allocating both on every call.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInitializeGhost
+ *
+ * Allocates the ghost region of x for matvecs with comm_pkg. Only single
+ * vectors in host memory are supported; otherwise, nothing is done.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInitializeGhost( hypre_ParVector     *x,
+                                hypre_ParCSRCommPkg *comm_pkg )
+{
+   HYPRE_Int  num_sends, num_recvs;
+
+   if (!x)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!comm_pkg ||
+       hypre_ParVectorNumVectors(x) != 1 ||
+       hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(x)) != hypre_MEMORY_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParVectorGhostMatches(x, comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ParVectorDestroyGhost(x);
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+
+   hypre_ParVectorGhostCommPkg(x)    = comm_pkg;
+   hypre_ParVectorGhostVector(x)     =
+      hypre_SeqVectorCreate(hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs));
+   hypre_SeqVectorInitialize_v2(hypre_ParVectorGhostVector(x), HYPRE_MEMORY_HOST);
+   hypre_ParVectorGhostSendSize(x)   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   hypre_ParVectorGhostSendData(x)   = hypre_TAlloc(HYPRE_Complex,
+                                                    hypre_ParVectorGhostSendSize(x),
+                                                    HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorDestroyGhost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorDestroyGhost( hypre_ParVector *x )
+{
+   if (x)
+   {
+      hypre_SeqVectorDestroy(hypre_ParVectorGhostVector(x));
+      hypre_TFree(hypre_ParVectorGhostSendData(x), HYPRE_MEMORY_HOST);
+
+      hypre_ParVectorGhostCommPkg(x)    = NULL;
+      hypre_ParVectorGhostVector(x)     = NULL;
+      hypre_ParVectorGhostSendData(x)   = NULL;
+      hypre_ParVectorGhostSendSize(x)   = 0;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorGhostMatches
+ *
+ * Returns 1 if the ghost region of x can be used for a matvec with comm_pkg.
+ * The sizes are compared as well, since a communication package may be
+ * destroyed and a new one allocated at the same address.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorGhostMatches( hypre_ParVector     *x,
+                             hypre_ParCSRCommPkg *comm_pkg )
+{
+   HYPRE_Int  num_sends, num_recvs;
+
+   if (!comm_pkg || hypre_ParVectorGhostCommPkg(x) != comm_pkg ||
+       hypre_ParVectorNumVectors(x) != 1)
+   {
+      return 0;
+   }
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+
+   return (hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) == hypre_ParVectorGhostSendSize(x) &&
+           hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs) ==
+           hypre_VectorSize(hypre_ParVectorGhostVector(x)));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorGhostPack
+ *
+ * Gathers the entries of x to be sent into the ghost send buffer.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorGhostPack( hypre_ParVector *x )
+{
+   hypre_ParCSRCommPkg *comm_pkg   = hypre_ParVectorGhostCommPkg(x);
+   HYPRE_Complex       *x_data     = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex       *send_data  = hypre_ParVectorGhostSendData(x);
+   HYPRE_Int           *send_elmts;
+   HYPRE_Int            i;
+
+   if (!comm_pkg)
+   {
+      return hypre_error_flag;
+   }
+
+   send_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParVectorGhostSendSize(x); i++)
+   {
+      send_data[i] = x_data[send_elmts[i]];
+   }
+
+   return hypre_error_flag;
+}
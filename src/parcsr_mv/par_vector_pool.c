@@ -0,0 +1,177 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Member functions for hypre_ParVectorPool class.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPoolCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVectorPool *
+hypre_ParVectorPoolCreate( void )
+{
+   hypre_ParVectorPool *pool;
+
+   pool = hypre_CTAlloc(hypre_ParVectorPool, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParVectorPoolNumVectors(pool) = 0;
+   hypre_ParVectorPoolAllocSize(pool)  = 0;
+   hypre_ParVectorPoolVectors(pool)    = NULL;
+   hypre_ParVectorPoolLent(pool)       = NULL;
+   hypre_ParVectorPoolNumLent(pool)    = 0;
+   hypre_ParVectorPoolMaxLent(pool)    = 0;
+
+   return pool;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPoolDestroy
+ *
+ * Destroys all vectors owned by the pool.  No vector may be lent out.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPoolDestroy( hypre_ParVectorPool *pool )
+{
+   HYPRE_Int i;
+
+   if (pool)
+   {
+      if (hypre_ParVectorPoolNumLent(pool) > 0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Destroying a vector pool with lent vectors!\n");
+      }
+
+      for (i = 0; i < hypre_ParVectorPoolNumVectors(pool); i++)
+      {
+         hypre_ParVectorDestroy(hypre_ParVectorPoolVector(pool, i));
+      }
+      hypre_TFree(hypre_ParVectorPoolVectors(pool), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParVectorPoolLent(pool), HYPRE_MEMORY_HOST);
+      hypre_TFree(pool, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPoolAcquire
+ *
+ * Lends a vector with the given layout.  A free vector of the pool is reused
+ * if one matches, otherwise a new one is created and added to the pool.  The
+ * contents of the vector are undefined.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVector *
+hypre_ParVectorPoolAcquire( hypre_ParVectorPool  *pool,
+                            MPI_Comm              comm,
+                            HYPRE_BigInt          global_size,
+                            HYPRE_BigInt         *partitioning,
+                            HYPRE_Int             num_vectors,
+                            HYPRE_MemoryLocation  memory_location )
+{
+   hypre_ParVector  *vector;
+   HYPRE_Int         i, local_size;
+
+   local_size = (HYPRE_Int) (partitioning[1] - partitioning[0]);
+
+   /* the pool may be shared by solvers running concurrently */
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp critical (hypre_ParVectorPool)
+#endif
+   {
+      for (i = 0; i < hypre_ParVectorPoolNumVectors(pool); i++)
+      {
+         vector = hypre_ParVectorPoolVector(pool, i);
+
+         if (!hypre_ParVectorPoolLent(pool)[i]                             &&
+             hypre_ParVectorComm(vector)            == comm                &&
+             hypre_ParVectorGlobalSize(vector)      == global_size         &&
+             hypre_ParVectorPartitioning(vector)[0] == partitioning[0]     &&
+             hypre_ParVectorPartitioning(vector)[1] == partitioning[1]     &&
+             hypre_ParVectorLocalSize(vector)       == local_size          &&
+             hypre_ParVectorNumVectors(vector)      == num_vectors         &&
+             hypre_ParVectorMemoryLocation(vector)  == memory_location)
+         {
+            break;
+         }
+      }
+
+      if (i == hypre_ParVectorPoolNumVectors(pool))
+      {
+         if (i == hypre_ParVectorPoolAllocSize(pool))
+         {
+            hypre_ParVectorPoolAllocSize(pool) = 2 * i + 4;
+            hypre_ParVectorPoolVectors(pool) =
+               hypre_TReAlloc(hypre_ParVectorPoolVectors(pool), hypre_ParVector *,
+                              hypre_ParVectorPoolAllocSize(pool), HYPRE_MEMORY_HOST);
+            hypre_ParVectorPoolLent(pool) =
+               hypre_TReAlloc(hypre_ParVectorPoolLent(pool), HYPRE_Int,
+                              hypre_ParVectorPoolAllocSize(pool), HYPRE_MEMORY_HOST);
+         }
+
+         vector = hypre_ParMultiVectorCreate(comm, global_size, partitioning, num_vectors);
+         hypre_ParVectorInitialize_v2(vector, memory_location);
+
+         hypre_ParVectorPoolVector(pool, i) = vector;
+         hypre_ParVectorPoolNumVectors(pool)++;
+      }
+
+      hypre_ParVectorPoolLent(pool)[i] = 1;
+      hypre_ParVectorPoolNumLent(pool)++;
+      hypre_ParVectorPoolMaxLent(pool) = hypre_max(hypre_ParVectorPoolMaxLent(pool),
+                                                   hypre_ParVectorPoolNumLent(pool));
+
+      vector = hypre_ParVectorPoolVector(pool, i);
+   }
+
+   return vector;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPoolRelease
+ *
+ * Returns a vector obtained from hypre_ParVectorPoolAcquire to the pool.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPoolRelease( hypre_ParVectorPool *pool,
+                            hypre_ParVector     *vector )
+{
+   HYPRE_Int i;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp critical (hypre_ParVectorPool)
+#endif
+   {
+      for (i = 0; i < hypre_ParVectorPoolNumVectors(pool); i++)
+      {
+         if (hypre_ParVectorPoolVector(pool, i) == vector)
+         {
+            break;
+         }
+      }
+
+      if (i == hypre_ParVectorPoolNumVectors(pool) || !hypre_ParVectorPoolLent(pool)[i])
+      {
+         hypre_error_in_arg(2);
+      }
+      else
+      {
+         hypre_ParVectorPoolLent(pool)[i] = 0;
+         hypre_ParVectorPoolNumLent(pool)--;
+      }
+   }
+
+   return hypre_error_flag;
+}
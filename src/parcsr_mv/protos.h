@@ -103,6 +103,9 @@ HYPRE_Int hypre_ParCSRMatrixGenerateFFFC( hypre_ParCSRMatrix *A, HYPRE_Int *CF_m
                                           HYPRE_BigInt *cpts_starts, hypre_ParCSRMatrix *S,
                                           hypre_ParCSRMatrix **A_FC_ptr,
                                           hypre_ParCSRMatrix **A_FF_ptr ) ;
+HYPRE_Int hypre_ParCSRMatrixUpdateFFFCHost( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
+                                            HYPRE_Int *CF_marker_offd, hypre_ParCSRMatrix *A_FC,
+                                            hypre_ParCSRMatrix *A_FF );
 HYPRE_Int hypre_ParCSRMatrixGenerateFFFC3(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
                                           HYPRE_BigInt *cpts_starts, hypre_ParCSRMatrix *S, hypre_ParCSRMatrix **A_FC_ptr,
                                           hypre_ParCSRMatrix **A_FF_ptr ) ;
@@ -320,6 +323,11 @@ HYPRE_Int hypre_ParCSRMatrixTranspose ( hypre_ParCSRMatrix *A, hypre_ParCSRMatri
                                         HYPRE_Int data );
 HYPRE_Int hypre_ParCSRMatrixTransposeHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
                                             HYPRE_Int data );
+HYPRE_Int hypre_ParCSRTransposePlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
+                                            hypre_ParCSRTransposePlan **plan_ptr );
+HYPRE_Int hypre_ParCSRTransposePlanApply ( hypre_ParCSRTransposePlan *plan, hypre_ParCSRMatrix *A,
+                                           hypre_ParCSRMatrix *AT );
+HYPRE_Int hypre_ParCSRTransposePlanDestroy ( hypre_ParCSRTransposePlan *plan );
 HYPRE_Int hypre_ParCSRMatrixTransposeDevice ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
                                               HYPRE_Int data );
 void hypre_ParCSRMatrixGenSpanningTree ( hypre_ParCSRMatrix *G_csr, HYPRE_Int **indices,
@@ -497,6 +505,12 @@ HYPRE_Int hypre_ParCSRMatrixGetRow ( hypre_ParCSRMatrix *mat, HYPRE_BigInt row,
                                      HYPRE_BigInt **col_ind, HYPRE_Complex **values );
 HYPRE_Int hypre_ParCSRMatrixRestoreRow ( hypre_ParCSRMatrix *matrix, HYPRE_BigInt row,
                                          HYPRE_Int *size, HYPRE_BigInt **col_ind, HYPRE_Complex **values );
+HYPRE_Int hypre_ParCSRMatrixGetRowView ( hypre_ParCSRMatrix *mat, HYPRE_Int local_row,
+                                         hypre_ParCSRMatrixRowView *view );
+HYPRE_Int hypre_ParCSRMatrixRowViewCopy ( const hypre_ParCSRMatrixRowView *view,
+                                          HYPRE_BigInt *col_ind, HYPRE_Complex *values );
+hypre_CSRMatrix *hypre_ParCSRMatrixExtractRowBlock ( hypre_ParCSRMatrix *mat, HYPRE_Int row_start,
+                                                     HYPRE_Int row_end, HYPRE_Int want_data );
 hypre_ParCSRMatrix *hypre_CSRMatrixToParCSRMatrix ( MPI_Comm comm, hypre_CSRMatrix *A,
                                                     HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts );
 HYPRE_Int GenerateDiagAndOffd ( hypre_CSRMatrix *A, hypre_ParCSRMatrix *matrix,
@@ -578,6 +592,9 @@ hypre_ParCSRMatrix *hypre_ParCSRTMatMatKT( hypre_ParCSRMatrix  *A, hypre_ParCSRM
 hypre_ParCSRMatrix *hypre_ParCSRTMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B);
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A,
                                              hypre_ParCSRMatrix  *P, HYPRE_Int keepTranspose );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKTFused( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A,
+                                                  hypre_ParCSRMatrix  *P, HYPRE_Int keep_transpose,
+                                                  HYPRE_Int working_set );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A,
                                            hypre_ParCSRMatrix  *P );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTDevice( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
@@ -653,6 +670,21 @@ HYPRE_Int hypre_ParVectorElmdivpy( hypre_ParVector *x, hypre_ParVector *b, hypre
 HYPRE_Int hypre_ParVectorElmdivpyMarked( hypre_ParVector *x, hypre_ParVector *b,
                                          hypre_ParVector *y, HYPRE_Int *marker,
                                          HYPRE_Int marker_val );
+/* par_vector_ghost.c */
+HYPRE_Int hypre_ParVectorInitializeGhost ( hypre_ParVector *x, hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParVectorDestroyGhost ( hypre_ParVector *x );
+HYPRE_Int hypre_ParVectorGhostMatches ( hypre_ParVector *x, hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParVectorGhostPack ( hypre_ParVector *x );
+
+/* par_vector_pool.c */
+hypre_ParVectorPool *hypre_ParVectorPoolCreate ( void );
+HYPRE_Int hypre_ParVectorPoolDestroy ( hypre_ParVectorPool *pool );
+hypre_ParVector *hypre_ParVectorPoolAcquire ( hypre_ParVectorPool *pool, MPI_Comm comm,
+                                              HYPRE_BigInt global_size, HYPRE_BigInt *partitioning,
+                                              HYPRE_Int num_vectors,
+                                              HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_ParVectorPoolRelease ( hypre_ParVectorPool *pool, hypre_ParVector *vector );
+
 /* par_vector_device.c */
 HYPRE_Int hypre_ParVectorGetValuesDevice(hypre_ParVector *vector, HYPRE_Int num_values,
                                          HYPRE_BigInt *indices, HYPRE_BigInt base,
@@ -106,6 +106,14 @@ HYPRE_Int hypre_DenseBlockMatrixPrint(MPI_Comm, hypre_DenseBlockMatrix*, const c
 HYPRE_Int hypre_DenseBlockMatrixMultiply(hypre_DenseBlockMatrix*, hypre_DenseBlockMatrix*,
                                          hypre_DenseBlockMatrix**);
 
+/* dense_block_matinv.c */
+HYPRE_Int hypre_DenseBlockInvertBatched(HYPRE_Int, HYPRE_Int, HYPRE_Complex*);
+HYPRE_Int hypre_DenseBlockMatrixInvert(hypre_DenseBlockMatrix*);
+
+/* dense_block_matvec.c */
+HYPRE_Int hypre_DenseBlockMatvecBatched(HYPRE_Int, HYPRE_Int, HYPRE_Complex, HYPRE_Complex*,
+                                        HYPRE_Complex*, HYPRE_Complex*);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,539 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Batched inversion of small dense blocks
+ *
+ *****************************************************************************/
+
+#include "_hypre_seq_block_mv.h"
+
+/* Number of blocks processed simultaneously by the interleaved kernel */
+#define HYPRE_DENSE_BLOCK_BATCH 8
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockInvertBatched1
+ *
+ * The kernels below return the number of singular blocks.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_DenseBlockInvertBatched1( HYPRE_Int      num_blocks,
+                                HYPRE_Complex *data )
+{
+   HYPRE_Int  num_singular = 0;
+   HYPRE_Int  ib;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(ib) reduction(+:num_singular) HYPRE_SMP_SCHEDULE
+#endif
+   for (ib = 0; ib < num_blocks; ib++)
+   {
+      if (data[ib] == 0.0)
+      {
+         num_singular++;
+      }
+      data[ib] = 1.0 / data[ib];
+   }
+
+   return num_singular;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockInvertBatched2
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_DenseBlockInvertBatched2( HYPRE_Int      num_blocks,
+                                HYPRE_Complex *data )
+{
+   HYPRE_Int  num_singular = 0;
+   HYPRE_Int  ib;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(ib) reduction(+:num_singular) HYPRE_SMP_SCHEDULE
+#endif
+   for (ib = 0; ib < num_blocks; ib++)
+   {
+      HYPRE_Complex       *a   = data + 4 * ib;
+      const HYPRE_Complex  a11 = a[0], a12 = a[1];
+      const HYPRE_Complex  a21 = a[2], a22 = a[3];
+      const HYPRE_Complex  det = a11 * a22 - a12 * a21;
+      const HYPRE_Complex  det_inv = 1.0 / det;
+
+      if (det == 0.0)
+      {
+         num_singular++;
+      }
+
+      a[0] =  a22 * det_inv;
+      a[1] = -a12 * det_inv;
+      a[2] = -a21 * det_inv;
+      a[3] =  a11 * det_inv;
+   }
+
+   return num_singular;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockInvertBatched3
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_DenseBlockInvertBatched3( HYPRE_Int      num_blocks,
+                                HYPRE_Complex *data )
+{
+   HYPRE_Int  num_singular = 0;
+   HYPRE_Int  ib;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(ib) reduction(+:num_singular) HYPRE_SMP_SCHEDULE
+#endif
+   for (ib = 0; ib < num_blocks; ib++)
+   {
+      HYPRE_Complex       *a   = data + 9 * ib;
+      const HYPRE_Complex  a11 = a[0], a12 = a[1], a13 = a[2];
+      const HYPRE_Complex  a21 = a[3], a22 = a[4], a23 = a[5];
+      const HYPRE_Complex  a31 = a[6], a32 = a[7], a33 = a[8];
+
+      const HYPRE_Complex  det = a11 * a22 * a33 - a11 * a23 * a32 -
+                                 a12 * a21 * a33 + a12 * a23 * a31 +
+                                 a13 * a21 * a32 - a13 * a22 * a31;
+      const HYPRE_Complex  det_inv = 1.0 / det;
+
+      if (det == 0.0)
+      {
+         num_singular++;
+      }
+
+      a[0] = (a22 * a33 - a23 * a32) * det_inv;
+      a[1] = (a13 * a32 - a12 * a33) * det_inv;
+      a[2] = (a12 * a23 - a13 * a22) * det_inv;
+      a[3] = (a23 * a31 - a21 * a33) * det_inv;
+      a[4] = (a11 * a33 - a13 * a31) * det_inv;
+      a[5] = (a13 * a21 - a11 * a23) * det_inv;
+      a[6] = (a21 * a32 - a22 * a31) * det_inv;
+      a[7] = (a12 * a31 - a11 * a32) * det_inv;
+      a[8] = (a11 * a22 - a12 * a21) * det_inv;
+   }
+
+   return num_singular;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockInvertInterleaved
+ *
+ * Inverts nb <= HYPRE_DENSE_BLOCK_BATCH consecutive n x n blocks by
+ * Gauss-Jordan elimination with partial pivoting. The blocks are copied to
+ * the work array w with the block index running fastest, so that every
+ * step of the elimination is a loop over the blocks. Unused slots are set
+ * to the identity. Returns the number of singular blocks.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_DenseBlockInvertInterleaved( HYPRE_Int      nb,
+                                   HYPRE_Int      n,
+                                   HYPRE_Complex *data,
+                                   HYPRE_Complex *w,
+                                   HYPRE_Int     *piv )
+{
+   const HYPRE_Int  B  = HYPRE_DENSE_BLOCK_BATCH;
+   const HYPRE_Int  n2 = n * n;
+
+   HYPRE_Complex    s[HYPRE_DENSE_BLOCK_BATCH];
+   HYPRE_Complex    t;
+   HYPRE_Real       amax, aval;
+   HYPRE_Int        singular[HYPRE_DENSE_BLOCK_BATCH];
+   HYPRE_Int        num_singular = 0;
+   HYPRE_Int        b, i, j, k, p;
+
+   /* Interleave blocks */
+   for (b = 0; b < nb; b++)
+   {
+      for (i = 0; i < n2; i++)
+      {
+         w[i * B + b] = data[b * n2 + i];
+      }
+   }
+   for (b = 0; b < B; b++)
+   {
+      singular[b] = 0;
+   }
+   for (b = nb; b < B; b++)
+   {
+      for (i = 0; i < n; i++)
+      {
+         for (j = 0; j < n; j++)
+         {
+            w[(i * n + j) * B + b] = (i == j) ? 1.0 : 0.0;
+         }
+      }
+   }
+
+   for (k = 0; k < n; k++)
+   {
+      /* Find pivot rows and interchange them with row k */
+      for (b = 0; b < B; b++)
+      {
+         p    = k;
+         amax = hypre_cabs(w[(k * n + k) * B + b]);
+         for (i = k + 1; i < n; i++)
+         {
+            aval = hypre_cabs(w[(i * n + k) * B + b]);
+            if (aval > amax)
+            {
+               amax = aval;
+               p    = i;
+            }
+         }
+         piv[k * B + b] = p;
+         if (amax == 0.0)
+         {
+            singular[b] = 1;
+         }
+
+         if (p != k)
+         {
+            for (j = 0; j < n; j++)
+            {
+               t = w[(k * n + j) * B + b];
+               w[(k * n + j) * B + b] = w[(p * n + j) * B + b];
+               w[(p * n + j) * B + b] = t;
+            }
+         }
+      }
+
+      /* Scale pivot row */
+      for (b = 0; b < B; b++)
+      {
+         s[b] = 1.0 / w[(k * n + k) * B + b];
+         w[(k * n + k) * B + b] = 1.0;
+      }
+      for (j = 0; j < n; j++)
+      {
+         for (b = 0; b < B; b++)
+         {
+            w[(k * n + j) * B + b] *= s[b];
+         }
+      }
+
+      /* Eliminate column k from the remaining rows */
+      for (i = 0; i < n; i++)
+      {
+         if (i == k)
+         {
+            continue;
+         }
+
+         for (b = 0; b < B; b++)
+         {
+            s[b] = w[(i * n + k) * B + b];
+            w[(i * n + k) * B + b] = 0.0;
+         }
+         for (j = 0; j < n; j++)
+         {
+            for (b = 0; b < B; b++)
+            {
+               w[(i * n + j) * B + b] -= s[b] * w[(k * n + j) * B + b];
+            }
+         }
+      }
+   }
+
+   /* Undo row interchanges by swapping columns in reverse order */
+   for (k = n - 1; k >= 0; k--)
+   {
+      for (b = 0; b < B; b++)
+      {
+         p = piv[k * B + b];
+         if (p != k)
+         {
+            for (i = 0; i < n; i++)
+            {
+               t = w[(i * n + k) * B + b];
+               w[(i * n + k) * B + b] = w[(i * n + p) * B + b];
+               w[(i * n + p) * B + b] = t;
+            }
+         }
+      }
+   }
+
+   /* De-interleave blocks */
+   for (b = 0; b < nb; b++)
+   {
+      for (i = 0; i < n2; i++)
+      {
+         data[b * n2 + i] = w[i * B + b];
+      }
+      num_singular += singular[b];
+   }
+
+   return num_singular;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockInvertBatchedN
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_DenseBlockInvertBatchedN( HYPRE_Int      num_blocks,
+                                HYPRE_Int      blk_size,
+                                HYPRE_Complex *data )
+{
+   const HYPRE_Int  B           = HYPRE_DENSE_BLOCK_BATCH;
+   const HYPRE_Int  bs2         = blk_size * blk_size;
+   HYPRE_Int        num_chunks  = (num_blocks + B - 1) / B;
+   HYPRE_Int        num_threads = hypre_NumThreads();
+   HYPRE_Complex   *work;
+   HYPRE_Int       *piv;
+   HYPRE_Int        num_singular = 0;
+
+   work = hypre_TAlloc(HYPRE_Complex, num_threads * bs2 * B, HYPRE_MEMORY_HOST);
+   piv  = hypre_TAlloc(HYPRE_Int, num_threads * blk_size * B, HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel reduction(+:num_singular)
+#endif
+   {
+      HYPRE_Int  my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int  ic, nb;
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (ic = 0; ic < num_chunks; ic++)
+      {
+         nb = hypre_min(B, num_blocks - ic * B);
+         num_singular += hypre_DenseBlockInvertInterleaved(nb, blk_size, data + ic * B * bs2,
+                                                           work + my_thread_num * bs2 * B,
+                                                           piv + my_thread_num * blk_size * B);
+      }
+   }
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+   hypre_TFree(piv, HYPRE_MEMORY_HOST);
+
+   return num_singular;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockInvertBatched
+ *
+ * Inverts in-place num_blocks consecutive dense blocks of size
+ * blk_size x blk_size stored in data. Since inv(A^T) = inv(A)^T, the blocks
+ * may be stored either by rows or by columns.
+ *
+ * 2x2 and 3x3 blocks are inverted with closed-form expressions, larger
+ * blocks with Gauss-Jordan elimination with partial pivoting applied to
+ * groups of blocks at once. Singular blocks (zero determinant or zero
+ * pivot column) are reported with a generic error; their entries are
+ * left as computed, i.e., contain Inf/NaN.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_DenseBlockInvertBatched( HYPRE_Int      num_blocks,
+                               HYPRE_Int      blk_size,
+                               HYPRE_Complex *data )
+{
+   HYPRE_Int  num_singular;
+   char       msg[HYPRE_MAX_MSG_LEN];
+
+   if (num_blocks <= 0 || blk_size <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   switch (blk_size)
+   {
+      case 1:
+         num_singular = hypre_DenseBlockInvertBatched1(num_blocks, data);
+         break;
+
+      case 2:
+         num_singular = hypre_DenseBlockInvertBatched2(num_blocks, data);
+         break;
+
+      case 3:
+         num_singular = hypre_DenseBlockInvertBatched3(num_blocks, data);
+         break;
+
+      default:
+         num_singular = hypre_DenseBlockInvertBatchedN(num_blocks, blk_size, data);
+         break;
+   }
+
+   if (num_singular > 0)
+   {
+      hypre_sprintf(msg, "%d of %d blocks of size %d are singular",
+                    num_singular, num_blocks, blk_size);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+   }
+
+   return hypre_error_flag;
+}
+
+#if defined(HYPRE_USING_GPU)
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockMatrixInvertDevice
+ *
+ * Device counterpart of hypre_DenseBlockInvertBatched based on the vendor
+ * batched LU routines (getrf + getri). These assume column-major blocks,
+ * which is immaterial here since inv(A^T) = inv(A)^T. Without vendor
+ * support for batched LU, the blocks are inverted on the host.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_DenseBlockMatrixInvertDevice( hypre_DenseBlockMatrix *A )
+{
+   HYPRE_Int        num_blocks   = hypre_DenseBlockMatrixNumBlocks(A);
+   HYPRE_Int        blk_size     = hypre_DenseBlockMatrixNumRowsBlock(A);
+   HYPRE_Int        num_nonzeros = hypre_DenseBlockMatrixNumNonzeros(A);
+   HYPRE_Complex   *data         = hypre_DenseBlockMatrixData(A);
+
+#if defined(HYPRE_USING_CUBLAS) || defined(HYPRE_USING_ROCSOLVER)
+   HYPRE_Complex   *tmpdata;
+   HYPRE_Complex  **tmpdata_aop;
+   HYPRE_Int       *pivots;
+   HYPRE_Int       *info;
+   HYPRE_Int       *h_info;
+   HYPRE_Int        num_singular = 0;
+   HYPRE_Int        ib;
+   char             msg[HYPRE_MAX_MSG_LEN];
+
+   if (num_blocks <= 0 || blk_size <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Memory allocation */
+   tmpdata     = hypre_TAlloc(HYPRE_Complex, num_nonzeros, HYPRE_MEMORY_DEVICE);
+   tmpdata_aop = hypre_TAlloc(HYPRE_Complex *, num_blocks, HYPRE_MEMORY_DEVICE);
+   pivots      = hypre_CTAlloc(HYPRE_Int, num_blocks * blk_size, HYPRE_MEMORY_DEVICE);
+   info        = hypre_CTAlloc(HYPRE_Int, num_blocks, HYPRE_MEMORY_DEVICE);
+   h_info      = hypre_TAlloc(HYPRE_Int, num_blocks, HYPRE_MEMORY_HOST);
+
+   /* LU factorization is computed on a copy of the blocks */
+   hypre_TMemcpy(tmpdata, data, HYPRE_Complex, num_nonzeros,
+                 HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_DEVICE);
+   hypreDevice_ComplexArrayToArrayOfPtrs(num_blocks, blk_size * blk_size,
+                                         tmpdata, tmpdata_aop);
+
+#if defined(HYPRE_USING_CUBLAS)
+   hypre_DenseBlockMatrixBuildAOP(A);
+
+   HYPRE_CUBLAS_CALL(hypre_cublas_getrfBatched(hypre_HandleCublasHandle(hypre_handle()),
+                                               blk_size,
+                                               tmpdata_aop,
+                                               blk_size,
+                                               pivots,
+                                               info,
+                                               num_blocks));
+   hypre_TMemcpy(h_info, info, HYPRE_Int, num_blocks, HYPRE_MEMORY_HOST, HYPRE_MEMORY_DEVICE);
+
+   HYPRE_CUBLAS_CALL(hypre_cublas_getriBatched(hypre_HandleCublasHandle(hypre_handle()),
+                                               blk_size,
+                                               (const HYPRE_Real **) tmpdata_aop,
+                                               blk_size,
+                                               pivots,
+                                               hypre_DenseBlockMatrixDataAOP(A),
+                                               blk_size,
+                                               info,
+                                               num_blocks));
+#else
+   HYPRE_ROCSOLVER_CALL(rocsolver_dgetrf_batched(hypre_HandleVendorSolverHandle(hypre_handle()),
+                                                 blk_size,
+                                                 blk_size,
+                                                 tmpdata_aop,
+                                                 blk_size,
+                                                 pivots,
+                                                 blk_size,
+                                                 info,
+                                                 num_blocks));
+   hypre_TMemcpy(h_info, info, HYPRE_Int, num_blocks, HYPRE_MEMORY_HOST, HYPRE_MEMORY_DEVICE);
+
+   /* rocSOLVER inverts in-place */
+   HYPRE_ROCSOLVER_CALL(rocsolver_dgetri_batched(hypre_HandleVendorSolverHandle(hypre_handle()),
+                                                 blk_size,
+                                                 tmpdata_aop,
+                                                 blk_size,
+                                                 pivots,
+                                                 blk_size,
+                                                 info,
+                                                 num_blocks));
+   hypre_TMemcpy(data, tmpdata, HYPRE_Complex, num_nonzeros,
+                 HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_DEVICE);
+#endif
+
+   /* A positive info value flags an exactly zero pivot of U */
+   for (ib = 0; ib < num_blocks; ib++)
+   {
+      if (h_info[ib] > 0)
+      {
+         num_singular++;
+      }
+   }
+
+   if (num_singular > 0)
+   {
+      hypre_sprintf(msg, "%d of %d blocks of size %d are singular",
+                    num_singular, num_blocks, blk_size);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+   }
+
+   /* Free memory */
+   hypre_TFree(tmpdata, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(tmpdata_aop, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(pivots, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(info, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(h_info, HYPRE_MEMORY_HOST);
+
+#else
+   HYPRE_UNUSED_VAR(num_nonzeros);
+   HYPRE_UNUSED_VAR(data);
+
+   hypre_DenseBlockMatrixMigrate(A, HYPRE_MEMORY_HOST);
+   hypre_DenseBlockInvertBatched(num_blocks, blk_size, hypre_DenseBlockMatrixData(A));
+   hypre_DenseBlockMatrixMigrate(A, HYPRE_MEMORY_DEVICE);
+#endif
+
+   return hypre_error_flag;
+}
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockMatrixInvert
+ *
+ * Inverts in-place each block of a dense block matrix with square blocks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_DenseBlockMatrixInvert( hypre_DenseBlockMatrix *A )
+{
+   if (hypre_DenseBlockMatrixNumRowsBlock(A) != hypre_DenseBlockMatrixNumColsBlock(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "local rows(A) != local cols(A)");
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(hypre_DenseBlockMatrixMemoryLocation(A));
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      hypre_DenseBlockMatrixInvertDevice(A);
+   }
+   else
+#endif
+   {
+      hypre_DenseBlockInvertBatched(hypre_DenseBlockMatrixNumBlocks(A),
+                                    hypre_DenseBlockMatrixNumRowsBlock(A),
+                                    hypre_DenseBlockMatrixData(A));
+   }
+
+   return hypre_error_flag;
+}
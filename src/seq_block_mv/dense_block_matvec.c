@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Batched matrix-vector products with small dense blocks
+ *
+ *****************************************************************************/
+
+#include "_hypre_seq_block_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseBlockMatvecBatched
+ *
+ * Computes y_b += alpha * A_b * x_b for num_blocks consecutive dense blocks
+ * A_b of size blk_size x blk_size stored by rows in data, where x_b and y_b
+ * are the b-th chunks of length blk_size of x and y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_DenseBlockMatvecBatched( HYPRE_Int      num_blocks,
+                               HYPRE_Int      blk_size,
+                               HYPRE_Complex  alpha,
+                               HYPRE_Complex *data,
+                               HYPRE_Complex *x,
+                               HYPRE_Complex *y )
+{
+   const HYPRE_Int  bs2 = blk_size * blk_size;
+   HYPRE_Int        ib;
+
+   if (blk_size == 2)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(ib) HYPRE_SMP_SCHEDULE
+#endif
+      for (ib = 0; ib < num_blocks; ib++)
+      {
+         const HYPRE_Complex *a  = data + 4 * ib;
+         const HYPRE_Complex  x0 = x[2 * ib], x1 = x[2 * ib + 1];
+
+         y[2 * ib]     += alpha * a[0] * x0;
+         y[2 * ib]     += alpha * a[1] * x1;
+         y[2 * ib + 1] += alpha * a[2] * x0;
+         y[2 * ib + 1] += alpha * a[3] * x1;
+      }
+   }
+   else if (blk_size == 3)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(ib) HYPRE_SMP_SCHEDULE
+#endif
+      for (ib = 0; ib < num_blocks; ib++)
+      {
+         const HYPRE_Complex *a  = data + 9 * ib;
+         const HYPRE_Complex  x0 = x[3 * ib], x1 = x[3 * ib + 1], x2 = x[3 * ib + 2];
+
+         y[3 * ib]     += alpha * a[0] * x0;
+         y[3 * ib]     += alpha * a[1] * x1;
+         y[3 * ib]     += alpha * a[2] * x2;
+         y[3 * ib + 1] += alpha * a[3] * x0;
+         y[3 * ib + 1] += alpha * a[4] * x1;
+         y[3 * ib + 1] += alpha * a[5] * x2;
+         y[3 * ib + 2] += alpha * a[6] * x0;
+         y[3 * ib + 2] += alpha * a[7] * x1;
+         y[3 * ib + 2] += alpha * a[8] * x2;
+      }
+   }
+   else
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(ib) HYPRE_SMP_SCHEDULE
+#endif
+      for (ib = 0; ib < num_blocks; ib++)
+      {
+         const HYPRE_Complex *a  = data + ib * bs2;
+         const HYPRE_Complex *xb = x + ib * blk_size;
+         HYPRE_Complex       *yb = y + ib * blk_size;
+         HYPRE_Int            i, j;
+
+         for (i = 0; i < blk_size; i++)
+         {
+            for (j = 0; j < blk_size; j++)
+            {
+               yb[i] += alpha * a[i * blk_size + j] * xb[j];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -22,3 +22,11 @@ HYPRE_Int hypre_DenseBlockMatrixPrint(MPI_Comm, hypre_DenseBlockMatrix*, const c
 /* dense_block_matmult.c */
 HYPRE_Int hypre_DenseBlockMatrixMultiply(hypre_DenseBlockMatrix*, hypre_DenseBlockMatrix*,
                                          hypre_DenseBlockMatrix**);
+
+/* dense_block_matinv.c */
+HYPRE_Int hypre_DenseBlockInvertBatched(HYPRE_Int, HYPRE_Int, HYPRE_Complex*);
+HYPRE_Int hypre_DenseBlockMatrixInvert(hypre_DenseBlockMatrix*);
+
+/* dense_block_matvec.c */
+HYPRE_Int hypre_DenseBlockMatvecBatched(HYPRE_Int, HYPRE_Int, HYPRE_Complex, HYPRE_Complex*,
+                                        HYPRE_Complex*, HYPRE_Complex*);
@@ -949,6 +949,531 @@ hypre_CSRMatrixMultiply( hypre_CSRMatrix *A,
    return C;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTripleMultiplyRowHost
+ *
+ * Accumulates row i of A * B in the open addressing hash table
+ * (ht_keys, ht_vals), growing it if needed. On return, ht_used holds the
+ * num_used slots that were filled.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixTripleMultiplyRowHost( HYPRE_Int       i,
+                                      HYPRE_Int      *A_i,
+                                      HYPRE_Int      *A_j,
+                                      HYPRE_Complex  *A_data,
+                                      HYPRE_Int      *B_i,
+                                      HYPRE_Int      *B_j,
+                                      HYPRE_Complex  *B_data,
+                                      HYPRE_Int     **ht_keys_ptr,
+                                      HYPRE_Complex **ht_vals_ptr,
+                                      HYPRE_Int     **ht_used_ptr,
+                                      HYPRE_Int      *ht_size_ptr,
+                                      HYPRE_Int      *num_used_ptr )
+{
+   HYPRE_Int     *ht_keys  = *ht_keys_ptr;
+   HYPRE_Complex *ht_vals  = *ht_vals_ptr;
+   HYPRE_Int     *ht_used  = *ht_used_ptr;
+   HYPRE_Int      ht_size  = *ht_size_ptr;
+   HYPRE_Int      num_used = 0;
+   HYPRE_Int      bound    = 0;
+
+   HYPRE_Int      ia, ib, ja, jb, h;
+   HYPRE_Complex  a_entry;
+
+   /* Upper bound on the row length of A * B, keep the table at most half full */
+   for (ia = A_i[i]; ia < A_i[i + 1]; ia++)
+   {
+      ja = A_j[ia];
+      bound += B_i[ja + 1] - B_i[ja];
+   }
+
+   if (2 * bound > ht_size)
+   {
+      hypre_TFree(ht_keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(ht_vals, HYPRE_MEMORY_HOST);
+      hypre_TFree(ht_used, HYPRE_MEMORY_HOST);
+
+      ht_size = hypre_max(ht_size, 64);
+      while (ht_size < 2 * bound)
+      {
+         ht_size *= 2;
+      }
+
+      ht_keys = hypre_TAlloc(HYPRE_Int, ht_size, HYPRE_MEMORY_HOST);
+      ht_vals = hypre_TAlloc(HYPRE_Complex, ht_size, HYPRE_MEMORY_HOST);
+      ht_used = hypre_TAlloc(HYPRE_Int, ht_size / 2, HYPRE_MEMORY_HOST);
+      for (h = 0; h < ht_size; h++)
+      {
+         ht_keys[h] = -1;
+      }
+
+      *ht_keys_ptr = ht_keys;
+      *ht_vals_ptr = ht_vals;
+      *ht_used_ptr = ht_used;
+      *ht_size_ptr = ht_size;
+   }
+
+   for (ia = A_i[i]; ia < A_i[i + 1]; ia++)
+   {
+      ja      = A_j[ia];
+      a_entry = A_data[ia];
+      for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+      {
+         jb = B_j[ib];
+         h  = (HYPRE_Int) (((hypre_uint) jb * 2654435761U) & (hypre_uint) (ht_size - 1));
+         while (ht_keys[h] != -1 && ht_keys[h] != jb)
+         {
+            h = (h + 1) & (ht_size - 1);
+         }
+
+         if (ht_keys[h] == -1)
+         {
+            ht_keys[h] = jb;
+            ht_vals[h] = a_entry * B_data[ib];
+            ht_used[num_used++] = h;
+         }
+         else
+         {
+            ht_vals[h] += a_entry * B_data[ib];
+         }
+      }
+   }
+
+   *num_used_ptr = num_used;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTripleMultiplyRowsHost
+ *
+ * Computes the rows of D = A * B * C that correspond to the rows of A, which
+ * may be a block of rows of a larger matrix: row i of A is row first_row + i
+ * of D. Row i of A * B is accumulated in a per-thread hash table and
+ * immediately multiplied by C; the columns of the resulting row of D are
+ * tracked in a second per-thread hash table. Both tables are sized by the
+ * longest row, so the scratch space does not depend on the size of B or C.
+ *
+ * If D_j is NULL, only the row lengths are computed and stored in
+ * D_i[first_row + i + 1]. Otherwise, the rows are written to D_j and D_data
+ * starting at D_i[first_row + i]. If square is nonzero, the diagonal entry of
+ * each row is stored first. Entries appear in the order they are first
+ * touched, as in hypre_CSRMatrixMultiplyHost.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixTripleMultiplyRowsHost( hypre_CSRMatrix *A,
+                                       hypre_CSRMatrix *B,
+                                       hypre_CSRMatrix *C,
+                                       HYPRE_Int        first_row,
+                                       HYPRE_Int        square,
+                                       HYPRE_Int       *D_i,
+                                       HYPRE_Int       *D_j,
+                                       HYPRE_Complex   *D_data )
+{
+   HYPRE_Complex  *A_data  = hypre_CSRMatrixData(A);
+   HYPRE_Int      *A_i     = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j     = hypre_CSRMatrixJ(A);
+   HYPRE_Int       nrows_A = hypre_CSRMatrixNumRows(A);
+
+   HYPRE_Complex  *B_data  = hypre_CSRMatrixData(B);
+   HYPRE_Int      *B_i     = hypre_CSRMatrixI(B);
+   HYPRE_Int      *B_j     = hypre_CSRMatrixJ(B);
+
+   HYPRE_Complex  *C_data  = hypre_CSRMatrixData(C);
+   HYPRE_Int      *C_i     = hypre_CSRMatrixI(C);
+   HYPRE_Int      *C_j     = hypre_CSRMatrixJ(C);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int     *ht_keys = NULL;
+      HYPRE_Complex *ht_vals = NULL;
+      HYPRE_Int     *ht_used = NULL;
+      HYPRE_Int      ht_size = 0;
+      HYPRE_Int     *dt_keys = NULL;
+      HYPRE_Int     *dt_pos  = NULL;
+      HYPRE_Int     *dt_used = NULL;
+      HYPRE_Int      dt_size = 0;
+      HYPRE_Int      num_used, dt_num_used;
+      HYPRE_Int      ns, ne, ii, i, k, h, ic, jb, jc, row;
+      HYPRE_Int      bound, counter;
+      HYPRE_Complex  ab_entry;
+
+      ii = hypre_GetThreadNum();
+      hypre_partition1D(nrows_A, hypre_NumActiveThreads(), ii, &ns, &ne);
+
+      for (i = ns; i < ne; i++)
+      {
+         row = first_row + i;
+
+         hypre_CSRMatrixTripleMultiplyRowHost(i, A_i, A_j, A_data, B_i, B_j, B_data,
+                                              &ht_keys, &ht_vals, &ht_used,
+                                              &ht_size, &num_used);
+
+         /* Upper bound on the row length of D, keep the table at most half full */
+         bound = square ? 1 : 0;
+         for (k = 0; k < num_used; k++)
+         {
+            jb = ht_keys[ht_used[k]];
+            bound += C_i[jb + 1] - C_i[jb];
+         }
+
+         if (2 * bound > dt_size)
+         {
+            hypre_TFree(dt_keys, HYPRE_MEMORY_HOST);
+            hypre_TFree(dt_pos, HYPRE_MEMORY_HOST);
+            hypre_TFree(dt_used, HYPRE_MEMORY_HOST);
+
+            dt_size = hypre_max(dt_size, 64);
+            while (dt_size < 2 * bound)
+            {
+               dt_size *= 2;
+            }
+
+            dt_keys = hypre_TAlloc(HYPRE_Int, dt_size, HYPRE_MEMORY_HOST);
+            dt_pos  = hypre_TAlloc(HYPRE_Int, dt_size, HYPRE_MEMORY_HOST);
+            dt_used = hypre_TAlloc(HYPRE_Int, dt_size / 2, HYPRE_MEMORY_HOST);
+            for (h = 0; h < dt_size; h++)
+            {
+               dt_keys[h] = -1;
+            }
+         }
+
+         dt_num_used = 0;
+         counter     = D_j ? D_i[row] : 0;
+         if (square)
+         {
+            h = (HYPRE_Int) (((hypre_uint) row * 2654435761U) & (hypre_uint) (dt_size - 1));
+            dt_keys[h] = row;
+            dt_pos[h]  = counter;
+            dt_used[dt_num_used++] = h;
+            if (D_j)
+            {
+               D_j[counter]    = row;
+               D_data[counter] = 0.0;
+            }
+            counter++;
+         }
+
+         for (k = 0; k < num_used; k++)
+         {
+            h        = ht_used[k];
+            jb       = ht_keys[h];
+            ab_entry = ht_vals[h];
+            for (ic = C_i[jb]; ic < C_i[jb + 1]; ic++)
+            {
+               jc = C_j[ic];
+               h  = (HYPRE_Int) (((hypre_uint) jc * 2654435761U) & (hypre_uint) (dt_size - 1));
+               while (dt_keys[h] != -1 && dt_keys[h] != jc)
+               {
+                  h = (h + 1) & (dt_size - 1);
+               }
+
+               if (dt_keys[h] == -1)
+               {
+                  dt_keys[h] = jc;
+                  dt_pos[h]  = counter;
+                  dt_used[dt_num_used++] = h;
+                  if (D_j)
+                  {
+                     D_j[counter]    = jc;
+                     D_data[counter] = ab_entry * C_data[ic];
+                  }
+                  counter++;
+               }
+               else if (D_j)
+               {
+                  D_data[dt_pos[h]] += ab_entry * C_data[ic];
+               }
+            }
+            ht_keys[ht_used[k]] = -1;
+         }
+
+         for (k = 0; k < dt_num_used; k++)
+         {
+            dt_keys[dt_used[k]] = -1;
+         }
+
+         if (!D_j)
+         {
+            D_i[row + 1] = counter;
+         }
+      }
+
+      hypre_TFree(ht_keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(ht_vals, HYPRE_MEMORY_HOST);
+      hypre_TFree(ht_used, HYPRE_MEMORY_HOST);
+      hypre_TFree(dt_keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(dt_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(dt_used, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTripleMultiplyHost
+ *
+ * Computes D = A * B * C one row at a time (see
+ * hypre_CSRMatrixTripleMultiplyRowsHost), so neither A * B nor B * C is ever
+ * stored. Besides D, each thread only needs hash tables sized by the longest
+ * row of A * B and of D. For Galerkin products (A = P^T, B = A, C = P), this
+ * replaces the storage of A * P and any work arrays over the fine or coarse
+ * grid.
+ *
+ * As in hypre_CSRMatrixMultiplyHost, the diagonal entry of each row is
+ * stored first when D is square.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixTripleMultiplyHost( hypre_CSRMatrix *A,
+                                   hypre_CSRMatrix *B,
+                                   hypre_CSRMatrix *C )
+{
+   HYPRE_Int             nrows_A   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int             ncols_A   = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int             num_nnz_A = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Int             nrows_B   = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int             ncols_B   = hypre_CSRMatrixNumCols(B);
+   HYPRE_Int             num_nnz_B = hypre_CSRMatrixNumNonzeros(B);
+   HYPRE_Int             nrows_C   = hypre_CSRMatrixNumRows(C);
+   HYPRE_Int             ncols_C   = hypre_CSRMatrixNumCols(C);
+   HYPRE_Int             num_nnz_C = hypre_CSRMatrixNumNonzeros(C);
+
+   HYPRE_MemoryLocation  memory_location_D = hypre_max(hypre_CSRMatrixMemoryLocation(A),
+                                                       hypre_CSRMatrixMemoryLocation(C));
+
+   hypre_CSRMatrix      *D;
+   HYPRE_Int            *D_i;
+   HYPRE_Int             i;
+
+   if (ncols_A != nrows_B || ncols_B != nrows_C)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Warning! incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   if ((num_nnz_A == 0) || (num_nnz_B == 0) || (num_nnz_C == 0))
+   {
+      D = hypre_CSRMatrixCreate(nrows_A, ncols_C, 0);
+      hypre_CSRMatrixNumRownnz(D) = 0;
+      hypre_CSRMatrixInitialize_v2(D, 0, memory_location_D);
+
+      return D;
+   }
+
+   /* First pass: compute sizes of D rows */
+   D_i = hypre_CTAlloc(HYPRE_Int, nrows_A + 1, memory_location_D);
+   hypre_CSRMatrixTripleMultiplyRowsHost(A, B, C, 0, nrows_A == ncols_C, D_i, NULL, NULL);
+   for (i = 0; i < nrows_A; i++)
+   {
+      D_i[i + 1] += D_i[i];
+   }
+
+   D = hypre_CSRMatrixCreate(nrows_A, ncols_C, D_i[nrows_A]);
+   hypre_CSRMatrixI(D) = D_i;
+   hypre_CSRMatrixInitialize_v2(D, 0, memory_location_D);
+
+   /* Second pass: fill in D_data and D_j */
+   hypre_CSRMatrixTripleMultiplyRowsHost(A, B, C, 0, nrows_A == ncols_C, D_i,
+                                         hypre_CSRMatrixJ(D), hypre_CSRMatrixData(D));
+
+   /* Set rownnz and num_rownnz */
+   hypre_CSRMatrixSetRownnz(D);
+
+   return D;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTransposeColumnBlockHost
+ *
+ * Stores rows first_row to first_row + nrows_AT - 1 of A^T in AT, whose
+ * arrays must have room for them. AT_offsets holds the prefix sums of the
+ * column counts of A. The entries of each row of AT are ordered by row of A,
+ * as in hypre_CSRMatrixTransposeHost.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixTransposeColumnBlockHost( hypre_CSRMatrix *A,
+                                         HYPRE_Int       *AT_offsets,
+                                         HYPRE_Int        first_row,
+                                         HYPRE_Int        nrows_AT,
+                                         hypre_CSRMatrix *AT )
+{
+   HYPRE_Complex  *A_data    = hypre_CSRMatrixData(A);
+   HYPRE_Int      *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int       nrows_A   = hypre_CSRMatrixNumRows(A);
+
+   HYPRE_Complex  *AT_data   = hypre_CSRMatrixData(AT);
+   HYPRE_Int      *AT_i      = hypre_CSRMatrixI(AT);
+   HYPRE_Int      *AT_j      = hypre_CSRMatrixJ(AT);
+   HYPRE_Int       last_row  = first_row + nrows_AT;
+   HYPRE_Int       offset    = AT_offsets[first_row];
+
+   HYPRE_Int       i, j, k, pos;
+
+   for (k = 0; k <= nrows_AT; k++)
+   {
+      AT_i[k] = AT_offsets[first_row + k] - offset;
+   }
+
+   for (i = 0; i < nrows_A; i++)
+   {
+      for (j = A_i[i]; j < A_i[i + 1]; j++)
+      {
+         k = A_j[j];
+         if (k >= first_row && k < last_row)
+         {
+            pos          = AT_i[k - first_row]++;
+            AT_j[pos]    = i;
+            AT_data[pos] = A_data[j];
+         }
+      }
+   }
+
+   /* Shift AT_i back */
+   for (k = nrows_AT; k > 0; k--)
+   {
+      AT_i[k] = AT_i[k - 1];
+   }
+   AT_i[0] = 0;
+
+   hypre_CSRMatrixNumRows(AT)     = nrows_AT;
+   hypre_CSRMatrixNumNonzeros(AT) = AT_i[nrows_AT];
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTripleMultiplyTHost
+ *
+ * Computes D = A^T * B * C like hypre_CSRMatrixTripleMultiplyHost, without
+ * forming A^T as a whole. A^T is built in blocks of consecutive rows with at
+ * most max_block_nnz nonzeros each (a block holds at least one row), and the
+ * rows of D are computed block by block. Only one block of A^T is stored at
+ * a time, so the working set besides D and the column counts of A is
+ * bounded by max_block_nnz and the longest row of A^T * B and of D.
+ *
+ * Each block is built twice, once for each pass over D. With
+ * max_block_nnz <= 0, A^T is built in one block.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixTripleMultiplyTHost( hypre_CSRMatrix *A,
+                                    hypre_CSRMatrix *B,
+                                    hypre_CSRMatrix *C,
+                                    HYPRE_Int        max_block_nnz )
+{
+   HYPRE_Int            *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int             nrows_A   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int             ncols_A   = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int             num_nnz_A = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Int             nrows_B   = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int             ncols_B   = hypre_CSRMatrixNumCols(B);
+   HYPRE_Int             num_nnz_B = hypre_CSRMatrixNumNonzeros(B);
+   HYPRE_Int             nrows_C   = hypre_CSRMatrixNumRows(C);
+   HYPRE_Int             ncols_C   = hypre_CSRMatrixNumCols(C);
+   HYPRE_Int             num_nnz_C = hypre_CSRMatrixNumNonzeros(C);
+   HYPRE_Int             square    = (ncols_A == ncols_C);
+
+   HYPRE_MemoryLocation  memory_location_D = hypre_max(hypre_CSRMatrixMemoryLocation(A),
+                                                       hypre_CSRMatrixMemoryLocation(C));
+
+   hypre_CSRMatrix      *D;
+   HYPRE_Int            *D_i;
+   hypre_CSRMatrix      *AT;
+   HYPRE_Int            *AT_offsets;
+   HYPRE_Int             block_nnz, block_rows;
+   HYPRE_Int             i, first, last, pass;
+
+   if (nrows_A != nrows_B || ncols_B != nrows_C)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Warning! incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   if ((num_nnz_A == 0) || (num_nnz_B == 0) || (num_nnz_C == 0))
+   {
+      D = hypre_CSRMatrixCreate(ncols_A, ncols_C, 0);
+      hypre_CSRMatrixNumRownnz(D) = 0;
+      hypre_CSRMatrixInitialize_v2(D, 0, memory_location_D);
+
+      return D;
+   }
+
+   if (max_block_nnz <= 0)
+   {
+      max_block_nnz = num_nnz_A;
+   }
+
+   /* Row offsets of A^T */
+   AT_offsets = hypre_CTAlloc(HYPRE_Int, ncols_A + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_nnz_A; i++)
+   {
+      AT_offsets[A_j[i] + 1]++;
+   }
+   for (i = 0; i < ncols_A; i++)
+   {
+      AT_offsets[i + 1] += AT_offsets[i];
+   }
+
+   /* Size the block storage by the largest block */
+   block_nnz  = 0;
+   block_rows = 0;
+   for (first = 0; first < ncols_A; first = last)
+   {
+      last = first + 1;
+      while (last < ncols_A && AT_offsets[last + 1] - AT_offsets[first] <= max_block_nnz)
+      {
+         last++;
+      }
+      block_nnz  = hypre_max(block_nnz, AT_offsets[last] - AT_offsets[first]);
+      block_rows = hypre_max(block_rows, last - first);
+   }
+
+   AT = hypre_CSRMatrixCreate(block_rows, nrows_A, block_nnz);
+   hypre_CSRMatrixInitialize_v2(AT, 0, HYPRE_MEMORY_HOST);
+
+   D_i = hypre_CTAlloc(HYPRE_Int, ncols_A + 1, memory_location_D);
+   D   = NULL;
+
+   /* First pass: compute sizes of D rows; second pass: fill in D_data and D_j */
+   for (pass = 0; pass < 2; pass++)
+   {
+      if (pass)
+      {
+         for (i = 0; i < ncols_A; i++)
+         {
+            D_i[i + 1] += D_i[i];
+         }
+
+         D = hypre_CSRMatrixCreate(ncols_A, ncols_C, D_i[ncols_A]);
+         hypre_CSRMatrixI(D) = D_i;
+         hypre_CSRMatrixInitialize_v2(D, 0, memory_location_D);
+      }
+
+      for (first = 0; first < ncols_A; first = last)
+      {
+         last = first + 1;
+         while (last < ncols_A && AT_offsets[last + 1] - AT_offsets[first] <= max_block_nnz)
+         {
+            last++;
+         }
+
+         hypre_CSRMatrixTransposeColumnBlockHost(A, AT_offsets, first, last - first, AT);
+         hypre_CSRMatrixTripleMultiplyRowsHost(AT, B, C, first, square, D_i,
+                                               pass ? hypre_CSRMatrixJ(D) : NULL,
+                                               pass ? hypre_CSRMatrixData(D) : NULL);
+      }
+   }
+
+   /* Set rownnz and num_rownnz */
+   hypre_CSRMatrixSetRownnz(D);
+
+   hypre_CSRMatrixDestroy(AT);
+   hypre_TFree(AT_offsets, HYPRE_MEMORY_HOST);
+
+   return D;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixDeleteZeros
  *--------------------------------------------------------------------------*/
@@ -1036,13 +1561,19 @@ transpose_idx (HYPRE_Int idx, HYPRE_Int dim1, HYPRE_Int dim2)
 }
 
 /*--------------------------------------------------------------------------
- * hypre_CSRMatrixTransposeHost
+ * hypre_CSRMatrixTransposePermHost
+ *
+ * Computes AT = A^T. If perm is not NULL, it must have room for the number
+ * of nonzeros of A and, on output, it holds the position in A of each
+ * nonzero of AT, i.e., AT_data[k] = A_data[perm[k]]. This allows one to
+ * refresh the values of AT without recomputing its sparsity pattern.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
-hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
-                             hypre_CSRMatrix **AT,
-                             HYPRE_Int         data)
+hypre_CSRMatrixTransposePermHost(hypre_CSRMatrix  *A,
+                                 hypre_CSRMatrix **AT,
+                                 HYPRE_Int         data,
+                                 HYPRE_Int        *perm)
 
 {
    HYPRE_Complex        *A_data     = hypre_CSRMatrixData(A);
@@ -1231,6 +1762,10 @@ hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
                offset = bucket[ii * num_cols_A + idx];
                AT_data[offset] = A_data[j];
                AT_j[offset] = ir;
+               if (perm)
+               {
+                  perm[offset] = j;
+               }
             }
          }
       }
@@ -1246,6 +1781,10 @@ hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
 
                offset = bucket[ii * num_cols_A + idx];
                AT_j[offset] = ir;
+               if (perm)
+               {
+                  perm[offset] = j;
+               }
             }
          }
       }
@@ -1268,6 +1807,18 @@ hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTransposeHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
+                             hypre_CSRMatrix **AT,
+                             HYPRE_Int         data)
+{
+   return hypre_CSRMatrixTransposePermHost(A, AT, data, NULL);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixTranspose
  *--------------------------------------------------------------------------*/
@@ -44,6 +44,12 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
 
+   hypre_CSRMatrixMatvecNumParts(matrix)  = 0;
+   hypre_CSRMatrixMatvecPartRows(matrix)  = NULL;
+   hypre_CSRMatrixMatvecPartNnzs(matrix)  = NULL;
+   hypre_CSRMatrixMatvecSplitRows(matrix) = 0;
+   hypre_CSRMatrixMatvecCarry(matrix)     = NULL;
+
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
    hypre_CSRMatrixSortedJ(matrix)        = NULL;
    hypre_CSRMatrixSortedData(matrix)     = NULL;
@@ -76,6 +82,10 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
       }
 
+      hypre_TFree(hypre_CSRMatrixMatvecPartRows(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixMatvecPartNnzs(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixMatvecCarry(matrix), HYPRE_MEMORY_HOST);
+
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
       hypre_TFree(hypre_CSRMatrixSortedData(matrix), memory_location);
       hypre_TFree(hypre_CSRMatrixSortedJ(matrix), memory_location);
@@ -1413,6 +1423,135 @@ hypre_CSRMatrixGetLoadBalancedPartitionEnd(hypre_CSRMatrix *A)
    return hypre_CSRMatrixGetLoadBalancedPartitionBoundary(A, hypre_GetThreadNum() + 1);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecPartitionIsValid
+ *
+ * Checks that the cached matvec partition of A was built for num_parts
+ * parts and still describes consistent positions in the row pointer of A.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixMatvecPartitionIsValid( hypre_CSRMatrix *A,
+                                       HYPRE_Int        num_parts )
+{
+   HYPRE_Int  *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int   num_rows  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int  *part_rows = hypre_CSRMatrixMatvecPartRows(A);
+   HYPRE_Int  *part_nnzs = hypre_CSRMatrixMatvecPartNnzs(A);
+   HYPRE_Int   p, row;
+
+   if (hypre_CSRMatrixMatvecNumParts(A) != num_parts || !part_rows ||
+       part_rows[num_parts] != num_rows || part_nnzs[num_parts] != A_i[num_rows])
+   {
+      return 0;
+   }
+
+   for (p = 0; p < num_parts; p++)
+   {
+      row = part_rows[p];
+      if (part_nnzs[p] < A_i[row] || (row < num_rows && part_nnzs[p] > A_i[row + 1]))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetupMatvecPartition
+ *
+ * Splits the work of a host matvec, i.e., the merged list of row ends and
+ * nonzeros, into num_parts contiguous pieces of equal size (merge-path).
+ * Part p starts at row part_rows[p] and nonzero part_nnzs[p]. When no row
+ * is longer than half a part, the boundaries are moved to row starts and
+ * split_rows is 0. Otherwise, long rows are shared by several parts.
+ *
+ * The partition, together with the scratch space holding the partial sums
+ * of shared rows, is cached on A and only rebuilt when num_parts or the
+ * row pointer of A change.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetupMatvecPartition( hypre_CSRMatrix *A,
+                                     HYPRE_Int        num_parts )
+{
+   HYPRE_Int      *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int       num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int       num_nnzs;
+   HYPRE_Int      *part_rows;
+   HYPRE_Int      *part_nnzs;
+   HYPRE_Complex  *carry = NULL;
+   HYPRE_Int       max_row_nnz = 0;
+   HYPRE_Int       split_rows;
+   HYPRE_Int       i, p, lo, hi, mid, diag;
+   HYPRE_Real      items_per_part;
+
+   if (hypre_CSRMatrixMatvecPartitionIsValid(A, num_parts))
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp critical (hypre_CSRMatrixMatvecPartition)
+#endif
+   if (!hypre_CSRMatrixMatvecPartitionIsValid(A, num_parts))
+   {
+      num_nnzs       = A_i[num_rows];
+      items_per_part = (HYPRE_Real) (num_rows + num_nnzs) / (HYPRE_Real) num_parts;
+
+      /* row-length analysis */
+      for (i = 0; i < num_rows; i++)
+      {
+         max_row_nnz = hypre_max(max_row_nnz, A_i[i + 1] - A_i[i]);
+      }
+      split_rows = (num_parts > 1 && (HYPRE_Real) max_row_nnz > 0.5 * items_per_part);
+
+      hypre_TFree(hypre_CSRMatrixMatvecPartRows(A), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixMatvecPartNnzs(A), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixMatvecCarry(A), HYPRE_MEMORY_HOST);
+      part_rows = hypre_TAlloc(HYPRE_Int, num_parts + 1, HYPRE_MEMORY_HOST);
+      part_nnzs = hypre_TAlloc(HYPRE_Int, num_parts + 1, HYPRE_MEMORY_HOST);
+      if (split_rows)
+      {
+         carry = hypre_TAlloc(HYPRE_Complex, num_parts, HYPRE_MEMORY_HOST);
+      }
+
+      for (p = 0; p <= num_parts; p++)
+      {
+         /* Find the point (row, nnz) where diagonal diag of the merge path
+            crosses it, i.e., the number of consumed row ends and nonzeros */
+         diag = (p == num_parts) ? (num_rows + num_nnzs) :
+                (HYPRE_Int) (p * items_per_part);
+         lo   = hypre_max(diag - num_nnzs, 0);
+         hi   = hypre_min(diag, num_rows);
+         while (lo < hi)
+         {
+            mid = lo + (hi - lo) / 2;
+            if (A_i[mid + 1] <= diag - 1 - mid)
+            {
+               lo = mid + 1;
+            }
+            else
+            {
+               hi = mid;
+            }
+         }
+
+         part_rows[p] = lo;
+         part_nnzs[p] = split_rows ? (diag - lo) : A_i[lo];
+      }
+
+      hypre_CSRMatrixMatvecPartRows(A)  = part_rows;
+      hypre_CSRMatrixMatvecPartNnzs(A)  = part_nnzs;
+      hypre_CSRMatrixMatvecSplitRows(A) = split_rows;
+      hypre_CSRMatrixMatvecCarry(A)     = carry;
+      hypre_CSRMatrixMatvecNumParts(A)  = num_parts;
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixPrefetch
  *--------------------------------------------------------------------------*/
@@ -47,6 +47,13 @@ typedef struct
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
 
+   /* cached row-length analysis of the threaded host matvec */
+   HYPRE_Int             matvec_num_parts;
+   HYPRE_Int            *matvec_part_rows;  /* first row of each part */
+   HYPRE_Int            *matvec_part_nnzs;  /* first nonzero of each part */
+   HYPRE_Int             matvec_split_rows; /* 1: rows may be shared by parts */
+   HYPRE_Complex        *matvec_carry;      /* partial sum of the last row of each part */
+
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
     defined(HYPRE_USING_ONEMKLSPARSE)
@@ -73,6 +80,11 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixMatvecNumParts(matrix)       ((matrix) -> matvec_num_parts)
+#define hypre_CSRMatrixMatvecPartRows(matrix)       ((matrix) -> matvec_part_rows)
+#define hypre_CSRMatrixMatvecPartNnzs(matrix)       ((matrix) -> matvec_part_nnzs)
+#define hypre_CSRMatrixMatvecSplitRows(matrix)      ((matrix) -> matvec_split_rows)
+#define hypre_CSRMatrixMatvecCarry(matrix)          ((matrix) -> matvec_carry)
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -13,6 +13,122 @@
 
 #include "seq_mv.h"
 
+/* number of vectors processed together by the multivector kernels */
+#define HYPRE_CSR_MATVEC_VEC_BLOCK 8
+
+/* distance (in nonzeros) of the software prefetch of the gathered x entries */
+#define HYPRE_CSR_MATVEC_PREFETCH_DIST 16
+
+#if defined(__GNUC__) || defined(__clang__)
+#define hypre_CSRMatvecPrefetch(ptr) __builtin_prefetch((ptr), 0, 1)
+#else
+#define hypre_CSRMatvecPrefetch(ptr)
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecRowSegment
+ *
+ * Returns sum_{jj = jbegin}^{jend-1} A_data[jj] * x_data[A_j[jj]], issuing
+ * prefetches for the x entries needed HYPRE_CSR_MATVEC_PREFETCH_DIST
+ * nonzeros ahead. Prefetching runs past jend, i.e., into the next rows,
+ * up to the last nonzero jlast of the caller, so that short rows also
+ * benefit from it.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Complex
+hypre_CSRMatrixMatvecRowSegment( HYPRE_Complex *A_data,
+                                 HYPRE_Int     *A_j,
+                                 HYPRE_Complex *x_data,
+                                 HYPRE_Int      jbegin,
+                                 HYPRE_Int      jend,
+                                 HYPRE_Int      jlast )
+{
+   HYPRE_Complex  sum = 0.0;
+   HYPRE_Int      jj, jpre = hypre_min(jend, jlast - HYPRE_CSR_MATVEC_PREFETCH_DIST);
+
+   for (jj = jbegin; jj < jpre; jj++)
+   {
+      hypre_CSRMatvecPrefetch(&x_data[A_j[jj + HYPRE_CSR_MATVEC_PREFETCH_DIST]]);
+      sum += A_data[jj] * x_data[A_j[jj]];
+   }
+   for (; jj < jend; jj++)
+   {
+      sum += A_data[jj] * x_data[A_j[jj]];
+   }
+
+   return sum;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSplitRowsHost
+ *
+ * y = alpha*A*x + beta*b for a single vector, using the merge-path
+ * partition of A (see hypre_CSRMatrixSetupMatvecPartition). Each part
+ * computes the rows it completes and returns the partial sum of the row it
+ * leaves unfinished, which is added afterwards. This balances matrices with
+ * a few very long rows, which a row-aligned partition cannot split.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixMatvecSplitRowsHost( HYPRE_Complex    alpha,
+                                    hypre_CSRMatrix *A,
+                                    HYPRE_Complex   *x_data,
+                                    HYPRE_Complex    beta,
+                                    HYPRE_Complex   *b_data,
+                                    HYPRE_Complex   *y_data )
+{
+   HYPRE_Complex  *A_data    = hypre_CSRMatrixData(A);
+   HYPRE_Int      *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int       num_rows  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int       num_parts = hypre_CSRMatrixMatvecNumParts(A);
+   HYPRE_Int      *part_rows = hypre_CSRMatrixMatvecPartRows(A);
+   HYPRE_Int      *part_nnzs = hypre_CSRMatrixMatvecPartNnzs(A);
+   HYPRE_Complex  *carry     = hypre_CSRMatrixMatvecCarry(A);
+   HYPRE_Int       p;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(p) schedule(static, 1)
+#endif
+   for (p = 0; p < num_parts; p++)
+   {
+      HYPRE_Int      row_end = part_rows[p + 1];
+      HYPRE_Int      nnz_end = part_nnzs[p + 1];
+      HYPRE_Int      jj      = part_nnzs[p];
+      HYPRE_Int      i;
+      HYPRE_Complex  sum;
+
+      /* rows whose last nonzero lies in this part */
+      for (i = part_rows[p]; i < row_end; i++)
+      {
+         sum = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data, jj, A_i[i + 1], nnz_end);
+         jj  = A_i[i + 1];
+
+         if (beta == 0.0)
+         {
+            y_data[i] = alpha * sum;
+         }
+         else
+         {
+            y_data[i] = alpha * sum + beta * b_data[i];
+         }
+      }
+
+      /* leading piece of row row_end, completed by a later part */
+      carry[p] = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data, jj, nnz_end, nnz_end);
+   }
+
+   for (p = 0; p < num_parts; p++)
+   {
+      if (part_rows[p + 1] < num_rows)
+      {
+         y_data[part_rows[p + 1]] += alpha * carry[p];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -35,6 +151,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
    HYPRE_Int        *A_rownnz = hypre_CSRMatrixRownnz(A);
    HYPRE_Int         num_rownnz = hypre_CSRMatrixNumRownnz(A);
+   HYPRE_BigInt      work = (HYPRE_BigInt) num_rows + hypre_CSRMatrixNumNonzeros(A);
 
    HYPRE_Complex    *x_data = hypre_VectorData(x);
    HYPRE_Complex    *b_data = hypre_VectorData(b) + offset;
@@ -52,6 +169,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    HYPRE_Complex     temp, tempx;
    HYPRE_Int         i, j, jj, m, ierr = 0;
    HYPRE_Real        xpar = 0.7;
+   HYPRE_Int         split_rows = 0;
    hypre_Vector     *x_tmp = NULL;
 
    /*---------------------------------------------------------------------
@@ -92,7 +210,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    if (alpha == 0.0)
    {
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
       for (i = 0; i < num_rows * num_vectors; i++)
       {
@@ -114,7 +232,23 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
    temp = beta / alpha;
 
-   if (num_vectors > 1)
+   /* Matrices with very long rows are multiplied with a merge-path partition
+      that may split rows among threads. Since the partial sums of a split row
+      depend on the number of threads, this is skipped when reproducible
+      reductions are requested */
+   if (num_vectors == 1 && offset == 0 &&
+       hypre_NumThreads() > 1 && hypre_OMPUseThreads(work) &&
+       !hypre_HandleReproducibleReductions(hypre_handle()))
+   {
+      hypre_CSRMatrixSetupMatvecPartition(A, hypre_NumThreads());
+      split_rows = hypre_CSRMatrixMatvecSplitRows(A);
+   }
+
+   if (split_rows)
+   {
+      hypre_CSRMatrixMatvecSplitRowsHost(alpha, A, x_data, beta, b_data, y_data);
+   }
+   else if (num_vectors > 1)
    {
       /*-----------------------------------------------------------------------
        * y = (beta/alpha)*b
@@ -123,7 +257,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       if (temp == 0.0)
       {
 #ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
          for (i = 0; i < num_rows * num_vectors; i++)
          {
@@ -133,7 +267,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       else if (temp == 1.0)
       {
 #ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
          for (i = 0; i < num_rows * num_vectors; i++)
          {
@@ -143,7 +277,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       else if (temp == -1.0)
       {
 #ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
          for (i = 0; i < num_rows * num_vectors; i++)
          {
@@ -153,7 +287,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       else
       {
 #ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
          for (i = 0; i < num_rows * num_vectors; i++)
          {
@@ -171,7 +305,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
          {
             case 2:
 #ifdef HYPRE_USING_OPENMP
-               #pragma omp parallel for private(i,j,jj,m) HYPRE_SMP_SCHEDULE
+               #pragma omp parallel for private(i,j,jj,m) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
                for (i = 0; i < num_rownnz; i++)
                {
@@ -195,7 +329,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
             case 3:
 #ifdef HYPRE_USING_OPENMP
-               #pragma omp parallel for private(i,j,jj,m) HYPRE_SMP_SCHEDULE
+               #pragma omp parallel for private(i,j,jj,m) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
                for (i = 0; i < num_rownnz; i++)
                {
@@ -221,7 +355,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
             case 4:
 #ifdef HYPRE_USING_OPENMP
-               #pragma omp parallel for private(i,j,jj,m) HYPRE_SMP_SCHEDULE
+               #pragma omp parallel for private(i,j,jj,m) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
                for (i = 0; i < num_rownnz; i++)
                {
@@ -248,20 +382,36 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                break;
 
             default:
+               /* Vectors are processed in blocks, so that each matrix entry is loaded once
+                  per block. With interleaved storage (vecstride == 1), the inner loops run
+                  over contiguous entries */
 #ifdef HYPRE_USING_OPENMP
-               #pragma omp parallel for private(i,j,jj,m,tempx) HYPRE_SMP_SCHEDULE
+               #pragma omp parallel for private(i,j,jj,m) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
                for (i = 0; i < num_rownnz; i++)
                {
+                  HYPRE_Int j0;
+
                   m = A_rownnz[i];
-                  for (j = 0; j < num_vectors; j++)
+                  for (j0 = 0; j0 < num_vectors; j0 += HYPRE_CSR_MATVEC_VEC_BLOCK)
                   {
-                     tempx = 0.0;
+                     HYPRE_Int     nv = hypre_min(HYPRE_CSR_MATVEC_VEC_BLOCK, num_vectors - j0);
+                     HYPRE_Complex tmp[HYPRE_CSR_MATVEC_VEC_BLOCK] = {0.0};
+
                      for (jj = A_i[m]; jj < A_i[m + 1]; jj++)
                      {
-                        tempx += A_data[jj] * x_data[j * vecstride_x + A_j[jj] * idxstride_x];
+                        HYPRE_Int     xidx = A_j[jj] * idxstride_x + j0 * vecstride_x;
+                        HYPRE_Complex coef = A_data[jj];
+
+                        for (j = 0; j < nv; j++)
+                        {
+                           tmp[j] += coef * x_data[xidx + j * vecstride_x];
+                        }
+                     }
+                     for (j = 0; j < nv; j++)
+                     {
+                        y_data[(j0 + j) * vecstride_y + m * idxstride_y] += tmp[j];
                      }
-                     y_data[j * vecstride_y + m * idxstride_y] += tempx;
                   }
                }
                break;
@@ -273,7 +423,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
          {
             case 2:
 #ifdef HYPRE_USING_OPENMP
-               #pragma omp parallel for private(i,j,jj) HYPRE_SMP_SCHEDULE
+               #pragma omp parallel for private(i,j,jj) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
                for (i = 0; i < num_rows; i++)
                {
@@ -295,7 +445,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
             case 3:
 #ifdef HYPRE_USING_OPENMP
-               #pragma omp parallel for private(i,j,jj) HYPRE_SMP_SCHEDULE
+               #pragma omp parallel for private(i,j,jj) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
                for (i = 0; i < num_rows; i++)
                {
@@ -319,7 +469,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
             case 4:
 #ifdef HYPRE_USING_OPENMP
-               #pragma omp parallel for private(i,j,jj) HYPRE_SMP_SCHEDULE
+               #pragma omp parallel for private(i,j,jj) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
                for (i = 0; i < num_rows; i++)
                {
@@ -345,18 +495,31 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
 
             default:
 #ifdef HYPRE_USING_OPENMP
-               #pragma omp parallel for private(i,j,jj,tempx) HYPRE_SMP_SCHEDULE
+               #pragma omp parallel for private(i,j,jj) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
                for (i = 0; i < num_rows; i++)
                {
-                  for (j = 0; j < num_vectors; ++j)
+                  HYPRE_Int j0;
+
+                  for (j0 = 0; j0 < num_vectors; j0 += HYPRE_CSR_MATVEC_VEC_BLOCK)
                   {
-                     tempx = 0.0;
+                     HYPRE_Int     nv = hypre_min(HYPRE_CSR_MATVEC_VEC_BLOCK, num_vectors - j0);
+                     HYPRE_Complex tmp[HYPRE_CSR_MATVEC_VEC_BLOCK] = {0.0};
+
                      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
                      {
-                        tempx += A_data[jj] * x_data[j * vecstride_x + A_j[jj] * idxstride_x];
+                        HYPRE_Int     xidx = A_j[jj] * idxstride_x + j0 * vecstride_x;
+                        HYPRE_Complex coef = A_data[jj];
+
+                        for (j = 0; j < nv; j++)
+                        {
+                           tmp[j] += coef * x_data[xidx + j * vecstride_x];
+                        }
+                     }
+                     for (j = 0; j < nv; j++)
+                     {
+                        y_data[(j0 + j) * vecstride_y + i * idxstride_y] += tmp[j];
                      }
-                     y_data[j * vecstride_y + i * idxstride_y] += tempx;
                   }
                }
                break;
@@ -370,7 +533,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       if (alpha != 1.0)
       {
 #ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
          for (i = 0; i < num_rows * num_vectors; i++)
          {
@@ -382,11 +545,12 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    {
       /* use rownnz pointer to do the A*x multiplication when
          num_rownnz is smaller than xpar*num_rows */
+      HYPRE_Int nnz_end = A_i[num_rows];
 
       if (temp == 0.0)
       {
 #ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
          for (i = 0; i < num_rows; i++)
          {
@@ -396,48 +560,39 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
          if (alpha == 1.0)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] = tempx;
             }
          } // y = A*x
          else if (alpha == -1.0)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx -= A_data[j] * x_data[A_j[j]];
-               }
+               tempx = -hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                        A_i[m], A_i[m + 1], nnz_end);
                y_data[m] = tempx;
             }
          } // y = -A*x
          else
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] = alpha * tempx;
             }
          } // y = alpha*A*x
@@ -447,7 +602,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
          if (alpha == 1.0)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -455,23 +610,20 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] += tempx;
             }
          } // y = A*x - b
          else if (alpha == -1.0)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -479,23 +631,20 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] -= tempx;
             }
          } // y = -A*x + b
          else
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -503,16 +652,13 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] += alpha * tempx;
             }
          } // y = alpha*(A*x - b)
@@ -522,7 +668,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
          if (alpha == 1.0)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -530,23 +676,20 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] += tempx;
             }
          } // y = A*x + b
          else if (alpha == -1.0)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -554,23 +697,20 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx -= A_data[j] * x_data[A_j[j]];
-               }
+               tempx = -hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                        A_i[m], A_i[m + 1], nnz_end);
                y_data[m] += tempx;
             }
          } // y = -A*x - b
          else
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -578,16 +718,13 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] += alpha * tempx;
             }
          } // y = alpha*(A*x + b)
@@ -597,7 +734,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
          if (alpha == 1.0)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -605,23 +742,20 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] += tempx;
             }
          } // y = A*x + beta*b
          else if (-1 == alpha)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -629,23 +763,20 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx -= A_data[j] * x_data[A_j[j]];
-               }
+               tempx = -hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                        A_i[m], A_i[m + 1], nnz_end);
                y_data[m] += tempx;
             }
          } // y = -A*x - temp*b
          else
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rows; i++)
             {
@@ -653,16 +784,13 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             }
 
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(work)
 #endif
             for (i = 0; i < num_rownnz; i++)
             {
                m = A_rownnz[i];
-               tempx = 0.0;
-               for (j = A_i[m]; j < A_i[m + 1]; j++)
-               {
-                  tempx += A_data[j] * x_data[A_j[j]];
-               }
+               tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                       A_i[m], A_i[m + 1], nnz_end);
                y_data[m] += alpha * tempx;
             }
          } // y = alpha*(A*x + temp*b)
@@ -671,14 +799,16 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    else
    {
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel private(i,jj,tempx)
+      #pragma omp parallel private(i,jj,tempx) HYPRE_SMP_IF(work)
 #endif
       {
          HYPRE_Int iBegin = hypre_CSRMatrixGetLoadBalancedPartitionBegin(A);
          HYPRE_Int iEnd = hypre_CSRMatrixGetLoadBalancedPartitionEnd(A);
+         HYPRE_Int nnz_end;
          hypre_assert(iBegin <= iEnd);
          hypre_assert(iBegin >= 0 && iBegin <= num_rows);
          hypre_assert(iEnd >= 0 && iEnd <= num_rows);
+         nnz_end = A_i[iEnd];
 
          if (temp == 0.0)
          {
@@ -686,11 +816,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             {
                for (i = iBegin; i < iEnd; i++)
                {
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                          A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] = tempx;
                }
             } // y = A*x
@@ -698,11 +825,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             {
                for (i = iBegin; i < iEnd; i++)
                {
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx -= A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = -hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                           A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] = tempx;
                }
             } // y = -A*x
@@ -710,11 +834,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
             {
                for (i = iBegin; i < iEnd; i++)
                {
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                          A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] = alpha * tempx;
                }
             } // y = alpha*A*x
@@ -726,11 +847,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = -b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                          A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += tempx;
                }
             } // y = A*x - y
@@ -739,11 +857,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx -= A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = -hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                           A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += tempx;
                }
             } // y = -A*x + y
@@ -752,11 +867,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = -alpha * b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                          A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += alpha * tempx;
                }
             } // y = alpha*(A*x - y)
@@ -768,11 +880,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                          A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += tempx;
                }
             } // y = A*x + y
@@ -781,11 +890,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = -b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx -= A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = -hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                           A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += tempx;
                }
             } // y = -A*x - y
@@ -794,11 +900,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = alpha * b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                          A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += alpha * tempx;
                }
             } // y = alpha*(A*x + y)
@@ -810,11 +913,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = b_data[i] * temp;
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                          A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += tempx;
                }
             } // y = A*x + temp*y
@@ -823,11 +923,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = -b_data[i] * temp;
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx -= A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = -hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                           A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += tempx;
                }
             } // y = -A*x - temp*y
@@ -836,11 +933,8 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
                for (i = iBegin; i < iEnd; i++)
                {
                   y_data[i] = b_data[i] * beta;
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
+                  tempx = hypre_CSRMatrixMatvecRowSegment(A_data, A_j, x_data,
+                                                          A_i[i], A_i[i + 1], nnz_end);
                   y_data[i] += alpha * tempx;
                }
             } // y = alpha*(A*x + temp*y)
@@ -940,6 +1034,7 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
 
    HYPRE_Int         i, j, jv, jj;
    HYPRE_Int         num_threads;
+   HYPRE_BigInt      work = (HYPRE_BigInt) num_rows + hypre_CSRMatrixNumNonzeros(A);
 
    HYPRE_Int         ierr  = 0;
 
@@ -1029,7 +1124,7 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
     * y += A^T*x
     *-----------------------------------------------------------------*/
    num_threads = hypre_NumThreads();
-   if (num_threads > 1)
+   if (num_threads > 1 && hypre_OMPUseThreads(work))
    {
       y_data_expand = hypre_CTAlloc(HYPRE_Complex,  num_threads * y_size, HYPRE_MEMORY_HOST);
 
@@ -1074,11 +1169,11 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
          /* multiple vector case is not threaded */
          for (i = 0; i < num_rows; i++)
          {
-            for ( jv = 0; jv < num_vectors; ++jv )
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
             {
-               for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+               j = A_j[jj];
+               for ( jv = 0; jv < num_vectors; ++jv )
                {
-                  j = A_j[jj];
                   y_data[ j * idxstride_y + jv * vecstride_y ] +=
                      A_data[jj] * x_data[ i * idxstride_x + jv * vecstride_x];
                }
@@ -1103,11 +1198,11 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
          }
          else
          {
-            for ( jv = 0; jv < num_vectors; ++jv )
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
             {
-               for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+               j = A_j[jj];
+               for ( jv = 0; jv < num_vectors; ++jv )
                {
-                  j = A_j[jj];
                   y_data[ j * idxstride_y + jv * vecstride_y ] +=
                      A_data[jj] * x_data[ i * idxstride_x + jv * vecstride_x ];
                }
@@ -28,8 +28,14 @@ hypre_CSRMatrix *hypre_CSRMatrixAdd ( HYPRE_Complex alpha, hypre_CSRMatrix *A, H
 hypre_CSRMatrix *hypre_CSRMatrixBigAdd ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiply ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
+hypre_CSRMatrix *hypre_CSRMatrixTripleMultiplyHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                                     hypre_CSRMatrix *C );
+hypre_CSRMatrix *hypre_CSRMatrixTripleMultiplyTHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                                      hypre_CSRMatrix *C, HYPRE_Int max_block_nnz );
 hypre_CSRMatrix *hypre_CSRMatrixDeleteZeros ( hypre_CSRMatrix *A, HYPRE_Real tol );
 HYPRE_Int hypre_CSRMatrixTransposeHost ( hypre_CSRMatrix *A, hypre_CSRMatrix **AT, HYPRE_Int data );
+HYPRE_Int hypre_CSRMatrixTransposePermHost ( hypre_CSRMatrix *A, hypre_CSRMatrix **AT, HYPRE_Int data,
+                                             HYPRE_Int *perm );
 HYPRE_Int hypre_CSRMatrixTranspose ( hypre_CSRMatrix *A, hypre_CSRMatrix **AT, HYPRE_Int data );
 HYPRE_Int hypre_CSRMatrixReorder ( hypre_CSRMatrix *A );
 HYPRE_Complex hypre_CSRMatrixSumElts ( hypre_CSRMatrix *A );
@@ -147,6 +153,7 @@ hypre_CSRMatrix *hypre_CSRMatrixUnion( hypre_CSRMatrix *A,
                                        HYPRE_BigInt *col_map_offd_A,
                                        HYPRE_BigInt *col_map_offd_B,
                                        HYPRE_BigInt **col_map_offd_C );
+HYPRE_Int hypre_CSRMatrixSetupMatvecPartition( hypre_CSRMatrix *A, HYPRE_Int num_parts );
 HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
@@ -289,6 +296,9 @@ HYPRE_Int hypre_SeqVectorAxpyz ( HYPRE_Complex alpha, hypre_Vector *x,
                                  hypre_Vector *z );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x, hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProdHost ( hypre_Vector *x, hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorUseReproInnerProd ( hypre_Vector *x, hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorInnerProdReproBins ( hypre_Vector *x, hypre_Vector *y, HYPRE_Real *bins );
+HYPRE_Real hypre_ReproBinsToReal ( HYPRE_Real *bins );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,
                                        HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,
@@ -67,6 +67,13 @@ typedef struct
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
 
+   /* cached row-length analysis of the threaded host matvec */
+   HYPRE_Int             matvec_num_parts;
+   HYPRE_Int            *matvec_part_rows;  /* first row of each part */
+   HYPRE_Int            *matvec_part_nnzs;  /* first nonzero of each part */
+   HYPRE_Int             matvec_split_rows; /* 1: rows may be shared by parts */
+   HYPRE_Complex        *matvec_carry;      /* partial sum of the last row of each part */
+
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
     defined(HYPRE_USING_ONEMKLSPARSE)
@@ -93,6 +100,11 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixMatvecNumParts(matrix)       ((matrix) -> matvec_num_parts)
+#define hypre_CSRMatrixMatvecPartRows(matrix)       ((matrix) -> matvec_part_rows)
+#define hypre_CSRMatrixMatvecPartNnzs(matrix)       ((matrix) -> matvec_part_nnzs)
+#define hypre_CSRMatrixMatvecSplitRows(matrix)      ((matrix) -> matvec_split_rows)
+#define hypre_CSRMatrixMatvecCarry(matrix)          ((matrix) -> matvec_carry)
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -276,6 +288,14 @@ typedef struct
 #define hypre_VectorEntryIJ(vector, i, j) \
    ((vector) -> data[((vector) -> vecstride) * j + ((vector) -> idxstride) * i])
 
+/*--------------------------------------------------------------------------
+ * Binned accumulator of the reproducible inner product: the exponent bins
+ * followed by a fallback flag and a fallback partial sum
+ *--------------------------------------------------------------------------*/
+
+#define hypre_REPRO_NUM_BINS    102
+#define hypre_REPRO_BINS_SIZE   (hypre_REPRO_NUM_BINS + 2)
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -307,8 +327,14 @@ hypre_CSRMatrix *hypre_CSRMatrixAdd ( HYPRE_Complex alpha, hypre_CSRMatrix *A, H
 hypre_CSRMatrix *hypre_CSRMatrixBigAdd ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiply ( hypre_CSRMatrix *A, hypre_CSRMatrix *B );
+hypre_CSRMatrix *hypre_CSRMatrixTripleMultiplyHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                                     hypre_CSRMatrix *C );
+hypre_CSRMatrix *hypre_CSRMatrixTripleMultiplyTHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                                      hypre_CSRMatrix *C, HYPRE_Int max_block_nnz );
 hypre_CSRMatrix *hypre_CSRMatrixDeleteZeros ( hypre_CSRMatrix *A, HYPRE_Real tol );
 HYPRE_Int hypre_CSRMatrixTransposeHost ( hypre_CSRMatrix *A, hypre_CSRMatrix **AT, HYPRE_Int data );
+HYPRE_Int hypre_CSRMatrixTransposePermHost ( hypre_CSRMatrix *A, hypre_CSRMatrix **AT, HYPRE_Int data,
+                                             HYPRE_Int *perm );
 HYPRE_Int hypre_CSRMatrixTranspose ( hypre_CSRMatrix *A, hypre_CSRMatrix **AT, HYPRE_Int data );
 HYPRE_Int hypre_CSRMatrixReorder ( hypre_CSRMatrix *A );
 HYPRE_Complex hypre_CSRMatrixSumElts ( hypre_CSRMatrix *A );
@@ -426,6 +452,7 @@ hypre_CSRMatrix *hypre_CSRMatrixUnion( hypre_CSRMatrix *A,
                                        HYPRE_BigInt *col_map_offd_A,
                                        HYPRE_BigInt *col_map_offd_B,
                                        HYPRE_BigInt **col_map_offd_C );
+HYPRE_Int hypre_CSRMatrixSetupMatvecPartition( hypre_CSRMatrix *A, HYPRE_Int num_parts );
 HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
@@ -568,6 +595,9 @@ HYPRE_Int hypre_SeqVectorAxpyz ( HYPRE_Complex alpha, hypre_Vector *x,
                                  hypre_Vector *z );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x, hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProdHost ( hypre_Vector *x, hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorUseReproInnerProd ( hypre_Vector *x, hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorInnerProdReproBins ( hypre_Vector *x, hypre_Vector *y, HYPRE_Real *bins );
+HYPRE_Real hypre_ReproBinsToReal ( HYPRE_Real *bins );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,
                                        HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,
@@ -236,7 +236,7 @@ hypre_SeqVectorResize( hypre_Vector *vector,
    else if (method == 1)
    {
       hypre_VectorVectorStride(vector) = 1;
-      hypre_VectorIndexStride(vector)  = num_vectors;
+      hypre_VectorIndexStride(vector)  = num_vectors_in;
    }
 
    return hypre_error_flag;
@@ -374,7 +374,7 @@ hypre_SeqVectorSetConstantValuesHost( hypre_Vector *v,
    HYPRE_Int      i;
 
 #if defined(HYPRE_USING_OPENMP)
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(total_size)
 #endif
    for (i = 0; i < total_size; i++)
    {
@@ -550,7 +550,7 @@ hypre_SeqVectorStridedCopy( hypre_Vector  *x,
 #endif
    {
 #if defined(HYPRE_USING_OPENMP)
-      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(size)
 #endif
       for (i = 0; i < size; i += istride)
       {
@@ -676,7 +676,7 @@ hypre_SeqVectorScaleHost( HYPRE_Complex alpha,
    HYPRE_Int      i;
 
 #if defined(HYPRE_USING_OPENMP)
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(total_size)
 #endif
    for (i = 0; i < total_size; i++)
    {
@@ -746,7 +746,7 @@ hypre_SeqVectorAxpyHost( HYPRE_Complex alpha,
    HYPRE_Int      i;
 
 #if defined(HYPRE_USING_OPENMP)
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(total_size)
 #endif
    for (i = 0; i < total_size; i++)
    {
@@ -810,7 +810,7 @@ hypre_SeqVectorAxpyzHost( HYPRE_Complex alpha,
    HYPRE_Int      i;
 
 #if defined(HYPRE_USING_OPENMP)
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(total_size)
 #endif
    for (i = 0; i < total_size; i++)
    {
@@ -884,7 +884,7 @@ hypre_SeqVectorElmdivpyHost( hypre_Vector *x,
          if (marker)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(size)
 #endif
             for (i = 0; i < size; i++)
             {
@@ -897,7 +897,7 @@ hypre_SeqVectorElmdivpyHost( hypre_Vector *x,
          else
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(size)
 #endif
             for (i = 0; i < size; i++)
             {
@@ -911,7 +911,7 @@ hypre_SeqVectorElmdivpyHost( hypre_Vector *x,
          if (marker)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(size)
 #endif
             for (i = 0; i < size; i++)
             {
@@ -926,7 +926,7 @@ hypre_SeqVectorElmdivpyHost( hypre_Vector *x,
          else
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(size)
 #endif
             for (i = 0; i < size; i++)
             {
@@ -942,7 +942,7 @@ hypre_SeqVectorElmdivpyHost( hypre_Vector *x,
          if (marker)
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(size)
 #endif
             for (i = 0; i < size; i++)
             {
@@ -959,7 +959,7 @@ hypre_SeqVectorElmdivpyHost( hypre_Vector *x,
          else
          {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+            #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(size)
 #endif
             for (i = 0; i < size; i++)
             {
@@ -1075,6 +1075,311 @@ hypre_SeqVectorElmdivpy( hypre_Vector *x,
    return hypre_SeqVectorElmdivpyMarked(x, b, y, NULL, -1);
 }
 
+/*--------------------------------------------------------------------------
+ * Reproducible inner products
+ *
+ * The products x_i*y_i are split into fixed index chunks. Each chunk picks a
+ * top bin b from its largest product and deposits every product into bins
+ * b, b-1 and b-2 by pre-rounding against sigma_b = 1.5*2^e_b, where
+ * e_b = hypre_REPRO_EMIN + b*hypre_REPRO_WIDTH. The deposited pieces are
+ * multiples of ulp(sigma_b) small enough that every later addition (across
+ * chunks, threads and MPI tasks) is exact, so the order of these additions
+ * does not matter. The only rounding is the part of each product below bin
+ * b-2 (at most 2^-59 of the largest product of its chunk), which depends
+ * on the chunk partition but not on the number of threads.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_REPRO_WIDTH      20
+#define hypre_REPRO_SCALE      1048576.0 /* 2^hypre_REPRO_WIDTH */
+#define hypre_REPRO_EMIN       -1022
+#define hypre_REPRO_HEADROOM   13
+#define hypre_REPRO_CHUNK      1024
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorUseReproInnerProd
+ *
+ * Returns whether inner products of x and y use the reproducible algorithm.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorUseReproInnerProd( hypre_Vector *x,
+                                  hypre_Vector *y )
+{
+#if defined(HYPRE_COMPLEX) || defined(HYPRE_SINGLE) || defined(HYPRE_LONG_DOUBLE)
+   HYPRE_UNUSED_VAR(x);
+   HYPRE_UNUSED_VAR(y);
+
+   return 0;
+#else
+   if (!hypre_HandleReproducibleReductions(hypre_handle()))
+   {
+      return 0;
+   }
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy2(hypre_VectorMemoryLocation(x),
+                            hypre_VectorMemoryLocation(y)) == HYPRE_EXEC_DEVICE)
+   {
+      return 0;
+   }
+#else
+   HYPRE_UNUSED_VAR(x);
+   HYPRE_UNUSED_VAR(y);
+#endif
+
+   return 1;
+#endif
+}
+
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && !defined(HYPRE_LONG_DOUBLE)
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproBinsNormalize
+ *
+ * Carries the high part of bins first, ..., last-1 into the next bin,
+ * leaving each of them within half an ulp of the next bin's sigma. Over the
+ * full range, the result only depends on the exact value of the bins.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ReproBinsNormalize( HYPRE_Real *bins,
+                          HYPRE_Int   first,
+                          HYPRE_Int   last )
+{
+   HYPRE_Real  sigma, half, c, r;
+   HYPRE_Int   b;
+
+   /* Scaling by 2^width is exact, so only the first bin needs ldexp */
+   sigma = ldexp(1.5, hypre_REPRO_EMIN + (first + 1) * hypre_REPRO_WIDTH);
+   half  = ldexp(0.5, hypre_REPRO_EMIN + (first + 1) * hypre_REPRO_WIDTH - 52);
+
+   for (b = first; b < last; b++, sigma *= hypre_REPRO_SCALE, half *= hypre_REPRO_SCALE)
+   {
+      c = (sigma + bins[b]) - sigma;
+      r = bins[b] - c;
+
+      /* Break ties the same way regardless of how bins[b] was reached */
+      if (r == -half)
+      {
+         r  = half;
+         c -= 2.0 * half;
+      }
+
+      bins[b]      = r;
+      bins[b + 1] += c;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProdReproChunk
+ *
+ * Deposits the products of one chunk into bins. Returns 1 if the chunk
+ * holds products too large (or not finite) for the binned format.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SeqVectorInnerProdReproChunk( HYPRE_Real *x_data,
+                                    HYPRE_Real *y_data,
+                                    HYPRE_Int   n,
+                                    HYPRE_Real *bins )
+{
+   HYPRE_Real  amax = 0.0;
+   HYPRE_Real  s0 = 0.0, s1 = 0.0, s2 = 0.0;
+   HYPRE_Real  sigma0, sigma1, sigma2;
+   HYPRE_Int   i, b, e;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp simd reduction(max:amax)
+#endif
+   for (i = 0; i < n; i++)
+   {
+      HYPRE_Real r = x_data[i] * y_data[i];
+
+      amax = hypre_max(amax, hypre_abs(r));
+   }
+
+   if (amax == 0.0)
+   {
+      return 0;
+   }
+   else if (!(amax <= HYPRE_REAL_MAX))
+   {
+      return 1;
+   }
+
+   /* Smallest top bin with amax < 2^(e_b - headroom) */
+   frexp(amax, &e);
+   b = (e + hypre_REPRO_HEADROOM - hypre_REPRO_EMIN + hypre_REPRO_WIDTH - 1) / hypre_REPRO_WIDTH;
+   b = hypre_max(b, 2);
+   if (b > hypre_REPRO_NUM_BINS - 3)
+   {
+      return 1;
+   }
+
+   sigma2 = ldexp(1.5, hypre_REPRO_EMIN + (b - 2) * hypre_REPRO_WIDTH);
+   sigma1 = sigma2 * hypre_REPRO_SCALE;
+   sigma0 = sigma1 * hypre_REPRO_SCALE;
+
+   /* The partial sums are exact, so they may be reassociated freely */
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp simd reduction(+:s0,s1,s2)
+#endif
+   for (i = 0; i < n; i++)
+   {
+      HYPRE_Real r = x_data[i] * y_data[i];
+      HYPRE_Real q;
+
+      q = (sigma0 + r) - sigma0; s0 += q; r -= q;
+      q = (sigma1 + r) - sigma1; s1 += q; r -= q;
+      q = (sigma2 + r) - sigma2; s2 += q;
+   }
+
+   bins[b]     += s0;
+   bins[b - 1] += s1;
+   bins[b - 2] += s2;
+
+   /* Keep the bins within their exact range for the next chunks */
+   hypre_ReproBinsNormalize(bins, b - 2, b + 2);
+
+   return 0;
+}
+
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProdReproBins
+ *
+ * Accumulates the inner product of x and y into bins, an array of size
+ * hypre_REPRO_BINS_SIZE. Bins of different vectors (e.g., the local parts
+ * of a ParVector on each MPI task) may be summed entrywise in any order
+ * before calling hypre_ReproBinsToReal.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorInnerProdReproBins( hypre_Vector *x,
+                                   hypre_Vector *y,
+                                   HYPRE_Real   *bins )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      total_size  = size * num_vectors;
+
+   HYPRE_Int      fallback    = 1;
+   HYPRE_Real     result      = 0.0;
+   HYPRE_Int      i;
+
+   for (i = 0; i < hypre_REPRO_BINS_SIZE; i++)
+   {
+      bins[i] = 0.0;
+   }
+
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && !defined(HYPRE_LONG_DOUBLE)
+   {
+      HYPRE_Int num_chunks = (total_size + hypre_REPRO_CHUNK - 1) / hypre_REPRO_CHUNK;
+
+      fallback = 0;
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel HYPRE_SMP_IF(total_size)
+#endif
+      {
+         HYPRE_Real  my_bins[hypre_REPRO_NUM_BINS];
+         HYPRE_Int   my_fallback = 0;
+         HYPRE_Int   b, k, n;
+
+         for (b = 0; b < hypre_REPRO_NUM_BINS; b++)
+         {
+            my_bins[b] = 0.0;
+         }
+
+#if defined(HYPRE_USING_OPENMP)
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (k = 0; k < num_chunks; k++)
+         {
+            if (!my_fallback)
+            {
+               n = hypre_min(hypre_REPRO_CHUNK, total_size - k * hypre_REPRO_CHUNK);
+               my_fallback = hypre_SeqVectorInnerProdReproChunk(x_data + k * hypre_REPRO_CHUNK,
+                                                                y_data + k * hypre_REPRO_CHUNK,
+                                                                n, my_bins);
+            }
+         }
+
+         hypre_ReproBinsNormalize(my_bins, 0, hypre_REPRO_NUM_BINS - 1);
+
+#if defined(HYPRE_USING_OPENMP)
+         #pragma omp critical (hypre_SeqVectorInnerProdRepro)
+#endif
+         {
+            for (b = 0; b < hypre_REPRO_NUM_BINS; b++)
+            {
+               bins[b] += my_bins[b];
+            }
+            fallback = fallback || my_fallback;
+         }
+      }
+   }
+#endif
+
+   if (fallback)
+   {
+      /* Out of range for the binned format: plain sum in a fixed order */
+      for (i = 0; i < total_size; i++)
+      {
+         result += hypre_conj(y_data[i]) * x_data[i];
+      }
+
+      for (i = 0; i < hypre_REPRO_NUM_BINS; i++)
+      {
+         bins[i] = 0.0;
+      }
+      bins[hypre_REPRO_NUM_BINS]     = 1.0;
+      bins[hypre_REPRO_NUM_BINS + 1] = result;
+   }
+   else
+   {
+      bins[hypre_REPRO_NUM_BINS + 1] = hypre_ReproBinsToReal(bins);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproBinsToReal
+ *
+ * Returns the value represented by bins. If any contribution fell back to
+ * the plain sum, returns the sum of the fallback partial sums instead.
+ * Note: bins is normalized in place.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ReproBinsToReal( HYPRE_Real *bins )
+{
+   HYPRE_Real result = 0.0;
+
+   if (bins[hypre_REPRO_NUM_BINS] > 0.0)
+   {
+      return bins[hypre_REPRO_NUM_BINS + 1];
+   }
+
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && !defined(HYPRE_LONG_DOUBLE)
+   {
+      HYPRE_Int b;
+
+      hypre_ReproBinsNormalize(bins, 0, hypre_REPRO_NUM_BINS - 1);
+      for (b = 0; b < hypre_REPRO_NUM_BINS; b++)
+      {
+         result += bins[b];
+      }
+   }
+#endif
+
+   return result;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SeqVectorInnerProdHost
  *--------------------------------------------------------------------------*/
@@ -1092,8 +1397,17 @@ hypre_SeqVectorInnerProdHost( hypre_Vector *x,
    HYPRE_Real     result      = 0.0;
    HYPRE_Int      i;
 
+   if (hypre_SeqVectorUseReproInnerProd(x, y))
+   {
+      HYPRE_Real bins[hypre_REPRO_BINS_SIZE];
+
+      hypre_SeqVectorInnerProdReproBins(x, y, bins);
+
+      return bins[hypre_REPRO_NUM_BINS + 1];
+   }
+
 #if defined(HYPRE_USING_OPENMP)
-   #pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(total_size)
 #endif
    for (i = 0; i < total_size; i++)
    {
@@ -1153,7 +1467,7 @@ hypre_SeqVectorSumEltsHost( hypre_Vector *vector )
    HYPRE_Int       i;
 
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i) reduction(+:sum) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i) reduction(+:sum) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(total_size)
 #endif
    for (i = 0; i < total_size; i++)
    {
@@ -1251,7 +1565,7 @@ hypre_SeqVectorMax( HYPRE_Complex alpha,
 #if defined(HYPRE_USING_DEVICE_OPENMP)
    #pragma omp target teams distribute parallel for private(i) is_device_ptr(y_data, x_data)
 #elif defined(HYPRE_USING_OPENMP)
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE HYPRE_SMP_IF(size)
 #endif
    for (i = 0; i < size; i++)
    {
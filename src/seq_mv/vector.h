@@ -55,4 +55,12 @@ typedef struct
 #define hypre_VectorEntryIJ(vector, i, j) \
    ((vector) -> data[((vector) -> vecstride) * j + ((vector) -> idxstride) * i])
 
+/*--------------------------------------------------------------------------
+ * Binned accumulator of the reproducible inner product: the exponent bins
+ * followed by a fallback flag and a fallback partial sum
+ *--------------------------------------------------------------------------*/
+
+#define hypre_REPRO_NUM_BINS    102
+#define hypre_REPRO_BINS_SIZE   (hypre_REPRO_NUM_BINS + 2)
+
 #endif
@@ -10,6 +10,51 @@
 
 #include "nd1_amge_interpolation.h"
 
+/*
+  Copy global row "row" of M into J and data, which live in memory_location,
+  and return its size in size. Returns -1 if the row is not local to M.
+  The row is range-checked before it is narrowed to a local index, so an
+  off-processor row can not wrap onto a local one.
+*/
+static HYPRE_Int
+hypre_ND1AMGeCopyRow (hypre_ParCSRMatrix   *M,
+                      HYPRE_BigInt          row,
+                      HYPRE_Int            *size,
+                      HYPRE_BigInt         *J,
+                      HYPRE_Real           *data,
+                      HYPRE_MemoryLocation  memory_location)
+{
+   HYPRE_MemoryLocation memory_location_M = hypre_ParCSRMatrixMemoryLocation(M);
+   HYPRE_BigInt local_row = row - hypre_ParCSRMatrixFirstRowIndex(M);
+
+   if (local_row < 0 || local_row >= (HYPRE_BigInt) hypre_ParCSRMatrixNumRows(M))
+   {
+      *size = 0;
+      return -1;
+   }
+
+   if (hypre_GetExecPolicy2(memory_location, memory_location_M) == HYPRE_EXEC_HOST)
+   {
+      hypre_ParCSRMatrixRowView view;
+
+      hypre_ParCSRMatrixGetRowView (M, (HYPRE_Int) local_row, &view);
+      *size = hypre_ParCSRMatrixRowViewSize(&view);
+      hypre_ParCSRMatrixRowViewCopy (&view, J, data);
+   }
+   else
+   {
+      HYPRE_BigInt *tmp_J;
+      HYPRE_Real *tmp_data;
+
+      hypre_ParCSRMatrixGetRow (M, row, size, &tmp_J, &tmp_data);
+      hypre_TMemcpy(J, tmp_J, HYPRE_BigInt, *size, memory_location, memory_location_M);
+      hypre_TMemcpy(data, tmp_data, HYPRE_Real, *size, memory_location, memory_location_M);
+      hypre_ParCSRMatrixRestoreRow (M, row, size, &tmp_J, &tmp_data);
+   }
+
+   return 0;
+}
+
 /*
   Assume that we are given a fine and coarse topology and the
   coarse degrees of freedom (DOFs) have been chosen. Assume also,
@@ -44,7 +89,6 @@ HYPRE_Int hypre_ND1AMGeInterpolation (hypre_ParCSRMatrix       * Aee,
    HYPRE_Int ierr = 0;
 
    HYPRE_Int  i, j;
-   HYPRE_BigInt  big_k;
    HYPRE_BigInt *offproc_rnums;
    HYPRE_Int *swap = NULL;
 
@@ -111,39 +155,32 @@ HYPRE_Int hypre_ND1AMGeInterpolation (hypre_ParCSRMatrix       * Aee,
    ELEM_EDGEidof = hypre_ParMatmul(ELEM_EDGE, EDGE_idof);
 
    /* Loop over local coarse elements */
-   big_k = hypre_ParCSRMatrixFirstRowIndex(ELEM_EDGE);
-   for (i = 0; i < numELEM; i++, big_k++)
+   for (i = 0; i < numELEM; i++)
    {
       HYPRE_Int size1, size2;
-      HYPRE_BigInt *col_ind0, *col_ind1, *col_ind2;
+      HYPRE_BigInt *col_ind1, *col_ind2;
 
-      HYPRE_BigInt *DOF0, *DOF;
+      HYPRE_BigInt *DOF;
       HYPRE_Int num_DOF;
       HYPRE_Int num_idof;
-      HYPRE_BigInt *idof0, *idof, *bdof;
+      HYPRE_BigInt *idof, *bdof;
       HYPRE_Int num_bdof;
 
-      HYPRE_Real *boolean_data;
+      hypre_ParCSRMatrixRowView view;
 
       /* Determine the coarse DOFs */
-      hypre_ParCSRMatrixGetRow (ELEM_DOF, big_k, &num_DOF, &DOF0, &boolean_data);
+      hypre_ParCSRMatrixGetRowView (ELEM_DOF, i, &view);
+      num_DOF = hypre_ParCSRMatrixRowViewSize(&view);
       DOF = hypre_TAlloc(HYPRE_BigInt,  num_DOF, HYPRE_MEMORY_HOST);
-      for (j = 0; j < num_DOF; j++)
-      {
-         DOF[j] = DOF0[j];
-      }
-      hypre_ParCSRMatrixRestoreRow (ELEM_DOF, big_k, &num_DOF, &DOF0, &boolean_data);
+      hypre_ParCSRMatrixRowViewCopy (&view, DOF, NULL);
 
       hypre_BigQsort0(DOF, 0, num_DOF - 1);
 
       /* Find the fine dofs interior for the current coarse element */
-      hypre_ParCSRMatrixGetRow (ELEM_idof, big_k, &num_idof, &idof0, &boolean_data);
+      hypre_ParCSRMatrixGetRowView (ELEM_idof, i, &view);
+      num_idof = hypre_ParCSRMatrixRowViewSize(&view);
       idof = hypre_TAlloc(HYPRE_BigInt,  num_idof, HYPRE_MEMORY_HOST);
-      for (j = 0; j < num_idof; j++)
-      {
-         idof[j] = idof0[j];
-      }
-      hypre_ParCSRMatrixRestoreRow (ELEM_idof, big_k, &num_idof, &idof0, &boolean_data);
+      hypre_ParCSRMatrixRowViewCopy (&view, idof, NULL);
 
       /* Sort the interior dofs according to their global number */
       hypre_BigQsort0(idof, 0, num_idof - 1);
@@ -151,13 +188,10 @@ HYPRE_Int hypre_ND1AMGeInterpolation (hypre_ParCSRMatrix       * Aee,
       /* Find the fine dofs on the boundary of the current coarse element */
       if (three_dimensional_problem)
       {
-         hypre_ParCSRMatrixGetRow (ELEM_FACEidof, big_k, &size1, &col_ind0, &boolean_data);
+         hypre_ParCSRMatrixGetRowView (ELEM_FACEidof, i, &view);
+         size1 = hypre_ParCSRMatrixRowViewSize(&view);
          col_ind1 = hypre_TAlloc(HYPRE_BigInt, size1, HYPRE_MEMORY_HOST);
-         for (j = 0; j < size1; j++)
-         {
-            col_ind1[j] = col_ind0[j];
-         }
-         hypre_ParCSRMatrixRestoreRow (ELEM_FACEidof, big_k, &size1, &col_ind0, &boolean_data);
+         hypre_ParCSRMatrixRowViewCopy (&view, col_ind1, NULL);
       }
       else
       {
@@ -165,13 +199,10 @@ HYPRE_Int hypre_ND1AMGeInterpolation (hypre_ParCSRMatrix       * Aee,
          size1 = 0;
       }
 
-      hypre_ParCSRMatrixGetRow (ELEM_EDGEidof, big_k, &size2, &col_ind0, &boolean_data);
+      hypre_ParCSRMatrixGetRowView (ELEM_EDGEidof, i, &view);
+      size2 = hypre_ParCSRMatrixRowViewSize(&view);
       col_ind2 = hypre_TAlloc(HYPRE_BigInt, size2, HYPRE_MEMORY_HOST);
-      for (j = 0; j < size2; j++)
-      {
-         col_ind2[j] = col_ind0[j];
-      }
-      hypre_ParCSRMatrixRestoreRow (ELEM_EDGEidof, big_k, &size2, &col_ind0, &boolean_data);
+      hypre_ParCSRMatrixRowViewCopy (&view, col_ind2, NULL);
 
       /* Merge and sort the boundary dofs according to their global number */
       num_bdof = size1 + size2;
@@ -192,25 +223,19 @@ HYPRE_Int hypre_ND1AMGeInterpolation (hypre_ParCSRMatrix       * Aee,
          HYPRE_Int *I = hypre_CSRMatrixI(A);
          HYPRE_BigInt *J = hypre_CSRMatrixBigJ(A);
          HYPRE_Real *data = hypre_CSRMatrixData(A);
-         HYPRE_BigInt *tmp_J;
-         HYPRE_Real *tmp_data;
 
          HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
-         HYPRE_MemoryLocation memory_location_Aee = hypre_ParCSRMatrixMemoryLocation(Aee);
 
          I[0] = 0;
          for (j = 0; j < num_idof; j++)
          {
-            getrow_ierr = hypre_ParCSRMatrixGetRow (Aee, idof[j], &size1, &tmp_J, &tmp_data);
+            getrow_ierr = hypre_ND1AMGeCopyRow (Aee, idof[j], &size1, J, data, memory_location_A);
             if (getrow_ierr < 0)
             {
                hypre_printf("getrow Aee off proc[%d] = \n", myproc);
             }
-            hypre_TMemcpy(J, tmp_J, HYPRE_BigInt, size1, memory_location_A, memory_location_Aee);
-            hypre_TMemcpy(data, tmp_data, HYPRE_Real, size1, memory_location_A, memory_location_Aee);
             J += size1;
             data += size1;
-            hypre_ParCSRMatrixRestoreRow (Aee, idof[j], &size1, &tmp_J, &tmp_data);
             I[j + 1] = size1 + I[j];
          }
       }
@@ -224,74 +249,26 @@ HYPRE_Int hypre_ND1AMGeInterpolation (hypre_ParCSRMatrix       * Aee,
          HYPRE_Int *I = hypre_CSRMatrixI(P);
          HYPRE_BigInt *J = hypre_CSRMatrixBigJ(P);
          HYPRE_Real *data = hypre_CSRMatrixData(P);
+         HYPRE_BigInt row;
          HYPRE_Int     m;
 
          HYPRE_BigInt *tmp_J;
          HYPRE_Real *tmp_data;
 
          HYPRE_MemoryLocation memory_location_P = hypre_CSRMatrixMemoryLocation(P);
-         HYPRE_MemoryLocation memory_location_d = hypre_ParCSRMatrixMemoryLocation(dof_DOF);
 
          I[0] = 0;
-         for (j = 0; j < num_idof; j++)
+         for (j = 0; j < num_idof + num_bdof; j++)
          {
-            getrow_ierr = hypre_ParCSRMatrixGetRow (dof_DOF, idof[j], &size1, &tmp_J, &tmp_data);
-            if (getrow_ierr >= 0)
+            row = (j < num_idof) ? idof[j] : bdof[j - num_idof];
+            getrow_ierr = hypre_ND1AMGeCopyRow (dof_DOF, row, &size1, J, data, memory_location_P);
+            if (getrow_ierr < 0)    /* row offproc */
             {
-               hypre_TMemcpy(J, tmp_J, HYPRE_BigInt, size1, memory_location_P, memory_location_d);
-               hypre_TMemcpy(data, tmp_data, HYPRE_Real, size1, memory_location_P, memory_location_d);
-               J += size1;
-               data += size1;
-               hypre_ParCSRMatrixRestoreRow (dof_DOF, idof[j], &size1, &tmp_J, &tmp_data);
-               I[j + 1] = size1 + I[j];
-            }
-            else    /* row offproc */
-            {
-               hypre_ParCSRMatrixRestoreRow (dof_DOF, idof[j], &size1, &tmp_J, &tmp_data);
                /* search for OffProcRows */
                m = 0;
                while (m < num_OffProcRows)
                {
-                  if (offproc_rnums[m] == idof[j])
-                  {
-                     break;
-                  }
-                  else
-                  {
-                     m++;
-                  }
-               }
-               size1 = (OffProcRows[swap[m]] -> ncols);
-               tmp_J = (OffProcRows[swap[m]] -> cols);
-               tmp_data = (OffProcRows[swap[m]] -> data);
-               hypre_TMemcpy(J, tmp_J, HYPRE_BigInt, size1, memory_location_P, HYPRE_MEMORY_HOST);
-               hypre_TMemcpy(data, tmp_data, HYPRE_Real, size1, memory_location_P, HYPRE_MEMORY_HOST);
-               J += size1;
-               data += size1;
-               I[j + 1] = size1 + I[j];
-            }
-         }
-
-         for ( ; j < num_idof + num_bdof; j++)
-         {
-            getrow_ierr = hypre_ParCSRMatrixGetRow (dof_DOF, bdof[j - num_idof], &size1, &tmp_J, &tmp_data);
-            if (getrow_ierr >= 0)
-            {
-               hypre_TMemcpy(J, tmp_J, HYPRE_BigInt, size1, memory_location_P, memory_location_d);
-               hypre_TMemcpy(data, tmp_data, HYPRE_Real, size1, memory_location_P, memory_location_d);
-               J += size1;
-               data += size1;
-               hypre_ParCSRMatrixRestoreRow (dof_DOF, bdof[j - num_idof], &size1, &tmp_J, &tmp_data);
-               I[j + 1] = size1 + I[j];
-            }
-            else    /* row offproc */
-            {
-               hypre_ParCSRMatrixRestoreRow (dof_DOF, bdof[j - num_idof], &size1, &tmp_J, &tmp_data);
-               /* search for OffProcRows */
-               m = 0;
-               while (m < num_OffProcRows)
-               {
-                  if (offproc_rnums[m] == bdof[j - num_idof])
+                  if (offproc_rnums[m] == row)
                   {
                      break;
                   }
@@ -306,10 +283,10 @@ HYPRE_Int hypre_ND1AMGeInterpolation (hypre_ParCSRMatrix       * Aee,
                tmp_data = (OffProcRows[swap[m]] -> data);
                hypre_TMemcpy(J, tmp_J, HYPRE_BigInt, size1, memory_location_P, HYPRE_MEMORY_HOST);
                hypre_TMemcpy(data, tmp_data, HYPRE_Real, size1, memory_location_P, HYPRE_MEMORY_HOST);
-               J += size1;
-               data += size1;
-               I[j + 1] = size1 + I[j];
             }
+            J += size1;
+            data += size1;
+            I[j + 1] = size1 + I[j];
          }
       }
 
@@ -257,6 +257,9 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Weighted line Jacobi, with tridiagonal solves along the lines of each
+ *          box in the coarsening direction of the level.  The default weight
+ *          is 1 rather than the point Jacobi weights of type 1
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                        HYPRE_Int          relax_type);
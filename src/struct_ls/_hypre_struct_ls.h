@@ -39,6 +39,9 @@ hypre_StructMatrix *hypre_CycRedCreateCoarseOp ( hypre_StructMatrix *A,
                                                  hypre_StructGrid *coarse_grid, HYPRE_Int cdir );
 HYPRE_Int hypre_CycRedSetupCoarseOp ( hypre_StructMatrix *A, hypre_StructMatrix *Ac,
                                       hypre_Index cindex, hypre_Index cstride, HYPRE_Int cdir );
+HYPRE_Int hypre_CycRedSetupLines ( void *cyc_red_vdata, hypre_StructMatrix *A );
+HYPRE_Int hypre_CycRedSolveLines ( void *cyc_red_vdata, hypre_StructVector *b,
+                                   hypre_StructVector *x );
 HYPRE_Int hypre_CyclicReductionSetup ( void *cyc_red_vdata, hypre_StructMatrix *A,
                                        hypre_StructVector *b, hypre_StructVector *x );
 HYPRE_Int hypre_CyclicReduction ( void *cyc_red_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -107,6 +110,20 @@ HYPRE_Int hypre_JacobiGetNumIterations ( void *jacobi_vdata, HYPRE_Int *num_iter
 HYPRE_Int hypre_JacobiSetTempVec ( void *jacobi_vdata, hypre_StructVector *t );
 HYPRE_Int hypre_JacobiGetFinalRelativeResidualNorm ( void *jacobi_vdata, HYPRE_Real *norm );
 
+/* line_relax.c */
+void *hypre_LineRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_LineRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_LineRelaxSetup ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                 hypre_StructVector *x );
+HYPRE_Int hypre_LineRelax ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                            hypre_StructVector *x );
+HYPRE_Int hypre_LineRelaxSetTol ( void *relax_vdata, HYPRE_Real tol );
+HYPRE_Int hypre_LineRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_LineRelaxSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
+HYPRE_Int hypre_LineRelaxSetWeight ( void *relax_vdata, HYPRE_Real weight );
+HYPRE_Int hypre_LineRelaxSetDirection ( void *relax_vdata, HYPRE_Int dir );
+HYPRE_Int hypre_LineRelaxSetTempVec ( void *relax_vdata, hypre_StructVector *t );
+
 /* pcg_struct.c */
 void *hypre_StructKrylovCAlloc ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
 HYPRE_Int hypre_StructKrylovFree ( void *ptr );
@@ -250,6 +267,7 @@ HYPRE_Int hypre_PFMGRelaxSetup ( void *pfmg_relax_vdata, hypre_StructMatrix *A,
                                  hypre_StructVector *b, hypre_StructVector *x );
 HYPRE_Int hypre_PFMGRelaxSetType ( void *pfmg_relax_vdata, HYPRE_Int relax_type );
 HYPRE_Int hypre_PFMGRelaxSetJacobiWeight ( void *pfmg_relax_vdata, HYPRE_Real weight );
+HYPRE_Int hypre_PFMGRelaxSetLineDirection ( void *pfmg_relax_vdata, HYPRE_Int dir );
 HYPRE_Int hypre_PFMGRelaxSetPreRelax ( void *pfmg_relax_vdata );
 HYPRE_Int hypre_PFMGRelaxSetPostRelax ( void *pfmg_relax_vdata );
 HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata, HYPRE_Real tol );
@@ -46,6 +46,10 @@
       hypre_IndexD(stride, cdir) *= 2;                                  \
    }
 
+/* Number of lines that are reduced together, one per SIMD lane, by the
+ * batched line solver */
+#define hypre_CycRedNumLanes 8
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionData data structure
  *--------------------------------------------------------------------------*/
@@ -78,6 +82,15 @@ typedef struct
    HYPRE_Int             time_index;
    HYPRE_BigInt          solve_flops;
    HYPRE_Int             max_levels;
+
+   /* Batched line solver (see hypre_CycRedSetupLines) */
+   HYPRE_Int             line_solve;   /* use the batched line solver? */
+   HYPRE_Int            *level_start;  /* offset of each level along a line */
+   HYPRE_Int            *level_cpos;   /* position of the first C-point */
+   HYPRE_Int             num_bundles;
+   HYPRE_Int            *bundle_box;   /* base_points box of each bundle */
+   HYPRE_Int            *bundle_line;  /* first line of each bundle in its box */
+   HYPRE_Real           *bundle_coefs; /* packed (w,c,e) coefficients */
 } hypre_CyclicReductionData;
 
 /*--------------------------------------------------------------------------
@@ -460,6 +473,507 @@ hypre_CycRedSetupCoarseOp( hypre_StructMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CycRedNumLines
+ *
+ * Returns the number of lines in the cdir direction in box (on the lattice
+ * given by base_stride), and sets loop_size to the number of lines in each
+ * direction (1 in the cdir direction).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedNumLines( hypre_Box   *box,
+                      hypre_Index  base_stride,
+                      HYPRE_Int    cdir,
+                      hypre_Index  loop_size )
+{
+   HYPRE_Int  d, num_lines = 1;
+
+   hypre_SetIndex(loop_size, 1);
+   hypre_BoxGetStrideSize(box, base_stride, loop_size);
+   hypre_IndexD(loop_size, cdir) = 1;
+   for (d = 0; d < hypre_BoxNDim(box); d++)
+   {
+      num_lines *= hypre_IndexD(loop_size, d);
+   }
+
+   return (hypre_BoxSizeD(box, cdir) > 0) ? num_lines : 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedLineStart
+ *
+ * Sets index to the first point of line number 'line' in box.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CycRedLineStart( hypre_Box   *box,
+                       hypre_Index  base_stride,
+                       hypre_Index  loop_size,
+                       HYPRE_Int    line,
+                       hypre_Index  index )
+{
+   HYPRE_Int  d;
+
+   hypre_SetIndex(index, 0);
+   for (d = 0; d < hypre_BoxNDim(box); d++)
+   {
+      hypre_IndexD(index, d) = hypre_BoxIMinD(box, d) +
+                               (line % hypre_IndexD(loop_size, d)) * hypre_IndexD(base_stride, d);
+      line /= hypre_IndexD(loop_size, d);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSetupLines
+ *
+ * If every line in the cdir direction lies entirely within one local box,
+ * the lines are independent tridiagonal systems.  They need no communication
+ * and no level-by-level box loops.  In that case the lines are grouped into
+ * bundles of hypre_CycRedNumLanes.  The reduced coefficients of all levels
+ * are computed here and stored interleaved by lane, so the solve can work on
+ * a whole bundle with unit-stride inner loops and thread over bundles.  Each
+ * level uses the same C/F splitting and arithmetic as the level-by-level
+ * algorithm.  Couplings to points outside the line are dropped; they multiply
+ * the zero ghost values in the level-by-level algorithm.  Periodic grids
+ * always use the level-by-level algorithm.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CycRedSetupLines( void               *cyc_red_vdata,
+                        hypre_StructMatrix *A )
+{
+   hypre_CyclicReductionData *cyc_red_data = (hypre_CyclicReductionData *) cyc_red_vdata;
+
+   MPI_Comm                comm        = (cyc_red_data -> comm);
+   HYPRE_Int               num_levels  = (cyc_red_data -> num_levels);
+   HYPRE_Int               cdir        = (cyc_red_data -> cdir);
+   hypre_IndexRef          base_index  = (cyc_red_data -> base_index);
+   hypre_IndexRef          base_stride = (cyc_red_data -> base_stride);
+   hypre_BoxArray         *base_points = (cyc_red_data -> base_points);
+   hypre_StructGrid       *grid        = hypre_StructMatrixGrid(A);
+   hypre_Box              *bbox        = hypre_StructGridBoundingBox(grid);
+   HYPRE_Int               L           = hypre_CycRedNumLanes;
+
+   HYPRE_Int              *level_start;
+   HYPRE_Int              *level_cpos;
+   HYPRE_Int               num_bundles;
+   HYPRE_Int              *bundle_box;
+   HYPRE_Int              *bundle_line;
+   HYPRE_Real             *bundle_coefs;
+
+   hypre_Box              *box;
+   hypre_Index             loop_size;
+   HYPRE_Int               line_solve, num_lines, num_points, lo, n, c0;
+   HYPRE_Int               bi, i, d, line;
+
+   /*-----------------------------------------------------
+    * Check that the lines are complete, and that the
+    * matrix data can be accessed directly on the host
+    *-----------------------------------------------------*/
+
+   line_solve = 1;
+   if ( hypre_GetExecPolicy1(hypre_StructMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST ||
+        hypre_StructMatrixConstantCoefficient(A) ||
+        hypre_IndexD(base_stride, cdir) != 1 )
+   {
+      line_solve = 0;
+   }
+   for (d = 0; d < hypre_StructGridNDim(grid); d++)
+   {
+      if (hypre_IndexD(hypre_StructGridPeriodic(grid), d))
+      {
+         line_solve = 0;
+      }
+   }
+   hypre_ForBoxI(i, base_points)
+   {
+      box = hypre_BoxArrayBox(base_points, i);
+      if ( hypre_BoxVolume(box) > 0 &&
+           (hypre_BoxIMinD(box, cdir) != hypre_BoxIMinD(bbox, cdir) ||
+            hypre_BoxIMaxD(box, cdir) != hypre_BoxIMaxD(bbox, cdir)) )
+      {
+         line_solve = 0;
+      }
+   }
+   hypre_MPI_Allreduce(&line_solve, &(cyc_red_data -> line_solve), 1, HYPRE_MPI_INT,
+                       hypre_MPI_MIN, comm);
+   if (!(cyc_red_data -> line_solve))
+   {
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------
+    * Level structure, common to all lines
+    *-----------------------------------------------------*/
+
+   level_start = hypre_TAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   level_cpos  = hypre_TAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+
+   lo = hypre_BoxIMinD(bbox, cdir);
+   n  = hypre_BoxSizeD(bbox, cdir);
+   level_start[0] = 0;
+   for (i = 0; i < num_levels; i++)
+   {
+      level_start[i + 1] = level_start[i] + n;
+
+      /* C-points are at c0 + 2k in the indexing of the level */
+      c0 = (i > 0) ? 0 : hypre_IndexD(base_index, cdir);
+      level_cpos[i] = ((c0 - lo) % 2 + 2) % 2;
+      lo = (lo + level_cpos[i] - c0) / 2;
+      n  = (n - level_cpos[i] + 1) / 2;
+   }
+   num_points = level_start[num_levels];
+
+   /*-----------------------------------------------------
+    * Bundle the lines of each box
+    *-----------------------------------------------------*/
+
+   num_bundles = 0;
+   hypre_ForBoxI(i, base_points)
+   {
+      box = hypre_BoxArrayBox(base_points, i);
+      num_lines = hypre_CycRedNumLines(box, base_stride, cdir, loop_size);
+      num_bundles += (num_lines + L - 1) / L;
+   }
+
+   bundle_box   = hypre_TAlloc(HYPRE_Int, num_bundles, HYPRE_MEMORY_HOST);
+   bundle_line  = hypre_TAlloc(HYPRE_Int, num_bundles, HYPRE_MEMORY_HOST);
+   bundle_coefs = hypre_CTAlloc(HYPRE_Real, (size_t) num_bundles * num_points * 3 * L,
+                                HYPRE_MEMORY_HOST);
+
+   num_bundles = 0;
+   hypre_ForBoxI(i, base_points)
+   {
+      box = hypre_BoxArrayBox(base_points, i);
+      num_lines = hypre_CycRedNumLines(box, base_stride, cdir, loop_size);
+      for (line = 0; line < num_lines; line += L)
+      {
+         bundle_box[num_bundles]  = i;
+         bundle_line[num_bundles] = line;
+         num_bundles++;
+      }
+   }
+
+   /*-----------------------------------------------------
+    * Pack the fine-line coefficients and compute those
+    * of the coarse levels, one bundle at a time.  Each
+    * point holds (w,c,e), each interleaved by lane.
+    *-----------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(bi) HYPRE_SMP_SCHEDULE
+#endif
+   for (bi = 0; bi < num_bundles; bi++)
+   {
+      hypre_Box   *bbox_i = hypre_BoxArrayBox(base_points, bundle_box[bi]);
+      hypre_Box   *A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), bundle_box[bi]);
+      HYPRE_Real  *coefs  = bundle_coefs + (size_t) bi * num_points * 3 * L;
+      HYPRE_Real  *Ap, *Awp, *Aep, *fc, *cc;
+      hypre_Index  index, lsize;
+      HYPRE_Int    blines, lane, l, p, q, iA, offsetA, nl;
+
+      hypre_SetIndex(index, 0);
+      Ap = hypre_StructMatrixExtractPointerByIndex(A, bundle_box[bi], index);
+      hypre_IndexD(index, cdir) = -1;
+      Awp = hypre_StructMatrixExtractPointerByIndex(A, bundle_box[bi], index);
+      hypre_IndexD(index, cdir) = 1;
+      Aep = hypre_StructMatrixExtractPointerByIndex(A, bundle_box[bi], index);
+      offsetA = hypre_BoxOffsetDistance(A_dbox, index);
+
+      blines = hypre_CycRedNumLines(bbox_i, base_stride, cdir, lsize) - bundle_line[bi];
+      nl = level_start[1];
+      for (lane = 0; lane < L; lane++)
+      {
+         if (lane < blines)
+         {
+            hypre_CycRedLineStart(bbox_i, base_stride, lsize, bundle_line[bi] + lane, index);
+            iA = hypre_BoxIndexRank(A_dbox, index);
+            for (p = 0; p < nl; p++, iA += offsetA)
+            {
+               coefs[(3 * p    ) * L + lane] = (p > 0)      ? Awp[iA] : 0.0;
+               coefs[(3 * p + 1) * L + lane] = Ap[iA];
+               coefs[(3 * p + 2) * L + lane] = (p < nl - 1) ? Aep[iA] : 0.0;
+            }
+         }
+         else
+         {
+            /* Unused lanes get the identity */
+            for (p = 0; p < nl; p++)
+            {
+               coefs[(3 * p + 1) * L + lane] = 1.0;
+            }
+         }
+      }
+
+      for (l = 0; l < (num_levels - 1); l++)
+      {
+         nl = level_start[l + 1] - level_start[l];
+         for (p = level_cpos[l]; p < nl; p += 2)
+         {
+            q  = (p - level_cpos[l]) / 2;
+            fc = coefs + (size_t) 3 * (level_start[l] + p) * L;
+            cc = coefs + (size_t) 3 * (level_start[l + 1] + q) * L;
+
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp simd
+#endif
+            for (lane = 0; lane < L; lane++)
+            {
+               cc[L + lane] = fc[L + lane];
+            }
+            if (p > 0)
+            {
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp simd
+#endif
+               for (lane = 0; lane < L; lane++)
+               {
+                  cc[lane]      = -fc[lane] * fc[lane - 3 * L] / fc[lane - 2 * L];
+                  cc[L + lane] -= fc[lane] * fc[lane - L] / fc[lane - 2 * L];
+               }
+            }
+            if (p < nl - 1)
+            {
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp simd
+#endif
+               for (lane = 0; lane < L; lane++)
+               {
+                  cc[L + lane]    -= fc[2 * L + lane] * fc[3 * L + lane] / fc[4 * L + lane];
+                  cc[2 * L + lane] = -fc[2 * L + lane] * fc[5 * L + lane] / fc[4 * L + lane];
+               }
+            }
+         }
+      }
+   }
+
+   (cyc_red_data -> level_start)  = level_start;
+   (cyc_red_data -> level_cpos)   = level_cpos;
+   (cyc_red_data -> num_bundles)  = num_bundles;
+   (cyc_red_data -> bundle_box)   = bundle_box;
+   (cyc_red_data -> bundle_line)  = bundle_line;
+   (cyc_red_data -> bundle_coefs) = bundle_coefs;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSolveLines
+ *
+ * Batched version of hypre_CyclicReduction for the case set up by
+ * hypre_CycRedSetupLines.  Each thread gathers the right-hand sides of one
+ * bundle into a lane-interleaved workspace that holds all levels, reduces
+ * the bundle down to the coarsest level and back, and scatters the result.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CycRedSolveLines( void               *cyc_red_vdata,
+                        hypre_StructVector *b,
+                        hypre_StructVector *x )
+{
+   hypre_CyclicReductionData *cyc_red_data = (hypre_CyclicReductionData *) cyc_red_vdata;
+
+   HYPRE_Int               num_levels   = (cyc_red_data -> num_levels);
+   HYPRE_Int               cdir         = (cyc_red_data -> cdir);
+   hypre_IndexRef          base_stride  = (cyc_red_data -> base_stride);
+   hypre_BoxArray         *base_points  = (cyc_red_data -> base_points);
+   HYPRE_Int              *level_start  = (cyc_red_data -> level_start);
+   HYPRE_Int              *level_cpos   = (cyc_red_data -> level_cpos);
+   HYPRE_Int               num_bundles  = (cyc_red_data -> num_bundles);
+   HYPRE_Int              *bundle_box   = (cyc_red_data -> bundle_box);
+   HYPRE_Int              *bundle_line  = (cyc_red_data -> bundle_line);
+   HYPRE_Real             *bundle_coefs = (cyc_red_data -> bundle_coefs);
+   HYPRE_Int               num_points   = level_start[num_levels];
+   HYPRE_Int               L            = hypre_CycRedNumLanes;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Real  *xw = hypre_TAlloc(HYPRE_Real, num_points * L, HYPRE_MEMORY_HOST);
+      HYPRE_Real  *coefs, *fc, *xf, *xc, *xp, *bp;
+      hypre_Box   *bbox_i, *x_dbox, *b_dbox;
+      hypre_Index  index, lsize;
+      HYPRE_Int    bi, blines, lane, l, p, q, nl, xi, bj, offsetx, offsetb;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (bi = 0; bi < num_bundles; bi++)
+      {
+         bbox_i = hypre_BoxArrayBox(base_points, bundle_box[bi]);
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), bundle_box[bi]);
+         b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), bundle_box[bi]);
+         xp     = hypre_StructVectorBoxData(x, bundle_box[bi]);
+         bp     = hypre_StructVectorBoxData(b, bundle_box[bi]);
+         coefs  = bundle_coefs + (size_t) bi * num_points * 3 * L;
+
+         hypre_SetIndex(index, 0);
+         hypre_IndexD(index, cdir) = 1;
+         offsetx = hypre_BoxOffsetDistance(x_dbox, index);
+         offsetb = hypre_BoxOffsetDistance(b_dbox, index);
+
+         /* Gather the right-hand sides */
+         blines = hypre_CycRedNumLines(bbox_i, base_stride, cdir, lsize) - bundle_line[bi];
+         nl = level_start[1];
+         for (lane = 0; lane < L; lane++)
+         {
+            if (lane < blines)
+            {
+               hypre_CycRedLineStart(bbox_i, base_stride, lsize, bundle_line[bi] + lane, index);
+               bj = hypre_BoxIndexRank(b_dbox, index);
+               for (p = 0; p < nl; p++, bj += offsetb)
+               {
+                  xw[p * L + lane] = bp[bj];
+               }
+            }
+            else
+            {
+               for (p = 0; p < nl; p++)
+               {
+                  xw[p * L + lane] = 0.0;
+               }
+            }
+         }
+
+         /* Down cycle: F-relaxation, then injection of the residual at C-points */
+         for (l = 0; l < (num_levels - 1); l++)
+         {
+            nl = level_start[l + 1] - level_start[l];
+            xf = xw + (size_t) level_start[l] * L;
+            xc = xw + (size_t) level_start[l + 1] * L;
+            fc = coefs + (size_t) 3 * level_start[l] * L;
+
+            for (p = 1 - level_cpos[l]; p < nl; p += 2)
+            {
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp simd
+#endif
+               for (lane = 0; lane < L; lane++)
+               {
+                  xf[p * L + lane] /= fc[(3 * p + 1) * L + lane];
+               }
+            }
+            for (p = level_cpos[l]; p < nl; p += 2)
+            {
+               q = (p - level_cpos[l]) / 2;
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp simd
+#endif
+               for (lane = 0; lane < L; lane++)
+               {
+                  xc[q * L + lane] = xf[p * L + lane];
+               }
+               if (p > 0)
+               {
+#ifdef HYPRE_USING_OPENMP
+                  #pragma omp simd
+#endif
+                  for (lane = 0; lane < L; lane++)
+                  {
+                     xc[q * L + lane] -= fc[(3 * p) * L + lane] * xf[(p - 1) * L + lane];
+                  }
+               }
+               if (p < nl - 1)
+               {
+#ifdef HYPRE_USING_OPENMP
+                  #pragma omp simd
+#endif
+                  for (lane = 0; lane < L; lane++)
+                  {
+                     xc[q * L + lane] -= fc[(3 * p + 2) * L + lane] * xf[(p + 1) * L + lane];
+                  }
+               }
+            }
+         }
+
+         /* Coarsest level, checking for a zero diagonal (singular problems) */
+         nl = level_start[l + 1] - level_start[l];
+         xf = xw + (size_t) level_start[l] * L;
+         fc = coefs + (size_t) 3 * level_start[l] * L;
+         for (p = 0; p < nl; p++)
+         {
+            for (lane = 0; lane < L; lane++)
+            {
+               if (fc[(3 * p + 1) * L + lane] != 0.0)
+               {
+                  xf[p * L + lane] /= fc[(3 * p + 1) * L + lane];
+               }
+            }
+         }
+
+         /* Up cycle: inject the coarse solution, then F-relaxation */
+         for (l = (num_levels - 2); l >= 0; l--)
+         {
+            nl = level_start[l + 1] - level_start[l];
+            xf = xw + (size_t) level_start[l] * L;
+            xc = xw + (size_t) level_start[l + 1] * L;
+            fc = coefs + (size_t) 3 * level_start[l] * L;
+
+            for (p = level_cpos[l]; p < nl; p += 2)
+            {
+               q = (p - level_cpos[l]) / 2;
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp simd
+#endif
+               for (lane = 0; lane < L; lane++)
+               {
+                  xf[p * L + lane] = xc[q * L + lane];
+               }
+            }
+            for (p = 1 - level_cpos[l]; p < nl; p += 2)
+            {
+               if (p > 0 && p < nl - 1)
+               {
+#ifdef HYPRE_USING_OPENMP
+                  #pragma omp simd
+#endif
+                  for (lane = 0; lane < L; lane++)
+                  {
+                     xf[p * L + lane] -= (fc[(3 * p) * L + lane] * xf[(p - 1) * L + lane] +
+                                          fc[(3 * p + 2) * L + lane] * xf[(p + 1) * L + lane]) /
+                                         fc[(3 * p + 1) * L + lane];
+                  }
+               }
+               else if (p > 0)
+               {
+                  for (lane = 0; lane < L; lane++)
+                  {
+                     xf[p * L + lane] -= fc[(3 * p) * L + lane] * xf[(p - 1) * L + lane] /
+                                         fc[(3 * p + 1) * L + lane];
+                  }
+               }
+               else if (p < nl - 1)
+               {
+                  for (lane = 0; lane < L; lane++)
+                  {
+                     xf[p * L + lane] -= fc[(3 * p + 2) * L + lane] * xf[(p + 1) * L + lane] /
+                                         fc[(3 * p + 1) * L + lane];
+                  }
+               }
+            }
+         }
+
+         /* Scatter the solution */
+         nl = level_start[1];
+         for (lane = 0; lane < hypre_min(blines, L); lane++)
+         {
+            hypre_CycRedLineStart(bbox_i, base_stride, lsize, bundle_line[bi] + lane, index);
+            xi = hypre_BoxIndexRank(x_dbox, index);
+            for (p = 0; p < nl; p++, xi += offsetx)
+            {
+               xp[xi] = xw[p * L + lane];
+            }
+         }
+      }
+
+      hypre_TFree(xw, HYPRE_MEMORY_HOST);
+   } /* omp parallel */
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionSetup
  *--------------------------------------------------------------------------*/
@@ -596,12 +1110,20 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
 
    (cyc_red_data -> fine_points_l)   = fine_points_l;
 
+   /*-----------------------------------------------------
+    * Set up the batched line solver.  When it applies,
+    * the coarse matrices, vectors and compute packages
+    * below are not needed and are left NULL.
+    *-----------------------------------------------------*/
+
+   hypre_CycRedSetupLines(cyc_red_vdata, A);
+
    /*-----------------------------------------------------
     * Set up matrix and vector structures
     *-----------------------------------------------------*/
 
-   A_l  = hypre_TAlloc(hypre_StructMatrix *,  num_levels, HYPRE_MEMORY_HOST);
-   x_l  = hypre_TAlloc(hypre_StructVector *,  num_levels, HYPRE_MEMORY_HOST);
+   A_l  = hypre_CTAlloc(hypre_StructMatrix *,  num_levels, HYPRE_MEMORY_HOST);
+   x_l  = hypre_CTAlloc(hypre_StructVector *,  num_levels, HYPRE_MEMORY_HOST);
 
    A_l[0] = hypre_StructMatrixRef(A);
    x_l[0] = hypre_StructVectorRef(x);
@@ -609,7 +1131,7 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
    x_num_ghost[2 * cdir]     = 1;
    x_num_ghost[2 * cdir + 1] = 1;
 
-   for (l = 0; l < (num_levels - 1); l++)
+   for (l = 0; l < (num_levels - 1) && !(cyc_red_data -> line_solve); l++)
    {
       A_l[l + 1] = hypre_CycRedCreateCoarseOp(A_l[l], grid_l[l + 1], cdir);
       //hypre_StructMatrixInitializeShell(A_l[l+1]);
@@ -629,7 +1151,7 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
    (cyc_red_data -> data) = data;
    (cyc_red_data -> data_const) = data_const;
 
-   for (l = 0; l < (num_levels - 1); l++)
+   for (l = 0; l < (num_levels - 1) && !(cyc_red_data -> line_solve); l++)
    {
       hypre_StructMatrixInitializeData(A_l[l + 1], data, data_const);
       data += hypre_StructMatrixDataSize(A_l[l + 1]);
@@ -662,7 +1184,7 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
     * Set up coarse grid operators
     *-----------------------------------------------------*/
 
-   for (l = 0; l < (num_levels - 1); l++)
+   for (l = 0; l < (num_levels - 1) && !(cyc_red_data -> line_solve); l++)
    {
       hypre_CycRedSetCIndex(base_index, base_stride, l, cdir, cindex);
       hypre_CycRedSetStride(base_index, base_stride, l, cdir, stride);
@@ -674,10 +1196,10 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
     * Set up compute packages
     *----------------------------------------------------------*/
 
-   down_compute_pkg_l = hypre_TAlloc(hypre_ComputePkg *,  (num_levels - 1), HYPRE_MEMORY_HOST);
-   up_compute_pkg_l   = hypre_TAlloc(hypre_ComputePkg *,  (num_levels - 1), HYPRE_MEMORY_HOST);
+   down_compute_pkg_l = hypre_CTAlloc(hypre_ComputePkg *,  (num_levels - 1), HYPRE_MEMORY_HOST);
+   up_compute_pkg_l   = hypre_CTAlloc(hypre_ComputePkg *,  (num_levels - 1), HYPRE_MEMORY_HOST);
 
-   for (l = 0; l < (num_levels - 1); l++)
+   for (l = 0; l < (num_levels - 1) && !(cyc_red_data -> line_solve); l++)
    {
       hypre_CycRedSetCIndex(base_index, base_stride, l, cdir, cindex);
       hypre_CycRedSetFIndex(base_index, base_stride, l, cdir, findex);
@@ -715,19 +1237,19 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
                    hypre_IndexY(base_stride) *
                    hypre_IndexZ(base_stride)  );
    (cyc_red_data -> solve_flops) =
-      hypre_StructVectorGlobalSize(x_l[0]) / 2 / (HYPRE_BigInt)flop_divisor;
+      hypre_StructGridGlobalSize(grid_l[0]) / 2 / (HYPRE_BigInt)flop_divisor;
    (cyc_red_data -> solve_flops) +=
-      5 * hypre_StructVectorGlobalSize(x_l[0]) / 2 / (HYPRE_BigInt)flop_divisor;
+      5 * hypre_StructGridGlobalSize(grid_l[0]) / 2 / (HYPRE_BigInt)flop_divisor;
    for (l = 1; l < (num_levels - 1); l++)
    {
       (cyc_red_data -> solve_flops) +=
-         10 * hypre_StructVectorGlobalSize(x_l[l]) / 2;
+         10 * hypre_StructGridGlobalSize(grid_l[l]) / 2;
    }
 
    if (num_levels > 1)
    {
       (cyc_red_data -> solve_flops) +=
-         hypre_StructVectorGlobalSize(x_l[l]) / 2;
+         hypre_StructGridGlobalSize(grid_l[l]) / 2;
    }
 
 
@@ -826,6 +1348,16 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
    A_l[0] = hypre_StructMatrixRef(A);
    x_l[0] = hypre_StructVectorRef(x);
 
+   if (cyc_red_data -> line_solve)
+   {
+      hypre_CycRedSolveLines(cyc_red_vdata, b, x);
+
+      hypre_IncFLOPCount(cyc_red_data -> solve_flops);
+      hypre_EndTiming(cyc_red_data -> time_index);
+
+      return hypre_error_flag;
+   }
+
    /*--------------------------------------------------
     * Copy b into x
     *--------------------------------------------------*/
@@ -1238,6 +1770,11 @@ hypre_CyclicReductionDestroy( void *cyc_red_vdata )
       hypre_TFree(cyc_red_data -> x_l, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> down_compute_pkg_l, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> up_compute_pkg_l, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> level_start, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> level_cpos, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> bundle_box, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> bundle_line, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> bundle_coefs, HYPRE_MEMORY_HOST);
 
       hypre_FinalizeTiming(cyc_red_data -> time_index);
       hypre_TFree(cyc_red_data, HYPRE_MEMORY_HOST);
@@ -0,0 +1,749 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Weighted line Jacobi relaxation.
+ *
+ * Each local box is split into lines along direction dir, and each iteration
+ * does x = x + weight * T^{-1} (b - A x), where T holds the couplings of A
+ * within the lines (a tridiagonal matrix per line).  Couplings to other lines
+ * and to points outside of the box only enter through the residual.  The
+ * Thomas factors of T are computed at setup, and the solve sweeps along the
+ * lines with box loops over the plane of all lines in a box, so adjacent
+ * lines are processed together.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+
+/* number of adjacent lines swept together by the host line solver */
+#define hypre_LineRelaxSlabSize 64
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Real              tol;                /* not yet used */
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Real              weight;
+   HYPRE_Int               dir;                /* line direction */
+
+   hypre_StructMatrix     *A;
+   hypre_StructVector     *b;
+   hypre_StructVector     *x;
+   hypre_StructVector     *t;
+
+   void                   *matvec_data;
+
+   /* Thomas factors, three arrays of the box volume per local box:
+    * the line's lower coefficients, the modified upper coefficients
+    * c' and the inverse pivots */
+   HYPRE_Int              *factor_starts;
+   HYPRE_Real             *factors;
+
+   /* log info (always logged) */
+   HYPRE_Int               num_iterations;
+   HYPRE_Int               time_index;
+
+} hypre_LineRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_LineRelaxCreate( MPI_Comm  comm )
+{
+   hypre_LineRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_LineRelaxData,  1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("LineRelax");
+
+   /* set defaults */
+   (relax_data -> tol)           = 1.0e-06;
+   (relax_data -> max_iter)      = 1000;
+   (relax_data -> zero_guess)    = 0;
+   (relax_data -> weight)        = 1.0;
+   (relax_data -> dir)           = 0;
+   (relax_data -> A)             = NULL;
+   (relax_data -> b)             = NULL;
+   (relax_data -> x)             = NULL;
+   (relax_data -> t)             = NULL;
+   (relax_data -> matvec_data)   = NULL;
+   (relax_data -> factor_starts) = NULL;
+   (relax_data -> factors)       = NULL;
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxDestroy( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      if (relax_data -> A)
+      {
+         hypre_TFree(relax_data -> factors, hypre_StructMatrixMemoryLocation(relax_data -> A));
+      }
+      hypre_TFree(relax_data -> factor_starts, HYPRE_MEMORY_HOST);
+      hypre_StructMatvecDestroy(relax_data -> matvec_data);
+      hypre_StructMatrixDestroy(relax_data -> A);
+      hypre_StructVectorDestroy(relax_data -> b);
+      hypre_StructVectorDestroy(relax_data -> x);
+      hypre_StructVectorDestroy(relax_data -> t);
+
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineRelaxGetCoef
+ *
+ * Copies the coefficient of stencil entry 'rank', taken at the point
+ * shifted by 'shift', into f over the box.  A negative rank gives zeros.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_LineRelaxGetCoef( hypre_StructMatrix *A,
+                        HYPRE_Int           i,
+                        hypre_Box          *box,
+                        HYPRE_Int           rank,
+                        HYPRE_Int           constant,
+                        hypre_Index         shift,
+                        HYPRE_Real         *fp )
+{
+   HYPRE_Int       ndim = hypre_StructMatrixNDim(A);
+   hypre_Box      *A_dbox;
+   HYPRE_Real     *Ap;
+   HYPRE_Real      value;
+   HYPRE_Int       Aoff;
+   hypre_IndexRef  start;
+   hypre_Index     stride, loop_size;
+
+   start = hypre_BoxIMin(box);
+   hypre_SetIndex(stride, 1);
+   hypre_BoxGetSize(box, loop_size);
+
+   if (rank < 0 || constant)
+   {
+      value = 0.0;
+      if (rank >= 0)
+      {
+         A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+         Ap     = hypre_StructMatrixBoxData(A, i, rank);
+         value  = Ap[hypre_CCBoxIndexRank(A_dbox, start)];
+      }
+
+#define DEVICE_VAR is_device_ptr(fp)
+      hypre_BoxLoop1Begin(ndim, loop_size,
+                          box, start, stride, fi);
+      {
+         fp[fi] = value;
+      }
+      hypre_BoxLoop1End(fi);
+#undef DEVICE_VAR
+   }
+   else
+   {
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      Ap     = hypre_StructMatrixBoxData(A, i, rank);
+      Aoff   = hypre_BoxOffsetDistance(A_dbox, shift);
+
+#define DEVICE_VAR is_device_ptr(fp,Ap)
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          A_dbox, start, stride, Ai,
+                          box, start, stride, fi);
+      {
+         fp[fi] = Ap[Ai + Aoff];
+      }
+      hypre_BoxLoop2End(Ai, fi);
+#undef DEVICE_VAR
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetup( void               *relax_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x )
+{
+   hypre_LineRelaxData   *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   HYPRE_Int              dir = (relax_data -> dir);
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_Int              symmetric = hypre_StructMatrixSymmetric(A);
+   HYPRE_MemoryLocation   memory_location = hypre_StructMatrixMemoryLocation(A);
+
+   hypre_StructGrid      *grid;
+   hypre_StructStencil   *stencil;
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_StructVector    *t;
+
+   hypre_Index            zero_index, lower_index, upper_index;
+   hypre_Index            start, stride, loop_size;
+   HYPRE_Int              diag_rank, lower_rank, upper_rank;
+   HYPRE_Int              num_boxes, volume, n, foff, pos, i;
+   HYPRE_Real            *fa, *fc, *fd;
+
+   /*----------------------------------------------------------
+    * Set up the temp vector and the residual routine
+    *----------------------------------------------------------*/
+
+   if ((relax_data -> t) == NULL)
+   {
+      t = hypre_StructVectorCreate(hypre_StructVectorComm(b),
+                                   hypre_StructVectorGrid(b));
+      hypre_StructVectorSetNumGhost(t, hypre_StructVectorNumGhost(x));
+      hypre_StructVectorInitialize(t);
+      hypre_StructVectorAssemble(t);
+      (relax_data -> t) = t;
+   }
+
+   hypre_StructMatvecDestroy(relax_data -> matvec_data);
+   (relax_data -> matvec_data) = hypre_StructMatvecCreate();
+   hypre_StructMatvecSetup((relax_data -> matvec_data), A, x);
+
+   if (relax_data -> A)
+   {
+      hypre_TFree(relax_data -> factors, hypre_StructMatrixMemoryLocation(relax_data -> A));
+   }
+   hypre_TFree(relax_data -> factor_starts, HYPRE_MEMORY_HOST);
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+   (relax_data -> x) = hypre_StructVectorRef(x);
+   (relax_data -> b) = hypre_StructVectorRef(b);
+
+   /*----------------------------------------------------------
+    * Find the line couplings.  With symmetric storage, a missing
+    * coupling is the opposite one taken at the neighboring point.
+    *----------------------------------------------------------*/
+
+   grid    = hypre_StructMatrixGrid(A);
+   stencil = hypre_StructMatrixStencil(A);
+   boxes   = hypre_StructGridBoxes(grid);
+
+   hypre_SetIndex(zero_index, 0);
+   hypre_SetIndex(lower_index, 0);
+   hypre_SetIndex(upper_index, 0);
+   hypre_IndexD(lower_index, dir) = -1;
+   hypre_IndexD(upper_index, dir) =  1;
+
+   diag_rank  = hypre_StructStencilElementRank(stencil, zero_index);
+   lower_rank = hypre_StructStencilElementRank(stencil, lower_index);
+   upper_rank = hypre_StructStencilElementRank(stencil, upper_index);
+
+   /*----------------------------------------------------------
+    * Compute the Thomas factors of each line
+    *----------------------------------------------------------*/
+
+   num_boxes = hypre_BoxArraySize(boxes);
+   (relax_data -> factor_starts) = hypre_TAlloc(HYPRE_Int, num_boxes + 1, HYPRE_MEMORY_HOST);
+   (relax_data -> factor_starts)[0] = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      volume = hypre_BoxVolume(hypre_BoxArrayBox(boxes, i));
+      (relax_data -> factor_starts)[i + 1] = (relax_data -> factor_starts)[i] + 3 * volume;
+   }
+   (relax_data -> factors) = hypre_TAlloc(HYPRE_Real, (relax_data -> factor_starts)[num_boxes],
+                                          memory_location);
+
+   hypre_SetIndex(stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      volume = hypre_BoxVolume(box);
+      fa     = (relax_data -> factors) + (relax_data -> factor_starts)[i];
+      fc     = fa + volume;
+      fd     = fc + volume;
+
+      /* fa = lower, fd = diagonal, fc = upper coefficients */
+      if (lower_rank < 0 && symmetric)
+      {
+         hypre_LineRelaxGetCoef(A, i, box, upper_rank, (constant_coefficient > 0),
+                                lower_index, fa);
+      }
+      else
+      {
+         hypre_LineRelaxGetCoef(A, i, box, lower_rank, (constant_coefficient > 0),
+                                zero_index, fa);
+      }
+      hypre_LineRelaxGetCoef(A, i, box, diag_rank, (constant_coefficient == 1),
+                             zero_index, fd);
+      if (upper_rank < 0 && symmetric)
+      {
+         hypre_LineRelaxGetCoef(A, i, box, lower_rank, (constant_coefficient > 0),
+                                upper_index, fc);
+      }
+      else
+      {
+         hypre_LineRelaxGetCoef(A, i, box, upper_rank, (constant_coefficient > 0),
+                                zero_index, fc);
+      }
+
+      /* sweep along the lines; fc is zero at the end of the line */
+      hypre_BoxGetSize(box, loop_size);
+      n = hypre_IndexD(loop_size, dir);
+      hypre_IndexD(loop_size, dir) = 1;
+      foff = hypre_BoxOffsetDistance(box, upper_index);
+      for (pos = 0; pos < n; pos++)
+      {
+         hypre_CopyIndex(hypre_BoxIMin(box), start);
+         hypre_IndexD(start, dir) += pos;
+
+         if (pos == 0)
+         {
+#define DEVICE_VAR is_device_ptr(fc,fd)
+            hypre_BoxLoop1Begin(ndim, loop_size,
+                                box, start, stride, fi);
+            {
+               fd[fi] = 1.0 / fd[fi];
+               fc[fi] = (n > 1) ? fc[fi] * fd[fi] : 0.0;
+            }
+            hypre_BoxLoop1End(fi);
+#undef DEVICE_VAR
+         }
+         else
+         {
+#define DEVICE_VAR is_device_ptr(fa,fc,fd)
+            hypre_BoxLoop1Begin(ndim, loop_size,
+                                box, start, stride, fi);
+            {
+               fd[fi] = 1.0 / (fd[fi] - fa[fi] * fc[fi - foff]);
+               fc[fi] = (pos < n - 1) ? fc[fi] * fd[fi] : 0.0;
+            }
+            hypre_BoxLoop1End(fi);
+#undef DEVICE_VAR
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineRelaxSolveBox
+ *
+ * Solves T t = t on the lines of one box and sets x = x + weight t, or
+ * x = weight t if zero is set.  Uses one box loop over the plane of lines
+ * per position along the lines.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_LineRelaxSolveBox( hypre_Box   *box,
+                         HYPRE_Int    dir,
+                         HYPRE_Real  *fa,
+                         HYPRE_Real  *fc,
+                         HYPRE_Real  *fd,
+                         hypre_Box   *t_dbox,
+                         HYPRE_Real  *tp,
+                         hypre_Box   *x_dbox,
+                         HYPRE_Real  *xp,
+                         HYPRE_Real   weight,
+                         HYPRE_Int    zero )
+{
+   HYPRE_Int    ndim = hypre_BoxNDim(box);
+   hypre_Index  unit_index, start, stride, loop_size;
+   HYPRE_Real   xscale = zero ? 0.0 : 1.0;
+   HYPRE_Int    n, toff, pos;
+
+   hypre_SetIndex(unit_index, 0);
+   hypre_IndexD(unit_index, dir) = 1;
+   hypre_SetIndex(stride, 1);
+
+   hypre_BoxGetSize(box, loop_size);
+   n = hypre_IndexD(loop_size, dir);
+   hypre_IndexD(loop_size, dir) = 1;
+   toff = hypre_BoxOffsetDistance(t_dbox, unit_index);
+
+   /* forward elimination */
+   for (pos = 0; pos < n; pos++)
+   {
+      hypre_CopyIndex(hypre_BoxIMin(box), start);
+      hypre_IndexD(start, dir) += pos;
+
+      if (pos == 0)
+      {
+#define DEVICE_VAR is_device_ptr(tp,fd)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             box, start, stride, fi,
+                             t_dbox, start, stride, ti);
+         {
+            tp[ti] *= fd[fi];
+         }
+         hypre_BoxLoop2End(fi, ti);
+#undef DEVICE_VAR
+      }
+      else
+      {
+#define DEVICE_VAR is_device_ptr(tp,fa,fd)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             box, start, stride, fi,
+                             t_dbox, start, stride, ti);
+         {
+            tp[ti] = (tp[ti] - fa[fi] * tp[ti - toff]) * fd[fi];
+         }
+         hypre_BoxLoop2End(fi, ti);
+#undef DEVICE_VAR
+      }
+   }
+
+   /* back substitution and update of x; fc is zero at the end of the line */
+   for (pos = n - 1; pos >= 0; pos--)
+   {
+      hypre_CopyIndex(hypre_BoxIMin(box), start);
+      hypre_IndexD(start, dir) += pos;
+
+      if (pos < n - 1)
+      {
+#define DEVICE_VAR is_device_ptr(tp,fc)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             box, start, stride, fi,
+                             t_dbox, start, stride, ti);
+         {
+            tp[ti] -= fc[fi] * tp[ti + toff];
+         }
+         hypre_BoxLoop2End(fi, ti);
+#undef DEVICE_VAR
+      }
+
+#define DEVICE_VAR is_device_ptr(tp,xp)
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          t_dbox, start, stride, ti,
+                          x_dbox, start, stride, xi);
+      {
+         xp[xi] = xscale * xp[xi] + weight * tp[ti];
+      }
+      hypre_BoxLoop2End(ti, xi);
+#undef DEVICE_VAR
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineRelaxSolveBoxHost
+ *
+ * Host version of hypre_LineRelaxSolveBox.  The lines are taken in slabs
+ * of up to hypre_LineRelaxSlabSize adjacent lines, and each slab is swept
+ * along the lines with the inner loop across its lines, which has unit
+ * stride unless the lines run in the x direction.  Slabs are threaded.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_LineRelaxSolveBoxHost( hypre_Box   *box,
+                             HYPRE_Int    dir,
+                             HYPRE_Real  *fa,
+                             HYPRE_Real  *fc,
+                             HYPRE_Real  *fd,
+                             hypre_Box   *t_dbox,
+                             HYPRE_Real  *tp,
+                             hypre_Box   *x_dbox,
+                             HYPRE_Real  *xp,
+                             HYPRE_Real   weight,
+                             HYPRE_Int    zero )
+{
+   HYPRE_Int    ndim = hypre_BoxNDim(box);
+   HYPRE_Real   xscale = zero ? 0.0 : 1.0;
+   HYPRE_Int    fs[HYPRE_MAXDIM], ts[HYPRE_MAXDIM], xs[HYPRE_MAXDIM];
+   HYPRE_Int    n, n1 = 1, n2 = 1, fs1 = 0, fs2 = 0, ts1 = 0, ts2 = 0, xs1 = 0, xs2 = 0;
+   HYPRE_Int    tbase, xbase, num_slabs1, num_slabs, d, s;
+
+   if (hypre_BoxVolume(box) == 0)
+   {
+      return;
+   }
+
+   /* strides of the box (for the factors) and of the data boxes of t and x */
+   fs[0] = 1;
+   ts[0] = 1;
+   xs[0] = 1;
+   for (d = 1; d < ndim; d++)
+   {
+      fs[d] = fs[d - 1] * hypre_BoxSizeD(box, d - 1);
+      ts[d] = ts[d - 1] * hypre_BoxSizeD(t_dbox, d - 1);
+      xs[d] = xs[d - 1] * hypre_BoxSizeD(x_dbox, d - 1);
+   }
+   for (d = ndim - 1; d >= 0; d--)
+   {
+      if (d != dir)
+      {
+         n2  = n1;
+         fs2 = fs1;
+         ts2 = ts1;
+         xs2 = xs1;
+         n1  = hypre_BoxSizeD(box, d);
+         fs1 = fs[d];
+         ts1 = ts[d];
+         xs1 = xs[d];
+      }
+   }
+   n     = hypre_BoxSizeD(box, dir);
+   tbase = hypre_BoxIndexRank(t_dbox, hypre_BoxIMin(box));
+   xbase = hypre_BoxIndexRank(x_dbox, hypre_BoxIMin(box));
+
+   num_slabs1 = (n1 + hypre_LineRelaxSlabSize - 1) / hypre_LineRelaxSlabSize;
+   num_slabs  = num_slabs1 * n2;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_slabs; s++)
+   {
+      HYPRE_Int    kstart = (s % num_slabs1) * hypre_LineRelaxSlabSize;
+      HYPRE_Int    kend   = hypre_min(kstart + hypre_LineRelaxSlabSize, n1);
+      HYPRE_Int    foff   = (s / num_slabs1) * fs2;
+      HYPRE_Int    toff   = tbase + (s / num_slabs1) * ts2;
+      HYPRE_Int    xoff   = xbase + (s / num_slabs1) * xs2;
+      HYPRE_Int    fsd    = fs[dir];
+      HYPRE_Int    tsd    = ts[dir];
+      HYPRE_Int    xsd    = xs[dir];
+      HYPRE_Real  *tq, *xq;
+      HYPRE_Real  *faq, *fcq, *fdq;
+      HYPRE_Int    pos, k;
+
+      /* forward elimination */
+      tq  = tp + toff;
+      fdq = fd + foff;
+      for (k = kstart; k < kend; k++)
+      {
+         tq[k * ts1] *= fdq[k * fs1];
+      }
+      for (pos = 1; pos < n; pos++)
+      {
+         tq  = tp + toff + pos * tsd;
+         faq = fa + foff + pos * fsd;
+         fdq = fd + foff + pos * fsd;
+         for (k = kstart; k < kend; k++)
+         {
+            tq[k * ts1] = (tq[k * ts1] - faq[k * fs1] * tq[k * ts1 - tsd]) * fdq[k * fs1];
+         }
+      }
+
+      /* back substitution and update of x; fc is zero at the end of the line */
+      for (pos = n - 1; pos >= 0; pos--)
+      {
+         tq  = tp + toff + pos * tsd;
+         xq  = xp + xoff + pos * xsd;
+         fcq = fc + foff + pos * fsd;
+         if (pos < n - 1)
+         {
+            for (k = kstart; k < kend; k++)
+            {
+               tq[k * ts1] -= fcq[k * fs1] * tq[k * ts1 + tsd];
+            }
+         }
+         for (k = kstart; k < kend; k++)
+         {
+            xq[k * xs1] = xscale * xq[k * xs1] + weight * tq[k * ts1];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelax( void               *relax_vdata,
+                 hypre_StructMatrix *A,
+                 hypre_StructVector *b,
+                 hypre_StructVector *x )
+{
+   hypre_LineRelaxData   *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   HYPRE_Int              max_iter    = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess  = (relax_data -> zero_guess);
+   HYPRE_Real             weight      = (relax_data -> weight);
+   HYPRE_Int              dir         = (relax_data -> dir);
+   hypre_StructVector    *t           = (relax_data -> t);
+   void                  *matvec_data = (relax_data -> matvec_data);
+   HYPRE_MemoryLocation   memory_location = hypre_StructMatrixMemoryLocation(A);
+
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *t_dbox;
+   hypre_Box             *x_dbox;
+   HYPRE_Real            *tp;
+   HYPRE_Real            *xp;
+   HYPRE_Real            *fa, *fc, *fd;
+
+   HYPRE_Int              volume, iter, i;
+
+   /*----------------------------------------------------------
+    * Initialize some things and deal with special cases
+    *----------------------------------------------------------*/
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   (relax_data -> num_iterations) = 0;
+
+   /* if max_iter is zero, return */
+   if (max_iter == 0)
+   {
+      /* if using a zero initial guess, return zero */
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      /* t = b - A x */
+      hypre_StructCopy(b, t);
+      if (!zero_guess || iter > 0)
+      {
+         hypre_StructMatvecCompute(matvec_data, -1.0, A, x, 1.0, t);
+      }
+
+      /* t = T^{-1} t and x = x + weight t */
+      hypre_ForBoxI(i, boxes)
+      {
+         box    = hypre_BoxArrayBox(boxes, i);
+         volume = hypre_BoxVolume(box);
+         fa     = (relax_data -> factors) + (relax_data -> factor_starts)[i];
+         fc     = fa + volume;
+         fd     = fc + volume;
+
+         t_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+         tp     = hypre_StructVectorBoxData(t, i);
+
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         xp     = hypre_StructVectorBoxData(x, i);
+
+         if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+         {
+            hypre_LineRelaxSolveBoxHost(box, dir, fa, fc, fd, t_dbox, tp,
+                                        x_dbox, xp, weight, (zero_guess && iter == 0));
+         }
+         else
+         {
+            hypre_LineRelaxSolveBox(box, dir, fa, fc, fd, t_dbox, tp,
+                                    x_dbox, xp, weight, (zero_guess && iter == 0));
+         }
+      }
+
+      (relax_data -> num_iterations) = iter + 1;
+   }
+
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetTol( void   *relax_vdata,
+                       HYPRE_Real  tol         )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetMaxIter( void *relax_vdata,
+                           HYPRE_Int   max_iter    )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetZeroGuess( void *relax_vdata,
+                             HYPRE_Int   zero_guess  )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetWeight( void    *relax_vdata,
+                          HYPRE_Real   weight      )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> weight) = weight;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * The line direction must be set before setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetDirection( void *relax_vdata,
+                             HYPRE_Int   dir         )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> dir) = dir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetTempVec( void               *relax_vdata,
+                           hypre_StructVector *t           )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   hypre_StructVectorDestroy(relax_data -> t);
+   (relax_data -> t) = hypre_StructVectorRef(t);
+
+   return hypre_error_flag;
+}
@@ -268,6 +268,16 @@ hypre_PFMGSetup( void               *pfmg_vdata,
          }
       }
 
+      /* Line Jacobi solves the couplings along cdir exactly.  For modes that
+       * are oscillatory in cdir, Fourier analysis gives the smoothing factor
+       * |1-w| + w*alpha, with alpha the share of the stencil off cdir as
+       * computed above.  It is smallest at w = 1, so the point Jacobi
+       * weights are not used */
+      if (relax_type == 4)
+      {
+         relax_weights[l] = 1.0;
+      }
+
       if (cdir != -1)
       {
          /* don't coarsen if a periodic direction and not divisible by 2 */
@@ -663,6 +673,10 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   if (num_levels > 1)
+   {
+      hypre_PFMGRelaxSetLineDirection(relax_data_l[0], cdir_l[0]);
+   }
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
@@ -683,6 +697,10 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            if (l < num_levels - 1)
+            {
+               hypre_PFMGRelaxSetLineDirection(relax_data_l[l], cdir_l[l]);
+            }
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
          }
       }
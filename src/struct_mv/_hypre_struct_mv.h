@@ -679,6 +679,25 @@ typedef struct
 #ifndef hypre_STRUCT_GRID_HEADER
 #define hypre_STRUCT_GRID_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridCommEntry:
+ *
+ * Cached communication pattern for a grid-stencil computation.  The pattern
+ * computed by hypre_CreateCommInfoFromStencil depends on the stencil only
+ * through its grow extents and its "stencil grid" (see communication_info.c),
+ * so these are used as the key.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_STRUCT_GRID_COMM_CACHE_SIZE 8
+
+typedef struct
+{
+   HYPRE_Int                      grow[2 * HYPRE_MAXDIM];
+   HYPRE_Int                      stencil_mask; /* bit si set if stencil_grid[si] */
+   struct hypre_CommInfo_struct  *comm_info;
+
+} hypre_StructGridCommEntry;
+
 /*--------------------------------------------------------------------------
  * hypre_StructGrid:
  *--------------------------------------------------------------------------*/
@@ -711,6 +730,11 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
    hypre_BoxManager    *boxman;
+
+   /* Communication patterns computed for this grid (round-robin replacement) */
+   HYPRE_Int                  num_comm_entries;
+   HYPRE_Int                  next_comm_entry;
+   hypre_StructGridCommEntry  comm_entries[hypre_STRUCT_GRID_COMM_CACHE_SIZE];
 } hypre_StructGrid;
 
 /*--------------------------------------------------------------------------
@@ -733,6 +757,13 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman)
+#define hypre_StructGridNumCommEntries(grid) ((grid) -> num_comm_entries)
+#define hypre_StructGridNextCommEntry(grid)  ((grid) -> next_comm_entry)
+#define hypre_StructGridCommEntries(grid)    ((grid) -> comm_entries)
+
+#define hypre_StructGridCommEntryGrow(entry)        ((entry) -> grow)
+#define hypre_StructGridCommEntryStencilMask(entry) ((entry) -> stencil_mask)
+#define hypre_StructGridCommEntryCommInfo(entry)    ((entry) -> comm_info)
 
 #define hypre_StructGridBox(grid, i)        (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
 #define hypre_StructGridNumBoxes(grid)      (hypre_BoxArraySize(hypre_StructGridBoxes(grid)))
@@ -1470,6 +1501,7 @@ HYPRE_Int hypre_CommInfoProjectSend ( hypre_CommInfo *comm_info, hypre_Index ind
 HYPRE_Int hypre_CommInfoProjectRecv ( hypre_CommInfo *comm_info, hypre_Index index,
                                       hypre_Index stride );
 HYPRE_Int hypre_CommInfoDestroy ( hypre_CommInfo *comm_info );
+HYPRE_Int hypre_CommInfoDuplicate ( hypre_CommInfo *comm_info, hypre_CommInfo **comm_info_ptr );
 HYPRE_Int hypre_CreateCommInfoFromStencil ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
                                             hypre_CommInfo **comm_info_ptr );
 HYPRE_Int hypre_CreateCommInfoFromNumGhost ( hypre_StructGrid *grid, HYPRE_Int *num_ghost,
@@ -1617,6 +1649,7 @@ HYPRE_Int hypre_StructPartialCopy ( hypre_StructVector *x, hypre_StructVector *y
 HYPRE_Int hypre_StructGridCreate ( MPI_Comm comm, HYPRE_Int dim, hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridRef ( hypre_StructGrid *grid, hypre_StructGrid **grid_ref );
 HYPRE_Int hypre_StructGridDestroy ( hypre_StructGrid *grid );
+HYPRE_Int hypre_StructGridClearCommInfo ( hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridSetPeriodic ( hypre_StructGrid *grid, hypre_Index periodic );
 HYPRE_Int hypre_StructGridSetExtents ( hypre_StructGrid *grid, hypre_Index ilower,
                                        hypre_Index iupper );
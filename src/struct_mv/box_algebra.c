@@ -107,6 +107,10 @@ hypre_SubtractBoxes( hypre_Box      *box1,
 
 /*--------------------------------------------------------------------------
  * Compute (box_array1 - box_array2) and replace box_array1 with result.
+ *
+ * Subtracting a box that does not intersect any box of the difference leaves
+ * the difference unchanged, so boxes of box_array2 outside the bounding box
+ * of box_array1 (which contains every later difference) are skipped.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -119,12 +123,45 @@ hypre_SubtractBoxArrays( hypre_BoxArray *box_array1,
    hypre_BoxArray  box_array;
    hypre_Box      *box1;
    hypre_Box      *box2;
-   HYPRE_Int       i, k;
+   hypre_Index     bbox_imin, bbox_imax;
+   HYPRE_Int       i, k, d, ndim;
+
+   if (hypre_BoxArraySize(box_array1) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* compute the bounding box of box_array1 */
+   ndim = hypre_BoxArrayNDim(box_array1);
+   hypre_CopyIndex(hypre_BoxIMin(hypre_BoxArrayBox(box_array1, 0)), bbox_imin);
+   hypre_CopyIndex(hypre_BoxIMax(hypre_BoxArrayBox(box_array1, 0)), bbox_imax);
+   hypre_ForBoxI(k, box_array1)
+   {
+      box1 = hypre_BoxArrayBox(box_array1, k);
+      for (d = 0; d < ndim; d++)
+      {
+         bbox_imin[d] = hypre_min(bbox_imin[d], hypre_BoxIMinD(box1, d));
+         bbox_imax[d] = hypre_max(bbox_imax[d], hypre_BoxIMaxD(box1, d));
+      }
+   }
 
    hypre_ForBoxI(i, box_array2)
    {
       box2 = hypre_BoxArrayBox(box_array2, i);
 
+      for (d = 0; d < ndim; d++)
+      {
+         if ( (hypre_BoxIMinD(box2, d) > bbox_imax[d]) ||
+              (hypre_BoxIMaxD(box2, d) < bbox_imin[d]) )
+         {
+            break;
+         }
+      }
+      if (d < ndim)
+      {
+         continue;
+      }
+
       /* compute new_diff_boxes = (diff_boxes - box2) */
       hypre_BoxArraySetSize(new_diff_boxes, 0);
       hypre_ForBoxI(k, diff_boxes)
@@ -201,6 +201,86 @@ hypre_CommInfoDestroy( hypre_CommInfo  *comm_info )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Copy per-box integer arrays such as the procs, rboxnums, or transforms
+ * arrays of a CommInfo.  The size of arrays[i] is the size of box array i.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int **
+hypre_CommInfoDuplicateArrays( HYPRE_Int           **arrays,
+                               hypre_BoxArrayArray  *boxes )
+{
+   HYPRE_Int  **new_arrays;
+   HYPRE_Int    i, size;
+
+   if (arrays == NULL)
+   {
+      return NULL;
+   }
+
+   new_arrays = hypre_CTAlloc(HYPRE_Int *, hypre_BoxArrayArraySize(boxes), HYPRE_MEMORY_HOST);
+   hypre_ForBoxArrayI(i, boxes)
+   {
+      size = hypre_BoxArraySize(hypre_BoxArrayArrayBoxArray(boxes, i));
+      new_arrays[i] = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(new_arrays[i], arrays[i], HYPRE_Int, size,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   return new_arrays;
+}
+
+/*--------------------------------------------------------------------------
+ * Return a deep copy of comm_info.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommInfoDuplicate( hypre_CommInfo   *comm_info,
+                         hypre_CommInfo  **comm_info_ptr )
+{
+   hypre_CommInfo       *new_info;
+   hypre_BoxArrayArray  *send_boxes = hypre_CommInfoSendBoxes(comm_info);
+   hypre_BoxArrayArray  *recv_boxes = hypre_CommInfoRecvBoxes(comm_info);
+   HYPRE_Int             num_transforms = hypre_CommInfoNumTransforms(comm_info);
+   hypre_Index          *coords = NULL;
+   hypre_Index          *dirs = NULL;
+
+   hypre_CommInfoCreate(
+      hypre_BoxArrayArrayDuplicate(send_boxes),
+      hypre_BoxArrayArrayDuplicate(recv_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoSendProcesses(comm_info), send_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoRecvProcesses(comm_info), recv_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoSendRBoxnums(comm_info), send_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoRecvRBoxnums(comm_info), recv_boxes),
+      hypre_BoxArrayArrayDuplicate(hypre_CommInfoSendRBoxes(comm_info)),
+      hypre_BoxArrayArrayDuplicate(hypre_CommInfoRecvRBoxes(comm_info)),
+      hypre_CommInfoBoxesMatch(comm_info), &new_info);
+
+   if (hypre_CommInfoCoords(comm_info) != NULL)
+   {
+      coords = hypre_TAlloc(hypre_Index, num_transforms, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(coords, hypre_CommInfoCoords(comm_info), hypre_Index, num_transforms,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   if (hypre_CommInfoDirs(comm_info) != NULL)
+   {
+      dirs = hypre_TAlloc(hypre_Index, num_transforms, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(dirs, hypre_CommInfoDirs(comm_info), hypre_Index, num_transforms,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_CommInfoSetTransforms(
+      new_info, num_transforms, coords, dirs,
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoSendTransforms(comm_info), send_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoRecvTransforms(comm_info), recv_boxes));
+
+   hypre_CopyIndex(hypre_CommInfoSendStride(comm_info), hypre_CommInfoSendStride(new_info));
+   hypre_CopyIndex(hypre_CommInfoRecvStride(comm_info), hypre_CommInfoRecvStride(new_info));
+
+   *comm_info_ptr = new_info;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * NEW version that uses the box manager to find neighbors boxes.
  * AHB 9/06
@@ -291,6 +371,15 @@ hypre_CommInfoDestroy( hypre_CommInfo  *comm_info )
  *    B. Boxes in the send and recv regions do not need to be in any
  *       particular order (including those that are periodic).
  *
+ * 5.  Caching
+ *
+ *   The result depends on the stencil only through the "grow" extents and
+ *   the stencil grid, so the patterns are cached on the grid with these as
+ *   the key.  Matrices, vectors, and the compute packages of the solvers
+ *   that use stencils with the same footprint on the same grid then share a
+ *   single computation.  A copy of the cached pattern is returned, since
+ *   callers may modify (e.g., project) it.
+ *
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -361,6 +450,10 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
    HYPRE_Int              num_periods, loc, box_id, id, proc_id;
    HYPRE_Int              myid;
 
+   hypre_StructGridCommEntry *cache_entries;
+   hypre_StructGridCommEntry *cache_entry;
+   HYPRE_Int                  stencil_mask;
+
    MPI_Comm               comm;
 
    /*------------------------------------------------------
@@ -440,6 +533,48 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
       hypre_SerialBoxLoop1End(si);
    }
 
+   /*------------------------------------------------------
+    * Return a copy of the cached pattern if there is one
+    *------------------------------------------------------*/
+
+   stencil_mask = 0;
+   for (si = 0; si < hypre_BoxVolume(stencil_box); si++)
+   {
+      if (stencil_grid[si])
+      {
+         stencil_mask |= (1 << si);
+      }
+   }
+
+   cache_entries = hypre_StructGridCommEntries(grid);
+   for (i = 0; i < hypre_StructGridNumCommEntries(grid); i++)
+   {
+      cache_entry = &cache_entries[i];
+      if (hypre_StructGridCommEntryStencilMask(cache_entry) != stencil_mask)
+      {
+         continue;
+      }
+      for (d = 0; d < ndim; d++)
+      {
+         if ((hypre_StructGridCommEntryGrow(cache_entry)[2 * d]     != grow[d][0]) ||
+             (hypre_StructGridCommEntryGrow(cache_entry)[2 * d + 1] != grow[d][1]))
+         {
+            break;
+         }
+      }
+      if (d == ndim)
+      {
+         hypre_BoxDestroy(stencil_box);
+         hypre_BoxDestroy(sbox);
+         hypre_TFree(stencil_grid, HYPRE_MEMORY_HOST);
+
+         hypre_CommInfoDuplicate(hypre_StructGridCommEntryCommInfo(cache_entry),
+                                 comm_info_ptr);
+
+         return hypre_error_flag;
+      }
+   }
+
    /*------------------------------------------------------
     * Compute send/recv boxes and procs for each local box
     *------------------------------------------------------*/
@@ -781,6 +916,27 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
                         send_rboxnums, recv_rboxnums, send_rboxes, recv_rboxes,
                         1, comm_info_ptr);
 
+   /* cache a copy, replacing the oldest entry if the cache is full */
+   i = hypre_StructGridNextCommEntry(grid);
+   cache_entry = &cache_entries[i];
+   if (i < hypre_StructGridNumCommEntries(grid))
+   {
+      hypre_CommInfoDestroy(hypre_StructGridCommEntryCommInfo(cache_entry));
+   }
+   else
+   {
+      hypre_StructGridNumCommEntries(grid)++;
+   }
+   for (d = 0; d < ndim; d++)
+   {
+      hypre_StructGridCommEntryGrow(cache_entry)[2 * d]     = grow[d][0];
+      hypre_StructGridCommEntryGrow(cache_entry)[2 * d + 1] = grow[d][1];
+   }
+   hypre_StructGridCommEntryStencilMask(cache_entry) = stencil_mask;
+   hypre_CommInfoDuplicate(*comm_info_ptr,
+                           &hypre_StructGridCommEntryCommInfo(cache_entry));
+   hypre_StructGridNextCommEntry(grid) = (i + 1) % hypre_STRUCT_GRID_COMM_CACHE_SIZE;
+
    return hypre_error_flag;
 }
 
@@ -846,6 +1002,13 @@ hypre_CreateCommInfoFromNumGhost( hypre_StructGrid      *grid,
 /*--------------------------------------------------------------------------
  * Return descriptions of communications patterns for migrating data
  * from one grid distribution to another.
+ *
+ * To avoid intersecting every local box with every remote box, the remote
+ * boxes are sorted by their lower bound in the first dimension.  Only the
+ * remote boxes whose lower bound lies within [imin - max_extent, imax] of a
+ * local box can intersect it, and this range is found by binary search.  The
+ * candidates are visited in their original order, so the result is the same
+ * as that of the all-pairs loop.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -881,6 +1044,13 @@ hypre_CreateCommInfoFromGrids( hypre_StructGrid      *from_grid,
    hypre_Box               *local_box;
    hypre_Box               *remote_box;
 
+   HYPRE_Int                num_remote;
+   HYPRE_Int               *remote_imin;
+   HYPRE_Int               *remote_order;
+   HYPRE_Int               *candidates;
+   HYPRE_Int                num_candidates, max_extent;
+   HYPRE_Int                lo, hi, c;
+
    HYPRE_Int                i, j, k, r, ndim;
 
    /*------------------------------------------------------
@@ -917,6 +1087,22 @@ hypre_CreateCommInfoFromGrids( hypre_StructGrid      *from_grid,
       hypre_ComputeBoxnums(remote_all_boxes, remote_all_procs,
                            &remote_all_boxnums);
 
+      /* sort the remote boxes by their lower bound in the first dimension */
+      num_remote   = hypre_BoxArraySize(remote_all_boxes);
+      remote_imin  = hypre_TAlloc(HYPRE_Int, num_remote, HYPRE_MEMORY_HOST);
+      remote_order = hypre_TAlloc(HYPRE_Int, num_remote, HYPRE_MEMORY_HOST);
+      candidates   = hypre_TAlloc(HYPRE_Int, num_remote, HYPRE_MEMORY_HOST);
+      max_extent   = 0;
+      hypre_ForBoxI(j, remote_all_boxes)
+      {
+         remote_box = hypre_BoxArrayBox(remote_all_boxes, j);
+         remote_imin[j]  = hypre_BoxIMinD(remote_box, 0);
+         remote_order[j] = j;
+         max_extent = hypre_max(max_extent,
+                                hypre_BoxIMaxD(remote_box, 0) - hypre_BoxIMinD(remote_box, 0));
+      }
+      hypre_qsort2i(remote_imin, remote_order, 0, num_remote - 1);
+
       comm_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(local_boxes), ndim);
       comm_procs = hypre_CTAlloc(HYPRE_Int *,  hypre_BoxArraySize(local_boxes), HYPRE_MEMORY_HOST);
       comm_boxnums = hypre_CTAlloc(HYPRE_Int *,  hypre_BoxArraySize(local_boxes), HYPRE_MEMORY_HOST);
@@ -932,8 +1118,23 @@ hypre_CreateCommInfoFromGrids( hypre_StructGrid      *from_grid,
          comm_boxnums[i] =
             hypre_CTAlloc(HYPRE_Int,  hypre_BoxArraySize(remote_all_boxes), HYPRE_MEMORY_HOST);
 
-         hypre_ForBoxI(j, remote_all_boxes)
+         /* find the remote boxes that may intersect local_box */
+         lo = (HYPRE_Int) (hypre_LowerBound(remote_imin, remote_imin + num_remote,
+                                            hypre_BoxIMinD(local_box, 0) - max_extent)
+                           - remote_imin);
+         hi = (HYPRE_Int) (hypre_LowerBound(remote_imin, remote_imin + num_remote,
+                                            hypre_BoxIMaxD(local_box, 0) + 1)
+                           - remote_imin);
+         num_candidates = hypre_max(hi - lo, 0);
+         for (c = 0; c < num_candidates; c++)
+         {
+            candidates[c] = remote_order[lo + c];
+         }
+         hypre_qsort0(candidates, 0, num_candidates - 1);
+
+         for (c = 0; c < num_candidates; c++)
          {
+            j = candidates[c];
             remote_box = hypre_BoxArrayBox(remote_all_boxes, j);
 
             hypre_IntersectBoxes(local_box, remote_box, comm_box);
@@ -956,6 +1157,9 @@ hypre_CreateCommInfoFromGrids( hypre_StructGrid      *from_grid,
       }
       hypre_BoxDestroy(comm_box);
 
+      hypre_TFree(remote_imin, HYPRE_MEMORY_HOST);
+      hypre_TFree(remote_order, HYPRE_MEMORY_HOST);
+      hypre_TFree(candidates, HYPRE_MEMORY_HOST);
       hypre_BoxArrayDestroy(remote_all_boxes);
       hypre_TFree(remote_all_procs, HYPRE_MEMORY_HOST);
       hypre_TFree(remote_all_boxnums, HYPRE_MEMORY_HOST);
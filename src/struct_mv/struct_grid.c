@@ -50,6 +50,8 @@ hypre_StructGridCreate( MPI_Comm           comm,
    hypre_SetIndex(hypre_StructGridPeriodic(grid), 0);
    hypre_StructGridRefCount(grid)     = 1;
    hypre_StructGridBoxMan(grid)       = NULL;
+   hypre_StructGridNumCommEntries(grid) = 0;
+   hypre_StructGridNextCommEntry(grid)  = 0;
 
    hypre_StructGridNumPeriods(grid)   = 1;
    hypre_StructGridPShifts(grid)     = NULL;
@@ -97,6 +99,7 @@ hypre_StructGridDestroy( hypre_StructGrid *grid )
 
          hypre_BoxManDestroy(hypre_StructGridBoxMan(grid));
          hypre_TFree( hypre_StructGridPShifts(grid), HYPRE_MEMORY_HOST);
+         hypre_StructGridClearCommInfo(grid);
 
          hypre_TFree(grid, HYPRE_MEMORY_HOST);
       }
@@ -106,6 +109,30 @@ hypre_StructGridDestroy( hypre_StructGrid *grid )
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridClearCommInfo
+ *
+ * Destroy the communication patterns cached on the grid.  This must be called
+ * whenever the boxes or the box manager of the grid change.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridClearCommInfo( hypre_StructGrid *grid )
+{
+   hypre_StructGridCommEntry  *entries = hypre_StructGridCommEntries(grid);
+   HYPRE_Int                   i;
+
+   for (i = 0; i < hypre_StructGridNumCommEntries(grid); i++)
+   {
+      hypre_CommInfoDestroy(hypre_StructGridCommEntryCommInfo(&entries[i]));
+      hypre_StructGridCommEntryCommInfo(&entries[i]) = NULL;
+   }
+   hypre_StructGridNumCommEntries(grid) = 0;
+   hypre_StructGridNextCommEntry(grid)  = 0;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructGridSetPeriodic
  *--------------------------------------------------------------------------*/
@@ -271,6 +298,9 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
 
    hypre_BeginTiming(time_index);
 
+   /* communication patterns computed for a previous assembly are stale */
+   hypre_StructGridClearCommInfo(grid);
+
    /* other initializations */
    num_local_boxes = hypre_BoxArraySize(local_boxes);
 
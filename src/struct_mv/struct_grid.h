@@ -14,6 +14,25 @@
 #ifndef hypre_STRUCT_GRID_HEADER
 #define hypre_STRUCT_GRID_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridCommEntry:
+ *
+ * Cached communication pattern for a grid-stencil computation.  The pattern
+ * computed by hypre_CreateCommInfoFromStencil depends on the stencil only
+ * through its grow extents and its "stencil grid" (see communication_info.c),
+ * so these are used as the key.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_STRUCT_GRID_COMM_CACHE_SIZE 8
+
+typedef struct
+{
+   HYPRE_Int                      grow[2 * HYPRE_MAXDIM];
+   HYPRE_Int                      stencil_mask; /* bit si set if stencil_grid[si] */
+   struct hypre_CommInfo_struct  *comm_info;
+
+} hypre_StructGridCommEntry;
+
 /*--------------------------------------------------------------------------
  * hypre_StructGrid:
  *--------------------------------------------------------------------------*/
@@ -46,6 +65,11 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
    hypre_BoxManager    *boxman;
+
+   /* Communication patterns computed for this grid (round-robin replacement) */
+   HYPRE_Int                  num_comm_entries;
+   HYPRE_Int                  next_comm_entry;
+   hypre_StructGridCommEntry  comm_entries[hypre_STRUCT_GRID_COMM_CACHE_SIZE];
 } hypre_StructGrid;
 
 /*--------------------------------------------------------------------------
@@ -68,6 +92,13 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman)
+#define hypre_StructGridNumCommEntries(grid) ((grid) -> num_comm_entries)
+#define hypre_StructGridNextCommEntry(grid)  ((grid) -> next_comm_entry)
+#define hypre_StructGridCommEntries(grid)    ((grid) -> comm_entries)
+
+#define hypre_StructGridCommEntryGrow(entry)        ((entry) -> grow)
+#define hypre_StructGridCommEntryStencilMask(entry) ((entry) -> stencil_mask)
+#define hypre_StructGridCommEntryCommInfo(entry)    ((entry) -> comm_info)
 
 #define hypre_StructGridBox(grid, i)        (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
 #define hypre_StructGridNumBoxes(grid)      (hypre_BoxArraySize(hypre_StructGridBoxes(grid)))
@@ -18,6 +18,21 @@ diff -bI"time" solvers.out.4 solvers.out.5 >&2
 diff -bI"time" solvers.out.6 solvers.out.7 >&2
 diff -bI"time" solvers.out.8 solvers.out.9 >&2
 diff -bI"time" solvers.out.10 solvers.out.11 >&2
+diff -bI"time" -I"Concurrent" solvers.out.13 solvers.out.14 >&2
+
+#=============================================================================
+# The concurrent corrections need a single task (job 16). Threaded runs are
+# not bitwise reproducible, so compare the iteration counts and check that
+# both converged and that job 16 did not fall back to sequential corrections.
+#=============================================================================
+
+if [ "`grep "Iterations" solvers.out.15`" != "`grep "Iterations" solvers.out.16`" ]; then
+   echo "Concurrent corrections changed the iteration count" >&2
+fi
+grep "Final Relative Residual Norm" solvers.out.15 solvers.out.16 | \
+   awk '$NF > 1e-6 {print "Run did not converge: " $0}' >&2
+grep "Concurrent" solvers.out.14 | grep -v "= 0$" >&2
+grep "Concurrent" solvers.out.16 | grep -v "= 2$" >&2
 
 #=============================================================================
 # compare with baseline case
@@ -48,6 +63,7 @@ FILES="\
  ${TNAME}.out.6\
  ${TNAME}.out.7\
  ${TNAME}.out.12\
+ ${TNAME}.out.13\
 "
 for i in $FILES
 do
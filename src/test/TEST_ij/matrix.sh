@@ -24,6 +24,13 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+# planned transpose must match the plain one exactly
+#=============================================================================
+
+grep "Transpose plan error" ${TNAME}.out.200 > ${TNAME}.testdata.temp
+echo "Transpose plan error = 0.000000e+00" | diff - ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -48,6 +55,7 @@ FILES="\
  ${TNAME}.out.110\
  ${TNAME}.out.111\
  ${TNAME}.out.112\
+ ${TNAME}.out.200\
 "
 
 for i in $FILES
@@ -32,6 +32,64 @@ tail -17 ${TNAME}.out.200 | head -6 > ${TNAME}.mgr_testdata
 tail -17 ${TNAME}.out.202 | head -6 > ${TNAME}.mgr_testdata.temp
 diff ${TNAME}.mgr_testdata ${TNAME}.mgr_testdata.temp >&2
 
+#=============================================================================
+# IJ: single-precision halos must save bytes when requested, and must
+#     change the result of BoomerAMG with tolerance 0
+#=============================================================================
+
+for i in 501 507 509
+do
+   grep "Single-precision halo bytes saved" ${TNAME}.out.$i | grep -v "= 0.000000e+00" > /dev/null ||
+      echo "No single-precision halos in ${TNAME}.out.$i" >&2
+done
+
+tail -3 ${TNAME}.out.508 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.509 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp > /dev/null &&
+   echo "Single-precision halos do not change ${TNAME}.out.509" >&2
+
+#=============================================================================
+# IJ: reproducible inner products must give the same result on 1 and 4 threads
+#=============================================================================
+
+tail -3 ${TNAME}.out.510 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.511 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# IJ: the block solve must match separate solves, and with tolerance 1e-7
+#     every right-hand side must converge on its own
+#=============================================================================
+
+for i in 512 513
+do
+   grep "Block solve max. relative deviation" ${TNAME}.out.$i |
+      awk '{ if ($NF > 1.0e-12) exit 1 }' ||
+      echo "Block solve differs from separate solves in ${TNAME}.out.$i" >&2
+done
+
+grep "Block solve component" ${TNAME}.out.513 |
+   awk '{ if ($NF > 1.0e-7) exit 1 }' ||
+   echo "Block solve component not converged in ${TNAME}.out.513" >&2
+
+#=============================================================================
+# IJ: threaded CR coarsening must converge; with reproducible reductions the
+#     coarse grids and the results must be the same on 1 and 4 threads
+#=============================================================================
+
+for i in 514 515
+do
+   grep "Final Relative Residual Norm" ${TNAME}.out.$i |
+      awk '{ if ($NF > 1.0e-8) exit 1 }' ||
+      echo "CR coarsening did not converge in ${TNAME}.out.$i" >&2
+done
+
+sed -n '/Operator Matrix Information/,/memory =/p' ${TNAME}.out.516 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.516 >> ${TNAME}.testdata
+sed -n '/Operator Matrix Information/,/memory =/p' ${TNAME}.out.517 > ${TNAME}.testdata.temp
+tail -3 ${TNAME}.out.517 >> ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -188,6 +246,38 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out" >&2
 fi
 
+FILES="\
+ ${TNAME}.out.500\
+ ${TNAME}.out.501\
+ ${TNAME}.out.502\
+ ${TNAME}.out.503\
+ ${TNAME}.out.504\
+ ${TNAME}.out.505\
+ ${TNAME}.out.506\
+ ${TNAME}.out.507\
+ ${TNAME}.out.508\
+ ${TNAME}.out.509\
+ ${TNAME}.out.510\
+ ${TNAME}.out.511\
+ ${TNAME}.out.512\
+ ${TNAME}.out.513\
+ ${TNAME}.out.516\
+ ${TNAME}.out.517\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out.f
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.f | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
 # put all of the output files together
 cat ${TNAME}.out.[a-z] > ${TNAME}.out
 
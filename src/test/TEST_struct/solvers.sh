@@ -18,6 +18,7 @@ FILES="\
  ${TNAME}.out.2\
  ${TNAME}.out.3\
  ${TNAME}.out.4\
+ ${TNAME}.out.5\
 "
 
 for i in $FILES
@@ -35,6 +35,179 @@ void CheckIfFileExists(char *file)
    fclose(test);
 }
 
+/* Returns the number of parts file.00000, file.00001, ... of an IJ data set */
+HYPRE_Int AMSDriverNumParts(const char *file)
+{
+   FILE *test;
+   char file0[100];
+   HYPRE_Int num_parts = 0;
+
+   while (1)
+   {
+      sprintf(file0, "%s.%05d", file, num_parts);
+      if (!(test = fopen(file0, "r")))
+      {
+         break;
+      }
+      fclose(test);
+      num_parts++;
+   }
+
+   return num_parts;
+}
+
+/* Opens part p of an IJ data set and reads its header, exits on failure */
+FILE *AMSDriverOpenPart(const char *file, HYPRE_Int p, HYPRE_Int header_size,
+                        HYPRE_BigInt *header)
+{
+   FILE *fp;
+   char file0[100];
+   HYPRE_Int i;
+
+   sprintf(file0, "%s.%05d", file, p);
+   if (!(fp = fopen(file0, "r")))
+   {
+      hypre_MPI_Finalize();
+      hypre_printf("Can't find the input file \"%s\"\n", file0);
+      exit(1);
+   }
+   for (i = 0; i < header_size; i++)
+   {
+      hypre_fscanf(fp, "%b", &header[i]);
+   }
+
+   return fp;
+}
+
+/* Reads an IJ matrix stored in more parts than there are MPI tasks. Each task
+   reads a contiguous range of the parts, so the data set written for 4 tasks
+   can also be used on 1 or 2 tasks. */
+void AMSDriverIJMatrixReadParts(const char *file, HYPRE_Int num_parts, HYPRE_IJMatrix *ij_A)
+{
+   HYPRE_Int num_procs, myid, first, last, p, ncols = 1;
+   HYPRE_BigInt header[4], ilower = 0, iupper = -1, jlower = 0, jupper = -1, I, J;
+   HYPRE_Complex value;
+   FILE *fp;
+
+   hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid);
+   if (num_parts < num_procs)
+   {
+      hypre_MPI_Finalize();
+      hypre_printf("The input file \"%s\" has fewer parts than tasks\n", file);
+      exit(1);
+   }
+   first = myid * num_parts / num_procs;
+   last  = (myid + 1) * num_parts / num_procs;
+
+   for (p = first; p < last; p++)
+   {
+      fp = AMSDriverOpenPart(file, p, 4, header);
+      if (p == first)
+      {
+         ilower = header[0];
+         jlower = header[2];
+      }
+      iupper = header[1];
+      jupper = header[3];
+      fclose(fp);
+   }
+
+   HYPRE_IJMatrixCreate(hypre_MPI_COMM_WORLD, ilower, iupper, jlower, jupper, ij_A);
+   HYPRE_IJMatrixSetObjectType(*ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixInitialize_v2(*ij_A, HYPRE_MEMORY_HOST);
+
+   for (p = first; p < last; p++)
+   {
+      fp = AMSDriverOpenPart(file, p, 4, header);
+      while (hypre_fscanf(fp, "%b %b%*[ \t]%le", &I, &J, &value) == 3)
+      {
+         if (I < ilower || I > iupper)
+         {
+            HYPRE_IJMatrixAddToValues(*ij_A, 1, &ncols, &I, &J, &value);
+         }
+         else
+         {
+            HYPRE_IJMatrixSetValues(*ij_A, 1, &ncols, &I, &J, &value);
+         }
+      }
+      fclose(fp);
+   }
+
+   HYPRE_IJMatrixAssemble(*ij_A);
+}
+
+/* Vector version of AMSDriverIJMatrixReadParts */
+void AMSDriverIJVectorReadParts(const char *file, HYPRE_Int num_parts, HYPRE_IJVector *ij_x)
+{
+   HYPRE_Int num_procs, myid, first, last, p;
+   HYPRE_BigInt header[2], jlower = 0, jupper = -1, j;
+   HYPRE_Complex value;
+   FILE *fp;
+
+   hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid);
+   if (num_parts < num_procs)
+   {
+      hypre_MPI_Finalize();
+      hypre_printf("The input file \"%s\" has fewer parts than tasks\n", file);
+      exit(1);
+   }
+   first = myid * num_parts / num_procs;
+   last  = (myid + 1) * num_parts / num_procs;
+
+   for (p = first; p < last; p++)
+   {
+      fp = AMSDriverOpenPart(file, p, 2, header);
+      if (p == first)
+      {
+         jlower = header[0];
+      }
+      jupper = header[1];
+      fclose(fp);
+   }
+
+   HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, jlower, jupper, ij_x);
+   HYPRE_IJVectorSetObjectType(*ij_x, HYPRE_PARCSR);
+   HYPRE_IJVectorInitialize_v2(*ij_x, HYPRE_MEMORY_HOST);
+
+   for (p = first; p < last; p++)
+   {
+      fp = AMSDriverOpenPart(file, p, 2, header);
+      while (hypre_fscanf(fp, "%b%*[ \t]%le", &j, &value) == 2)
+      {
+         if (j < jlower || j > jupper)
+         {
+            HYPRE_IJVectorAddToValues(*ij_x, 1, &j, &value);
+         }
+         else
+         {
+            HYPRE_IJVectorSetValues(*ij_x, 1, &j, &value);
+         }
+      }
+      fclose(fp);
+   }
+
+   HYPRE_IJVectorAssemble(*ij_x);
+}
+
+/* Number of subspace corrections for which AMS set up concurrent vectors */
+HYPRE_Int AMSDriverConcurrentCorrections(HYPRE_Solver ams)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) ams;
+   HYPRE_Int i, num_corr = 0;
+
+   for (i = 0; i < 5; i++)
+   {
+      if (ams_data -> zi[i])
+      {
+         num_corr++;
+      }
+   }
+
+   return num_corr;
+}
+
 void AMSDriverMatrixRead(const char *file, HYPRE_ParCSRMatrix *A)
 {
    FILE *test;
@@ -53,7 +226,16 @@ void AMSDriverMatrixRead(const char *file, HYPRE_ParCSRMatrix *A)
       {
          HYPRE_IJMatrix ij_A;
          void *object;
-         HYPRE_IJMatrixRead(file, hypre_MPI_COMM_WORLD, HYPRE_PARCSR, &ij_A);
+         HYPRE_Int num_procs, num_parts = AMSDriverNumParts(file);
+         hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
+         if (num_parts == num_procs)
+         {
+            HYPRE_IJMatrixRead(file, hypre_MPI_COMM_WORLD, HYPRE_PARCSR, &ij_A);
+         }
+         else
+         {
+            AMSDriverIJMatrixReadParts(file, num_parts, &ij_A);
+         }
          HYPRE_IJMatrixGetObject(ij_A, &object);
          *A = (HYPRE_ParCSRMatrix) object;
          hypre_IJMatrixObject((hypre_IJMatrix *)ij_A) = NULL;
@@ -85,7 +267,16 @@ void AMSDriverVectorRead(const char *file, HYPRE_ParVector *x)
       {
          HYPRE_IJVector ij_x;
          void *object;
-         HYPRE_IJVectorRead(file, hypre_MPI_COMM_WORLD, HYPRE_PARCSR, &ij_x);
+         HYPRE_Int num_procs, num_parts = AMSDriverNumParts(file);
+         hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
+         if (num_parts == num_procs)
+         {
+            HYPRE_IJVectorRead(file, hypre_MPI_COMM_WORLD, HYPRE_PARCSR, &ij_x);
+         }
+         else
+         {
+            AMSDriverIJVectorReadParts(file, num_parts, &ij_x);
+         }
          HYPRE_IJVectorGetObject(ij_x, &object);
          *x = (HYPRE_ParVector) object;
          hypre_IJVectorObject((hypre_IJVector *)ij_x) = NULL;
@@ -115,6 +306,7 @@ main (hypre_int argc,
    HYPRE_Real rtol;
    HYPRE_Int rr;
    HYPRE_Int zero_cond;
+   HYPRE_Int concurrent, nthreads;
    HYPRE_Int blockSize;
    HYPRE_Solver solver, precond;
 
@@ -134,8 +326,30 @@ main (hypre_int argc,
    HYPRE_ExecutionPolicy default_exec_policy = HYPRE_EXEC_DEVICE;
 #endif
 
-   /* Initialize MPI */
+   /* Initialize MPI, with full thread support for concurrent corrections */
+#if defined(HYPRE_USING_OPENMP) && !defined(HYPRE_SEQUENTIAL)
+   {
+      hypre_int i, provided;
+
+      for (i = 1; i < argc; i++)
+      {
+         if (strcmp(argv[i], "-concurrent") == 0)
+         {
+            break;
+         }
+      }
+      if (i < argc)
+      {
+         MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+      }
+      else
+      {
+         hypre_MPI_Init(&argc, &argv);
+      }
+   }
+#else
    hypre_MPI_Init(&argc, &argv);
+#endif
    hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid);
 
@@ -204,6 +418,8 @@ main (hypre_int argc,
    rtol = 0;
    rr = 0;
    zero_cond = 0;
+   concurrent = 0;
+   nthreads = 0;
 
    /* Parse command line */
    {
@@ -237,6 +453,16 @@ main (hypre_int argc,
             arg_index++;
             cycle_type = atoi(argv[arg_index++]);
          }
+         else if ( strcmp(argv[arg_index], "-concurrent") == 0 )
+         {
+            arg_index++;
+            concurrent = 1;
+         }
+         else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+         {
+            arg_index++;
+            nthreads = atoi(argv[arg_index++]);
+         }
          else if ( strcmp(argv[arg_index], "-rlx") == 0 )
          {
             arg_index++;
@@ -364,10 +590,12 @@ main (hypre_int argc,
          hypre_printf("    -maxit <num>         : maximum number of iterations (200)    \n");
          hypre_printf("    -pcg_maxit <num>     : maximum number of PCG iterations (50) \n");
          hypre_printf("    -tol <num>           : convergence tolerance (1e-6)          \n");
+         hypre_printf("    -nthreads <num>      : number of OpenMP threads              \n");
          hypre_printf("                                                                 \n");
          hypre_printf("  AMS solver options:                                            \n");
          hypre_printf("    -dim <num>           : space dimension                       \n");
          hypre_printf("    -type <num>          : 3-level cycle type (0-8, 11-14)       \n");
+         hypre_printf("    -concurrent          : concurrent additive corrections       \n");
          hypre_printf("    -theta <num>         : BoomerAMG threshold (0.25)            \n");
          hypre_printf("    -ctype <num>         : BoomerAMG coarsening type             \n");
          hypre_printf("    -agg <num>           : Levels of BoomerAMG agg. coarsening   \n");
@@ -401,6 +629,11 @@ main (hypre_int argc,
       amg_rlx_type = 18;
    }
 
+   if (nthreads > 0)
+   {
+      hypre_SetNumThreads(nthreads);
+   }
+
    AMSDriverMatrixRead("mfem.A", &A);
    AMSDriverVectorRead("mfem.x0", &x0);
    AMSDriverVectorRead("mfem.b", &b);
@@ -537,6 +770,7 @@ main (hypre_int argc,
       HYPRE_AMSSetMaxIter(solver, maxit);
       HYPRE_AMSSetTol(solver, tol);
       HYPRE_AMSSetCycleType(solver, cycle_type);
+      HYPRE_AMSSetConcurrentCorrections(solver, concurrent);
       HYPRE_AMSSetPrintLevel(solver, 1);
       HYPRE_AMSSetDiscreteGradient(solver, G);
 
@@ -594,6 +828,12 @@ main (hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (concurrent && hypre_NumThreads() > 1 && myid == 0)
+      {
+         hypre_printf("Concurrent subspace corrections = %d\n",
+                      AMSDriverConcurrentCorrections(solver));
+      }
+
       /* Destroy solver */
       HYPRE_AMSDestroy(solver);
    }
@@ -658,6 +898,7 @@ main (hypre_int argc,
          HYPRE_AMSSetMaxIter(precond, 1);
          HYPRE_AMSSetTol(precond, 0.0);
          HYPRE_AMSSetCycleType(precond, cycle_type);
+         HYPRE_AMSSetConcurrentCorrections(precond, concurrent);
          HYPRE_AMSSetPrintLevel(precond, 0);
          HYPRE_AMSSetDiscreteGradient(precond, G);
 
@@ -754,6 +995,11 @@ main (hypre_int argc,
       /* Run info - needed logging turned on */
       HYPRE_PCGGetNumIterations(solver, &num_iterations);
       HYPRE_PCGGetFinalRelativeResidualNorm(solver, &final_res_norm);
+      if (concurrent && solver_id == 3 && hypre_NumThreads() > 1 && myid == 0)
+      {
+         hypre_printf("Concurrent subspace corrections = %d\n",
+                      AMSDriverConcurrentCorrections(precond));
+      }
       if (myid == 0)
       {
          hypre_printf("\n");
@@ -789,6 +1035,7 @@ main (hypre_int argc,
       HYPRE_AMSSetMaxIter(precond, 1);
       HYPRE_AMSSetTol(precond, 0.0);
       HYPRE_AMSSetCycleType(precond, cycle_type);
+      HYPRE_AMSSetConcurrentCorrections(precond, concurrent);
       HYPRE_AMSSetPrintLevel(precond, 0);
       HYPRE_AMSSetDiscreteGradient(precond, G);
 
@@ -82,6 +82,8 @@ HYPRE_Int BuildParLaplacian125pt (HYPRE_Int argc, char *argv [], HYPRE_Int arg_i
                                   HYPRE_ParCSRMatrix *A_ptr );
 HYPRE_Int BuildParRotate7pt (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                              HYPRE_ParCSRMatrix *A_ptr );
+HYPRE_Int BuildParInclusion (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
+                              HYPRE_ParCSRMatrix *A_ptr);
 HYPRE_Int BuildParVarDifConv (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                               HYPRE_ParCSRMatrix *A_ptr, HYPRE_ParVector *rhs_ptr );
 HYPRE_ParCSRMatrix GenerateSysLaplacian (MPI_Comm comm, HYPRE_BigInt nx, HYPRE_BigInt ny,
@@ -97,9 +99,13 @@ HYPRE_Int SetSysVcoefValues(HYPRE_Int num_fun, HYPRE_BigInt nx, HYPRE_BigInt ny,
 
 HYPRE_Int BuildParCoordinates (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                                HYPRE_Int *coorddim_ptr, float **coord_ptr );
+HYPRE_Int ShiftParDiagonal (HYPRE_ParCSRMatrix A, HYPRE_Int num_rows, HYPRE_Complex shift,
+                            HYPRE_BigInt **rows_ptr );
+HYPRE_Int TestAMGBlockSolve (HYPRE_Solver amg_solver, HYPRE_ParCSRMatrix A, HYPRE_Int dim );
 
 extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int iterations,
                                                    HYPRE_Real rel_residual_norm);
+extern HYPRE_Int hypre_BoomerAMGThreadingStats(void *amg_vdata, HYPRE_Int num_reps);
 
 extern HYPRE_Int hypre_FlexGMRESModifyPCDefault(void *precond_data, HYPRE_Int iteration,
                                                 HYPRE_Real rel_residual_norm);
@@ -114,6 +120,11 @@ main( hypre_int argc,
    HYPRE_Int           arg_index;
    HYPRE_Int           print_usage;
    HYPRE_Int           log_level = 0;
+   HYPRE_Int           omp_min_work = 0;
+   HYPRE_Int           omp_bench = 0;
+   HYPRE_Int           repro_reductions = 0;
+   HYPRE_Int           nthreads = 0;
+   HYPRE_Int           amg_block_solve = 0;
    HYPRE_Int           sparsity_known = 0;
    HYPRE_Int           add = 0;
    HYPRE_Int           check_constant = 0;
@@ -224,6 +235,7 @@ main( hypre_int argc,
    HYPRE_Int           test_ij = 0;
    HYPRE_Int           test_multivec = 0;
    HYPRE_Int           test_scaling = 0;
+   HYPRE_Int           test_transpose_plan = 0;
    HYPRE_Int           test_error = 0;
 
    const HYPRE_Real    dt_inf = DT_INF;
@@ -246,6 +258,8 @@ main( hypre_int argc,
    HYPRE_Real     CR_strong_th = 0.0;
    HYPRE_Int      CR_use_CG = 0;
    HYPRE_Int      P_max_elmts = 4;
+   HYPRE_Real     target_op_cmplxty = 0.0;
+   HYPRE_Int      float_halo_level = -1;
    HYPRE_Int      cycle_type;
    HYPRE_Int      fcycle;
    HYPRE_Int      coarsen_type = 10;
@@ -281,6 +295,8 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    fused_rap = 0;
+   HYPRE_Int    fused_rap_ws = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -293,10 +309,13 @@ main( hypre_int argc,
    HYPRE_Real   atol = 0.0;
    HYPRE_Real   max_row_sum = 1.;
    HYPRE_Int    converge_type = 0;
+   HYPRE_Int    conv_check_type = 0;
+   HYPRE_Int    conv_check_freq = 1;
    HYPRE_Int    precon_cycles = 1;
 
    HYPRE_Int  cheby_order = 2;
    HYPRE_Int  cheby_eig_est = 10;
+   HYPRE_Int  cheby_eig_reuse = 0;
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
@@ -373,6 +392,8 @@ main( hypre_int argc,
    HYPRE_Int    rel_change = 0;
    HYPRE_Int    second_time = 0;
    HYPRE_Int    benchmark = 0;
+   HYPRE_Int    amg_update_rows = 0;
+   HYPRE_Int    amg_update_full = 0;
 
    /* begin lobpcg */
    HYPRE_Int    hybrid = 1;
@@ -393,6 +414,7 @@ main( hypre_int argc,
    HYPRE_Int  two_norm = 1;
    HYPRE_Int  skip_break = 0;
    HYPRE_Int  flex = 0;
+   HYPRE_Int  deflate = -1;
    HYPRE_Int  pcgIterations = 0;
    HYPRE_Int  pcgMode = 1;
    HYPRE_Real pcgTol = 1e-2;
@@ -430,6 +452,7 @@ main( hypre_int argc,
    HYPRE_Int mgr_num_reserved_nodes = 0;
    HYPRE_Int mgr_non_c_to_f = 1;
    HYPRE_Int mgr_frelax_method = 0;
+   HYPRE_Int mgr_reuse = 0;
    HYPRE_Int *mgr_num_cindexes = NULL;
    HYPRE_Int **mgr_cindexes = NULL;
    HYPRE_BigInt *mgr_reserved_coarse_indexes = NULL;
@@ -701,6 +724,31 @@ main( hypre_int argc,
          arg_index++;
          log_level = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-omp_min_work") == 0 )
+      {
+         arg_index++;
+         omp_min_work = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-omp_bench") == 0 )
+      {
+         arg_index++;
+         omp_bench = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-repro_reductions") == 0 )
+      {
+         arg_index++;
+         repro_reductions = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         nthreads = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_block_solve") == 0 )
+      {
+         arg_index++;
+         amg_block_solve = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-frombinfile") == 0 )
       {
          arg_index++;
@@ -773,6 +821,12 @@ main( hypre_int argc,
          build_matrix_type      = 8;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-inclusion") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 9;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-test_ij") == 0 )
       {
          arg_index++;
@@ -788,6 +842,11 @@ main( hypre_int argc,
          arg_index++;
          test_scaling = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-test_transpose_plan") == 0 )
+      {
+         arg_index++;
+         test_transpose_plan = 1;
+      }
       else if ( strcmp(argv[arg_index], "-test_error") == 0 )
       {
          arg_index++;
@@ -1338,6 +1397,12 @@ main( hypre_int argc,
          arg_index++;
          mgr_frelax_method = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mgr_reuse") == 0 )
+      {
+         /* reuse the MGR splitting and patterns in repeated setups */
+         arg_index++;
+         mgr_reuse = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-mgr_relax_type") == 0 )
       {
          /* relax type for "single level" F-relaxation */
@@ -1633,6 +1698,20 @@ main( hypre_int argc,
          arg_index++;
          second_time = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-amg_update") == 0 )
+      {
+         arg_index++;
+         amg_update_rows = atoi(argv[arg_index++]);
+         amg_update_full = 0;
+         second_time = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-amg_update_full") == 0 )
+      {
+         arg_index++;
+         amg_update_rows = atoi(argv[arg_index++]);
+         amg_update_full = 1;
+         second_time = 1;
+      }
       else if ( strcmp(argv[arg_index], "-benchmark") == 0 )
       {
          arg_index++;
@@ -1860,6 +1939,16 @@ main( hypre_int argc,
          arg_index++;
          converge_type = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-conv_check_type") == 0 )
+      {
+         arg_index++;
+         conv_check_type = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-conv_check_freq") == 0 )
+      {
+         arg_index++;
+         conv_check_freq = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-atol") == 0 )
       {
          arg_index++;
@@ -1935,6 +2024,16 @@ main( hypre_int argc,
          arg_index++;
          P_max_elmts  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-target_cmplxty") == 0 )
+      {
+         arg_index++;
+         target_op_cmplxty  = (HYPRE_Real)atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-float_halo_level") == 0 )
+      {
+         arg_index++;
+         float_halo_level  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-interpvecvar") == 0 )
       {
          arg_index++;
@@ -1991,6 +2090,11 @@ main( hypre_int argc,
          arg_index++;
          flex  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-deflate") == 0 )
+      {
+         arg_index++;
+         deflate  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-var") == 0 )
       {
          arg_index++;
@@ -2099,6 +2203,11 @@ main( hypre_int argc,
          arg_index++;
          cheby_eig_est = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cheby_eig_reuse") == 0 )
+      {
+         arg_index++;
+         cheby_eig_reuse = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cheby_variant") == 0 )
       {
          arg_index++;
@@ -2169,6 +2278,16 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fused_rap") == 0 )
+      {
+         arg_index++;
+         fused_rap  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fused_rap_ws") == 0 )
+      {
+         arg_index++;
+         fused_rap_ws = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -2323,6 +2442,12 @@ main( hypre_int argc,
          hypre_printf("      0 = (default) No messaging.\n");
          hypre_printf("      1 = Display memory usage statistics for each MPI rank.\n");
          hypre_printf("      2 = Display aggregate memory usage statistics over MPI ranks.\n");
+         hypre_printf("  -omp_min_work <val>        : min. work for threaded host kernels\n");
+         hypre_printf("  -omp_bench <reps>          : time threaded vs serial matvecs per AMG level\n");
+         hypre_printf("  -repro_reductions <val>    : thread-count independent inner products (1)\n");
+         hypre_printf("  -nthreads <val>            : number of OpenMP threads\n");
+         hypre_printf("  -amg_block_solve <dim>     : after solver 0, solve for dim random right-hand\n");
+         hypre_printf("                               sides with HYPRE_BoomerAMGBlockSolve\n");
          hypre_printf("  -fromfile <filename>       : ");
          hypre_printf("matrix read from multiple files (IJ format)\n");
          hypre_printf("  -frombinfile <filename>    : ");
@@ -2340,6 +2465,9 @@ main( hypre_int argc,
          hypre_printf("  -difconv [<opts>]      : build convection-diffusion problem\n");
          hypre_printf("  -vardifconv [<opts>]   : build variable conv.-diffusion problem\n");
          hypre_printf("  -rotate [<opts>]       : build 7pt rotated laplacian problem\n");
+         hypre_printf("  -inclusion [<opts>]    : build 2D diffusion with high-contrast inclusions\n");
+         hypre_printf("    -contrast <val>      : coefficient inside the inclusions (1e6)\n");
+         hypre_printf("    -ninc <nix> <niy>    : number of inclusions per direction (4 4)\n");
          hypre_printf("    -n <nx> <ny> <nz>    : total problem size \n");
          hypre_printf("    -P <Px> <Py> <Pz>    : processor topology\n");
          hypre_printf("    -c <cx> <cy> <cz>    : diffusion coefficients\n");
@@ -2486,6 +2614,7 @@ main( hypre_int argc,
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -cheby_eig_reuse <val> : warm start Chebyshev eigenvalue estimates on re-setup (default is 0)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -2510,6 +2639,14 @@ main( hypre_int argc,
          hypre_printf("  -th   <val>            : set AMG threshold Theta = val \n");
          hypre_printf("  -tr   <val>            : set AMG interpolation truncation factor = val \n");
          hypre_printf("  -Pmx  <val>            : set maximal no. of elmts per row for AMG interpolation (default: 4)\n");
+         hypre_printf("  -target_cmplxty <val>  : truncate AMG interpolation adaptively to reach operator complexity val\n");
+         hypre_printf("  -fused_rap <0/1>       : form AMG coarse operators row by row (single task, host)\n");
+         hypre_printf("  -fused_rap_ws <val>    : with -fused_rap, form P^T in blocks of at most val nonzeros\n");
+         hypre_printf("  -float_halo_level <val>: send single-precision halos from AMG level val on (-2: automatic),\n");
+         hypre_printf("                           only with AMG tolerance 0, e.g., as a preconditioner\n");
+         hypre_printf("  -amg_update <val>      : AMG-PCG: shift the diagonal of val local rows after the first solve,\n");
+         hypre_printf("                           update the AMG hierarchy in place and solve again\n");
+         hypre_printf("  -amg_update_full <val> : as -amg_update, but with a full AMG setup\n");
          hypre_printf("  -jtr  <val>            : set truncation threshold for Jacobi interpolation = val \n");
          hypre_printf("  -Ssw  <val>            : set S-commpkg-switch = val \n");
          hypre_printf("  -mxrs <val>            : set AMG maximum row sum threshold for dependency weakening \n");
@@ -2532,7 +2669,10 @@ main( hypre_int argc,
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
+         hypre_printf("  -conv_check_type <val> : BoomerAMG convergence check: 0=every cycle, 1=every k cycles, 2=predicted\n");
+         hypre_printf("  -conv_check_freq <k>   : number of cycles between BoomerAMG convergence checks\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -deflate  <val>        : PCG deflation with val subdomains (0: one per process)\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
@@ -2558,6 +2698,7 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -test_transpose_plan   : compare a planned transpose with a plain one\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2650,6 +2791,8 @@ main( hypre_int argc,
          hypre_printf("                                     for F-relaxation \n");
          hypre_printf("  -mgr_frelax_method   1           : Use a 'multi-level smoother' strategy \n");
          hypre_printf("                                     for F-relaxation \n");
+         hypre_printf("  -mgr_reuse   1                   : reuse splitting and sparsity patterns \n");
+         hypre_printf("                                     in repeated setups (-second_time) \n");
          /* end MGR options */
          /* hypre ILU options */
          hypre_printf("  -ilu_type   <val>                : set ILU factorization type = val\n");
@@ -2782,6 +2925,14 @@ main( hypre_int argc,
    /* Set log level */
    HYPRE_SetLogLevel(log_level);
 
+   /* Minimum work for OpenMP threaded kernels */
+   HYPRE_SetOMPMinWork(omp_min_work);
+   HYPRE_SetReproducibleReductions(repro_reductions);
+   if (nthreads > 0)
+   {
+      hypre_SetNumThreads(nthreads);
+   }
+
    /* default memory location */
    HYPRE_SetMemoryLocation(memory_location);
 
@@ -2882,6 +3033,10 @@ main( hypre_int argc,
    {
       BuildParRotate7pt(argc, argv, build_matrix_arg_index, &parcsr_A);
    }
+   else if ( build_matrix_type == 9 )
+   {
+      BuildParInclusion(argc, argv, build_matrix_arg_index, &parcsr_A);
+   }
    else
    {
       hypre_printf("You have asked for an unsupported problem with\n");
@@ -4255,6 +4410,58 @@ main( hypre_int argc,
       hypre_ClearTiming();
    }
 
+   /*-----------------------------------------------------------
+    * Test transpose plan: refresh A^T after changing the values of A
+    * and compare it with a transpose computed from scratch
+    *-----------------------------------------------------------*/
+
+   if (test_transpose_plan)
+   {
+      hypre_ParCSRMatrix        *B     = NULL;
+      hypre_ParCSRMatrix        *BT    = NULL;
+      hypre_ParCSRMatrix        *BTp   = NULL;
+      hypre_ParCSRMatrix        *D     = NULL;
+      hypre_ParCSRTransposePlan *plan  = NULL;
+      hypre_CSRMatrix           *B_diag;
+      hypre_CSRMatrix           *B_offd;
+      HYPRE_Complex             *B_data;
+      HYPRE_Int                  k;
+      HYPRE_Real                 error;
+
+      B = hypre_ParCSRMatrixClone((hypre_ParCSRMatrix *) parcsr_A, 1);
+      hypre_ParCSRTransposePlanCreate(B, &BTp, &plan);
+
+      /* Change the values of B, keeping its sparsity pattern */
+      B_diag = hypre_ParCSRMatrixDiag(B);
+      B_offd = hypre_ParCSRMatrixOffd(B);
+      B_data = hypre_CSRMatrixData(B_diag);
+      for (k = 0; k < hypre_CSRMatrixNumNonzeros(B_diag); k++)
+      {
+         B_data[k] += 1.0e-3 * (HYPRE_Real) (k + 1);
+      }
+      B_data = hypre_CSRMatrixData(B_offd);
+      for (k = 0; k < hypre_CSRMatrixNumNonzeros(B_offd); k++)
+      {
+         B_data[k] -= 2.0e-3 * (HYPRE_Real) (k + 1);
+      }
+
+      hypre_ParCSRTransposePlanApply(plan, B, BTp);
+      hypre_ParCSRMatrixTranspose(B, &BT, 1);
+
+      hypre_ParCSRMatrixAdd(1.0, BT, -1.0, BTp, &D);
+      error = hypre_ParCSRMatrixFnorm(D);
+      if (myid == 0)
+      {
+         hypre_printf("Transpose plan error = %e\n", error);
+      }
+
+      hypre_ParCSRMatrixDestroy(D);
+      hypre_ParCSRMatrixDestroy(BT);
+      hypre_ParCSRMatrixDestroy(BTp);
+      hypre_ParCSRTransposePlanDestroy(plan);
+      hypre_ParCSRMatrixDestroy(B);
+   }
+
    /*-----------------------------------------------------------
     * Perform sparse matrix/vector multiplication
     *-----------------------------------------------------------*/
@@ -4494,6 +4701,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetIsolatedFPoints(amg_solver, num_isolated_fpt, isolated_fpt_index);
       HYPRE_BoomerAMGSetMeasureType(amg_solver, measure_type);
       HYPRE_BoomerAMGSetConvergeType(amg_solver, converge_type);
+      HYPRE_BoomerAMGSetConvCheckType(amg_solver, conv_check_type);
+      HYPRE_BoomerAMGSetConvCheckFreq(amg_solver, conv_check_freq);
       HYPRE_BoomerAMGSetTol(amg_solver, tol);
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
@@ -4502,6 +4711,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
       HYPRE_BoomerAMGSetTruncFactor(amg_solver, trunc_factor);
       HYPRE_BoomerAMGSetPMaxElmts(amg_solver, P_max_elmts);
+      HYPRE_BoomerAMGSetFloatHaloLevel(amg_solver, float_halo_level);
+      HYPRE_BoomerAMGSetTargetOpCmplxty(amg_solver, target_op_cmplxty);
       HYPRE_BoomerAMGSetJacobiTruncThreshold(amg_solver, jacobi_trunc_threshold);
       HYPRE_BoomerAMGSetSCommPkgSwitch(amg_solver, S_commpkg_switch);
       /* note: log is written to standard output, not to file */
@@ -4534,6 +4745,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyOrder(amg_solver, cheby_order);
       HYPRE_BoomerAMGSetChebyFraction(amg_solver, cheby_fraction);
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
+      HYPRE_BoomerAMGSetChebyEigReuse(amg_solver, cheby_eig_reuse);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
@@ -4621,6 +4833,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetFusedRAP(amg_solver, fused_rap);
+      HYPRE_BoomerAMGSetFusedRAPWorkingSet(amg_solver, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -4667,6 +4881,11 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (solver_id == 0 && omp_bench > 0)
+      {
+         hypre_BoomerAMGThreadingStats((void *) amg_solver, omp_bench);
+      }
+
       if (solver_id == 0)
       {
          time_index = hypre_InitializeTiming("BoomerAMG Solve");
@@ -4764,6 +4983,20 @@ main( hypre_int argc,
       {
          HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
          HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+         if (float_halo_level != -1)
+         {
+            HYPRE_Real float_halo_bytes;
+
+            HYPRE_BoomerAMGGetFloatHaloBytesSaved(amg_solver, &float_halo_bytes);
+            if (myid == 0)
+            {
+               hypre_printf("\nSingle-precision halo bytes saved = %e\n", float_halo_bytes);
+            }
+         }
+         if (amg_block_solve > 1)
+         {
+            TestAMGBlockSolve(amg_solver, parcsr_A, amg_block_solve);
+         }
       }
       else if (solver_id == 90)
       {
@@ -4932,6 +5165,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetFusedRAP(amg_solver, fused_rap);
+      HYPRE_BoomerAMGSetFusedRAPWorkingSet(amg_solver, fused_rap_ws);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -5023,6 +5258,10 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      if (deflate >= 0)
+      {
+         HYPRE_ParCSRPCGSetDeflationSubdomains(pcg_solver, parcsr_A, deflate);
+      }
 
       if (solver_id == 1)
       {
@@ -5048,6 +5287,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
          HYPRE_BoomerAMGSetPMaxElmts(pcg_precond, P_max_elmts);
+         HYPRE_BoomerAMGSetFloatHaloLevel(pcg_precond, float_halo_level);
          HYPRE_BoomerAMGSetJacobiTruncThreshold(pcg_precond, jacobi_trunc_threshold);
          HYPRE_BoomerAMGSetSCommPkgSwitch(pcg_precond, S_commpkg_switch);
          HYPRE_BoomerAMGSetPrintLevel(pcg_precond, poutdat);
@@ -5079,6 +5319,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
@@ -5155,6 +5396,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(pcg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(pcg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5355,6 +5598,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(pcg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(pcg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5553,6 +5798,11 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (solver_id == 1 && omp_bench > 0)
+      {
+         hypre_BoomerAMGThreadingStats((void *) pcg_precond, omp_bench);
+      }
+
       time_index = hypre_InitializeTiming("PCG Solve");
       hypre_BeginTiming(time_index);
       hypre_GpuProfilingPushRange("PCG-Solve-1");
@@ -5581,20 +5831,54 @@ main( hypre_int argc,
          cudaProfilerStart();
 #endif
 
-         time_index = hypre_InitializeTiming("PCG Setup");
-         hypre_BeginTiming(time_index);
+         /* modify a few rows of A, then update or redo the AMG setup */
+         if (solver_id == 1 && amg_update_rows > 0 && parcsr_M == parcsr_A)
+         {
+            HYPRE_BigInt *update_rows = NULL;
+            HYPRE_Int     num_update_rows;
 
-         hypre_GpuProfilingPushRange("PCG-Setup-2");
+            num_update_rows = hypre_min(amg_update_rows,
+                                        hypre_ParCSRMatrixNumRows((hypre_ParCSRMatrix *) parcsr_A));
+            ShiftParDiagonal(parcsr_A, num_update_rows, 1.0, &update_rows);
 
-         HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
-                        (HYPRE_Vector) b, (HYPRE_Vector) x);
+            time_index = hypre_InitializeTiming("BoomerAMG Update");
+            hypre_BeginTiming(time_index);
 
-         hypre_GpuProfilingPopRange();
+            if (amg_update_full)
+            {
+               HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
+                              (HYPRE_Vector) b, (HYPRE_Vector) x);
+            }
+            else
+            {
+               HYPRE_BoomerAMGSetupUpdate(pcg_precond, parcsr_M, b, x,
+                                          num_update_rows, update_rows);
+            }
 
-         hypre_EndTiming(time_index);
-         hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
-         hypre_FinalizeTiming(time_index);
-         hypre_ClearTiming();
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            hypre_TFree(update_rows, HYPRE_MEMORY_HOST);
+         }
+         else
+         {
+            time_index = hypre_InitializeTiming("PCG Setup");
+            hypre_BeginTiming(time_index);
+
+            hypre_GpuProfilingPushRange("PCG-Setup-2");
+
+            HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
+                           (HYPRE_Vector) b, (HYPRE_Vector) x);
+
+            hypre_GpuProfilingPopRange();
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+         }
 
          time_index = hypre_InitializeTiming("PCG Solve");
          hypre_BeginTiming(time_index);
@@ -5624,6 +5908,16 @@ main( hypre_int argc,
 
       if (solver_id == 1)
       {
+         if (float_halo_level != -1)
+         {
+            HYPRE_Real float_halo_bytes;
+
+            HYPRE_BoomerAMGGetFloatHaloBytesSaved(pcg_precond, &float_halo_bytes);
+            if (myid == 0)
+            {
+               hypre_printf("\nSingle-precision halo bytes saved = %e\n", float_halo_bytes);
+            }
+         }
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
       else if (solver_id == 8)
@@ -5682,7 +5976,15 @@ main( hypre_int argc,
       {
          hypre_printf("\n");
          hypre_printf("Iterations = %d\n", num_iterations);
-         hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+         if (repro_reductions)
+         {
+            /* all digits are reproducible */
+            hypre_printf("Final Relative Residual Norm = %.16e\n", final_res_norm);
+         }
+         else
+         {
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+         }
          hypre_printf("\n");
       }
 
@@ -6779,6 +7081,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMinCoarseSize(amg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(amg_precond, trunc_factor);
          HYPRE_BoomerAMGSetPMaxElmts(amg_precond, P_max_elmts);
+         HYPRE_BoomerAMGSetFloatHaloLevel(amg_precond, float_halo_level);
          HYPRE_BoomerAMGSetJacobiTruncThreshold(amg_precond, jacobi_trunc_threshold);
          HYPRE_BoomerAMGSetSCommPkgSwitch(amg_precond, S_commpkg_switch);
          HYPRE_BoomerAMGSetPrintLevel(amg_precond, poutdat);
@@ -6893,6 +7196,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(amg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(amg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -7099,6 +7404,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(pcg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(pcg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7480,6 +7787,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(pcg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(pcg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7706,6 +8015,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(pcg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(pcg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8142,6 +8453,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(pcg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(pcg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8569,6 +8882,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(pcg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(pcg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8910,6 +9225,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFusedRAP(pcg_precond, fused_rap);
+         HYPRE_BoomerAMGSetFusedRAPWorkingSet(pcg_precond, fused_rap_ws);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -9055,6 +9372,7 @@ main( hypre_int argc,
       HYPRE_MGRSetNonCpointsToFpoints(mgr_solver, mgr_non_c_to_f);
       /* set F relaxation strategy */
       HYPRE_MGRSetFRelaxMethod(mgr_solver, mgr_frelax_method);
+      HYPRE_MGRSetReuse(mgr_solver, mgr_reuse);
       /* set relax type for single level F-relaxation and post-relaxation */
       HYPRE_MGRSetRelaxType(mgr_solver, mgr_relax_type);
       HYPRE_MGRSetNumRelaxSweeps(mgr_solver, mgr_num_relax_sweeps);
@@ -11624,3 +11942,348 @@ BuildParIsoLaplacian( HYPRE_Int argc, char** argv, HYPRE_ParCSRMatrix *A_ptr )
 }
 
 /* end lobpcg */
+
+/*----------------------------------------------------------------------
+ * Solve diag(A,...,A) x = b for a random block vector b with dim
+ * interleaved components using HYPRE_BoomerAMGBlockSolve, and compare
+ * each component with a separate HYPRE_BoomerAMGSolve (host memory)
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+TestAMGBlockSolve( HYPRE_Solver         amg_solver,
+                   HYPRE_ParCSRMatrix   A,
+                   HYPRE_Int            dim )
+{
+   MPI_Comm          comm       = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt     *row_starts = hypre_ParCSRMatrixRowStarts(A);
+   HYPRE_BigInt      global_num_rows = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_Int         num_rows   = hypre_ParCSRMatrixNumRows(A);
+
+   hypre_ParVector  *b_blk, *x_blk, *b_d, *x_d, *r_d;
+   HYPRE_Complex    *b_blk_data, *x_blk_data, *b_d_data, *x_d_data;
+   HYPRE_BigInt      blk_starts[2];
+   HYPRE_Real        res_norm, rhs_norm, diff, diff_max, x_max;
+   HYPRE_Real        local_diff[2], global_diff[2];
+   HYPRE_Int         myid, d, i;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   blk_starts[0] = dim * row_starts[0];
+   blk_starts[1] = dim * row_starts[1];
+
+   b_blk = hypre_ParVectorCreate(comm, dim * global_num_rows, blk_starts);
+   x_blk = hypre_ParVectorCreate(comm, dim * global_num_rows, blk_starts);
+   hypre_ParVectorInitialize_v2(b_blk, HYPRE_MEMORY_HOST);
+   hypre_ParVectorInitialize_v2(x_blk, HYPRE_MEMORY_HOST);
+   hypre_ParVectorSetRandomValues(b_blk, 2747 + myid);
+   hypre_ParVectorSetConstantValues(x_blk, 0.0);
+
+   HYPRE_BoomerAMGBlockSolve(amg_solver, A, (HYPRE_ParVector) b_blk, (HYPRE_ParVector) x_blk);
+
+   b_d = hypre_ParVectorCreate(comm, global_num_rows, row_starts);
+   x_d = hypre_ParVectorCreate(comm, global_num_rows, row_starts);
+   r_d = hypre_ParVectorCreate(comm, global_num_rows, row_starts);
+   hypre_ParVectorInitialize_v2(b_d, HYPRE_MEMORY_HOST);
+   hypre_ParVectorInitialize_v2(x_d, HYPRE_MEMORY_HOST);
+   hypre_ParVectorInitialize_v2(r_d, HYPRE_MEMORY_HOST);
+
+   b_blk_data = hypre_VectorData(hypre_ParVectorLocalVector(b_blk));
+   x_blk_data = hypre_VectorData(hypre_ParVectorLocalVector(x_blk));
+   b_d_data   = hypre_VectorData(hypre_ParVectorLocalVector(b_d));
+   x_d_data   = hypre_VectorData(hypre_ParVectorLocalVector(x_d));
+
+   diff_max = 0.0;
+   for (d = 0; d < dim; d++)
+   {
+      /* residual of component d of the block solution */
+      for (i = 0; i < num_rows; i++)
+      {
+         b_d_data[i] = b_blk_data[dim * i + d];
+         x_d_data[i] = x_blk_data[dim * i + d];
+      }
+      hypre_ParVectorCopy(b_d, r_d);
+      hypre_ParCSRMatrixMatvec(-1.0, A, x_d, 1.0, r_d);
+      res_norm = sqrt(hypre_ParVectorInnerProd(r_d, r_d));
+      rhs_norm = sqrt(hypre_ParVectorInnerProd(b_d, b_d));
+
+      /* separate solve for component d */
+      hypre_ParVectorSetConstantValues(x_d, 0.0);
+      HYPRE_BoomerAMGSolve(amg_solver, A, (HYPRE_ParVector) b_d, (HYPRE_ParVector) x_d);
+
+      local_diff[0] = local_diff[1] = 0.0;
+      for (i = 0; i < num_rows; i++)
+      {
+         diff = hypre_abs(x_blk_data[dim * i + d] - x_d_data[i]);
+         local_diff[0] = hypre_max(local_diff[0], diff);
+         local_diff[1] = hypre_max(local_diff[1], hypre_abs(x_d_data[i]));
+      }
+      hypre_MPI_Allreduce(local_diff, global_diff, 2, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+      x_max    = global_diff[1] > 0.0 ? global_diff[1] : 1.0;
+      diff_max = hypre_max(diff_max, global_diff[0] / x_max);
+
+      if (myid == 0)
+      {
+         hypre_printf("Block solve component %d relative residual norm = %e\n", d,
+                      rhs_norm > 0.0 ? res_norm / rhs_norm : res_norm);
+      }
+   }
+
+   if (myid == 0)
+   {
+      hypre_printf("Block solve max. relative deviation from separate solves = %e\n", diff_max);
+   }
+
+   hypre_ParVectorDestroy(b_blk);
+   hypre_ParVectorDestroy(x_blk);
+   hypre_ParVectorDestroy(b_d);
+   hypre_ParVectorDestroy(x_d);
+   hypre_ParVectorDestroy(r_d);
+
+   return (0);
+}
+
+/*----------------------------------------------------------------------
+ * Add shift to the diagonal of the first num_rows local rows of A and
+ * return the global indices of these rows in rows_ptr (host memory)
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+ShiftParDiagonal( HYPRE_ParCSRMatrix   A,
+                  HYPRE_Int            num_rows,
+                  HYPRE_Complex        shift,
+                  HYPRE_BigInt       **rows_ptr )
+{
+   hypre_ParCSRMatrix   *par_A           = (hypre_ParCSRMatrix *) A;
+   hypre_CSRMatrix      *A_diag          = hypre_ParCSRMatrixDiag(par_A);
+   HYPRE_MemoryLocation  memory_location = hypre_CSRMatrixMemoryLocation(A_diag);
+   HYPRE_BigInt          first_row       = hypre_ParCSRMatrixFirstRowIndex(par_A);
+
+   HYPRE_Int            *A_i, *A_j;
+   HYPRE_Complex        *A_data;
+   HYPRE_BigInt         *rows;
+   HYPRE_Int             i, j, nnz;
+
+   num_rows = hypre_min(num_rows, hypre_CSRMatrixNumRows(A_diag));
+
+   /* copy the leading rows to the host */
+   A_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(A_i, hypre_CSRMatrixI(A_diag), HYPRE_Int, num_rows + 1,
+                 HYPRE_MEMORY_HOST, memory_location);
+   nnz    = A_i[num_rows];
+   A_j    = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   A_data = hypre_TAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(A_j, hypre_CSRMatrixJ(A_diag), HYPRE_Int, nnz,
+                 HYPRE_MEMORY_HOST, memory_location);
+   hypre_TMemcpy(A_data, hypre_CSRMatrixData(A_diag), HYPRE_Complex, nnz,
+                 HYPRE_MEMORY_HOST, memory_location);
+
+   rows = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = A_i[i]; j < A_i[i + 1]; j++)
+      {
+         if (A_j[j] == i)
+         {
+            A_data[j] += shift;
+            break;
+         }
+      }
+      rows[i] = first_row + (HYPRE_BigInt) i;
+   }
+
+   hypre_TMemcpy(hypre_CSRMatrixData(A_diag), A_data, HYPRE_Complex, nnz,
+                 memory_location, HYPRE_MEMORY_HOST);
+
+   hypre_TFree(A_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(A_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(A_data, HYPRE_MEMORY_HOST);
+
+   *rows_ptr = rows;
+
+   return 0;
+}
+
+/*----------------------------------------------------------------------
+ * Coefficient of cell (ix, iy) for BuildParInclusion
+ *----------------------------------------------------------------------*/
+
+static HYPRE_Real
+InclusionCoefficient( HYPRE_BigInt ix,
+                      HYPRE_BigInt iy,
+                      HYPRE_BigInt nx,
+                      HYPRE_BigInt ny,
+                      HYPRE_Int    nix,
+                      HYPRE_Int    niy,
+                      HYPRE_Real   contrast )
+{
+   /* position inside the block, scaled to [0, n) */
+   HYPRE_BigInt px = (ix * nix) % nx;
+   HYPRE_BigInt py = (iy * niy) % ny;
+
+   if (4 * px >= nx && 4 * px < 3 * nx && 4 * py >= ny && 4 * py < 3 * ny)
+   {
+      return contrast;
+   }
+
+   return 1.0;
+}
+
+/*----------------------------------------------------------------------
+ * Build 5-point 2D diffusion on a unit-coefficient background with
+ * nix x niy rectangular inclusions of coefficient contrast.  Each
+ * inclusion covers the middle half of its block in both directions; face
+ * coefficients are harmonic averages and the boundary is Dirichlet.
+ * Rows are numbered lexicographically and distributed in strips of
+ * grid lines.  Parameters given in command line.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+BuildParInclusion( HYPRE_Int            argc,
+                   char                *argv[],
+                   HYPRE_Int            arg_index,
+                   HYPRE_ParCSRMatrix  *A_ptr     )
+{
+   HYPRE_BigInt              nx, ny;
+   HYPRE_Int                 nix, niy;
+   HYPRE_Real                contrast;
+
+   HYPRE_IJMatrix            ij_A;
+   HYPRE_ParCSRMatrix        A;
+   void                     *object;
+
+   HYPRE_Int                 num_procs, myid;
+   HYPRE_BigInt              iy_lower, iy_upper, ilower, iupper;
+   HYPRE_BigInt              ix, iy, jx, jy, row, cols[5];
+   HYPRE_Real                values[5], k, kn, kf;
+   HYPRE_Int                 ncols, d;
+
+   const HYPRE_Int           dx[4] = {-1, 1, 0, 0};
+   const HYPRE_Int           dy[4] = {0, 0, -1, 1};
+
+   /*-----------------------------------------------------------
+    * Initialize some stuff
+    *-----------------------------------------------------------*/
+
+   hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs );
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid );
+
+   /*-----------------------------------------------------------
+    * Set defaults
+    *-----------------------------------------------------------*/
+
+   nx = 64;
+   ny = 64;
+
+   nix      = 4;
+   niy      = 4;
+   contrast = 1.0e6;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+   arg_index = 0;
+   while (arg_index < argc)
+   {
+      if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         nx = atoi(argv[arg_index++]);
+         ny = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ninc") == 0 )
+      {
+         arg_index++;
+         nix = atoi(argv[arg_index++]);
+         niy = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-contrast") == 0 )
+      {
+         arg_index++;
+         contrast = (HYPRE_Real) atof(argv[arg_index++]);
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Check a few things
+    *-----------------------------------------------------------*/
+
+   if (nix < 1 || niy < 1 || ny < (HYPRE_BigInt) num_procs)
+   {
+      hypre_printf("Error: Invalid number of inclusions or grid lines per processor \n");
+      exit(1);
+   }
+
+   /*-----------------------------------------------------------
+    * Print driver parameters
+    *-----------------------------------------------------------*/
+
+   if (myid == 0)
+   {
+      hypre_printf("  Diffusion with inclusions:\n");
+      hypre_printf("    (nx, ny) = (%b, %b)\n", nx, ny);
+      hypre_printf("    inclusions = %d x %d\n", nix, niy);
+      hypre_printf("    contrast   = %e\n\n", contrast);
+   }
+
+   /*-----------------------------------------------------------
+    * Generate the matrix
+    *-----------------------------------------------------------*/
+
+   iy_lower = (ny * myid) / num_procs;
+   iy_upper = (ny * (myid + 1)) / num_procs - 1;
+   ilower   = iy_lower * nx;
+   iupper   = (iy_upper + 1) * nx - 1;
+
+   HYPRE_IJMatrixCreate(hypre_MPI_COMM_WORLD, ilower, iupper, ilower, iupper, &ij_A);
+   HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixInitialize_v2(ij_A, HYPRE_MEMORY_HOST);
+
+   for (iy = iy_lower; iy <= iy_upper; iy++)
+   {
+      for (ix = 0; ix < nx; ix++)
+      {
+         row   = iy * nx + ix;
+         k     = InclusionCoefficient(ix, iy, nx, ny, nix, niy, contrast);
+         ncols = 1;
+
+         cols[0]   = row;
+         values[0] = 0.0;
+         for (d = 0; d < 4; d++)
+         {
+            jx = ix + dx[d];
+            jy = iy + dy[d];
+            if (jx < 0 || jx >= nx || jy < 0 || jy >= ny)
+            {
+               /* Dirichlet face */
+               values[0] += k;
+               continue;
+            }
+            kn = InclusionCoefficient(jx, jy, nx, ny, nix, niy, contrast);
+            kf = 2.0 * k * kn / (k + kn);
+
+            cols[ncols]   = jy * nx + jx;
+            values[ncols] = -kf;
+            values[0]    += kf;
+            ncols++;
+         }
+
+         HYPRE_IJMatrixSetValues(ij_A, 1, &ncols, &row, cols, values);
+      }
+   }
+
+   HYPRE_IJMatrixAssemble(ij_A);
+   HYPRE_IJMatrixGetObject(ij_A, &object);
+   A = (HYPRE_ParCSRMatrix) object;
+
+   /* keep the ParCSR matrix, drop the IJ wrapper */
+   hypre_IJMatrixObject(ij_A) = NULL;
+   HYPRE_IJMatrixDestroy(ij_A);
+
+   *A_ptr = A;
+
+   return (0);
+}
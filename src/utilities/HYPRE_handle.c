@@ -23,6 +23,26 @@ HYPRE_SetLogLevel( HYPRE_Int log_level )
    return hypre_SetLogLevel(log_level);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetOMPMinWork
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetOMPMinWork( HYPRE_Int min_work )
+{
+   return hypre_SetOMPMinWork(min_work);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetReproducibleReductions
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetReproducibleReductions( HYPRE_Int reproducible )
+{
+   return hypre_SetReproducibleReductions(reproducible);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetSpTransUseVendor
  *--------------------------------------------------------------------------*/
@@ -468,6 +468,43 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
  **/
 HYPRE_Int HYPRE_SetLogLevel(HYPRE_Int log_level);
 
+/**
+ * Sets the minimum amount of work, measured in rows plus nonzeros (or vector
+ * entries), below which OpenMP-threaded host kernels such as vector updates,
+ * inner products and sparse matrix-vector products run on the calling thread
+ * instead of forking a thread team. On the coarse levels of a multigrid
+ * hierarchy the fork/join cost can exceed the work itself; a threshold of a
+ * few thousand is typically a good choice. The default is 0 (always thread).
+ * Kernels that do run threaded still fork and join their own team; hypre does
+ * not keep a thread team alive across a multigrid cycle.
+ * This setting has no effect without OpenMP or for device execution.
+ *
+ * @param min_work The minimum work for a kernel to be threaded.
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetOMPMinWork(HYPRE_Int min_work);
+
+/**
+ * Enables (1) or disables (0, default) reproducible inner products on the
+ * host. When enabled, \e hypre_SeqVectorInnerProd and \e hypre_ParVectorInnerProd
+ * (and hence the Krylov solvers and the AMG convergence checks that use them)
+ * accumulate in a binned, pre-rounded format whose result does not depend on
+ * the number of OpenMP threads, the loop schedule, or the order in which MPI
+ * combines partial sums. Results are only reproducible for a fixed
+ * distribution of the vectors over MPI tasks. This setting has no effect for
+ * device execution or for complex, single or long double builds.
+ *
+ * BoomerAMG compatible relaxation coarsening (coarsen type 99) also honors
+ * this setting: its hybrid Gauss-Seidel sweeps then run sequentially on each
+ * task, so the C/F splitting is identical for any number of OpenMP threads.
+ *
+ * @param reproducible Whether to use reproducible inner products.
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetReproducibleReductions(HYPRE_Int reproducible);
+
 /**
  * Specifies the algorithm used for sparse matrix transposition in device builds.
  *
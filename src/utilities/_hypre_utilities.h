@@ -50,6 +50,8 @@ typedef void (*GPUMfreeFunc)(void *);
 typedef struct
 {
    HYPRE_Int              log_level;
+   HYPRE_Int              omp_min_work;
+   HYPRE_Int              reproducible_reductions;
    HYPRE_Int              hypre_error;
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
@@ -98,6 +100,8 @@ typedef struct
 
 /* accessor macros to hypre_Handle */
 #define hypre_HandleLogLevel(hypre_handle)                       ((hypre_handle) -> log_level)
+#define hypre_HandleOMPMinWork(hypre_handle)                     ((hypre_handle) -> omp_min_work)
+#define hypre_HandleReproducibleReductions(hypre_handle)         ((hypre_handle) -> reproducible_reductions)
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 
@@ -808,6 +812,7 @@ extern "C" {
 #define MPI_ANY_TAG         hypre_MPI_ANY_TAG
 #define MPI_SOURCE          hypre_MPI_SOURCE
 #define MPI_TAG             hypre_MPI_TAG
+#define MPI_THREAD_MULTIPLE hypre_MPI_THREAD_MULTIPLE
 
 #define MPI_Init            hypre_MPI_Init
 #define MPI_Finalize        hypre_MPI_Finalize
@@ -865,6 +870,7 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Query_thread    hypre_MPI_Query_thread
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -920,6 +926,7 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_INFO_NULL     0
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
+#define  hypre_MPI_THREAD_MULTIPLE 3
 
 #else
 
@@ -972,6 +979,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_SOURCE          MPI_SOURCE
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
+#define  hypre_MPI_THREAD_MULTIPLE MPI_THREAD_MULTIPLE
 
 #endif
 
@@ -1075,6 +1083,7 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Query_thread( HYPRE_Int *provided );
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
@@ -1100,6 +1109,11 @@ HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 
 #define HYPRE_SMP_SCHEDULE schedule(static)
 
+/* Clause for host kernels whose cost is dominated by fork/join overhead when
+   the loop is short: run on the encountering thread below the threshold set
+   with HYPRE_SetOMPMinWork */
+#define HYPRE_SMP_IF(work) if (hypre_OMPUseThreads(work))
+
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -1624,6 +1638,7 @@ HYPRE_Int hypre_NumThreads( void );
 HYPRE_Int hypre_NumActiveThreads( void );
 HYPRE_Int hypre_GetThreadNum( void );
 void      hypre_SetNumThreads(HYPRE_Int nt);
+HYPRE_Int hypre_OMPUseThreads( HYPRE_BigInt work );
 
 #else
 
@@ -1631,6 +1646,7 @@ void      hypre_SetNumThreads(HYPRE_Int nt);
 #define hypre_NumActiveThreads() 1
 #define hypre_GetThreadNum() 0
 #define hypre_SetNumThreads(x)
+#define hypre_OMPUseThreads(x) 0
 
 #endif
 
@@ -2452,6 +2468,8 @@ HYPRE_Int hypre_GetSyncCudaCompute(HYPRE_Int *cuda_compute_stream_sync_ptr);
 
 /* handle.c */
 HYPRE_Int hypre_SetLogLevel( HYPRE_Int log_level );
+HYPRE_Int hypre_SetOMPMinWork( HYPRE_Int min_work );
+HYPRE_Int hypre_SetReproducibleReductions( HYPRE_Int reproducible );
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
@@ -26,6 +26,42 @@ hypre_SetLogLevel(HYPRE_Int log_level)
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SetOMPMinWork
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetOMPMinWork(HYPRE_Int min_work)
+{
+   if (min_work < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleOMPMinWork(hypre_handle()) = min_work;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SetReproducibleReductions
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetReproducibleReductions(HYPRE_Int reproducible)
+{
+   if (reproducible < 0 || reproducible > 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleReproducibleReductions(hypre_handle()) = reproducible;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SetSpTransUseVendor
  *--------------------------------------------------------------------------*/
@@ -34,6 +34,8 @@ typedef void (*GPUMfreeFunc)(void *);
 typedef struct
 {
    HYPRE_Int              log_level;
+   HYPRE_Int              omp_min_work;
+   HYPRE_Int              reproducible_reductions;
    HYPRE_Int              hypre_error;
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
@@ -82,6 +84,8 @@ typedef struct
 
 /* accessor macros to hypre_Handle */
 #define hypre_HandleLogLevel(hypre_handle)                       ((hypre_handle) -> log_level)
+#define hypre_HandleOMPMinWork(hypre_handle)                     ((hypre_handle) -> omp_min_work)
+#define hypre_HandleReproducibleReductions(hypre_handle)         ((hypre_handle) -> reproducible_reductions)
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 
@@ -887,6 +887,13 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Query_thread( HYPRE_Int *provided )
+{
+   *provided = hypre_MPI_THREAD_MULTIPLE;
+   return (0);
+}
+
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                      hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
@@ -1558,6 +1565,18 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+HYPRE_Int
+hypre_MPI_Query_thread( HYPRE_Int *provided )
+{
+   hypre_int mpi_provided;
+   HYPRE_Int ierr;
+
+   ierr = (HYPRE_Int) MPI_Query_thread(&mpi_provided);
+   *provided = (HYPRE_Int) mpi_provided;
+
+   return ierr;
+}
+
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
@@ -76,6 +76,7 @@ extern "C" {
 #define MPI_ANY_TAG         hypre_MPI_ANY_TAG
 #define MPI_SOURCE          hypre_MPI_SOURCE
 #define MPI_TAG             hypre_MPI_TAG
+#define MPI_THREAD_MULTIPLE hypre_MPI_THREAD_MULTIPLE
 
 #define MPI_Init            hypre_MPI_Init
 #define MPI_Finalize        hypre_MPI_Finalize
@@ -133,6 +134,7 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Query_thread    hypre_MPI_Query_thread
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -188,6 +190,7 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_INFO_NULL     0
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
+#define  hypre_MPI_THREAD_MULTIPLE 3
 
 #else
 
@@ -240,6 +243,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_SOURCE          MPI_SOURCE
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
+#define  hypre_MPI_THREAD_MULTIPLE MPI_THREAD_MULTIPLE
 
 #endif
 
@@ -343,6 +347,7 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Query_thread( HYPRE_Int *provided );
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
@@ -11,3 +11,8 @@
 
 #define HYPRE_SMP_SCHEDULE schedule(static)
 
+/* Clause for host kernels whose cost is dominated by fork/join overhead when
+   the loop is short: run on the encountering thread below the threshold set
+   with HYPRE_SetOMPMinWork */
+#define HYPRE_SMP_IF(work) if (hypre_OMPUseThreads(work))
+
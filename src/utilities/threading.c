@@ -51,6 +51,15 @@ hypre_SetNumThreads( HYPRE_Int nt )
    omp_set_num_threads(nt);
 }
 
+/* Returns whether a loop doing "work" units (typically rows + nonzeros) is
+   large enough to amortize the cost of forking a thread team */
+
+HYPRE_Int
+hypre_OMPUseThreads( HYPRE_BigInt work )
+{
+   return (work >= hypre_HandleOMPMinWork(hypre_handle()));
+}
+
 #endif
 
 /* This next function must be called from within a parallel region! */
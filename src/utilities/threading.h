@@ -14,6 +14,7 @@ HYPRE_Int hypre_NumThreads( void );
 HYPRE_Int hypre_NumActiveThreads( void );
 HYPRE_Int hypre_GetThreadNum( void );
 void      hypre_SetNumThreads(HYPRE_Int nt);
+HYPRE_Int hypre_OMPUseThreads( HYPRE_BigInt work );
 
 #else
 
@@ -21,6 +22,7 @@ void      hypre_SetNumThreads(HYPRE_Int nt);
 #define hypre_NumActiveThreads() 1
 #define hypre_GetThreadNum() 0
 #define hypre_SetNumThreads(x)
+#define hypre_OMPUseThreads(x) 0
 
 #endif
 